@@ -57,9 +57,15 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -72,7 +78,9 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataStringGlobals.hh>
 #include <DisplayRoutines.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <UtilityRoutines.hh>
 
@@ -157,6 +165,11 @@ namespace ConductionTransferFunctionCalc {
 	Array2D< Real64 > s0( 3, 4 ); // Coefficients for the current surface temperature terms
 	Real64 TinyLimit;
 	Array2D< Real64 > IdenMatrix; // Identity Matrix
+	char const CTFCacheHeader[] = { 'E', '+', 'C', 'T', 'F', '2', char( sizeof( Real64 ) ), char( sizeof( int ) ) }; // Leads each file
+
+	// Object Data
+	std::vector< CTFCacheData > CTFCache; // CTFs of the constructions calculated or read by the last InitConductionTransferFunctions
+	// in the CTF cache folder: format version and sizes of the stored numbers
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
@@ -177,6 +190,8 @@ namespace ConductionTransferFunctionCalc {
 		//                      June 2000, RKS, addition of QTFs (both 1- and 2-D solutions for constructions
 		//                       with embedded/internal heat sources/sinks)
 		//                      July 2010-August 2011, RKS, R-value only layer enhancement
+		//                      Oct 2026, reuse the CTFs of identical constructions within a run and,
+		//                       through EPLUS_CTF_CACHE_DIR, across runs
 		//       RE-ENGINEERED  June 1996, February 1997, August-October 1997, RKS; Nov 1999, LKL
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -225,6 +240,9 @@ namespace ConductionTransferFunctionCalc {
 		// Using/Aliasing
 		using namespace DataConversions;
 		using General::RoundSigDigits;
+		using DataStringGlobals::pathChar;
+		using DataStringGlobals::altpathChar;
+		using namespace FileSystem;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -321,11 +339,35 @@ namespace ConductionTransferFunctionCalc {
 		Real64 Alpha; // thermal diffusivity in m2/s, for local check of properties
 		Real64 DeltaTimestep; // zone timestep in seconds, for local check of properties
 		Real64 ThicknessThreshold; // min thickness consistent with other thermal properties, for local check
+		std::vector< Real64 > CTFKey; // Converted layer properties, time step and solution options of a construction
+		int CTFCacheNum; // Index in CTFCache of the CTFs of a construction (-1 if not available)
+		std::string CTFCacheFolder; // Folder keeping CTFs across runs (empty if none)
 
 		// FLOW:
 		// Subroutine initializations
 		TinyLimit = rTinyValue;
 		DoCTFErrorReport = false;
+		CTFCache.clear();
+
+		// Parametric runs over the same constructions can keep their CTFs in a cache folder,
+		// one file per construction key.
+		char const * const EPLUS_CTF_CACHE_DIR = getenv( "EPLUS_CTF_CACHE_DIR" );
+		if ( EPLUS_CTF_CACHE_DIR != nullptr && *EPLUS_CTF_CACHE_DIR != '\0' ) {
+			CTFCacheFolder = EPLUS_CTF_CACHE_DIR;
+			while ( CTFCacheFolder.size() > 1 && ( CTFCacheFolder.back() == pathChar || CTFCacheFolder.back() == altpathChar ) ) {
+				CTFCacheFolder.pop_back();
+			}
+			if ( ! directoryExists( CTFCacheFolder ) && pathExists( getParentDirectoryPath( CTFCacheFolder ) ) ) {
+				makeDirectory( CTFCacheFolder );
+			}
+			if ( directoryExists( CTFCacheFolder ) ) {
+				CTFCacheFolder += pathChar;
+			} else {
+				ShowWarningError( "InitConductionTransferFunctions: cannot create the CTF cache folder \"" + CTFCacheFolder + "\" given by EPLUS_CTF_CACHE_DIR." );
+				ShowContinueError( "The CTFs will be calculated for this run only." );
+				CTFCacheFolder.clear();
+			}
+		}
 
 		for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) { // Begin construction loop ...
 
@@ -617,7 +659,40 @@ namespace ConductionTransferFunctionCalc {
 
 				} // ... end of construct loop (check reversed--Constr)
 
-				if ( ! RevConst ) { // Calculate CTFs (non-reversed constr)
+				// The CTFs only depend on the converted layer properties, the time step and the
+				// solution options, so constructions sharing them share their CTFs: look for CTFs
+				// calculated earlier in this run, then in the cache folder.
+				CTFCacheNum = -1;
+				if ( ! RevConst ) {
+					CTFKey.assign( { TimeStepZone, double( MaxCTFTerms ), double( LayersInConstruct ), double( Construct( ConstrNum ).SolutionDimensions ), dyn, double( Construct( ConstrNum ).SourceSinkPresent ), double( Construct( ConstrNum ).SourceAfterLayer ), double( Construct( ConstrNum ).TempAfterLayer ) } );
+					for ( Layer = 1; Layer <= LayersInConstruct; ++Layer ) {
+						CTFKey.insert( CTFKey.end(), { dl( Layer ), rk( Layer ), rho( Layer ), cp( Layer ), lr( Layer ), double( ResLayer( Layer ) ) } );
+					}
+					for ( int CacheNum = 0; CacheNum < int( CTFCache.size() ); ++CacheNum ) {
+						if ( CTFCache[ CacheNum ].Key == CTFKey ) {
+							CTFCacheNum = CacheNum;
+							break;
+						}
+					}
+					if ( CTFCacheNum < 0 && ! CTFCacheFolder.empty() ) {
+						CTFCacheData CTFs;
+						if ( ReadCTFCacheFile( CTFCacheFolder + GetCTFCacheKey( CTFKey ) + ".ctf", CTFKey, CTFs ) ) {
+							CTFCache.push_back( CTFs );
+							CTFCacheNum = int( CTFCache.size() ) - 1;
+						}
+					}
+					if ( CTFCacheNum >= 0 ) {
+						auto const & CTFs( CTFCache[ CTFCacheNum ] );
+						Construct( ConstrNum ).CTFTimeStep = CTFs.CTFTimeStep;
+						Construct( ConstrNum ).NumHistories = CTFs.NumHistories;
+						Construct( ConstrNum ).NumCTFTerms = CTFs.NumCTFTerms;
+						s0 = CTFs.s0;
+						s = CTFs.s;
+						e = CTFs.e;
+					}
+				}
+
+				if ( ! RevConst && CTFCacheNum < 0 ) { // Calculate CTFs (non-reversed constr)
 
 					// Estimate number of nodes each layer of the construct will require
 					// and calculate the nodal spacing from that
@@ -1126,6 +1201,30 @@ namespace ConductionTransferFunctionCalc {
 
 					} // ... end of CTF calculation loop.
 
+					// Keep the CTFs for later constructions and, in the cache folder, for later runs. Only
+					// converged CTFs are kept, and none once an error was found: a construction that fails
+					// is calculated again, and reports its convergence problem, wherever it appears.
+					if ( CTFConvrg && ! ErrorsFound ) {
+						CTFCacheData CTFs;
+						CTFs.Key = CTFKey;
+						CTFs.CTFTimeStep = Construct( ConstrNum ).CTFTimeStep;
+						CTFs.NumHistories = Construct( ConstrNum ).NumHistories;
+						CTFs.NumCTFTerms = Construct( ConstrNum ).NumCTFTerms;
+						CTFs.s0 = s0;
+						CTFs.s.allocate( 3, 4, CTFs.NumCTFTerms );
+						CTFs.e.allocate( CTFs.NumCTFTerms );
+						for ( HistTerm = 1; HistTerm <= CTFs.NumCTFTerms; ++HistTerm ) {
+							for ( int j = 1; j <= 4; ++j ) {
+								for ( int i = 1; i <= 3; ++i ) {
+									CTFs.s( i, j, HistTerm ) = s( i, j, HistTerm );
+								}
+							}
+							CTFs.e( HistTerm ) = e( HistTerm );
+						}
+						if ( ! CTFCacheFolder.empty() ) WriteCTFCacheFile( CTFCacheFolder + GetCTFCacheKey( CTFKey ) + ".ctf", CTFs );
+						CTFCache.push_back( CTFs );
+					}
+
 				} // ... end of IF block for non-reversed constructs.
 
 			} else { // Construct has only resistive layers (no thermal mass).
@@ -2238,6 +2337,153 @@ namespace ConductionTransferFunctionCalc {
 
 	}
 
+	std::string
+	GetCTFCacheKey( std::vector< Real64 > const & key ) // Converted layer properties, time step and solution options
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the name of the file of a construction in the CTF cache folder: a 64-bit
+		// FNV-1a hash of the bytes of its key, in hexadecimal.
+
+		std::uint64_t hash( 14695981039346656037ull ); // FNV offset basis
+		unsigned char const * const bytes( reinterpret_cast< unsigned char const * >( key.data() ) );
+		for ( std::size_t b = 0; b < key.size() * sizeof( Real64 ); ++b ) {
+			hash ^= bytes[ b ];
+			hash *= 1099511628211ull; // FNV prime
+		}
+
+		static char const hexDigits[] = "0123456789abcdef";
+		std::string fileName;
+		for ( int shift = 60; shift >= 0; shift -= 4 ) fileName += hexDigits[ ( hash >> shift ) & 0xF ];
+		return fileName;
+	}
+
+	bool
+	ReadCTFCacheFile(
+		std::string const & fileName, // File of the construction in the CTF cache folder
+		std::vector< Real64 > const & key, // Converted layer properties, time step and solution options
+		CTFCacheData & CTFs // CTFs read from the file
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reads the CTFs kept by an earlier run in the CTF cache folder. Returns false if
+		// the file is missing, incomplete, or holds the CTFs of another key.
+
+		// METHODOLOGY EMPLOYED:
+		// The file holds the program version, the key and the CTFs as written by WriteCTFCacheFile,
+		// in binary so that the CTFs are the same as calculated ones to the last bit. Files written
+		// by another version of the program are not used, since its CTF calculation may differ.
+
+		// Using/Aliasing
+		using DataStringGlobals::VerString;
+
+		std::ifstream cacheFile( fileName, std::ios::binary );
+		if ( ! cacheFile ) return false;
+
+		char header[ sizeof( CTFCacheHeader ) ];
+		cacheFile.read( header, sizeof( header ) );
+		if ( ! cacheFile || ! std::equal( header, header + sizeof( header ), CTFCacheHeader ) ) return false;
+
+		std::uint64_t versionSize( 0 );
+		cacheFile.read( reinterpret_cast< char * >( &versionSize ), sizeof( versionSize ) );
+		if ( ! cacheFile || versionSize != VerString.size() ) return false;
+		std::string version( VerString.size(), ' ' );
+		cacheFile.read( &version[ 0 ], version.size() );
+		if ( ! cacheFile || version != VerString ) return false;
+
+		std::uint64_t keySize( 0 );
+		cacheFile.read( reinterpret_cast< char * >( &keySize ), sizeof( keySize ) );
+		if ( ! cacheFile || keySize != key.size() ) return false;
+		CTFs.Key.resize( key.size() );
+		cacheFile.read( reinterpret_cast< char * >( CTFs.Key.data() ), key.size() * sizeof( Real64 ) );
+		if ( ! cacheFile || CTFs.Key != key ) return false;
+
+		std::int32_t NumHistories( 0 );
+		std::int32_t NumCTFTerms( 0 );
+		cacheFile.read( reinterpret_cast< char * >( &CTFs.CTFTimeStep ), sizeof( CTFs.CTFTimeStep ) );
+		cacheFile.read( reinterpret_cast< char * >( &NumHistories ), sizeof( NumHistories ) );
+		cacheFile.read( reinterpret_cast< char * >( &NumCTFTerms ), sizeof( NumCTFTerms ) );
+		if ( ! cacheFile || NumCTFTerms < 0 || NumCTFTerms > MaxCTFTerms ) return false;
+		CTFs.NumHistories = NumHistories;
+		CTFs.NumCTFTerms = NumCTFTerms;
+
+		CTFs.s0.allocate( 3, 4 );
+		CTFs.s.allocate( 3, 4, NumCTFTerms );
+		CTFs.e.allocate( NumCTFTerms );
+		cacheFile.read( reinterpret_cast< char * >( CTFs.s0.data() ), CTFs.s0.size() * sizeof( Real64 ) );
+		cacheFile.read( reinterpret_cast< char * >( CTFs.s.data() ), CTFs.s.size() * sizeof( Real64 ) );
+		cacheFile.read( reinterpret_cast< char * >( CTFs.e.data() ), CTFs.e.size() * sizeof( Real64 ) );
+		return bool( cacheFile );
+	}
+
+	void
+	WriteCTFCacheFile(
+		std::string const & fileName, // File of the construction in the CTF cache folder
+		CTFCacheData const & CTFs // CTFs to keep
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keeps the CTFs of a construction in the CTF cache folder for later runs.
+
+		// METHODOLOGY EMPLOYED:
+		// The file is written aside, under a name unique to this process, then renamed, so that
+		// concurrent runs only ever read complete files. If another run has just written the
+		// same file, it is kept.
+
+		// Using/Aliasing
+		using DataStringGlobals::VerString;
+
+		std::string const partFileName( fileName + ".part" + std::to_string( FileSystem::getProcessId() ) + '_' + std::to_string( std::chrono::system_clock::now().time_since_epoch().count() ) );
+		{
+			std::ofstream cacheFile( partFileName, std::ios::binary );
+			if ( ! cacheFile ) return;
+
+			std::uint64_t const versionSize( VerString.size() );
+			std::uint64_t const keySize( CTFs.Key.size() );
+			std::int32_t const NumHistories( CTFs.NumHistories );
+			std::int32_t const NumCTFTerms( CTFs.NumCTFTerms );
+			cacheFile.write( CTFCacheHeader, sizeof( CTFCacheHeader ) );
+			cacheFile.write( reinterpret_cast< char const * >( &versionSize ), sizeof( versionSize ) );
+			cacheFile.write( VerString.data(), VerString.size() );
+			cacheFile.write( reinterpret_cast< char const * >( &keySize ), sizeof( keySize ) );
+			cacheFile.write( reinterpret_cast< char const * >( CTFs.Key.data() ), CTFs.Key.size() * sizeof( Real64 ) );
+			cacheFile.write( reinterpret_cast< char const * >( &CTFs.CTFTimeStep ), sizeof( CTFs.CTFTimeStep ) );
+			cacheFile.write( reinterpret_cast< char const * >( &NumHistories ), sizeof( NumHistories ) );
+			cacheFile.write( reinterpret_cast< char const * >( &NumCTFTerms ), sizeof( NumCTFTerms ) );
+			cacheFile.write( reinterpret_cast< char const * >( CTFs.s0.data() ), CTFs.s0.size() * sizeof( Real64 ) );
+			cacheFile.write( reinterpret_cast< char const * >( CTFs.s.data() ), CTFs.s.size() * sizeof( Real64 ) );
+			cacheFile.write( reinterpret_cast< char const * >( CTFs.e.data() ), CTFs.e.size() * sizeof( Real64 ) );
+			cacheFile.close();
+			if ( ! cacheFile ) {
+				FileSystem::removeFile( partFileName );
+				return;
+			}
+		}
+
+		FileSystem::moveFile( partFileName, fileName );
+		if ( FileSystem::fileExists( partFileName ) ) FileSystem::removeFile( partFileName );
+	}
+
 } // ConductionTransferFunctionCalc
 
 } // EnergyPlus
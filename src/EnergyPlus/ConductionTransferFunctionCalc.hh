@@ -59,6 +59,10 @@
 #ifndef ConductionTransferFunctionCalc_hh_INCLUDED
 #define ConductionTransferFunctionCalc_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -109,6 +113,33 @@ namespace ConductionTransferFunctionCalc {
 	extern Array2D< Real64 > s0; // Coefficients for the current surface temperature terms
 	extern Real64 TinyLimit;
 	extern Array2D< Real64 > IdenMatrix; // Identity Matrix
+	extern char const CTFCacheHeader[ 8 ]; // Leads each file in the CTF cache folder
+
+	// Types
+
+	struct CTFCacheData
+	{
+		// Members
+		std::vector< Real64 > Key; // Converted layer properties, time step and solution options of the construction
+		Real64 CTFTimeStep; // Time step of the CTFs
+		int NumHistories; // Number of zone time steps per CTF time step
+		int NumCTFTerms; // Number of CTF history terms
+		Array2D< Real64 > s0; // Coefficients for the current surface temperature terms
+		Array3D< Real64 > s; // Coefficients for the surface temperature history terms
+		Array1D< Real64 > e; // Coefficients for the surface flux history term
+
+		// Default Constructor
+		CTFCacheData() :
+			CTFTimeStep( 0.0 ),
+			NumHistories( 0 ),
+			NumCTFTerms( 0 ),
+			s0( 3, 4, 0.0 )
+		{}
+
+	};
+
+	// Object Data
+	extern std::vector< CTFCacheData > CTFCache; // CTFs of the constructions calculated or read by the last InitConductionTransferFunctions
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE ConductionTransferFunctionCalc
 
@@ -138,6 +169,22 @@ namespace ConductionTransferFunctionCalc {
 	void
 	ReportCTFs( bool const DoReportBecauseError );
 
+	std::string
+	GetCTFCacheKey( std::vector< Real64 > const & key ); // Converted layer properties, time step and solution options
+
+	bool
+	ReadCTFCacheFile(
+		std::string const & fileName, // File of the construction in the CTF cache folder
+		std::vector< Real64 > const & key, // Converted layer properties, time step and solution options
+		CTFCacheData & CTFs // CTFs read from the file
+	);
+
+	void
+	WriteCTFCacheFile(
+		std::string const & fileName, // File of the construction in the CTF cache folder
+		CTFCacheData const & CTFs // CTFs to keep
+	);
+
 } // ConductionTransferFunctionCalc
 
 } // EnergyPlus
@@ -57,6 +57,7 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <cassert>
 #include <cmath>
 #include <string>
 
@@ -214,6 +215,7 @@ namespace CurveManager {
 
 	int NumCurves( 0 ); //Autodesk Was used unintialized in InitCurveReporting
 	bool GetCurvesInputFlag( true ); // First time, input is "gotten"
+	bool MyBeginTimeStepFlag( false ); // TRUE once curve outputs should be reset at the next begin environment
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
 
@@ -234,6 +236,7 @@ namespace CurveManager {
 	{
 		NumCurves = 0;
 		GetCurvesInputFlag = true;
+		MyBeginTimeStepFlag = false;
 		PerfCurve.deallocate();
 		PerfCurveTableData.deallocate();
 		TableData.deallocate();
@@ -336,7 +339,7 @@ namespace CurveManager {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static bool MyBeginTimeStepFlag;
+		// na
 
 		// need to be careful on where and how resetting curve outputs to some "iactive value" is done
 		// EMS can intercept curves and modify output
@@ -377,6 +380,112 @@ namespace CurveManager {
 
 	}
 
+	void
+	CurveValues(
+		int const CurveIndex, // index of curve in curve array
+		Array1S< Real64 > const Var1, // 1st independent variable at each point
+		Array1S< Real64 > Result, // curve value at each point
+		Optional< Array1S< Real64 > const > Var2, // 2nd independent variable at each point
+		Optional< Array1S< Real64 > const > Var3 // 3rd independent variable at each point
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates one curve or table at a set of operating points in a single call.
+		// Gives the same results as calling CurveValue once per point, in order.
+
+		// METHODOLOGY EMPLOYED:
+		// The curve index, interpolation type and kernel are checked and selected once for the batch.
+		// Regression curves then run their compiled kernel over the points; tables are evaluated point
+		// by point through the table routines, which keep their bracket search hints between points.
+		// Report variables reflect the last point, as they would after the equivalent sequence of calls.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataGlobals::BeginEnvrnFlag;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int const NumPoints( Var1.isize() );
+		if ( NumPoints == 0 ) return;
+		assert( Result.isize() >= NumPoints );
+		assert( ( ! present( Var2 ) ) || ( Var2().isize() >= NumPoints ) );
+		assert( ( ! present( Var3 ) ) || ( Var3().isize() >= NumPoints ) );
+
+		if ( BeginEnvrnFlag && MyBeginTimeStepFlag ) {
+			ResetPerformanceCurveOutput();
+			MyBeginTimeStepFlag = false;
+		}
+
+		if ( ! BeginEnvrnFlag ) {
+			MyBeginTimeStepFlag = true;
+		}
+
+		if ( ( CurveIndex <= 0 ) || ( CurveIndex > NumCurves ) ) {
+			ShowFatalError( "CurveValues: Invalid curve passed." );
+		}
+
+		auto & Curve( PerfCurve( CurveIndex ) );
+		bool const HasVar2( present( Var2 ) );
+		bool const HasVar3( present( Var3 ) );
+
+		{ auto const SELECT_CASE_var( Curve.InterpolationType );
+		if ( SELECT_CASE_var == EvaluateCurveToLimits ) {
+			if ( Curve.KernelCurveType != Curve.CurveType ) CompilePerformanceCurve( Curve );
+			CurveKernelFunction const Kernel( Curve.Kernel );
+			for ( int i = 1; i <= NumPoints; ++i ) {
+				Real64 const V1( max( min( Var1( i ), Curve.Var1Max ), Curve.Var1Min ) );
+				Real64 const V2( HasVar2 ? max( min( Var2()( i ), Curve.Var2Max ), Curve.Var2Min ) : 0.0 );
+				Real64 const V3( HasVar3 ? max( min( Var3()( i ), Curve.Var3Max ), Curve.Var3Min ) : 0.0 );
+				Real64 Value( Kernel( Curve, V1, V2, V3, 0.0 ) );
+				if ( Curve.CurveMinPresent ) Value = max( Value, Curve.CurveMin );
+				if ( Curve.CurveMaxPresent ) Value = min( Value, Curve.CurveMax );
+				Result( i ) = Value;
+			}
+		} else if ( SELECT_CASE_var == LinearInterpolationOfTable ) {
+			for ( int i = 1; i <= NumPoints; ++i ) {
+				if ( HasVar3 ) {
+					Result( i ) = PerformanceTableObject( CurveIndex, Var1( i ), Var2()( i ), Var3()( i ) );
+				} else if ( HasVar2 ) {
+					Result( i ) = PerformanceTableObject( CurveIndex, Var1( i ), Var2()( i ) );
+				} else {
+					Result( i ) = PerformanceTableObject( CurveIndex, Var1( i ) );
+				}
+			}
+		} else if ( SELECT_CASE_var == LagrangeInterpolationLinearExtrapolation ) {
+			for ( int i = 1; i <= NumPoints; ++i ) {
+				if ( HasVar3 ) {
+					Result( i ) = TableLookupObject( CurveIndex, Var1( i ), Var2()( i ), Var3()( i ) );
+				} else if ( HasVar2 ) {
+					Result( i ) = TableLookupObject( CurveIndex, Var1( i ), Var2()( i ) );
+				} else {
+					Result( i ) = TableLookupObject( CurveIndex, Var1( i ) );
+				}
+			}
+		} else {
+			ShowFatalError( "CurveValues: Invalid Interpolation Type" );
+		}}
+
+		if ( Curve.EMSOverrideOn ) {
+			for ( int i = 1; i <= NumPoints; ++i ) {
+				Result( i ) = Curve.EMSOverrideCurveValue;
+			}
+		}
+
+		Curve.CurveOutput = Result( NumPoints );
+		Curve.CurveInput1 = Var1( NumPoints );
+		if ( HasVar2 ) Curve.CurveInput2 = Var2()( NumPoints );
+		if ( HasVar3 ) Curve.CurveInput3 = Var3()( NumPoints );
+
+	}
+
 	void
 	GetCurveInput()
 	{
@@ -2717,6 +2826,9 @@ namespace CurveManager {
 
 		}
 
+		// select evaluation kernels and table grid descriptions now that all curve and table data are known
+		CompilePerformanceCurves();
+
 	}
 
 	void
@@ -3797,6 +3909,339 @@ Label999: ;
 		return DLAG;
 	}
 
+	// Fixed-arity regression curve kernels selected by CompilePerformanceCurve.
+	// Independent variables arrive already limited to the curve's min/max; output limits are applied by the caller.
+
+	Real64
+	LinearCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + V1 * Curve.Coeff2;
+	}
+
+	Real64
+	QuadraticCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 );
+	}
+
+	Real64
+	QuadLinearCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const V4 )
+	{
+		return Curve.Coeff1 + V1 * Curve.Coeff2 + V2 * Curve.Coeff3 + V3 * Curve.Coeff4 + V4 * Curve.Coeff5;
+	}
+
+	Real64
+	CubicCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) );
+	}
+
+	Real64
+	QuarticCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * ( Curve.Coeff4 + V1 * Curve.Coeff5 ) ) );
+	}
+
+	Real64
+	BiQuadraticCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) + V2 * ( Curve.Coeff4 + V2 * Curve.Coeff5 ) + V1 * V2 * Curve.Coeff6;
+	}
+
+	Real64
+	QuadraticLinearCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+	{
+		return ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) ) + ( Curve.Coeff4 + V1 * ( Curve.Coeff5 + V1 * Curve.Coeff6 ) ) * V2;
+	}
+
+	Real64
+	CubicLinearCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+	{
+		return ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) ) ) + ( Curve.Coeff5 + V1 * Curve.Coeff6 ) * V2;
+	}
+
+	Real64
+	BiCubicCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 + V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 + V1 * V2 * V2 * Curve.Coeff10;
+	}
+
+	Real64
+	ChillerPartLoadWithLiftCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const )
+	{
+		return Curve.Coeff1 + Curve.Coeff2*V1 + Curve.Coeff3*V1*V1 + Curve.Coeff4*V2 + Curve.Coeff5*V2*V2 + Curve.Coeff6*V1*V2  + Curve.Coeff7*V1*V1*V1 + Curve.Coeff8*V2*V2*V2 + Curve.Coeff9*V1*V1*V2 + Curve.Coeff10*V1*V2*V2 + Curve.Coeff11*V1*V1*V2*V2 + Curve.Coeff12*V3*V2*V2*V2;
+	}
+
+	Real64
+	TriQuadraticCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const V3, Real64 const )
+	{
+		auto const & Tri2ndOrder( Curve.Tri2ndOrder( 1 ) );
+		auto const V1s( V1 * V1 );
+		auto const V2s( V2 * V2 );
+		auto const V3s( V3 * V3 );
+		return Tri2ndOrder.CoeffA0 + Tri2ndOrder.CoeffA1 * V1s + Tri2ndOrder.CoeffA2 * V1 + Tri2ndOrder.CoeffA3 * V2s + Tri2ndOrder.CoeffA4 * V2 + Tri2ndOrder.CoeffA5 * V3s + Tri2ndOrder.CoeffA6 * V3 + Tri2ndOrder.CoeffA7 * V1s * V2s + Tri2ndOrder.CoeffA8 * V1 * V2 + Tri2ndOrder.CoeffA9 * V1 * V2s + Tri2ndOrder.CoeffA10 * V1s * V2 + Tri2ndOrder.CoeffA11 * V1s * V3s + Tri2ndOrder.CoeffA12 * V1 * V3 + Tri2ndOrder.CoeffA13 * V1 * V3s + Tri2ndOrder.CoeffA14 * V1s * V3 + Tri2ndOrder.CoeffA15 * V2s * V3s + Tri2ndOrder.CoeffA16 * V2 * V3 + Tri2ndOrder.CoeffA17 * V2 * V3s + Tri2ndOrder.CoeffA18 * V2s * V3 + Tri2ndOrder.CoeffA19 * V1s * V2s * V3s + Tri2ndOrder.CoeffA20 * V1s * V2s * V3 + Tri2ndOrder.CoeffA21 * V1s * V2 * V3s + Tri2ndOrder.CoeffA22 * V1 * V2s * V3s + Tri2ndOrder.CoeffA23 * V1s * V2 * V3 + Tri2ndOrder.CoeffA24 * V1 * V2s * V3 + Tri2ndOrder.CoeffA25 * V1 * V2 * V3s + Tri2ndOrder.CoeffA26 * V1 * V2 * V3;
+	}
+
+	Real64
+	ExponentCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + Curve.Coeff2 * std::pow( V1, Curve.Coeff3 );
+	}
+
+	Real64
+	FanPressureRiseCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const V2, Real64 const, Real64 const )
+	{
+		return V1 * ( Curve.Coeff1 * V1 + Curve.Coeff2 + Curve.Coeff3 * std::sqrt( V2 ) ) + Curve.Coeff4 * V2;
+	}
+
+	Real64
+	ExponentialSkewNormalCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		static Real64 const sqrt_2_inv( 1.0 / std::sqrt( 2.0 ) );
+		Real64 const CoeffZ1( ( V1 - Curve.Coeff1 ) / Curve.Coeff2 ); // Coefficient Z1 in exponential skew normal curve
+		Real64 const CoeffZ2( ( Curve.Coeff4 * V1 * std::exp( Curve.Coeff3 * V1 ) - Curve.Coeff1 ) / Curve.Coeff2 ); // Coefficient Z2 in exponential skew normal curve
+		Real64 const CoeffZ3( -Curve.Coeff1 / Curve.Coeff2 ); // Coefficient Z3 in exponential skew normal curve
+		Real64 const CurveValueNumer( std::exp( -0.5 * ( CoeffZ1 * CoeffZ1 ) ) * ( 1.0 + sign( 1.0, CoeffZ2 ) * std::erf( std::abs( CoeffZ2 ) * sqrt_2_inv ) ) );
+		Real64 const CurveValueDenom( std::exp( -0.5 * ( CoeffZ3 * CoeffZ3 ) ) * ( 1.0 + sign( 1.0, CoeffZ3 ) * std::erf( std::abs( CoeffZ3 ) * sqrt_2_inv ) ) );
+		return CurveValueNumer / CurveValueDenom;
+	}
+
+	Real64
+	SigmoidCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		Real64 const CurveValueExp( std::exp( ( Curve.Coeff3 - V1 ) / Curve.Coeff4 ) );
+		return Curve.Coeff1 + Curve.Coeff2 / std::pow( 1.0 + CurveValueExp, Curve.Coeff5 );
+	}
+
+	Real64
+	RectangularHyperbola1CurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return ( ( Curve.Coeff1 * V1 ) / ( Curve.Coeff2 + V1 ) ) + Curve.Coeff3;
+	}
+
+	Real64
+	RectangularHyperbola2CurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return ( ( Curve.Coeff1 * V1 ) / ( Curve.Coeff2 + V1 ) ) + ( Curve.Coeff3 * V1 );
+	}
+
+	Real64
+	ExponentialDecayCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 );
+	}
+
+	Real64
+	DoubleExponentialDecayCurveKernel( PerfomanceCurveData const & Curve, Real64 const V1, Real64 const, Real64 const, Real64 const )
+	{
+		return Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 ) + Curve.Coeff4 * std::exp( Curve.Coeff5 * V1 );
+	}
+
+	Real64
+	UndefinedCurveKernel( PerfomanceCurveData const &, Real64 const, Real64 const, Real64 const, Real64 const )
+	{
+		return 0.0;
+	}
+
+	void
+	CompilePerformanceCurves()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Selects the evaluation kernel of every curve and derives the grid description of every
+		// linearly interpolated table once input is complete, so that curve evaluation does not
+		// dispatch on curve type or rescan table data on every call.
+
+		for ( int CurveIndex = 1; CurveIndex <= NumCurves; ++CurveIndex ) {
+			CompilePerformanceCurve( PerfCurve( CurveIndex ) );
+		}
+		for ( auto & Table : PerfCurveTableData ) {
+			CompilePerformanceTable( Table );
+		}
+
+	}
+
+	void
+	CompilePerformanceCurve( PerfomanceCurveData & Curve )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Selects the fixed-arity kernel used by PerformanceCurveObject for this curve's CurveType.
+
+		// METHODOLOGY EMPLOYED:
+		// KernelCurveType records the type the kernel was selected for; evaluation recompiles when the
+		// curve type has been changed since (e.g., by SolveRegression or by unit tests filling PerfCurve directly).
+
+		switch ( Curve.CurveType ) {
+		case Linear:
+			Curve.Kernel = LinearCurveKernel;
+			break;
+		case Quadratic:
+			Curve.Kernel = QuadraticCurveKernel;
+			break;
+		case QuadLinear:
+			Curve.Kernel = QuadLinearCurveKernel;
+			break;
+		case Cubic:
+			Curve.Kernel = CubicCurveKernel;
+			break;
+		case Quartic:
+			Curve.Kernel = QuarticCurveKernel;
+			break;
+		case BiQuadratic:
+			Curve.Kernel = BiQuadraticCurveKernel;
+			break;
+		case QuadraticLinear:
+			Curve.Kernel = QuadraticLinearCurveKernel;
+			break;
+		case CubicLinear:
+			Curve.Kernel = CubicLinearCurveKernel;
+			break;
+		case BiCubic:
+			Curve.Kernel = BiCubicCurveKernel;
+			break;
+		case ChillerPartLoadWithLift:
+			Curve.Kernel = ChillerPartLoadWithLiftCurveKernel;
+			break;
+		case TriQuadratic:
+			Curve.Kernel = TriQuadraticCurveKernel;
+			break;
+		case Exponent:
+			Curve.Kernel = ExponentCurveKernel;
+			break;
+		case FanPressureRise:
+			Curve.Kernel = FanPressureRiseCurveKernel;
+			break;
+		case ExponentialSkewNormal:
+			Curve.Kernel = ExponentialSkewNormalCurveKernel;
+			break;
+		case Sigmoid:
+			Curve.Kernel = SigmoidCurveKernel;
+			break;
+		case RectangularHyperbola1:
+			Curve.Kernel = RectangularHyperbola1CurveKernel;
+			break;
+		case RectangularHyperbola2:
+			Curve.Kernel = RectangularHyperbola2CurveKernel;
+			break;
+		case ExponentialDecay:
+			Curve.Kernel = ExponentialDecayCurveKernel;
+			break;
+		case DoubleExponentialDecay:
+			Curve.Kernel = DoubleExponentialDecayCurveKernel;
+			break;
+		default:
+			Curve.Kernel = UndefinedCurveKernel;
+			break;
+		}
+		Curve.KernelCurveType = Curve.CurveType;
+
+	}
+
+	void
+	CompilePerformanceTable( PerfCurveTableDataStruct & Table )
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Derives the range and ordering of the table's independent variable grids once, so that
+		// PerformanceTableObject does not rescan X1 and X2 on every call.
+
+		Table.X1Ascending = true;
+		for ( int i = 2, e = Table.X1.isize(); i <= e; ++i ) {
+			if ( Table.X1( i ) <= Table.X1( i - 1 ) ) {
+				Table.X1Ascending = false;
+				break;
+			}
+		}
+		Table.X2Ascending = true;
+		for ( int i = 2, e = Table.X2.isize(); i <= e; ++i ) {
+			if ( Table.X2( i ) <= Table.X2( i - 1 ) ) {
+				Table.X2Ascending = false;
+				break;
+			}
+		}
+		if ( Table.X1.size() > 0u ) {
+			Table.X1Min = minval( Table.X1 );
+			Table.X1Max = maxval( Table.X1 );
+		}
+		if ( Table.X2.size() > 0u ) {
+			Table.X2Min = minval( Table.X2 );
+			Table.X2Max = maxval( Table.X2 );
+		}
+		Table.X1Bracket = 1;
+		Table.X2Bracket = 1;
+		Table.GridCompiled = true;
+
+	}
+
+	int
+	FindTableBracket(
+		Real64 const V, // value to bracket (already limited to the range of X)
+		Array1D< Real64 > const & X, // table independent variable values
+		bool const Ascending, // X is strictly increasing
+		int & Bracket // search hint in, lower bracket index out
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the last index of X whose value is less than or equal to V, for V strictly inside the range of X.
+
+		// METHODOLOGY EMPLOYED:
+		// For strictly increasing X the previous bracket is checked first (successive calls from a component
+		// usually land in the same interval) and a bisection is used otherwise. Unordered data keeps the
+		// original full scan so results are unchanged.
+
+		int const NumX( X.isize() );
+		if ( ! Ascending ) {
+			int LowPtr( 0 );
+			for ( int i = 1; i <= NumX; ++i ) {
+				if ( V >= X( i ) ) LowPtr = i;
+			}
+			return LowPtr;
+		}
+
+		int Low( Bracket );
+		if ( ( Low >= 1 ) && ( Low < NumX ) && ( X( Low ) <= V ) && ( V < X( Low + 1 ) ) ) return Low;
+
+		Low = 1;
+		int High( NumX );
+		while ( High - Low > 1 ) {
+			int const Mid( ( Low + High ) / 2 );
+			if ( X( Mid ) <= V ) {
+				Low = Mid;
+			} else {
+				High = Mid;
+			}
+		}
+		Bracket = Low;
+		return Low;
+
+	}
+
 	Real64
 	PerformanceCurveObject(
 		int const CurveIndex, // index of curve in curve array
@@ -3816,6 +4261,7 @@ Label999: ;
 		//                          RectangularHyperbola2, ExponentialDecay
 
 		//       RE-ENGINEERED  Autodesk: Performance tuning
+		//                      Oct 2026, evaluate through the kernel selected by CompilePerformanceCurve
 
 		// PURPOSE OF THIS FUNCTION:
 		// Given the curve index and the values of 1 or 2 independent variables,
@@ -3833,93 +4279,16 @@ Label999: ;
 		// Return value
 		Real64 CurveValue;
 
-		// Locals
-		// FUNCTION ARGUMENT DEFINITIONS:
-
-		// FUNCTION PARAMETER DEFINITIONS:
-		// na
-
-		// INTERFACE BLOCK SPECIFICATIONS
-		// na
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-
-		static Real64 const sqrt_2_inv( 1.0 / std::sqrt( 2.0 ) );
-
-		Real64 CoeffZ1; // cpw22Aug2010 Coefficient Z1 in exponential skew normal curve
-		Real64 CoeffZ2; // cpw22Aug2010 Coefficient Z2 in exponential skew normal curve
-		Real64 CoeffZ3; // cpw22Aug2010 Coefficient Z3 in exponential skew normal curve
-		Real64 CurveValueNumer; // cpw22Aug2010 Numerator in in exponential skew normal curve
-		Real64 CurveValueDenom; // cpw22Aug2010 Numerator in in exponential skew normal curve
-		Real64 CurveValueExp; // cpw22Aug2010 Exponential term in sigmoid curve
-		auto const & Curve( PerfCurve( CurveIndex ) );
+		auto & Curve( PerfCurve( CurveIndex ) );
 
 		Real64 const V1( max( min( Var1, Curve.Var1Max ), Curve.Var1Min ) ); // 1st independent variable after limits imposed
 		Real64 const V2( Var2.present() ? max( min( Var2, Curve.Var2Max ), Curve.Var2Min ) : 0.0 ); // 2nd independent variable after limits imposed
 		Real64 const V3( Var3.present() ? max( min( Var3, Curve.Var3Max ), Curve.Var3Min ) : 0.0 ); // 3rd independent variable after limits imposed
 		Real64 const V4( Var4.present() ? max( min( Var4, Curve.Var4Max ), Curve.Var4Min ) : 0.0 ); // 4th independent variable after limits imposed
 
-		{ auto const SELECT_CASE_var( Curve.CurveType );
-		if ( SELECT_CASE_var == Linear ) {
-			CurveValue = Curve.Coeff1 + V1 * Curve.Coeff2;
-		} else if ( SELECT_CASE_var == Quadratic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 );
-		} else if ( SELECT_CASE_var == QuadLinear ) {
-			CurveValue = Curve.Coeff1 + V1 * Curve.Coeff2 + V2 * Curve.Coeff3 + V3 * Curve.Coeff4 + V4 * Curve.Coeff5;
-		} else if ( SELECT_CASE_var == Cubic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) );
-		} else if ( SELECT_CASE_var == Quartic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * ( Curve.Coeff4 + V1 * Curve.Coeff5 ) ) );
-		} else if ( SELECT_CASE_var == BiQuadratic ) {
-			CurveValue = Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) + V2 * ( Curve.Coeff4 + V2 * Curve.Coeff5 ) + V1 * V2 * Curve.Coeff6;
-		} else if ( SELECT_CASE_var == QuadraticLinear ) {
-			CurveValue = ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * Curve.Coeff3 ) ) + ( Curve.Coeff4 + V1 * ( Curve.Coeff5 + V1 * Curve.Coeff6 ) ) * V2;
-		} else if ( SELECT_CASE_var == CubicLinear ) {
-			CurveValue = ( Curve.Coeff1 + V1 * ( Curve.Coeff2 + V1 * ( Curve.Coeff3 + V1 * Curve.Coeff4 ) ) ) + ( Curve.Coeff5 + V1 * Curve.Coeff6 ) * V2;
-		} else if ( SELECT_CASE_var == BiCubic ) {
-			CurveValue = Curve.Coeff1 + V1 * Curve.Coeff2 + V1 * V1 * Curve.Coeff3 + V2 * Curve.Coeff4 + V2 * V2 * Curve.Coeff5 + V1 * V2 * Curve.Coeff6 + V1 * V1 * V1 * Curve.Coeff7 + V2 * V2 * V2 * Curve.Coeff8 + V1 * V1 * V2 * Curve.Coeff9 + V1 * V2 * V2 * Curve.Coeff10;
-		} else if ( SELECT_CASE_var == ChillerPartLoadWithLift ) {
-			CurveValue = Curve.Coeff1 + Curve.Coeff2*V1 + Curve.Coeff3*V1*V1 + Curve.Coeff4*V2 + Curve.Coeff5*V2*V2 + Curve.Coeff6*V1*V2  + Curve.Coeff7*V1*V1*V1 + Curve.Coeff8*V2*V2*V2 + Curve.Coeff9*V1*V1*V2 + Curve.Coeff10*V1*V2*V2 + Curve.Coeff11*V1*V1*V2*V2 + Curve.Coeff12*V3*V2*V2*V2;
-		} else if ( SELECT_CASE_var == TriQuadratic ) {
-			auto const & Tri2ndOrder( Curve.Tri2ndOrder( 1 ) );
-			auto const V1s( V1 * V1 );
-			auto const V2s( V2 * V2 );
-			auto const V3s( V3 * V3 );
-			CurveValue = Tri2ndOrder.CoeffA0 + Tri2ndOrder.CoeffA1 * V1s + Tri2ndOrder.CoeffA2 * V1 + Tri2ndOrder.CoeffA3 * V2s + Tri2ndOrder.CoeffA4 * V2 + Tri2ndOrder.CoeffA5 * V3s + Tri2ndOrder.CoeffA6 * V3 + Tri2ndOrder.CoeffA7 * V1s * V2s + Tri2ndOrder.CoeffA8 * V1 * V2 + Tri2ndOrder.CoeffA9 * V1 * V2s + Tri2ndOrder.CoeffA10 * V1s * V2 + Tri2ndOrder.CoeffA11 * V1s * V3s + Tri2ndOrder.CoeffA12 * V1 * V3 + Tri2ndOrder.CoeffA13 * V1 * V3s + Tri2ndOrder.CoeffA14 * V1s * V3 + Tri2ndOrder.CoeffA15 * V2s * V3s + Tri2ndOrder.CoeffA16 * V2 * V3 + Tri2ndOrder.CoeffA17 * V2 * V3s + Tri2ndOrder.CoeffA18 * V2s * V3 + Tri2ndOrder.CoeffA19 * V1s * V2s * V3s + Tri2ndOrder.CoeffA20 * V1s * V2s * V3 + Tri2ndOrder.CoeffA21 * V1s * V2 * V3s + Tri2ndOrder.CoeffA22 * V1 * V2s * V3s + Tri2ndOrder.CoeffA23 * V1s * V2 * V3 + Tri2ndOrder.CoeffA24 * V1 * V2s * V3 + Tri2ndOrder.CoeffA25 * V1 * V2 * V3s + Tri2ndOrder.CoeffA26 * V1 * V2 * V3;
-		} else if ( SELECT_CASE_var == Exponent ) {
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 * std::pow( V1, Curve.Coeff3 );
-		} else if ( SELECT_CASE_var == FanPressureRise ) { //cpw22Aug2010 Added Fan Pressure Rise curve
-			CurveValue = V1 * ( Curve.Coeff1 * V1 + Curve.Coeff2 + Curve.Coeff3 * std::sqrt( V2 ) ) + Curve.Coeff4 * V2;
-		} else if ( SELECT_CASE_var == ExponentialSkewNormal ) { //cpw22Aug2010 Added Exponential Skew Normal curve
-			CoeffZ1 = ( V1 - Curve.Coeff1 ) / Curve.Coeff2;
-			CoeffZ2 = ( Curve.Coeff4 * V1 * std::exp( Curve.Coeff3 * V1 ) - Curve.Coeff1 ) / Curve.Coeff2;
-			CoeffZ3 = -Curve.Coeff1 / Curve.Coeff2;
-			//    CurveValueNumer = EXP(-0.5d0 * CoeffZ1**2) * (1.0d0 + SIGN(1.0d0,CoeffZ2) * ErfFunction(ABS(CoeffZ2)/SQRT(2.0d0)))
-			//    CurveValueDenom = EXP(-0.5d0 * CoeffZ3**2) * (1.0d0 + SIGN(1.0d0,CoeffZ3) * ErfFunction(ABS(CoeffZ3)/SQRT(2.0d0)))
-			CurveValueNumer = std::exp( -0.5 * ( CoeffZ1 * CoeffZ1 ) ) * ( 1.0 + sign( 1.0, CoeffZ2 ) * std::erf( std::abs( CoeffZ2 ) * sqrt_2_inv ) );
-			CurveValueDenom = std::exp( -0.5 * ( CoeffZ3 * CoeffZ3 ) ) * ( 1.0 + sign( 1.0, CoeffZ3 ) * std::erf( std::abs( CoeffZ3 ) * sqrt_2_inv ) );
-			CurveValue = CurveValueNumer / CurveValueDenom;
-		} else if ( SELECT_CASE_var == Sigmoid ) { //cpw22Aug2010 Added Sigmoid curve
-			CurveValueExp = std::exp( ( Curve.Coeff3 - V1 ) / Curve.Coeff4 );
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 / std::pow( 1.0 + CurveValueExp, Curve.Coeff5 );
-		} else if ( SELECT_CASE_var == RectangularHyperbola1 ) { //cpw22Aug2010 Added Rectangular Hyperbola Type 1 curve
-			CurveValueNumer = Curve.Coeff1 * V1;
-			CurveValueDenom = Curve.Coeff2 + V1;
-			CurveValue = ( CurveValueNumer / CurveValueDenom ) + Curve.Coeff3;
-		} else if ( SELECT_CASE_var == RectangularHyperbola2 ) { //cpw22Aug2010 Added Rectangular Hyperbola Type 2 curve
-			CurveValueNumer = Curve.Coeff1 * V1;
-			CurveValueDenom = Curve.Coeff2 + V1;
-			CurveValue = ( CurveValueNumer / CurveValueDenom ) + ( Curve.Coeff3 * V1 );
-		} else if ( SELECT_CASE_var == ExponentialDecay ) { //cpw22Aug2010 Added Exponential Decay curve
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 );
-		} else if ( SELECT_CASE_var == DoubleExponentialDecay ) { //ykt Jul 2011 Added Double Exponential Decay curve
-			CurveValue = Curve.Coeff1 + Curve.Coeff2 * std::exp( Curve.Coeff3 * V1 ) + Curve.Coeff4 * std::exp( Curve.Coeff5 * V1 );
-		} else {
-			CurveValue = 0.0;
-		}}
+		if ( Curve.KernelCurveType != Curve.CurveType ) CompilePerformanceCurve( Curve );
+		CurveValue = Curve.Kernel( Curve, V1, V2, V3, V4 );
 
 		if ( Curve.CurveMinPresent ) CurveValue = max( CurveValue, Curve.CurveMin );
 		if ( Curve.CurveMaxPresent ) CurveValue = min( CurveValue, Curve.CurveMax );
@@ -3939,7 +4308,7 @@ Label999: ;
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   May 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, grid range and bracket search from CompilePerformanceTable
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -3974,10 +4343,6 @@ Label999: ;
 		Real64 V1; // 1st independent variable after limits imposed
 		Real64 V2; // 2nd independent variable after limits imposed
 		Real64 V3; // 3rd independent variable after limits imposed
-		Real64 TempX1Low;
-		Real64 TempX1High;
-		Real64 TempX2Low;
-		Real64 TempX2High;
 		//INTEGER   :: ATempX1LowPtr(1)
 		//INTEGER   :: ATempX1HighPtr(1)
 		//INTEGER   :: ATempX2LowPtr(1)
@@ -3991,8 +4356,6 @@ Label999: ;
 		Real64 X1ValLow;
 		Real64 X1ValHigh;
 		//INTEGER   :: MaxSizeArray
-		int X1Val;
-		int X2Val;
 		int TableIndex;
 
 		TableIndex = PerfCurve( CurveIndex ).TableIndex;
@@ -4011,68 +4374,59 @@ Label999: ;
 			V3 = 0.0;
 		}
 
+		auto & Table( PerfCurveTableData( TableIndex ) );
+		if ( ! Table.GridCompiled ) CompilePerformanceTable( Table );
+
 		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
-			if ( V1 <= TempX1Low ) {
+			if ( V1 <= Table.X1Min ) {
 				TempX1LowPtr = 1;
 				TempX1HighPtr = 1;
-			} else if ( V1 >= TempX1High ) {
-				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
+			} else if ( V1 >= Table.X1Max ) {
+				TempX1LowPtr = size( Table.X1 );
 				TempX1HighPtr = TempX1LowPtr;
 			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
-				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
+				TempX1LowPtr = FindTableBracket( V1, Table.X1, Table.X1Ascending, Table.X1Bracket );
+				if ( V1 == Table.X1( TempX1LowPtr ) ) {
 					TempX1HighPtr = TempX1LowPtr;
 				} else {
 					TempX1HighPtr = TempX1LowPtr + 1;
 				}
 			}
 			if ( TempX1LowPtr == TempX1HighPtr ) {
-				TableValue = PerfCurveTableData( TableIndex ).Y( 1, TempX1LowPtr );
+				TableValue = Table.Y( 1, TempX1LowPtr );
 			} else {
-				X1Frac = ( V1 - PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) / ( PerfCurveTableData( TableIndex ).X1( TempX1HighPtr ) - PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) );
-				TableValue = X1Frac * PerfCurveTableData( TableIndex ).Y( 1, TempX1HighPtr ) + ( 1 - X1Frac ) * PerfCurveTableData( TableIndex ).Y( 1, TempX1LowPtr );
+				X1Frac = ( V1 - Table.X1( TempX1LowPtr ) ) / ( Table.X1( TempX1HighPtr ) - Table.X1( TempX1LowPtr ) );
+				TableValue = X1Frac * Table.Y( 1, TempX1HighPtr ) + ( 1 - X1Frac ) * Table.Y( 1, TempX1LowPtr );
 			}
 
 		} else if ( SELECT_CASE_var == 2 ) {
 
-			TempX1Low = minval( PerfCurveTableData( TableIndex ).X1 );
-			TempX1High = maxval( PerfCurveTableData( TableIndex ).X1 );
-			if ( V1 <= TempX1Low ) {
+			if ( V1 <= Table.X1Min ) {
 				TempX1LowPtr = 1;
 				TempX1HighPtr = 1;
-			} else if ( V1 >= TempX1High ) {
-				TempX1LowPtr = size( PerfCurveTableData( TableIndex ).X1 );
+			} else if ( V1 >= Table.X1Max ) {
+				TempX1LowPtr = size( Table.X1 );
 				TempX1HighPtr = TempX1LowPtr;
 			} else {
-				for ( X1Val = 1; X1Val <= isize( PerfCurveTableData( TableIndex ).X1 ); ++X1Val ) {
-					if ( V1 >= PerfCurveTableData( TableIndex ).X1( X1Val ) ) TempX1LowPtr = X1Val;
-				}
-				if ( V1 == PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) {
+				TempX1LowPtr = FindTableBracket( V1, Table.X1, Table.X1Ascending, Table.X1Bracket );
+				if ( V1 == Table.X1( TempX1LowPtr ) ) {
 					TempX1HighPtr = TempX1LowPtr;
 				} else {
 					TempX1HighPtr = TempX1LowPtr + 1;
 				}
 			}
-			TempX2Low = minval( PerfCurveTableData( TableIndex ).X2 );
-			TempX2High = maxval( PerfCurveTableData( TableIndex ).X2 );
 
-			if ( V2 <= TempX2Low ) {
+			if ( V2 <= Table.X2Min ) {
 				TempX2LowPtr = 1;
 				TempX2HighPtr = 1;
-			} else if ( V2 >= TempX2High ) {
-				TempX2LowPtr = size( PerfCurveTableData( TableIndex ).X2 );
+			} else if ( V2 >= Table.X2Max ) {
+				TempX2LowPtr = size( Table.X2 );
 				TempX2HighPtr = TempX2LowPtr;
 			} else {
-				for ( X2Val = 1; X2Val <= isize( PerfCurveTableData( TableIndex ).X2 ); ++X2Val ) {
-					if ( V2 >= PerfCurveTableData( TableIndex ).X2( X2Val ) ) TempX2LowPtr = X2Val;
-				}
-				if ( V2 == PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) ) {
+				TempX2LowPtr = FindTableBracket( V2, Table.X2, Table.X2Ascending, Table.X2Bracket );
+				if ( V2 == Table.X2( TempX2LowPtr ) ) {
 					TempX2HighPtr = TempX2LowPtr;
 				} else {
 					TempX2HighPtr = TempX2LowPtr + 1;
@@ -4081,19 +4435,19 @@ Label999: ;
 
 			if ( TempX1LowPtr == TempX1HighPtr ) {
 				if ( TempX2LowPtr == TempX2HighPtr ) {
-					TableValue = PerfCurveTableData( TableIndex ).Y( TempX2LowPtr, TempX1LowPtr );
+					TableValue = Table.Y( TempX2LowPtr, TempX1LowPtr );
 				} else {
-					X2Frac = ( V2 - PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) ) / ( PerfCurveTableData( TableIndex ).X2( TempX2HighPtr ) - PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) );
-					TableValue = X2Frac * PerfCurveTableData( TableIndex ).Y( TempX2HighPtr, TempX1LowPtr ) + ( 1 - X2Frac ) * PerfCurveTableData( TableIndex ).Y( TempX2LowPtr, TempX1LowPtr );
+					X2Frac = ( V2 - Table.X2( TempX2LowPtr ) ) / ( Table.X2( TempX2HighPtr ) - Table.X2( TempX2LowPtr ) );
+					TableValue = X2Frac * Table.Y( TempX2HighPtr, TempX1LowPtr ) + ( 1 - X2Frac ) * Table.Y( TempX2LowPtr, TempX1LowPtr );
 				}
 			} else {
-				X1Frac = ( V1 - PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) ) / ( PerfCurveTableData( TableIndex ).X1( TempX1HighPtr ) - PerfCurveTableData( TableIndex ).X1( TempX1LowPtr ) );
+				X1Frac = ( V1 - Table.X1( TempX1LowPtr ) ) / ( Table.X1( TempX1HighPtr ) - Table.X1( TempX1LowPtr ) );
 				if ( TempX2LowPtr == TempX2HighPtr ) {
-					TableValue = X1Frac * PerfCurveTableData( TableIndex ).Y( TempX2LowPtr, TempX1HighPtr ) + ( 1 - X1Frac ) * PerfCurveTableData( TableIndex ).Y( TempX2LowPtr, TempX1LowPtr );
+					TableValue = X1Frac * Table.Y( TempX2LowPtr, TempX1HighPtr ) + ( 1 - X1Frac ) * Table.Y( TempX2LowPtr, TempX1LowPtr );
 				} else {
-					X1ValLow = X1Frac * PerfCurveTableData( TableIndex ).Y( TempX2LowPtr, TempX1HighPtr ) + ( 1 - X1Frac ) * PerfCurveTableData( TableIndex ).Y( TempX2LowPtr, TempX1LowPtr );
-					X1ValHigh = X1Frac * PerfCurveTableData( TableIndex ).Y( TempX2HighPtr, TempX1HighPtr ) + ( 1 - X1Frac ) * PerfCurveTableData( TableIndex ).Y( TempX2HighPtr, TempX1LowPtr );
-					X2Frac = ( V2 - PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) ) / ( PerfCurveTableData( TableIndex ).X2( TempX2HighPtr ) - PerfCurveTableData( TableIndex ).X2( TempX2LowPtr ) );
+					X1ValLow = X1Frac * Table.Y( TempX2LowPtr, TempX1HighPtr ) + ( 1 - X1Frac ) * Table.Y( TempX2LowPtr, TempX1LowPtr );
+					X1ValHigh = X1Frac * Table.Y( TempX2HighPtr, TempX1HighPtr ) + ( 1 - X1Frac ) * Table.Y( TempX2HighPtr, TempX1LowPtr );
+					X2Frac = ( V2 - Table.X2( TempX2LowPtr ) ) / ( Table.X2( TempX2HighPtr ) - Table.X2( TempX2LowPtr ) );
 					TableValue = X2Frac * X1ValHigh + ( 1 - X2Frac ) * X1ValLow;
 				}
 			}
@@ -4126,7 +4480,7 @@ Label999: ;
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   May 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, interpolate directly on the table grids instead of per-call copies
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -4173,11 +4527,6 @@ Label999: ;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:)     :: ONEDVALS
 		Array2D< Real64 > TWODVALS;
 		Array3D< Real64 > THREEDVALS;
-		Array1D< Real64 > VALSX;
-		Array1D< Real64 > VALSY;
-		Array1D< Real64 > VALSV3;
-		Array1D< Real64 > VALSV4;
-		Array1D< Real64 > VALSV5;
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:) :: HPVAL
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:) :: HPVALS
 		//REAL(r64), ALLOCATABLE, DIMENSION(:,:,:,:,:) :: DVLTRN
@@ -4280,120 +4629,72 @@ Label999: ;
 			V5 = 0.0;
 		}
 
-		{ auto const SELECT_CASE_var( TableLookup( TableIndex ).NumIndependentVars );
+		auto const & Table( TableLookup( TableIndex ) );
+		{ auto const SELECT_CASE_var( Table.NumIndependentVars );
 		if ( SELECT_CASE_var == 1 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
+			NX = Table.NumX1Vars;
 			NY = 1;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			TableValue = DLAG( V1, VALSX( 1 ), VALSX, VALSX, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
+			NUMPT = Table.InterpolationOrder;
+			TableValue = DLAG( V1, Table.X1Var( 1 ), Table.X1Var, Table.X1Var, Table.TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 2 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			TableValue = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
-			VALSX.deallocate();
-			VALSY.deallocate();
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NUMPT = Table.InterpolationOrder;
+			TableValue = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, 1, 1, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 		} else if ( SELECT_CASE_var == 3 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NUMPT = Table.InterpolationOrder;
 			TWODVALS.allocate( 1, NV3 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-				TWODVALS( 1, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, 1, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+				TWODVALS( 1, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, 1, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 			}
 			if ( NV3 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V3, 1.0, VALSV3, VALSV3, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
+				TableValue = DLAG( V3, 1.0, Table.X3Var, Table.X3Var, TWODVALS, NV3, 1, NUMPT, IEXTV3, IEXTV4 );
 			}
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
 		} else if ( SELECT_CASE_var == 4 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NV4 = Table.NumX4Vars;
+			NUMPT = Table.InterpolationOrder;
 			TWODVALS.allocate( NV4, NV3 );
 			// perform 2-D interpolation of X (V1) and Y (V2) and save in 2-D array
 			for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
 				for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-					TWODVALS( IV4, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( 1, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+					TWODVALS( IV4, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( 1, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 				}
 			}
 			// final interpolation of 2-D array in V3 and V4
-			TableValue = DLAG( V3, V4, VALSV3, VALSV4, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
-			TWODVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
+			TableValue = DLAG( V3, V4, Table.X3Var, Table.X4Var, TWODVALS, NV3, NV4, NUMPT, IEXTV3, IEXTV4 );
 		} else if ( SELECT_CASE_var == 5 ) {
-			NX = TableLookup( TableIndex ).NumX1Vars;
-			NY = TableLookup( TableIndex ).NumX2Vars;
-			NV3 = TableLookup( TableIndex ).NumX3Vars;
-			NV4 = TableLookup( TableIndex ).NumX4Vars;
-			NV5 = TableLookup( TableIndex ).NumX5Vars;
-			NUMPT = TableLookup( TableIndex ).InterpolationOrder;
-			VALSX.allocate( NX );
-			VALSX = TableLookup( TableIndex ).X1Var;
-			VALSY.allocate( NY );
-			VALSY = TableLookup( TableIndex ).X2Var;
-			VALSV3.allocate( NV3 );
-			VALSV3 = TableLookup( TableIndex ).X3Var;
-			VALSV4.allocate( NV4 );
-			VALSV4 = TableLookup( TableIndex ).X4Var;
-			VALSV5.allocate( NV5 );
-			VALSV5 = TableLookup( TableIndex ).X5Var;
+			NX = Table.NumX1Vars;
+			NY = Table.NumX2Vars;
+			NV3 = Table.NumX3Vars;
+			NV4 = Table.NumX4Vars;
+			NV5 = Table.NumX5Vars;
+			NUMPT = Table.InterpolationOrder;
 			THREEDVALS.allocate( NV5, NV4, NV3 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
 				for ( IV4 = 1; IV4 <= NV4; ++IV4 ) {
 					for ( IV3 = 1; IV3 <= NV3; ++IV3 ) {
-						THREEDVALS( IV5, IV4, IV3 ) = DLAG( V1, V2, VALSX, VALSY, TableLookup( TableIndex ).TableLookupZData( IV5, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
+						THREEDVALS( IV5, IV4, IV3 ) = DLAG( V1, V2, Table.X1Var, Table.X2Var, Table.TableLookupZData( IV5, IV4, IV3, _, _ ), NX, NY, NUMPT, IEXTX, IEXTY );
 					}
 				}
 			}
 			TWODVALS.allocate( 1, NV5 );
 			for ( IV5 = 1; IV5 <= NV5; ++IV5 ) {
-				TWODVALS( 1, IV5 ) = DLAG( V3, V4, VALSV3, VALSV4, THREEDVALS( IV5, _, _ ), NV3, NV4, NUMPT, IEXTX, IEXTY );
+				TWODVALS( 1, IV5 ) = DLAG( V3, V4, Table.X3Var, Table.X4Var, THREEDVALS( IV5, _, _ ), NV3, NV4, NUMPT, IEXTX, IEXTY );
 			}
 			if ( NV5 == 1 ) {
 				TableValue = TWODVALS( 1, 1 );
 			} else {
-				TableValue = DLAG( V5, 1.0, VALSV5, VALSV5, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
-			}
-			TWODVALS.deallocate();
-			THREEDVALS.deallocate();
-			VALSX.deallocate();
-			VALSY.deallocate();
-			VALSV3.deallocate();
-			VALSV4.deallocate();
-			VALSV5.deallocate();
+				TableValue = DLAG( V5, 1.0, Table.X5Var, Table.X5Var, TWODVALS, NV5, 1, NUMPT, IEXTV5, IEXTV4 );
+			}
 		} else {
 			TableValue = 0.0;
 			ShowSevereError( "Errors found in table output calculation for " + PerfCurve( CurveIndex ).Name );
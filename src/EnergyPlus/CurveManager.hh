@@ -244,13 +244,43 @@ namespace CurveManager {
 		Array1D< Real64 > X1;
 		Array1D< Real64 > X2;
 		Array2D< Real64 > Y;
+		// regular grid description derived from X1/X2 by CompilePerformanceTable
+		bool GridCompiled; // TRUE once the grid members below describe X1 and X2
+		bool X1Ascending; // X1 is strictly increasing (bracket search may use bisection)
+		bool X2Ascending; // X2 is strictly increasing (bracket search may use bisection)
+		Real64 X1Min; // minimum value in X1
+		Real64 X1Max; // maximum value in X1
+		Real64 X2Min; // minimum value in X2
+		Real64 X2Max; // maximum value in X2
+		int X1Bracket; // lower bracket index found by the last X1 search (search hint)
+		int X2Bracket; // lower bracket index found by the last X2 search (search hint)
 
 		// Default Constructor
-		PerfCurveTableDataStruct()
+		PerfCurveTableDataStruct() :
+			GridCompiled( false ),
+			X1Ascending( false ),
+			X2Ascending( false ),
+			X1Min( 0.0 ),
+			X1Max( 0.0 ),
+			X2Min( 0.0 ),
+			X2Max( 0.0 ),
+			X1Bracket( 1 ),
+			X2Bracket( 1 )
 		{}
 
 	};
 
+	struct PerfomanceCurveData;
+
+	// Fixed-arity evaluation kernel for a regression curve (independent variables already limited)
+	typedef Real64 ( *CurveKernelFunction )(
+		PerfomanceCurveData const & Curve,
+		Real64 const V1,
+		Real64 const V2,
+		Real64 const V3,
+		Real64 const V4
+	);
+
 	struct PerfomanceCurveData
 	{
 		// Members
@@ -311,6 +341,9 @@ namespace CurveManager {
 		Real64 CurveInput3; // curve input #1 (e.g., z or X3 variable)
 		Real64 CurveInput4; // curve input #1 (e.g., X4 variable)
 		Real64 CurveInput5; // curve input #1 (e.g., X5 variable)
+		// compiled evaluation
+		int KernelCurveType; // CurveType the kernel below was selected for (-1 if not yet selected)
+		CurveKernelFunction Kernel; // evaluation kernel selected from CurveType by CompilePerformanceCurve
 
 		// Default Constructor
 		PerfomanceCurveData() :
@@ -367,7 +400,9 @@ namespace CurveManager {
 			CurveInput2( 0.0 ),
 			CurveInput3( 0.0 ),
 			CurveInput4( 0.0 ),
-			CurveInput5( 0.0 )
+			CurveInput5( 0.0 ),
+			KernelCurveType( -1 ),
+			Kernel( nullptr )
 		{}
 
 	};
@@ -430,12 +465,38 @@ namespace CurveManager {
 		Optional< Real64 const > Var5 = _ // 5th independent variable
 	);
 
+	void
+	CurveValues(
+		int const CurveIndex, // index of curve in curve array
+		Array1S< Real64 > const Var1, // 1st independent variable at each point
+		Array1S< Real64 > Result, // curve value at each point
+		Optional< Array1S< Real64 > const > Var2 = _, // 2nd independent variable at each point
+		Optional< Array1S< Real64 > const > Var3 = _ // 3rd independent variable at each point
+	);
+
 	void
 	GetCurveInput();
 
 	void
 	GetCurveInputData( bool & ErrorsFound );
 
+	void
+	CompilePerformanceCurves();
+
+	void
+	CompilePerformanceCurve( PerfomanceCurveData & Curve );
+
+	void
+	CompilePerformanceTable( PerfCurveTableDataStruct & Table );
+
+	int
+	FindTableBracket(
+		Real64 const V, // value to bracket (already limited to the range of X)
+		Array1D< Real64 > const & X, // table independent variable values
+		bool const Ascending, // X is strictly increasing
+		int & Bracket // search hint in, lower bracket index out
+	);
+
 	void
 	InitCurveReporting();
 
@@ -10482,6 +10482,126 @@ Label50: ;
 
 	}
 
+	void
+	CalcDXCoilFullLoadPerformance( DXCoilOperatingPointData & Point ) // operating point to evaluate
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the full load coil bypass factor, total capacity, sensible heat ratio and energy
+		// input ratio modifiers of a DX cooling coil at an operating point.
+
+		// METHODOLOGY EMPLOYED:
+		// AdjustCBF, CalcTotCapSHR and the EIR modifier curves, as called by the coil models.
+
+		// Using/Aliasing
+		using CurveManager::CurveValue;
+
+		// Adjust coil bypass factor for actual air flow rate
+		Point.CBF = AdjustCBF( Point.RatedCBF, Point.RatedAirMassFlowRate, Point.AirMassFlow );
+
+		CalcTotCapSHR( Point.InletDryBulb, Point.InletHumRat, Point.InletEnthalpy, Point.InletWetBulb, Point.AirMassFlowRatio, Point.AirMassFlow, Point.RatedTotCap, Point.CBF, Point.CCapFTemp, Point.CCapFFlow, Point.TotCap, Point.SHR, Point.CondInletTemp, Point.Pressure );
+
+		Point.EIRTempModFac = CurveValue( Point.EIRFTemp, Point.InletWetBulb, Point.CondInletTemp );
+		Point.EIRFlowModFac = CurveValue( Point.EIRFFlow, Point.AirMassFlowRatio );
+		Point.Evaluated = true;
+
+	}
+
+	void
+	SetMultiSpeedDXCoilOperatingPoint(
+		int const DXCoilNum, // index of the multispeed DX cooling coil
+		int const SpeedNum, // speed number
+		Real64 const AirMassFlow, // air mass flow rate for the bypass factor, capacity and SHR [kg/s]
+		Real64 const AirMassFlowRatio, // ratio of air mass flow to rated air mass flow for the flow curves
+		Real64 const InletDryBulb, // inlet air dry bulb temperature [C]
+		Real64 const InletHumRat, // inlet air humidity ratio [kg water / kg dry air]
+		Real64 const InletEnthalpy, // inlet air specific enthalpy [J/kg]
+		Real64 const InletWetBulb, // inlet air wet bulb temperature [C]
+		Real64 const CondInletTemp, // condenser inlet temperature [C]
+		Real64 const Pressure, // air pressure [Pa]
+		DXCoilOperatingPointData & Point // operating point
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Fills an operating point with the performance data of one speed of a multispeed DX cooling
+		// coil and the given operating conditions.
+
+		Point.RatedTotCap = DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNum );
+		Point.RatedCBF = DXCoil( DXCoilNum ).MSRatedCBF( SpeedNum );
+		Point.RatedAirMassFlowRate = DXCoil( DXCoilNum ).MSRatedAirMassFlowRate( SpeedNum );
+		Point.CCapFTemp = DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNum );
+		Point.CCapFFlow = DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNum );
+		Point.EIRFTemp = DXCoil( DXCoilNum ).MSEIRFTemp( SpeedNum );
+		Point.EIRFFlow = DXCoil( DXCoilNum ).MSEIRFFlow( SpeedNum );
+		Point.InletDryBulb = InletDryBulb;
+		Point.InletHumRat = InletHumRat;
+		Point.InletEnthalpy = InletEnthalpy;
+		Point.InletWetBulb = InletWetBulb;
+		Point.AirMassFlow = AirMassFlow;
+		Point.AirMassFlowRatio = AirMassFlowRatio;
+		Point.CondInletTemp = CondInletTemp;
+		Point.Pressure = Pressure;
+		Point.Evaluated = false;
+
+	}
+
+	void
+	CalcMultiSpeedDXCoilFullLoadPerformance(
+		int const DXCoilNum, // index of the multispeed DX cooling coil
+		int const SpeedNum, // speed number of the point
+		DXCoilOperatingPointData & Point // operating point to evaluate
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Calculates the full load performance of a multispeed DX cooling coil at the given speed,
+		// reusing the performance last calculated at that speed when the operating point is unchanged.
+
+		// METHODOLOGY EMPLOYED:
+		// The full load performance at a speed only depends on the inlet air and condenser conditions
+		// and the air flow rate at that speed, not on the speed or cycling ratio, so it does not change
+		// between the calls made by the speed ratio solvers of the parent within a time step. The last
+		// point calculated at each speed is kept in DXCoil%MSFullLoadPerformance. Points using an EMS
+		// overridden curve are always calculated.
+
+		// Using/Aliasing
+		using CurveManager::PerfCurve;
+
+		if ( DXCoil( DXCoilNum ).MSFullLoadPerformance.isize() != DXCoil( DXCoilNum ).NumOfSpeeds ) {
+			DXCoil( DXCoilNum ).MSFullLoadPerformance.allocate( DXCoil( DXCoilNum ).NumOfSpeeds );
+		}
+
+		auto & Last( DXCoil( DXCoilNum ).MSFullLoadPerformance( SpeedNum ) );
+		bool const Overridden( PerfCurve( Point.CCapFTemp ).EMSOverrideOn || PerfCurve( Point.CCapFFlow ).EMSOverrideOn || PerfCurve( Point.EIRFTemp ).EMSOverrideOn || PerfCurve( Point.EIRFFlow ).EMSOverrideOn );
+		if ( Last.Evaluated && ! Overridden && Last.RatedTotCap == Point.RatedTotCap && Last.RatedCBF == Point.RatedCBF && Last.RatedAirMassFlowRate == Point.RatedAirMassFlowRate && Last.CCapFTemp == Point.CCapFTemp && Last.CCapFFlow == Point.CCapFFlow && Last.EIRFTemp == Point.EIRFTemp && Last.EIRFFlow == Point.EIRFFlow && Last.InletDryBulb == Point.InletDryBulb && Last.InletHumRat == Point.InletHumRat && Last.InletEnthalpy == Point.InletEnthalpy && Last.InletWetBulb == Point.InletWetBulb && Last.AirMassFlow == Point.AirMassFlow && Last.AirMassFlowRatio == Point.AirMassFlowRatio && Last.CondInletTemp == Point.CondInletTemp && Last.Pressure == Point.Pressure ) {
+			Point = Last;
+			return;
+		}
+
+		CalcDXCoilFullLoadPerformance( Point );
+		Last = Point;
+
+	}
+
 	void
 	CalcMultiSpeedDXCoilCooling(
 		int const DXCoilNum, // the number of the DX heating coil to be simulated
@@ -10498,6 +10618,7 @@ Label50: ;
 		//       AUTHOR         Lixing Gu, FSEC
 		//       DATE WRITTEN   June 2007
 		//       MODIFIED       April 2010, Chandan sharma, FSEC, added basin heater
+		//                      Oct 2026, reuse the full load performance of each speed at unchanged conditions
 		//       RE-ENGINEERED  Revised based on CalcMultiSpeedDXCoil
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -10565,9 +10686,7 @@ Label50: ;
 		Real64 tADP; // Apparatus dew point temperature [C]
 		Real64 wADP; // Apparatus dew point humidity ratio [kg/kg]
 		Real64 hTinwADP; // Enthalpy at inlet dry-bulb and wADP [J/kg]
-		Real64 RatedCBFHS; // coil bypass factor at rated conditions (high speed)
 		Real64 CBFHS; // coil bypass factor at max flow (high speed)
-		Real64 RatedCBFLS; // coil bypass factor at rated conditions (low speed)
 		Real64 CBFLS; // coil bypass factor at max flow (low speed)
 		Real64 TotCapHS; // total capacity at high speed [W]
 		Real64 SHRHS; // sensible heat ratio at high speed
@@ -10613,6 +10732,8 @@ Label50: ;
 		Real64 Hfg;
 		Real64 AirVolumeFlowRate; // Air volume flow rate across the heating coil
 		Real64 VolFlowperRatedTotCap; // Air volume flow rate divided by rated total heating capacity
+		DXCoilOperatingPointData FullLoadPointLS; // full load operating point at the low speed
+		DXCoilOperatingPointData FullLoadPointHS; // full load operating point at the high speed
 
 		if ( DXCoil( DXCoilNum ).CondenserInletNodeNum( DXMode ) != 0 ) {
 			OutdoorPressure = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( DXMode ) ).Press;
@@ -10742,13 +10863,16 @@ Label50: ;
 					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues...", DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
-				// Adjust high speed coil bypass factor for actual maximum air flow rate.
-				RatedCBFHS = DXCoil( DXCoilNum ).MSRatedCBF( SpeedNumHS );
-				CBFHS = AdjustCBF( RatedCBFHS, DXCoil( DXCoilNum ).MSRatedAirMassFlowRate( SpeedNumHS ), MSHPMassFlowRateHigh );
-				RatedCBFLS = DXCoil( DXCoilNum ).MSRatedCBF( SpeedNumLS );
-				CBFLS = AdjustCBF( RatedCBFLS, DXCoil( DXCoilNum ).MSRatedAirMassFlowRate( SpeedNumLS ), MSHPMassFlowRateLow );
-				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioLS, MSHPMassFlowRateLow, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumLS ), CBFLS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNumLS ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNumLS ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+				// get low and high speed total capacity, SHR and EIR modifiers at current conditions, with the
+				// coil bypass factors adjusted for the actual air flow rates
+				SetMultiSpeedDXCoilOperatingPoint( DXCoilNum, SpeedNumLS, MSHPMassFlowRateLow, AirMassFlowRatioLS, InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, CondInletTemp, OutdoorPressure, FullLoadPointLS );
+				CalcMultiSpeedDXCoilFullLoadPerformance( DXCoilNum, SpeedNumLS, FullLoadPointLS );
+				SetMultiSpeedDXCoilOperatingPoint( DXCoilNum, SpeedNumHS, MSHPMassFlowRateHigh, AirMassFlowRatioHS, InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, CondInletTemp, OutdoorPressure, FullLoadPointHS );
+				CalcMultiSpeedDXCoilFullLoadPerformance( DXCoilNum, SpeedNumHS, FullLoadPointHS );
+				CBFLS = FullLoadPointLS.CBF;
+				TotCapLS = FullLoadPointLS.TotCap;
+				CBFHS = FullLoadPointHS.CBF;
+				TotCapHS = FullLoadPointHS.TotCap;
 				// get low speed outlet conditions
 				hDelta = TotCapLS / MSHPMassFlowRateLow;
 				// Calculate new apparatus dew point conditions
@@ -10780,9 +10904,7 @@ Label50: ;
 					LSOutletAirHumRat = PsyWFnTdbH( LSOutletAirDryBulbTemp, LSOutletAirEnthalpy, RoutineName );
 				}
 
-				// get high speed total capacity and SHR at current conditions
-
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioHS, MSHPMassFlowRateHigh, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumHS ), CBFHS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNumHS ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNumHS ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
+				// get high speed outlet conditions
 				hDelta = TotCapHS / MSHPMassFlowRateHigh;
 				// Calculate new apparatus dew point conditions
 				hADP = InletAirEnthalpy - hDelta / ( 1.0 - CBFHS );
@@ -10845,12 +10967,12 @@ Label50: ;
 				}
 
 				// get high speed EIR at current conditions
-				EIRTempModFacHS = CurveValue( DXCoil( DXCoilNum ).MSEIRFTemp( SpeedNumHS ), InletAirWetBulbC, CondInletTemp );
-				EIRFlowModFacHS = CurveValue( DXCoil( DXCoilNum ).MSEIRFFlow( SpeedNumHS ), AirMassFlowRatioHS );
+				EIRTempModFacHS = FullLoadPointHS.EIRTempModFac;
+				EIRFlowModFacHS = FullLoadPointHS.EIRFlowModFac;
 				EIRHS = 1.0 / DXCoil( DXCoilNum ).MSRatedCOP( SpeedNumHS ) * EIRFlowModFacHS * EIRTempModFacHS;
 				// get low speed EIR at current conditions
-				EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).MSEIRFTemp( SpeedNumLS ), InletAirWetBulbC, CondInletTemp );
-				EIRFlowModFacLS = CurveValue( DXCoil( DXCoilNum ).MSEIRFFlow( SpeedNumLS ), AirMassFlowRatioLS );
+				EIRTempModFacLS = FullLoadPointLS.EIRTempModFac;
+				EIRFlowModFacLS = FullLoadPointLS.EIRFlowModFac;
 				EIRLS = 1.0 / DXCoil( DXCoilNum ).MSRatedCOP( SpeedNumLS ) * EIRTempModFacLS * EIRFlowModFacLS;
 
 				// get current total capacity, SHR, EIR
@@ -10972,13 +11094,12 @@ Label50: ;
 					CondInletHumRat = PsyWFnTdbTwbPb( CondInletTemp, OutdoorWetBulb, OutdoorPressure, RoutineName );
 				}
 
-				RatedCBFLS = DXCoil( DXCoilNum ).MSRatedCBF( SpeedNum );
-				CBFLS = AdjustCBF( RatedCBFLS, DXCoil( DXCoilNum ).MSRatedAirMassFlowRate( SpeedNum ), MSHPMassFlowRateHigh );
-
 				// Adjust low speed coil bypass factor for actual flow rate.
 				// CBF = AdjustCBF(DXCoil(DXCoilNum)%RatedCBF2,DXCoil(DXCoilNum)%RatedAirMassFlowRate2,AirMassFlow)
 				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioLS, MSHPMassFlowRateHigh, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNum ), CBFLS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNum ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNum ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+				SetMultiSpeedDXCoilOperatingPoint( DXCoilNum, SpeedNum, MSHPMassFlowRateHigh, AirMassFlowRatioLS, InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, CondInletTemp, OutdoorPressure, FullLoadPointLS );
+				CalcMultiSpeedDXCoilFullLoadPerformance( DXCoilNum, SpeedNum, FullLoadPointLS );
+				TotCapLS = FullLoadPointLS.TotCap;
 				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
 				//  Node(DXCoil(DXCoilNum)%AirInNode)%Press)
 				hDelta = TotCapLS / AirMassFlow;
@@ -11061,8 +11182,8 @@ Label50: ;
 				OutletAirHumRat = LSOutletAirHumRat;
 				OutletAirDryBulbTemp = LSOutletAirDryBulbTemp;
 				// get low speed EIR at current conditions
-				EIRTempModFacLS = CurveValue( DXCoil( DXCoilNum ).MSEIRFTemp( SpeedNum ), InletAirWetBulbC, CondInletTemp );
-				EIRFlowModFacLS = CurveValue( DXCoil( DXCoilNum ).MSEIRFFlow( SpeedNum ), AirMassFlowRatioLS );
+				EIRTempModFacLS = FullLoadPointLS.EIRTempModFac;
+				EIRFlowModFacLS = FullLoadPointLS.EIRFlowModFac;
 				EIRLS = 1.0 / DXCoil( DXCoilNum ).MSRatedCOP( SpeedNum ) * EIRTempModFacLS * EIRFlowModFacLS;
 
 				// get the eletrical power consumption
@@ -61,6 +61,7 @@
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array1S.hh>
 #include <ObjexxFCL/Optional.hh>
 
 // EnergyPlus Headers
@@ -184,6 +185,61 @@ namespace DXCoils {
 
 	// Types
 
+	struct DXCoilOperatingPointData
+	{
+		// Members
+		// Coil performance data for this point (one speed or mode of one coil)
+		Real64 RatedTotCap; // rated total cooling capacity [W]
+		Real64 RatedCBF; // rated coil bypass factor
+		Real64 RatedAirMassFlowRate; // air mass flow rate at rated conditions [kg/s]
+		int CCapFTemp; // index of total cooling capacity modifier curve (function of temperature)
+		int CCapFFlow; // index of total cooling capacity modifier curve (function of flow fraction)
+		int EIRFTemp; // index of energy input ratio modifier curve (function of temperature)
+		int EIRFFlow; // index of energy input ratio modifier curve (function of flow fraction)
+		// Operating conditions
+		Real64 InletDryBulb; // inlet air dry bulb temperature [C]
+		Real64 InletHumRat; // inlet air humidity ratio [kg water / kg dry air]
+		Real64 InletEnthalpy; // inlet air specific enthalpy [J/kg]
+		Real64 InletWetBulb; // inlet air wet bulb temperature [C]
+		Real64 AirMassFlow; // air mass flow rate for the bypass factor, capacity and SHR [kg/s]
+		Real64 AirMassFlowRatio; // ratio of air mass flow to rated air mass flow for the flow curves
+		Real64 CondInletTemp; // condenser inlet temperature [C]
+		Real64 Pressure; // air pressure [Pa]
+		// Full load performance
+		Real64 CBF; // coil bypass factor adjusted for AirMassFlow
+		Real64 TotCap; // total cooling capacity [W]
+		Real64 SHR; // sensible heat ratio
+		Real64 EIRTempModFac; // EIR modifier (function of entering wetbulb, outside drybulb)
+		Real64 EIRFlowModFac; // EIR modifier (function of actual supply air flow vs rated flow)
+		bool Evaluated; // TRUE once the full load performance has been calculated
+
+		// Default Constructor
+		DXCoilOperatingPointData() :
+			RatedTotCap( 0.0 ),
+			RatedCBF( 0.0 ),
+			RatedAirMassFlowRate( 0.0 ),
+			CCapFTemp( 0 ),
+			CCapFFlow( 0 ),
+			EIRFTemp( 0 ),
+			EIRFFlow( 0 ),
+			InletDryBulb( 0.0 ),
+			InletHumRat( 0.0 ),
+			InletEnthalpy( 0.0 ),
+			InletWetBulb( 0.0 ),
+			AirMassFlow( 0.0 ),
+			AirMassFlowRatio( 0.0 ),
+			CondInletTemp( 0.0 ),
+			Pressure( 0.0 ),
+			CBF( 0.0 ),
+			TotCap( 0.0 ),
+			SHR( 0.0 ),
+			EIRTempModFac( 0.0 ),
+			EIRFlowModFac( 0.0 ),
+			Evaluated( false )
+		{}
+
+	};
+
 	struct DXCoilData
 	{
 		// Members
@@ -504,6 +560,7 @@ namespace DXCoils {
 		int MSSpeedNumHS; // current high speed number of multspeed HP
 		Real64 MSSpeedRatio; // current speed ratio of multspeed HP
 		Real64 MSCycRatio; // current cycling ratio of multspeed HP
+		Array1D< DXCoilOperatingPointData > MSFullLoadPerformance; // last full load performance calculated at each speed
 
 		//The following members are for VRF Coils (FluidTCtrl Model)
 		int VRFIUPtr; // index to the VRF Indoor Unit where the coil is placed
@@ -957,6 +1014,31 @@ namespace DXCoils {
 		Real64 const Pressure // air pressure [Pa]
 	);
 
+	void
+	CalcDXCoilFullLoadPerformance( DXCoilOperatingPointData & Point ); // operating point to evaluate
+
+	void
+	SetMultiSpeedDXCoilOperatingPoint(
+		int const DXCoilNum, // index of the multispeed DX cooling coil
+		int const SpeedNum, // speed number
+		Real64 const AirMassFlow, // air mass flow rate for the bypass factor, capacity and SHR [kg/s]
+		Real64 const AirMassFlowRatio, // ratio of air mass flow to rated air mass flow for the flow curves
+		Real64 const InletDryBulb, // inlet air dry bulb temperature [C]
+		Real64 const InletHumRat, // inlet air humidity ratio [kg water / kg dry air]
+		Real64 const InletEnthalpy, // inlet air specific enthalpy [J/kg]
+		Real64 const InletWetBulb, // inlet air wet bulb temperature [C]
+		Real64 const CondInletTemp, // condenser inlet temperature [C]
+		Real64 const Pressure, // air pressure [Pa]
+		DXCoilOperatingPointData & Point // operating point
+	);
+
+	void
+	CalcMultiSpeedDXCoilFullLoadPerformance(
+		int const DXCoilNum, // index of the multispeed DX cooling coil
+		int const SpeedNum, // speed number of the point
+		DXCoilOperatingPointData & Point // operating point to evaluate
+	);
+
 	void
 	CalcMultiSpeedDXCoilCooling(
 		int const DXCoilNum, // the number of the DX heating coil to be simulated
@@ -95,8 +95,8 @@ namespace DataAirLoop {
 	extern Real64 LoopSystemOnMassFlowrate; // Loop mass flow rate during on cycle using an OnOff fan
 	extern Real64 LoopSystemOffMassFlowrate; // Loop mass flow rate during off cycle using an OnOff fan
 	extern Real64 LoopOnOffFanPartLoadRatio; // OnOff fan part load ratio
-	extern Real64 LoopHeatingCoilMaxRTF; // Maximum run time fraction for electric or gas heating coil in an HVAC Air Loop
-	extern Real64 LoopOnOffFanRTF; // OnOff fan run time fraction in an HVAC Air Loop
+	extern thread_local Real64 LoopHeatingCoilMaxRTF; // Maximum run time fraction for electric or gas heating coil in an HVAC Air Loop
+	extern thread_local Real64 LoopOnOffFanRTF; // OnOff fan run time fraction in an HVAC Air Loop
 	extern Real64 LoopDXCoilRTF; // OnOff fan run time fraction in an HVAC Air Loop
 	extern Real64 LoopCompCycRatio; // Loop compressor cycling ratio for multispeed heat pump
 
@@ -56,6 +56,9 @@
 // computer software, distribute, and sublicense such enhancements or derivative works thereof,
 // in binary and source code form.
 
+// C++ Headers
+#include <algorithm>
+
 // EnergyPlus Headers
 #include <DataBSDFWindow.hh>
 #include <DataGlobals.hh>
@@ -134,6 +137,136 @@ namespace DataBSDFWindow {
 	// Object Data
 	Array1D< BSDFWindowGeomDescr > ComplexWind; // Window geometry structure: set in CalcPerSolarBeam/SolarShading
 
+	// Functions
+
+	Real64
+	BSDFSparseMatrix::operator ()( int const i, int const j ) const
+	{
+		auto const first( ColIndex.begin() + RowStart[ i - 1 ] );
+		auto const last( ColIndex.begin() + RowStart[ i ] );
+		auto const pos( std::lower_bound( first, last, j ) );
+		if ( ( pos == last ) || ( *pos != j ) ) return 0.0;
+		return Value[ pos - ColIndex.begin() ];
+	}
+
+	Real64
+	BSDFSparseMatrix::rowDot( int const i, Array1< Real64 > const & W ) const
+	{
+		Real64 Sum( 0.0 );
+		for ( int k = RowStart[ i - 1 ], e = RowStart[ i ]; k < e; ++k ) {
+			Sum += W( ColIndex[ k ] ) * Value[ k ];
+		}
+		return Sum;
+	}
+
+	Real64
+	BSDFSparseMatrix::rowSum( int const i ) const
+	{
+		Real64 Sum( 0.0 );
+		for ( int k = RowStart[ i - 1 ], e = RowStart[ i ]; k < e; ++k ) {
+			Sum += Value[ k ];
+		}
+		return Sum;
+	}
+
+	void
+	CompressBSDFMatrix(
+		Array2< Real64 > const & Dense, // Dense property matrix as read from input
+		BSDFSparseMatrix & Sparse // Compressed matrix
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Store a BSDF property matrix in compressed row form so that a construction does not carry
+		// NBasis x NBasis dense arrays for each of its four property matrices.
+
+		// METHODOLOGY EMPLOYED:
+		// Exact zeros are dropped; all other elements are kept unchanged, so products over the
+		// compressed matrix equal the dense ones.
+
+		Sparse.NRows = Dense.isize1();
+		Sparse.NCols = Dense.isize2();
+		Sparse.RowStart.assign( Sparse.NRows + 1, 0 );
+		Sparse.ColIndex.clear();
+		Sparse.Value.clear();
+
+		for ( int i = 1; i <= Sparse.NRows; ++i ) {
+			for ( int j = 1; j <= Sparse.NCols; ++j ) {
+				Real64 const Val( Dense( Dense.l1() + i - 1, Dense.l2() + j - 1 ) );
+				if ( Val == 0.0 ) continue;
+				Sparse.ColIndex.push_back( j );
+				Sparse.Value.push_back( Val );
+			}
+			Sparse.RowStart[ i ] = static_cast< int >( Sparse.Value.size() );
+		}
+		Sparse.ColIndex.shrink_to_fit();
+		Sparse.Value.shrink_to_fit();
+
+	}
+
+	void
+	CalcBSDFLamdaSums(
+		BSDFWindowInputStruct & BSDFInput, // Construction BSDF input
+		Array1< Real64 > const & Lamda // Basis projected solid angles
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Precompute the Lamda-weighted row and column sums of the property matrices that the
+		// static and beam property calculations of every state using this construction need.
+
+		// METHODOLOGY EMPLOYED:
+		// One pass over the stored elements of each matrix.  As elsewhere in the complex fenestration
+		// calculation, the incident and outgoing bases are assumed to be the same.
+
+		int const NBasis( Lamda.isize() );
+
+		BSDFInput.SolFrtTransLamdaRow.dimension( NBasis, 0.0 );
+		BSDFInput.SolFrtTransLamdaCol.dimension( NBasis, 0.0 );
+		BSDFInput.VisFrtTransLamdaCol.dimension( NBasis, 0.0 );
+		BSDFInput.SolBkReflLamdaRow.dimension( NBasis, 0.0 );
+		BSDFInput.VisBkReflLamdaRow.dimension( NBasis, 0.0 );
+
+		BSDFSparseMatrix const & SolFrtTrans( BSDFInput.SolFrtTrans );
+		for ( int i = 1; i <= std::min( SolFrtTrans.NRows, NBasis ); ++i ) {
+			for ( int k = SolFrtTrans.RowStart[ i - 1 ], e = SolFrtTrans.RowStart[ i ]; k < e; ++k ) {
+				int const j( SolFrtTrans.ColIndex[ k ] );
+				if ( j > NBasis ) continue;
+				BSDFInput.SolFrtTransLamdaRow( i ) += Lamda( j ) * SolFrtTrans.Value[ k ];
+				BSDFInput.SolFrtTransLamdaCol( j ) += Lamda( i ) * SolFrtTrans.Value[ k ];
+			}
+		}
+
+		BSDFSparseMatrix const & VisFrtTrans( BSDFInput.VisFrtTrans );
+		for ( int i = 1; i <= std::min( VisFrtTrans.NRows, NBasis ); ++i ) {
+			for ( int k = VisFrtTrans.RowStart[ i - 1 ], e = VisFrtTrans.RowStart[ i ]; k < e; ++k ) {
+				int const j( VisFrtTrans.ColIndex[ k ] );
+				if ( j > NBasis ) continue;
+				BSDFInput.VisFrtTransLamdaCol( j ) += Lamda( i ) * VisFrtTrans.Value[ k ];
+			}
+		}
+
+		for ( int i = 1; i <= std::min( BSDFInput.SolBkRefl.NRows, NBasis ); ++i ) {
+			BSDFInput.SolBkReflLamdaRow( i ) = BSDFInput.SolBkRefl.rowDot( i, Lamda );
+		}
+		for ( int i = 1; i <= std::min( BSDFInput.VisBkRefl.NRows, NBasis ); ++i ) {
+			BSDFInput.VisBkReflLamdaRow( i ) = BSDFInput.VisBkRefl.rowDot( i, Lamda );
+		}
+
+	}
+
 } // DataBSDFWindow
 
 } // EnergyPlus
@@ -64,6 +64,9 @@
 #include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array3D.hh>
 
+// C++ Headers
+#include <vector>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 #include <DataVectorTypes.hh>
@@ -433,6 +436,45 @@ namespace DataBSDFWindow {
 
 	};
 
+	struct BSDFSparseMatrix
+	{
+		// Compressed row storage of a BSDF property matrix.  Klems matrices are mostly zero
+		// (axisymmetric input is purely diagonal), so only nonzero elements are kept.
+		// Element access keeps the 1-based ( row, column ) indexing of the dense input matrix.
+		// Members
+		int NRows; // No. rows in matrix
+		int NCols; // No. columns in matrix
+		std::vector< int > RowStart; // Offset of the first stored element of each row (size NRows + 1)
+		std::vector< int > ColIndex; // Column of each stored element
+		std::vector< Real64 > Value; // Value of each stored element
+
+		// Default Constructor
+		BSDFSparseMatrix() :
+			NRows( 0 ),
+			NCols( 0 )
+		{}
+
+		// Element ( i, j ), zero when not stored
+		Real64
+		operator ()( int const i, int const j ) const;
+
+		// Sum over row i of W( j ) * A( i, j )
+		Real64
+		rowDot( int const i, Array1< Real64 > const & W ) const;
+
+		// Sum over row i of A( i, j )
+		Real64
+		rowSum( int const i ) const;
+
+		// Number of stored elements
+		int
+		nonZeros() const
+		{
+			return static_cast< int >( Value.size() );
+		}
+
+	};
+
 	struct BSDFWindowInputStruct
 	{
 		// Members
@@ -448,23 +490,29 @@ namespace DataBSDFWindow {
 		int SolFrtTransIndex; // pointer to matrix for Front optical transmittance matrix
 		int SolFrtTransNrows; // No. rows in matrix
 		int SolFrtTransNcols; // No. columns in matrix
-		Array2D< Real64 > SolFrtTrans; // Front optical transmittance matrix
+		BSDFSparseMatrix SolFrtTrans; // Front optical transmittance matrix
 		int SolBkReflIndex; // pointer to matrix for Back optical reflectance matrix
 		int SolBkReflNrows; // No. rows in matrix
 		int SolBkReflNcols; // No. columns in matrix
-		Array2D< Real64 > SolBkRefl; // Back optical reflectance matrix
+		BSDFSparseMatrix SolBkRefl; // Back optical reflectance matrix
 		int VisFrtTransIndex; // pointer to matrix for Front visible transmittance matrix
 		int VisFrtTransNrows; // No. rows in matrix
 		int VisFrtTransNcols; // No. columns in matrix
-		Array2D< Real64 > VisFrtTrans; // Front visible transmittance matrix
+		BSDFSparseMatrix VisFrtTrans; // Front visible transmittance matrix
 		int VisBkReflIndex; // pointer to matrix for Back visible reflectance matrix
 		int VisBkReflNrows; // No. rows in matrix
 		int VisBkReflNcols; // No. columns in matrix
-		Array2D< Real64 > VisBkRefl; // Back visible reflectance matrix
+		BSDFSparseMatrix VisBkRefl; // Back visible reflectance matrix
 		//INTEGER   :: ThermalConstruction  !Pointer to location in Construct array of thermal construction for the state
 		// (to be implemented)
 		int NumLayers;
 		Array1D< BSDFLayerAbsorpStruct > Layer;
+		// Basis-weighted sums of the property matrices, computed once per construction by CalcBSDFLamdaSums
+		Array1D< Real64 > SolFrtTransLamdaRow; // Sum over M of Lamda( M ) * SolFrtTrans( I, M )
+		Array1D< Real64 > SolFrtTransLamdaCol; // Sum over M of Lamda( M ) * SolFrtTrans( M, J )
+		Array1D< Real64 > VisFrtTransLamdaCol; // Sum over M of Lamda( M ) * VisFrtTrans( M, J )
+		Array1D< Real64 > SolBkReflLamdaRow; // Sum over J of Lamda( J ) * SolBkRefl( I, J )
+		Array1D< Real64 > VisBkReflLamdaRow; // Sum over J of Lamda( J ) * VisBkRefl( I, J )
 
 		// Default Constructor
 		BSDFWindowInputStruct() :
@@ -495,6 +543,20 @@ namespace DataBSDFWindow {
 	// Object Data
 	extern Array1D< BSDFWindowGeomDescr > ComplexWind; // Window geometry structure: set in CalcPerSolarBeam/SolarShading
 
+	// Functions
+
+	void
+	CompressBSDFMatrix(
+		Array2< Real64 > const & Dense, // Dense property matrix as read from input
+		BSDFSparseMatrix & Sparse // Compressed matrix
+	);
+
+	void
+	CalcBSDFLamdaSums(
+		BSDFWindowInputStruct & BSDFInput, // Construction BSDF input
+		Array1< Real64 > const & Lamda // Basis projected solid angles
+	);
+
 } // DataBSDFWindow
 
 } // EnergyPlus
@@ -338,25 +338,25 @@ namespace DataHVACGlobals {
 	int NumElecCircuits( 0 ); // Number of electric circuits specified in simulation
 	int NumGasMeters( 0 ); // Number of gas meters specified in simulation
 	int NumPrimaryAirSys( 0 ); // Number of primary HVAC air systems
-	Real64 FanElecPower( 0.0 ); // fan power from last fan simulation
+	thread_local Real64 FanElecPower( 0.0 ); // fan power from last fan simulation
 	Real64 OnOffFanPartLoadFraction( 1.0 ); // fan part-load fraction (Fan:OnOff)
 	Real64 DXCoilTotalCapacity( 0.0 ); // DX coil total cooling capacity (eio report var for HPWHs)
 	Real64 DXElecCoolingPower( 0.0 ); // Electric power consumed by DX cooling coil last DX simulation
 	Real64 DXElecHeatingPower( 0.0 ); // Electric power consumed by DX heating coil last DX simulation
-	Real64 ElecHeatingCoilPower( 0.0 ); // Electric power consumed by electric heating coil
+	thread_local Real64 ElecHeatingCoilPower( 0.0 ); // Electric power consumed by electric heating coil
 	Real64 AirToAirHXElecPower( 0.0 ); // Electric power consumed by Heat Exchanger:Air To Air (Generic or Flat Plate)
 	// from last simulation in HeatRecovery.cc
 	Real64 UnbalExhMassFlow( 0.0 ); // unbalanced zone exhaust from a zone equip component [kg/s]
 	Real64 BalancedExhMassFlow( 0.0 ); // balanced zone exhaust (declared as so by user)  [kg/s]
 	Real64 PlenumInducedMassFlow( 0.0 ); // secondary air mass flow rate induced from a return plenum [kg/s]
-	bool TurnFansOn( false ); // If true overrides fan schedule and cycles fans on
+	thread_local bool TurnFansOn( false ); // If true overrides fan schedule and cycles fans on
 	bool TurnZoneFansOnlyOn(false); // If true overrides zone fan schedule and cycles fans on (currently used only by parallel powered induction unit)
-	bool TurnFansOff( false ); // If True overides fan schedule and TurnFansOn and forces fans off
+	thread_local bool TurnFansOff( false ); // If True overides fan schedule and TurnFansOn and forces fans off
 	bool ZoneCompTurnFansOn( false ); // If true overrides fan schedule and cycles fans on
 	bool ZoneCompTurnFansOff( false ); // If True overides fan schedule and TurnFansOn and forces fans off
 	bool SetPointErrorFlag( false ); // True if any needed setpoints not set; if true, program terminates
 	bool DoSetPointTest( false ); // True one time only for sensed node setpoint test
-	bool NightVentOn( false ); // set TRUE in SimAirServingZone if night ventilation is happening
+	thread_local bool NightVentOn( false ); // set TRUE in SimAirServingZone if night ventilation is happening
 
 	int NumTempContComps( 0 );
 	Real64 HPWHInletDBTemp( 0.0 ); // Used by curve objects when calculating DX coil performance for HEAT PUMP:WATER HEATER
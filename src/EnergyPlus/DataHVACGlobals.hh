@@ -327,25 +327,25 @@ namespace DataHVACGlobals {
 	extern int NumElecCircuits; // Number of electric circuits specified in simulation
 	extern int NumGasMeters; // Number of gas meters specified in simulation
 	extern int NumPrimaryAirSys; // Number of primary HVAC air systems
-	extern Real64 FanElecPower; // fan power from last fan simulation
+	extern thread_local Real64 FanElecPower; // fan power from last fan simulation
 	extern Real64 OnOffFanPartLoadFraction; // fan part-load fraction (Fan:OnOff)
 	extern Real64 DXCoilTotalCapacity; // DX coil total cooling capacity (eio report var for HPWHs)
 	extern Real64 DXElecCoolingPower; // Electric power consumed by DX cooling coil last DX simulation
 	extern Real64 DXElecHeatingPower; // Electric power consumed by DX heating coil last DX simulation
-	extern Real64 ElecHeatingCoilPower; // Electric power consumed by electric heating coil
+	extern thread_local Real64 ElecHeatingCoilPower; // Electric power consumed by electric heating coil
 	extern Real64 AirToAirHXElecPower; // Electric power consumed by Heat Exchanger:Air To Air (Generic or Flat Plate)
 	// from last simulation in HeatRecovery.cc
 	extern Real64 UnbalExhMassFlow; // unbalanced zone exhaust from a zone equip component [kg/s]
 	extern Real64 BalancedExhMassFlow; // balanced zone exhaust (declared as so by user)  [kg/s]
 	extern Real64 PlenumInducedMassFlow; // secondary air mass flow rate induced from a return plenum [kg/s]
-	extern bool TurnFansOn; // If true overrides fan schedule and cycles fans on
+	extern thread_local bool TurnFansOn; // If true overrides fan schedule and cycles fans on
 	extern bool TurnZoneFansOnlyOn; // If true overrides zone fan schedule and cycles fans on (currently used only by parallel powered induction unit)
-	extern bool TurnFansOff; // If True overides fan schedule and TurnFansOn and forces fans off
+	extern thread_local bool TurnFansOff; // If True overides fan schedule and TurnFansOn and forces fans off
 	extern bool ZoneCompTurnFansOn; // If true overrides fan schedule and cycles fans on
 	extern bool ZoneCompTurnFansOff; // If True overides fan schedule and TurnFansOn and forces fans off
 	extern bool SetPointErrorFlag; // True if any needed setpoints not set; if true, program terminates
 	extern bool DoSetPointTest; // True one time only for sensed node setpoint test
-	extern bool NightVentOn; // set TRUE in SimAirServingZone if night ventilation is happening
+	extern thread_local bool NightVentOn; // set TRUE in SimAirServingZone if night ventilation is happening
 
 	extern int NumTempContComps;
 	extern Real64 HPWHInletDBTemp; // Used by curve objects when calculating DX coil performance for HEAT PUMP:WATER HEATER
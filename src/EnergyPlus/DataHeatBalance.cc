@@ -453,6 +453,7 @@ namespace DataHeatBalance {
 	bool AnyConstructInternalSourceInInput( false ); // true if the user has entered any constructions with internal sources
 	bool AdaptiveComfortRequested_CEN15251( false ); // true if people objects have adaptive comfort requests. CEN15251
 	bool AdaptiveComfortRequested_ASH55( false ); // true if people objects have adaptive comfort requests. ASH55
+	bool ZoneIntGainSumsCurrent( false ); // true when ZoneIntGainSums holds the current gain rates of all the devices
 	int NumRefrigeratedRacks( 0 ); // Total number of refrigerated case compressor racks in input
 	int NumRefrigSystems( 0 ); // Total number of detailed refrigeration systems in input
 	int NumRefrigCondensers( 0 ); // Total number of detailed refrigeration condensers in input
@@ -634,6 +635,7 @@ namespace DataHeatBalance {
 	Array1D< ZonePreDefRepType > ZonePreDefRep;
 	ZonePreDefRepType BuildingPreDefRep; //Autodesk:Note Removed explicit constructor that was missing some entries
 	Array1D< ZoneSimData > ZoneIntGain;
+	Array2D< ZoneIntGainSumsData > ZoneIntGainSums; // Device gain rates by type (0 for all types) and zone
 	Array1D< MaterialProperties > Material;
 	Array1D< GapSupportPillar > SupportPillar;
 	Array1D< GapDeflectionState > DeflectionState;
@@ -774,6 +776,7 @@ namespace DataHeatBalance {
 		AnyConstructInternalSourceInInput = false;
 		AdaptiveComfortRequested_CEN15251 = false;
 		AdaptiveComfortRequested_ASH55 = false;
+		ZoneIntGainSumsCurrent = false;
 		NumRefrigeratedRacks = 0;
 		NumRefrigSystems = 0;
 		NumRefrigCondensers = 0;
@@ -890,6 +893,7 @@ namespace DataHeatBalance {
 		ZonePreDefRep.deallocate();
 		BuildingPreDefRep = ZonePreDefRepType();
 		ZoneIntGain.deallocate();
+		ZoneIntGainSums.deallocate();
 		Material.deallocate();
 		SupportPillar.deallocate();
 		DeflectionState.deallocate();
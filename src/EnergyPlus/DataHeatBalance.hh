@@ -435,6 +435,7 @@ namespace DataHeatBalance {
 	extern bool AnyConstructInternalSourceInInput; // true if the user has entered any constructions with internal sources
 	extern bool AdaptiveComfortRequested_CEN15251; // true if people objects have adaptive comfort requests. CEN15251
 	extern bool AdaptiveComfortRequested_ASH55; // true if people objects have adaptive comfort requests. ASH55
+	extern bool ZoneIntGainSumsCurrent; // true when ZoneIntGainSums holds the current gain rates of all the devices
 	extern int NumRefrigeratedRacks; // Total number of refrigerated case compressor racks in input
 	extern int NumRefrigSystems; // Total number of detailed refrigeration systems in input
 	extern int NumRefrigCondensers; // Total number of detailed refrigeration condensers in input
@@ -2298,6 +2299,30 @@ namespace DataHeatBalance {
 
 	};
 
+	struct ZoneIntGainSumsData // Gain rates of the internal gain devices of a zone, summed
+	{
+		// Members
+		Real64 ConvectGainRate; // convection heat gain rate, watts
+		Real64 ReturnAirConvGainRate; // return air convection heat gain rate, W
+		Real64 RadiantGainRate; // thermal radiation heat gain rate, watts
+		Real64 LatentGainRate; // moisture gain rate, Watts
+		Real64 ReturnAirLatentGainRate; // return air moisture gain rate, Watts
+		Real64 CarbonDioxideGainRate; // carbon dioxide gain rate
+		Real64 GenericContamGainRate; // generic contaminant gain rate
+
+		// Default Constructor
+		ZoneIntGainSumsData() :
+			ConvectGainRate( 0.0 ),
+			ReturnAirConvGainRate( 0.0 ),
+			RadiantGainRate( 0.0 ),
+			LatentGainRate( 0.0 ),
+			ReturnAirLatentGainRate( 0.0 ),
+			CarbonDioxideGainRate( 0.0 ),
+			GenericContamGainRate( 0.0 )
+		{}
+
+	};
+
 	struct ZoneSimData // Calculated data by Zone during each time step/hour
 	{
 		// Members
@@ -3325,6 +3350,7 @@ namespace DataHeatBalance {
 	extern Array1D< ZonePreDefRepType > ZonePreDefRep;
 	extern ZonePreDefRepType BuildingPreDefRep; //Autodesk:Note Removed explicit constructor that was missing some entries
 	extern Array1D< ZoneSimData > ZoneIntGain;
+	extern Array2D< ZoneIntGainSumsData > ZoneIntGainSums; // Device gain rates by type (0 for all types) and zone
 	extern Array1D< MaterialProperties > Material;
 	extern Array1D< GapSupportPillar > SupportPillar;
 	extern Array1D< GapDeflectionState > DeflectionState;
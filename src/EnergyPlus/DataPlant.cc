@@ -405,6 +405,7 @@ namespace DataPlant {
 
 	int PlantManageSubIterations( 0 ); // tracks plant iterations to characterize solver
 	int PlantManageHalfLoopCalls( 0 ); // tracks number of half loop calls
+	int PlantManageCalls( 0 ); // number of calls to ManagePlantLoops, tells saved branch states apart
 
 	// two-way common pipe variables
 	//REAL(r64),SAVE,ALLOCATABLE,DIMENSION(:)    :: CurSecCPLegFlow    !Mass flow rate in primary common pipe leg
@@ -463,6 +464,7 @@ namespace DataPlant {
 		LoadChangeDownStream.deallocate();
 		PlantManageSubIterations = 0;
 		PlantManageHalfLoopCalls = 0;
+		PlantManageCalls = 0;
 		Pipe.deallocate();
 		PlantLoop.deallocate();
 		PlantAvailMgr.deallocate();
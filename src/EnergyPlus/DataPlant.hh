@@ -418,6 +418,7 @@ namespace DataPlant {
 
 	extern int PlantManageSubIterations; // tracks plant iterations to characterize solver
 	extern int PlantManageHalfLoopCalls; // tracks number of half loop calls
+	extern int PlantManageCalls; // number of calls to ManagePlantLoops, tells saved branch states apart
 
 	// two-way common pipe variables
 	//REAL(r64),SAVE,ALLOCATABLE,DIMENSION(:)    :: CurSecCPLegFlow    !Mass flow rate in primary common pipe leg
@@ -635,6 +636,21 @@ namespace DataPlant {
 
 	};
 
+	struct BranchSimStateData
+	{
+		// Members
+		int PlantManageCall; // ManagePlantLoops call in which the states were saved (0 if none saved)
+		Array1D< DataLoopNode::NodeData > NodesBefore; // component inlet and outlet nodes before the components were simulated
+		Array1D< DataLoopNode::NodeData > NodesAfter; // component inlet and outlet nodes after the components were simulated
+		Array1D< Real64 > MyLoad; // component loads before the components were simulated
+
+		// Default Constructor
+		BranchSimStateData() :
+			PlantManageCall( 0 )
+		{}
+
+	};
+
 	struct BranchData
 	{
 		// Members
@@ -660,6 +676,7 @@ namespace DataPlant {
 		int PressureCurveType; // Either none, pressure curve, or generic curve
 		int PressureCurveIndex; // Curve: index for pressure drop calculations
 		Real64 PressureEffectiveK;
+		Array1D< BranchSimStateData > SimState; // States of the last simulation of the branch, by FlowLock + 1
 
 		// Default Constructor
 		BranchData() :
@@ -682,7 +699,8 @@ namespace DataPlant {
 			PressureDrop( 0.0 ),
 			PressureCurveType( 0 ),
 			PressureCurveIndex( 0 ),
-			PressureEffectiveK( 0.0 )
+			PressureEffectiveK( 0.0 ),
+			SimState( 2 )
 		{}
 
 		// Max abs of Comp array MyLoad values //Autodesk:Tuned For replacement of any( abs( Comp.MyLoad() > SmallLoad ) usage
@@ -1136,6 +1154,7 @@ namespace DataPlant {
 		Real64 OutletNodeFlowrate; // Debug Variable
 		Real64 OutletNodeTemperature; // Debug Variable
 		int LastLoopSideSimulated;
+		int SkippedCompSimulations; // component simulations skipped on unchanged branches
 
 		// Default Constructor
 		ReportVars() :
@@ -1149,7 +1168,8 @@ namespace DataPlant {
 			InletNodeTemperature( 0.0 ),
 			OutletNodeFlowrate( 0.0 ),
 			OutletNodeTemperature( 0.0 ),
-			LastLoopSideSimulated( 0 )
+			LastLoopSideSimulated( 0 ),
+			SkippedCompSimulations( 0 )
 		{}
 
 	};
@@ -216,11 +216,11 @@ namespace DataSizing {
 	int NumZoneSizingInput( 0 ); // Number of Zone Sizing objects
 	int NumSysSizInput( 0 ); // Number of System Sizing objects
 	int NumPltSizInput( 0 ); // Number of Plant Sizing objects
-	int CurSysNum( 0 ); // Current Air System index (0 if not in air loop)
+	thread_local int CurSysNum( 0 ); // Current Air System index (0 if not in air loop)
 	int CurOASysNum( 0 ); // Current outside air system index (0 if not in OA Sys)
 	int CurZoneEqNum( 0 ); // Current Zone Equipment index (0 if not simulating ZoneEq)
-	int CurBranchNum( 0 ); // Index of branch being simulated (or 0 if not air loop)
-	int CurDuctType( 0 ); // Duct type of current branch
+	thread_local int CurBranchNum( 0 ); // Index of branch being simulated (or 0 if not air loop)
+	thread_local int CurDuctType( 0 ); // Duct type of current branch
 	int CurLoopNum( 0 ); // the current plant loop index
 	int CurCondLoopNum( 0 ); // the current condenser loop number
 	int CurEnvirNumSimDay( 0 ); // current environment number for day simulated
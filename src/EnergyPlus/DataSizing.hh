@@ -206,11 +206,11 @@ namespace DataSizing {
 	extern int NumZoneSizingInput; // Number of Zone Sizing objects
 	extern int NumSysSizInput; // Number of System Sizing objects
 	extern int NumPltSizInput; // Number of Plant Sizing objects
-	extern int CurSysNum; // Current Air System index (0 if not in air loop)
+	extern thread_local int CurSysNum; // Current Air System index (0 if not in air loop)
 	extern int CurOASysNum; // Current outside air system index (0 if not in OA Sys)
 	extern int CurZoneEqNum; // Current Zone Equipment index (0 if not simulating ZoneEq)
-	extern int CurBranchNum; // Index of branch being simulated (or 0 if not air loop)
-	extern int CurDuctType; // Duct type of current branch
+	extern thread_local int CurBranchNum; // Index of branch being simulated (or 0 if not air loop)
+	extern thread_local int CurDuctType; // Duct type of current branch
 	extern int CurLoopNum; // the current plant loop index
 	extern int CurCondLoopNum; // the current condenser loop number
 	extern int CurEnvirNumSimDay; // current environment number for day simulated
@@ -141,9 +141,14 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	std::string const TraceHVACControllerEnvVar( "TRACE_HVACCONTROLLER" ); // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	std::string const ParallelAirLoopsEnvVar( "PARALLEL_AIRLOOPS" ); // To simulate independent air loops concurrently
+	std::string const SkipUnchangedPlantBranchesEnvVar( "SKIP_UNCHANGED_PLANT_BRANCHES" ); // To reuse plant branch results when nothing changed
+	std::string const ParallelPlantLoopsEnvVar( "PARALLEL_PLANTLOOPS" ); // To simulate independent plant loops concurrently
+	std::string const WindowResponseTablesEnvVar( "WINDOW_RESPONSE_TABLES" ); // To start bare glazing heat balances from a precomputed response
 
 	std::string const MinReportFrequencyEnvVar( "MINREPORTFREQUENCY" ); // environment var for reporting frequency.
 	std::string const cDisplayInputInAuditEnvVar( "DISPLAYINPUTINAUDIT" ); // environmental variable that enables the echoing of the input file into the audit file
+	std::string const EPNumThreadsEnvVar( "EP_OMP_NUM_THREADS" ); // Number of threads for parallel calculations
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -166,6 +171,14 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	bool TraceHVACControllerEnvFlag( false ); // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	bool ParallelAirLoopsEnvFlag( false ); // If TRUE air loops without shared state are simulated concurrently
+	// (see SimAirServingZones::SimAirLoops)
+	bool SkipUnchangedPlantBranchesEnvFlag( false ); // If TRUE plant branches with unchanged states are not resimulated
+	// (see PlantLoopSolver::SimulateLoopSideBranchGroup)
+	bool ParallelPlantLoopsEnvFlag( false ); // If TRUE groups of plant loops without shared state are simulated concurrently
+	// (see PlantManager::ManagePlantLoops)
+	bool WindowResponseTablesEnvFlag( false ); // If TRUE bare glazing heat balances start from a precomputed response
+	// (see WindowManager::SolveForWindowTemperatures)
 	bool ReportDuringWarmup( false ); // True when the report outputs even during warmup
 	bool ReportDuringHVACSizingSimulation( false ); // true when reporting outputs during HVAC sizing Simulation
 	bool ReportDetailedWarmupConvergence( false ); // True when the detailed warmup convergence is requested
@@ -193,6 +206,7 @@ namespace DataSystemVariables {
 	bool lnumActiveSims( false );
 	int MaxNumberOfThreads( 1 );
 	int NumberIntRadThreads( 1 );
+	int NumberParallelThreads( 1 ); // Number of threads used by parallel loops (see ParallelFor.hh)
 	int iNominalTotSurfaces( 0 );
 	bool Threading( false );
 
@@ -110,9 +110,14 @@ namespace DataSystemVariables {
 	// solutions of all controllers on each air loop at each call to SimAirLoop()
 	extern std::string const TraceHVACControllerEnvVar; // To generate a trace file for
 	//  each individual HVAC controller with all controller iterations
+	extern std::string const ParallelAirLoopsEnvVar; // To simulate independent air loops concurrently
+	extern std::string const SkipUnchangedPlantBranchesEnvVar; // To reuse plant branch results when nothing changed
+	extern std::string const ParallelPlantLoopsEnvVar; // To simulate independent plant loops concurrently
+	extern std::string const WindowResponseTablesEnvVar; // To start bare glazing heat balances from a precomputed response
 
 	extern std::string const MinReportFrequencyEnvVar; // environment var for reporting frequency.
 	extern std::string const cDisplayInputInAuditEnvVar; // environmental variable that enables the echoing of the input file into the audit file
+	extern std::string const EPNumThreadsEnvVar; // Number of threads for parallel calculations
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -135,6 +140,10 @@ namespace DataSystemVariables {
 	// HVAC controllers on each air loop at each call to SimAirLoop()
 	extern bool TraceHVACControllerEnvFlag; // If TRUE generates a trace file for each individual HVAC
 	// controller with all controller iterations
+	extern bool ParallelAirLoopsEnvFlag; // If TRUE air loops without shared state are simulated concurrently
+	extern bool SkipUnchangedPlantBranchesEnvFlag; // If TRUE plant branches with unchanged states are not resimulated
+	extern bool ParallelPlantLoopsEnvFlag; // If TRUE groups of plant loops without shared state are simulated concurrently
+	extern bool WindowResponseTablesEnvFlag; // If TRUE bare glazing heat balances start from a precomputed response
 	extern bool ReportDuringWarmup; // True when the report outputs even during warmup
 	extern bool ReportDuringHVACSizingSimulation; // true when reporting outputs during HVAC sizing Simulation
 	extern bool ReportDetailedWarmupConvergence; // True when the detailed warmup convergence is requested
@@ -162,6 +171,7 @@ namespace DataSystemVariables {
 	extern bool lnumActiveSims;
 	extern int MaxNumberOfThreads;
 	extern int NumberIntRadThreads;
+	extern int NumberParallelThreads; // Number of threads used by parallel loops (see ParallelFor.hh)
 	extern int iNominalTotSurfaces;
 	extern bool Threading;
 
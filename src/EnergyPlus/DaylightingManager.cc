@@ -60,6 +60,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <mutex>
 #include <string>
 
 // ObjexxFCL Headers
@@ -96,11 +97,12 @@
 #include <InternalHeatGains.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <ParallelFor.hh>
 #include <PierceSurface.hh>
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
 #include <SQLiteProcedures.hh>
-#include <SurfaceOctree.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WindowComplexManager.hh>
@@ -173,27 +175,16 @@ namespace DaylightingManager {
 	// MODULE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
 
-	// Surface count crossover for using octree algorithm
-	// The octree gives lower computational complexity for much higher performance
-	//  as the surface count increases but has some overhead such that the direct
-	//  algorithm can be more efficient at small surface counts.
-	// Testing to date shows that the octree performance is close to that of the
-	//  direct algorithm even with small surface counts and that there is no single
-	//  crossover that is ideal for all models: some cases with 10-30 surfaces were
-	//  faster with the octree but another with 80 surfaces was faster with the
-	//  direct algorithm.
-	// A reasonable, conservative crossover is selected but may be refined as more
-	//  experience is gained.
-	int const octreeCrossover( 100 ); // Octree surface count crossover
-
 	// MODULE VARIABLE DECLARATIONS:
 	int TotWindowsWithDayl( 0 ); // Total number of exterior windows in all daylit zones
 	int OutputFileDFS( 0 ); // Unit number for daylight factors
 	Array1D< Real64 > DaylIllum( MaxRefPoints, 0.0 ); // Daylight illuminance at reference points (lux)
-	Real64 PHSUN( 0.0 ); // Solar altitude (radians)
-	Real64 SPHSUN( 0.0 ); // Sine of solar altitude
-	Real64 CPHSUN( 0.0 ); // Cosine of solar altitude
-	Real64 THSUN( 0.0 ); // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+	// The sun angles and the EINTSK through AVWLSUdisk arrays below are per-point scratch for the daylighting
+	// factor calculation: they are thread_local so that points can be processed concurrently (see ParallelFor)
+	thread_local Real64 PHSUN( 0.0 ); // Solar altitude (radians)
+	thread_local Real64 SPHSUN( 0.0 ); // Sine of solar altitude
+	thread_local Real64 CPHSUN( 0.0 ); // Cosine of solar altitude
+	thread_local Real64 THSUN( 0.0 ); // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
 	Array1D< Real64 > PHSUNHR( 24, 0.0 ); // Hourly values of PHSUN
 	Array1D< Real64 > SPHSUNHR( 24, 0.0 ); // Hourly values of the sine of PHSUN
 	Array1D< Real64 > CPHSUNHR( 24, 0.0 ); // Hourly values of the cosine of PHSUN
@@ -203,24 +194,24 @@ namespace DaylightingManager {
 	// I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
 	// J = 1 for bare window, 2 - 12 for shaded;
 	// K = sun position index.
-	Array3D< Real64 > EINTSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related portion of internally reflected illuminance
-	Array2D< Real64 > EINTSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance,
+	thread_local Array3D< Real64 > EINTSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related portion of internally reflected illuminance
+	thread_local Array2D< Real64 > EINTSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance,
 	// excluding entering beam
-	Array2D< Real64 > EINTSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance
+	thread_local Array2D< Real64 > EINTSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related portion of internally reflected illuminance
 	// due to entering beam
-	Array3D< Real64 > WLUMSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related window luminance
-	Array2D< Real64 > WLUMSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, excluding view of solar disk
-	Array2D< Real64 > WLUMSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, due to view of solar disk
+	thread_local Array3D< Real64 > WLUMSK( 24, MaxSlatAngs+1, 4, 0.0 ); // Sky-related window luminance
+	thread_local Array2D< Real64 > WLUMSU( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, excluding view of solar disk
+	thread_local Array2D< Real64 > WLUMSUdisk( 24, MaxSlatAngs+1, 0.0 ); // Sun-related window luminance, due to view of solar disk
 
 	Array2D< Real64 > GILSK( 24, 4, 0.0 ); // Horizontal illuminance from sky, by sky type, for each hour of the day
 	Array1D< Real64 > GILSU( 24, 0.0 ); // Horizontal illuminance from sun for each hour of the day
 
-	Array3D< Real64 > EDIRSK( 24, MaxSlatAngs+1, 4 ); // Sky-related component of direct illuminance
-	Array2D< Real64 > EDIRSU( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-	Array2D< Real64 > EDIRSUdisk( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance due to beam solar at ref pt
-	Array3D< Real64 > AVWLSK( 24, MaxSlatAngs+1, 4 ); // Sky-related average window luminance
-	Array2D< Real64 > AVWLSU( 24, MaxSlatAngs+1 ); // Sun-related average window luminance, excluding view of solar disk
-	Array2D< Real64 > AVWLSUdisk( 24, MaxSlatAngs+1 ); // Sun-related average window luminance due to view of solar disk
+	thread_local Array3D< Real64 > EDIRSK( 24, MaxSlatAngs+1, 4 ); // Sky-related component of direct illuminance
+	thread_local Array2D< Real64 > EDIRSU( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+	thread_local Array2D< Real64 > EDIRSUdisk( 24, MaxSlatAngs+1 ); // Sun-related component of direct illuminance due to beam solar at ref pt
+	thread_local Array3D< Real64 > AVWLSK( 24, MaxSlatAngs+1, 4 ); // Sky-related average window luminance
+	thread_local Array2D< Real64 > AVWLSU( 24, MaxSlatAngs+1 ); // Sun-related average window luminance, excluding view of solar disk
+	thread_local Array2D< Real64 > AVWLSUdisk( 24, MaxSlatAngs+1 ); // Sun-related average window luminance due to view of solar disk
 
 	// Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -972,72 +963,14 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Vector3< Real64 > W2; // Second vertex of window
-		static Vector3< Real64 > W3; // Third vertex of window
-		static Vector3< Real64 > W21; // Vector from window vertex 2 to window vertex 1
-		static Vector3< Real64 > W23; // Vector from window vertex 2 to window vertex 3
-		static Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
-		static Vector3< Real64 > RREF2; // Location of virtual reference point in absolute coordinate system
-		static Vector3< Real64 > RWIN; // Center of a window element in absolute coordinate system
-		static Vector3< Real64 > RWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static Vector3< Real64 > Ray; // Unit vector along ray from reference point to window element
-		static Vector3< Real64 > WNORM2; // Unit vector normal to TDD:DOME (if exists)
-		static Vector3< Real64 > VIEWVC; // View vector in absolute coordinate system
-		static Vector3< Real64 > U2; // Second vertex of window for TDD:DOME (if exists)
-		static Vector3< Real64 > U21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static Vector3< Real64 > U23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-//		static Vector2< Real64 > ZF; // Fraction of zone controlled by each reference point //Unused
-
-		static Vector3< Real64 > VIEWVC2; // Virtual view vector in absolute coordinate system
-		int IHR; // Hour of day counter
+		Vector3< Real64 > VIEWVC; // View vector in absolute coordinate system
 		int NRF; // Number of daylighting reference points in a zone
 		int IL; // Reference point counter
 		Real64 AZVIEW; // Azimuth of view vector in absolute coord system for
 		//  glare calculation (radians)
-		int IConst; // Construction counter
-		int ICtrl; // Window control counter
-		int IWin; // Window counter
-		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
-		int InShelfSurf; // Inside daylighting shelf surface number
-		int ShType; // Window shading type
-		int BlNum; // Window Blind Number
-		int LSHCAL; // Interior shade calculation flag: 0=not yet
-		//  calculated, 1=already calculated
-		int NWX; // Number of window elements in x direction for dayltg calc
-		int NWY; // Number of window elements in y direction for dayltg calc
-		int NWYlim; // For triangle, largest NWY for a given IX
-		int IX; // Counter for window elements in the x direction
-		int IY; // Counter for window elements in the y direction
-		Real64 COSB; // Cosine of angle between window outward normal and ray from
-		//  reference point to window element
-		Real64 PHRAY; // Altitude of ray from reference point to window element (radians)
-		Real64 THRAY; // Azimuth of ray from reference point to window element (radians)
-		Real64 DOMEGA; // Solid angle subtended by window element wrt reference point (steradians)
-		Real64 TVISB; // Visible transmittance of window for COSB angle of incidence (times light well
-		//   efficiency, if appropriate)
-		int ISunPos; // Sun position counter; used to avoid calculating various
-		//  quantities that do not depend on sun position.
-		Real64 ObTrans; // Product of solar transmittances of exterior obstructions hit by ray
-		// from reference point through a window element
-		int loopwin; // loop index for exterior windows associated with a daylit zone
-		bool is_Rectangle; // True if window is rectangular
-		bool is_Triangle; // True if window is triangular
-		Real64 DWX; // Horizontal dimension of window element (m)
-		Real64 DWY; // Vertical dimension of window element (m)
-		Real64 DAXY; // Area of window element
-		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
-		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
 		static bool refFirstTime( true );
-		int BRef;
-		int ILB;
-		bool hitIntObs; // True iff interior obstruction hit
-		bool hitExtObs; // True iff ray from ref pt to ext win hits an exterior obstruction
-		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
-		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
 		static bool MySunIsUpFlag( false );
 
-		int WinEl; // Current window element
-
 		if ( refFirstTime && std::any_of( ZoneDaylight.begin(), ZoneDaylight.end(), []( ZoneDaylightCalc const & e ){ return e.TotalDaylRefPoints > 0; } ) ) {
 			RefErrIndex.allocate( maxval( ZoneDaylight, &ZoneDaylightCalc::TotalDaylRefPoints ), TotSurfaces );
 			RefErrIndex = 0;
@@ -1084,99 +1017,200 @@ namespace DaylightingManager {
 		}
 
 		NRF = ZoneDaylight( ZoneNum ).TotalDaylRefPoints;
-		BRef = 0;
 
-		for ( IL = 1; IL <= NRF; ++IL ) {
-			// Reference point in absolute coordinate system
-			RREF = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
+		// The first point also sets the point-independent window properties; the remaining points only write
+		// to their own slots of the daylight factor arrays and can be processed concurrently
+		if ( NRF > 0 ) CalcDayltgCoeffsAtRefPoint( ZoneNum, 1, AZVIEW, VIEWVC, MySunIsUpFlag );
+		if ( CanCalcDayltgCoeffsConcurrently( ZoneNum ) ) {
+			ParallelFor( 2, NRF, [&]( int const iRefPoint ){ CalcDayltgCoeffsAtRefPoint( ZoneNum, iRefPoint, AZVIEW, VIEWVC, MySunIsUpFlag ); } );
+		} else {
+			for ( IL = 2; IL <= NRF; ++IL ) {
+				CalcDayltgCoeffsAtRefPoint( ZoneNum, IL, AZVIEW, VIEWVC, MySunIsUpFlag );
+			}
+		}
 
-			//           -------------
-			// ---------- WINDOW LOOP ----------
-			//           -------------
-			for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+	}
 
-				FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForRefPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, is_Rectangle, is_Triangle );
-				//           ---------------------
-				// ---------- WINDOW ELEMENT LOOP ----------
-				//           ---------------------
+	void
+	CalcDayltgCoeffsAtRefPoint(
+		int const ZoneNum,
+		int const IL, // Reference point number
+		Real64 const AZVIEW, // Azimuth of view vector in absolute coord system for glare calculation (radians)
+		Vector3< Real64 > const & VIEWVC, // View vector in absolute coordinate system
+		bool & MySunIsUpFlag // Sun-up state carried between calls for detailed timestep integration
+	)
+	{
 
-				WinEl = 0;
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda Lawrie
+		//       DATE WRITTEN   April 2012
+		//       MODIFIED       October 2026, broken out of CalcDayltgCoeffsRefPoints
+		//       RE-ENGINEERED  na
 
-				for ( IX = 1; IX <= NWX; ++IX ) {
-					if ( is_Rectangle ) {
-						NWYlim = NWY;
-					} else if ( is_Triangle ) {
-						NWYlim = NWY - IX + 1;
-					}
+		// PURPOSE OF THIS SUBROUTINE:
+		// Provides calculations for Daylighting Coefficients for one daylighting reference point
 
-					for ( IY = 1; IY <= NWYlim; ++IY ) {
+		// METHODOLOGY EMPLOYED:
+		// Loops over the zone's windows, window elements and sun positions for this point. Only this
+		// point's slots of the ZoneDaylight factor arrays are written and the sun angle and illuminance
+		// scratch variables are thread_local, so different points may be processed concurrently
 
-						++WinEl;
+		// REFERENCES:
+		// na
 
-						FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForRefPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, WNORM2, ExtWinType, IConst, RREF2, is_Triangle, TVISIntWin, TVISIntWinDisk );
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataEnvironment::SunIsUp;
 
-						//           -------------------
-						// ---------- SUN POSITION LOOP ----------
-						//           -------------------
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-						// Sun position counter. Used to avoid calculating various quantities
-						// that do not depend on sun position.
+		Vector3< Real64 > W2; // Second vertex of window
+		Vector3< Real64 > W3; // Third vertex of window
+		Vector3< Real64 > W21; // Vector from window vertex 2 to window vertex 1
+		Vector3< Real64 > W23; // Vector from window vertex 2 to window vertex 3
+		Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
+		Vector3< Real64 > RREF2; // Location of virtual reference point in absolute coordinate system
+		Vector3< Real64 > RWIN; // Center of a window element in absolute coordinate system
+		Vector3< Real64 > RWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		Vector3< Real64 > Ray; // Unit vector along ray from reference point to window element
+		Vector3< Real64 > WNORM2; // Unit vector normal to TDD:DOME (if exists)
+		Vector3< Real64 > U2; // Second vertex of window for TDD:DOME (if exists)
+		Vector3< Real64 > U21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		Vector3< Real64 > U23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+
+		Vector3< Real64 > VIEWVC2; // Virtual view vector in absolute coordinate system
+		int IHR; // Hour of day counter
+		int IConst; // Construction counter
+		int ICtrl; // Window control counter
+		int IWin; // Window counter
+		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
+		int InShelfSurf; // Inside daylighting shelf surface number
+		int ShType; // Window shading type
+		int BlNum; // Window Blind Number
+		int LSHCAL; // Interior shade calculation flag: 0=not yet
+		//  calculated, 1=already calculated
+		int NWX; // Number of window elements in x direction for dayltg calc
+		int NWY; // Number of window elements in y direction for dayltg calc
+		int NWYlim; // For triangle, largest NWY for a given IX
+		int IX; // Counter for window elements in the x direction
+		int IY; // Counter for window elements in the y direction
+		Real64 COSB; // Cosine of angle between window outward normal and ray from
+		//  reference point to window element
+		Real64 PHRAY; // Altitude of ray from reference point to window element (radians)
+		Real64 THRAY; // Azimuth of ray from reference point to window element (radians)
+		Real64 DOMEGA; // Solid angle subtended by window element wrt reference point (steradians)
+		Real64 TVISB; // Visible transmittance of window for COSB angle of incidence (times light well
+		//   efficiency, if appropriate)
+		int ISunPos; // Sun position counter; used to avoid calculating various
+		//  quantities that do not depend on sun position.
+		Real64 ObTrans; // Product of solar transmittances of exterior obstructions hit by ray
+		// from reference point through a window element
+		int loopwin; // loop index for exterior windows associated with a daylit zone
+		bool is_Rectangle; // True if window is rectangular
+		bool is_Triangle; // True if window is triangular
+		Real64 DWX; // Horizontal dimension of window element (m)
+		Real64 DWY; // Vertical dimension of window element (m)
+		Real64 DAXY; // Area of window element
+		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
+		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
+		int ILB;
+		bool hitIntObs; // True iff interior obstruction hit
+		bool hitExtObs; // True iff ray from ref pt to ext win hits an exterior obstruction
+		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
+		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
 
-						if ( ! DetailedSolarTimestepIntegration ) {
-							ISunPos = 0;
-							for ( IHR = 1; IHR <= 24; ++IHR ) {
-
-								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
-
-							} // End of hourly sun position loop, IHR
-						} else { //timestep integrated
-							if ( SunIsUp && ! MySunIsUpFlag ) {
-								ISunPos = 0;
-								MySunIsUpFlag = true;
-							} else if ( SunIsUp && MySunIsUpFlag ) {
-								ISunPos = 1;
-							} else if ( ! SunIsUp && MySunIsUpFlag ) {
-								MySunIsUpFlag = false;
-								ISunPos = -1;
-							} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
-								ISunPos = -1;
-							}
+		int WinEl; // Current window element
 
-							FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
-						}
+		// Reference point in absolute coordinate system
+		RREF = ZoneDaylight( ZoneNum ).DaylRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
 
-					} // End of window Y-element loop, IY
-				} // End of window X-element loop, IX
+		//           -------------
+		// ---------- WINDOW LOOP ----------
+		//           -------------
+		for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
 
-				// Loop again over hourly sun positions and calculate daylight factors by adding
-				// direct and inter-reflected illum components, then dividing by exterior horiz illum.
-				// Also calculate corresponding glare factors.
+			FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForRefPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, is_Rectangle, is_Triangle );
+			//           ---------------------
+			// ---------- WINDOW ELEMENT LOOP ----------
+			//           ---------------------
 
-				ILB = BRef + IL;
+			WinEl = 0;
 
-				if ( ! DetailedSolarTimestepIntegration ) {
-					ISunPos = 0;
-					for ( IHR = 1; IHR <= 24; ++IHR ) {
-						FigureRefPointDayltgFactorsToAddIllums( ZoneNum, ILB, IHR, ISunPos, IWin, loopwin, NWX, NWY, ICtrl );
+			for ( IX = 1; IX <= NWX; ++IX ) {
+				if ( is_Rectangle ) {
+					NWYlim = NWY;
+				} else if ( is_Triangle ) {
+					NWYlim = NWY - IX + 1;
+				}
 
-					} // End of sun position loop, IHR
-				} else {
-					if ( SunIsUp && ! MySunIsUpFlag ) {
+				for ( IY = 1; IY <= NWYlim; ++IY ) {
+
+					++WinEl;
+
+					FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForRefPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, WNORM2, ExtWinType, IConst, RREF2, is_Triangle, TVISIntWin, TVISIntWinDisk );
+
+					//           -------------------
+					// ---------- SUN POSITION LOOP ----------
+					//           -------------------
+
+					// Sun position counter. Used to avoid calculating various quantities
+					// that do not depend on sun position.
+
+					if ( ! DetailedSolarTimestepIntegration ) {
 						ISunPos = 0;
-						MySunIsUpFlag = true;
-					} else if ( SunIsUp && MySunIsUpFlag ) {
-						ISunPos = 1;
-					} else if ( ! SunIsUp && MySunIsUpFlag ) {
-						MySunIsUpFlag = false;
-						ISunPos = -1;
-					} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
-						ISunPos = -1;
+						for ( IHR = 1; IHR <= 24; ++IHR ) {
+
+							FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
+
+						} // End of hourly sun position loop, IHR
+					} else { //timestep integrated
+						if ( SunIsUp && ! MySunIsUpFlag ) {
+							ISunPos = 0;
+							MySunIsUpFlag = true;
+						} else if ( SunIsUp && MySunIsUpFlag ) {
+							ISunPos = 1;
+						} else if ( ! SunIsUp && MySunIsUpFlag ) {
+							MySunIsUpFlag = false;
+							ISunPos = -1;
+						} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
+							ISunPos = -1;
+						}
+
+						FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForRefPoint, TVISIntWin, TVISIntWinDisk );
 					}
-					FigureRefPointDayltgFactorsToAddIllums( ZoneNum, ILB, HourOfDay, ISunPos, IWin, loopwin, NWX, NWY, ICtrl );
+
+				} // End of window Y-element loop, IY
+			} // End of window X-element loop, IX
+
+			// Loop again over hourly sun positions and calculate daylight factors by adding
+			// direct and inter-reflected illum components, then dividing by exterior horiz illum.
+			// Also calculate corresponding glare factors.
+
+			ILB = IL;
+
+			if ( ! DetailedSolarTimestepIntegration ) {
+				ISunPos = 0;
+				for ( IHR = 1; IHR <= 24; ++IHR ) {
+					FigureRefPointDayltgFactorsToAddIllums( ZoneNum, ILB, IHR, ISunPos, IWin, loopwin, NWX, NWY, ICtrl );
+
+				} // End of sun position loop, IHR
+			} else {
+				if ( SunIsUp && ! MySunIsUpFlag ) {
+					ISunPos = 0;
+					MySunIsUpFlag = true;
+				} else if ( SunIsUp && MySunIsUpFlag ) {
+					ISunPos = 1;
+				} else if ( ! SunIsUp && MySunIsUpFlag ) {
+					MySunIsUpFlag = false;
+					ISunPos = -1;
+				} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
+					ISunPos = -1;
 				}
-			} // End of window loop, loopwin - IWin
+				FigureRefPointDayltgFactorsToAddIllums( ZoneNum, ILB, HourOfDay, ISunPos, IWin, loopwin, NWX, NWY, ICtrl );
+			}
+		} // End of window loop, loopwin - IWin
+
 
-		} // End of reference point loop, IL
 
 	}
 
@@ -1225,73 +1259,14 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Vector3< Real64 > W2; // Second vertex of window
-		static Vector3< Real64 > W3; // Third vertex of window
-		static Vector3< Real64 > U2; // Second vertex of window for TDD:DOME (if exists)
-		static Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
-		static Vector3< Real64 > RREF2; // Location of virtual reference point in absolute coordinate system
-		static Vector3< Real64 > RWIN; // Center of a window element in absolute coordinate system
-		static Vector3< Real64 > RWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
-		static Vector3< Real64 > Ray; // Unit vector along ray from reference point to window element
-		static Vector3< Real64 > W21; // Vector from window vertex 2 to window vertex 1
-		static Vector3< Real64 > W23; // Vector from window vertex 2 to window vertex 3
-		static Vector3< Real64 > U21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
-		static Vector3< Real64 > U23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
-		static Vector3< Real64 > WNORM2; // Unit vector normal to TDD:DOME (if exists)
-		static Vector3< Real64 > VIEWVC; // View vector in absolute coordinate system
-		static Vector3< Real64 > VIEWVC2; // Virtual view vector in absolute coordinate system
-//		static Vector2< Real64 > ZF; // Fraction of zone controlled by each reference point //Unused
-		//  In the following four variables, I=1 for clear sky, 2 for overcast.
-		int IHR; // Hour of day counter
+		Vector3< Real64 > VIEWVC; // View vector in absolute coordinate system
 		int NRF; // Number of daylighting reference points in a zone
 		int IL; // Reference point counter
 		Real64 AZVIEW; // Azimuth of view vector in absolute coord system for
 		//  glare calculation (radians)
-		int IConst; // Construction counter
-		int ICtrl; // Window control counter
-		int IWin; // Window counter
-		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
-		int InShelfSurf; // Inside daylighting shelf surface number
-		int ShType; // Window shading type
-		int BlNum; // Window Blind Number
-		int LSHCAL; // Interior shade calculation flag: 0=not yet
-		//  calculated, 1=already calculated
-		int NWX; // Number of window elements in x direction for dayltg calc
-		int NWY; // Number of window elements in y direction for dayltg calc
-		int NWYlim; // For triangle, largest NWY for a given IX
-		Real64 DWX; // Horizontal dimension of window element (m)
-		Real64 DWY; // Vertical dimension of window element (m)
-		int IX; // Counter for window elements in the x direction
-		int IY; // Counter for window elements in the y direction
-		Real64 COSB; // Cosine of angle between window outward normal and ray from
-		//  reference point to window element
-		Real64 PHRAY; // Altitude of ray from reference point to window element (radians)
-		Real64 THRAY; // Azimuth of ray from reference point to window element (radians)
-		Real64 DOMEGA; // Solid angle subtended by window element wrt reference point (steradians)
-		Real64 TVISB; // Visible transmittance of window for COSB angle of incidence (times light well
-		//   efficiency, if appropriate)
-		int ISunPos; // Sun position counter; used to avoid calculating various
-		//  quantities that do not depend on sun position.
-		Real64 ObTrans; // Product of solar transmittances of exterior obstructions hit by ray
-		// from reference point through a window element
-		int loopwin; // loop index for exterior windows associated with a daylit zone
-		bool is_Rectangle; // True if window is rectangular
-		bool is_Triangle; // True if window is triangular
-		Real64 DAXY; // Area of window element
-		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
-		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
-		int ILB;
 		int MapNum; // Loop for map number
-		bool hitIntObs; // True iff interior obstruction hit
-		bool hitExtObs; // True iff ray from ref pt to ext win hits an exterior obstruction
-		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
-		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
-//		Array2D< Real64 > MapWindowSolidAngAtRefPt; //Inactive Only allocated and assigning to: Also only 1 value used at a time
-//		Array2D< Real64 > MapWindowSolidAngAtRefPtWtd; // Only 1 value used at a time: Replaced by below
-		Real64 MapWindowSolidAngAtRefPtWtd;
 		static bool mapFirstTime( true );
 		static bool MySunIsUpFlag( false );
-		int WinEl; // window elements counter
 
 		if ( mapFirstTime && TotIllumMaps > 0 ) {
 			IL = -999;
@@ -1346,85 +1321,228 @@ namespace DaylightingManager {
 //			MapWindowSolidAngAtRefPt.allocate( NRF, ZoneDaylight( ZoneNum ).NumOfDayltgExtWins ); //Inactive
 //			MapWindowSolidAngAtRefPtWtd.allocate( NRF, ZoneDaylight( ZoneNum ).NumOfDayltgExtWins ); // Not an array anymore
 
-			for ( IL = 1; IL <= NRF; ++IL ) {
+			// The first point also sets the point-independent window properties; the remaining points only write
+			// to their own slots of the map factor arrays and can be processed concurrently
+			if ( NRF > 0 ) CalcDayltgCoeffsAtMapPoint( ZoneNum, MapNum, 1, AZVIEW, VIEWVC, MySunIsUpFlag );
+			if ( CanCalcDayltgCoeffsConcurrently( ZoneNum ) ) {
+				ParallelFor( 2, NRF, [&]( int const iMapPoint ){ CalcDayltgCoeffsAtMapPoint( ZoneNum, MapNum, iMapPoint, AZVIEW, VIEWVC, MySunIsUpFlag ); } );
+			} else {
+				for ( IL = 2; IL <= NRF; ++IL ) {
+					CalcDayltgCoeffsAtMapPoint( ZoneNum, MapNum, IL, AZVIEW, VIEWVC, MySunIsUpFlag );
+				}
+			}
 
-				RREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
+		} // MapNum
 
-				//           -------------
-				// ---------- WINDOW LOOP ----------
-				//           -------------
+	}
 
-//				MapWindowSolidAngAtRefPt = 0.0; //Inactive
-				MapWindowSolidAngAtRefPtWtd = 0.0;
+	void
+	CalcDayltgCoeffsAtMapPoint(
+		int const ZoneNum,
+		int const MapNum, // Illuminance map number
+		int const IL, // Map point number
+		Real64 const AZVIEW, // Azimuth of view vector in absolute coord system for glare calculation (radians)
+		Vector3< Real64 > const & VIEWVC, // View vector in absolute coordinate system
+		bool & MySunIsUpFlag // Sun-up state carried between calls for detailed timestep integration
+	)
+	{
 
-				for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Linda Lawrie
+		//       DATE WRITTEN   April 2012
+		//       MODIFIED       October 2026, broken out of CalcDayltgCoeffsMapPoints
+		//       RE-ENGINEERED  na
 
-					FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, is_Rectangle, is_Triangle, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
-					//           ---------------------
-					// ---------- WINDOW ELEMENT LOOP ----------
-					//           ---------------------
-					WinEl = 0;
+		// PURPOSE OF THIS SUBROUTINE:
+		// Provides calculations for Daylighting Coefficients for one illuminance map point
 
-					for ( IX = 1; IX <= NWX; ++IX ) {
-						if ( is_Rectangle ) {
-							NWYlim = NWY;
-						} else if ( is_Triangle ) {
-							NWYlim = NWY - IX + 1;
-						}
+		// METHODOLOGY EMPLOYED:
+		// Same as CalcDayltgCoeffsAtRefPoint: only this point's slots of the IllumMapCalc factor arrays
+		// are written, so different map points may be processed concurrently
 
-						for ( IY = 1; IY <= NWYlim; ++IY ) {
+		// REFERENCES:
+		// na
 
-							++WinEl;
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+		using DataEnvironment::SunIsUp;
 
-							FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForMapPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, WNORM2, ExtWinType, IConst, RREF2, is_Triangle, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
-							//           -------------------
-							// ---------- SUN POSITION LOOP ----------
-							//           -------------------
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-							// Sun position counter. Used to avoid calculating various quantities
-							// that do not depend on sun position.
-							if ( ! DetailedSolarTimestepIntegration ) {
-								ISunPos = 0;
-								for ( IHR = 1; IHR <= 24; ++IHR ) {
-									FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
-								} // End of hourly sun position loop, IHR
-							} else {
-								if ( SunIsUp && ! MySunIsUpFlag ) {
-									ISunPos = 0;
-									MySunIsUpFlag = true;
-								} else if ( SunIsUp && MySunIsUpFlag ) {
-									ISunPos = 1;
-								} else if ( ! SunIsUp && MySunIsUpFlag ) {
-									MySunIsUpFlag = false;
-									ISunPos = -1;
-								} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
-									ISunPos = -1;
-								}
-								FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
+		Vector3< Real64 > W2; // Second vertex of window
+		Vector3< Real64 > W3; // Third vertex of window
+		Vector3< Real64 > U2; // Second vertex of window for TDD:DOME (if exists)
+		Vector3< Real64 > RREF; // Location of a reference point in absolute coordinate system
+		Vector3< Real64 > RREF2; // Location of virtual reference point in absolute coordinate system
+		Vector3< Real64 > RWIN; // Center of a window element in absolute coordinate system
+		Vector3< Real64 > RWIN2; // Center of a window element for TDD:DOME (if exists) in abs coord sys
+		Vector3< Real64 > Ray; // Unit vector along ray from reference point to window element
+		Vector3< Real64 > W21; // Vector from window vertex 2 to window vertex 1
+		Vector3< Real64 > W23; // Vector from window vertex 2 to window vertex 3
+		Vector3< Real64 > U21; // Vector from window vertex 2 to window vertex 1 for TDD:DOME (if exists)
+		Vector3< Real64 > U23; // Vector from window vertex 2 to window vertex 3 for TDD:DOME (if exists)
+		Vector3< Real64 > WNORM2; // Unit vector normal to TDD:DOME (if exists)
+		Vector3< Real64 > VIEWVC2; // Virtual view vector in absolute coordinate system
+		int IHR; // Hour of day counter
+		int IConst; // Construction counter
+		int ICtrl; // Window control counter
+		int IWin; // Window counter
+		int IWin2; // Secondary window counter (for TDD:DOME object, if exists)
+		int InShelfSurf; // Inside daylighting shelf surface number
+		int ShType; // Window shading type
+		int BlNum; // Window Blind Number
+		int LSHCAL; // Interior shade calculation flag: 0=not yet
+		//  calculated, 1=already calculated
+		int NWX; // Number of window elements in x direction for dayltg calc
+		int NWY; // Number of window elements in y direction for dayltg calc
+		int NWYlim; // For triangle, largest NWY for a given IX
+		Real64 DWX; // Horizontal dimension of window element (m)
+		Real64 DWY; // Vertical dimension of window element (m)
+		int IX; // Counter for window elements in the x direction
+		int IY; // Counter for window elements in the y direction
+		Real64 COSB; // Cosine of angle between window outward normal and ray from
+		//  reference point to window element
+		Real64 PHRAY; // Altitude of ray from reference point to window element (radians)
+		Real64 THRAY; // Azimuth of ray from reference point to window element (radians)
+		Real64 DOMEGA; // Solid angle subtended by window element wrt reference point (steradians)
+		Real64 TVISB; // Visible transmittance of window for COSB angle of incidence (times light well
+		//   efficiency, if appropriate)
+		int ISunPos; // Sun position counter; used to avoid calculating various
+		//  quantities that do not depend on sun position.
+		Real64 ObTrans; // Product of solar transmittances of exterior obstructions hit by ray
+		// from reference point through a window element
+		int loopwin; // loop index for exterior windows associated with a daylit zone
+		bool is_Rectangle; // True if window is rectangular
+		bool is_Triangle; // True if window is triangular
+		Real64 DAXY; // Area of window element
+		Real64 SkyObstructionMult; // Ratio of obstructed to unobstructed sky diffuse at a ground point
+		int ExtWinType; // Exterior window type (InZoneExtWin, AdjZoneExtWin, NotInOrAdjZoneExtWin)
+		int ILB;
+		bool hitIntObs; // True iff interior obstruction hit
+		bool hitExtObs; // True iff ray from ref pt to ext win hits an exterior obstruction
+		Real64 TVISIntWin; // Visible transmittance of int win at COSBIntWin for light from ext win
+		Real64 TVISIntWinDisk; // Visible transmittance of int win at COSBIntWin for sun
+//		Array2D< Real64 > MapWindowSolidAngAtRefPt; //Inactive Only allocated and assigning to: Also only 1 value used at a time
+//		Array2D< Real64 > MapWindowSolidAngAtRefPtWtd; // Only 1 value used at a time: Replaced by below
+		Real64 MapWindowSolidAngAtRefPtWtd;
+		int WinEl; // window elements counter
 
-							}
-						} // End of window Y-element loop, IY
-					} // End of window X-element loop, IX
+		RREF = IllumMapCalc( MapNum ).MapRefPtAbsCoord( {1,3}, IL ); // (x, y, z)
+
+		//           -------------
+		// ---------- WINDOW LOOP ----------
+		//           -------------
+
+//				MapWindowSolidAngAtRefPt = 0.0; //Inactive
+		MapWindowSolidAngAtRefPtWtd = 0.0;
 
+		for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+
+			FigureDayltgCoeffsAtPointsSetupForWindow( ZoneNum, IL, loopwin, CalledForMapPoint, RREF, VIEWVC, IWin, IWin2, NWX, NWY, W2, W3, W21, W23, LSHCAL, InShelfSurf, ICtrl, ShType, BlNum, WNORM2, ExtWinType, IConst, RREF2, DWX, DWY, DAXY, U2, U23, U21, VIEWVC2, is_Rectangle, is_Triangle, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
+			//           ---------------------
+			// ---------- WINDOW ELEMENT LOOP ----------
+			//           ---------------------
+			WinEl = 0;
+
+			for ( IX = 1; IX <= NWX; ++IX ) {
+				if ( is_Rectangle ) {
+					NWYlim = NWY;
+				} else if ( is_Triangle ) {
+					NWYlim = NWY - IX + 1;
+				}
+
+				for ( IY = 1; IY <= NWYlim; ++IY ) {
+
+					++WinEl;
+
+					FigureDayltgCoeffsAtPointsForWindowElements( ZoneNum, IL, loopwin, CalledForMapPoint, WinEl, IWin, IWin2, IX, IY, SkyObstructionMult, W2, W21, W23, RREF, NWYlim, VIEWVC2, DWX, DWY, DAXY, U2, U23, U21, RWIN, RWIN2, Ray, PHRAY, LSHCAL, COSB, ObTrans, TVISB, DOMEGA, THRAY, hitIntObs, hitExtObs, WNORM2, ExtWinType, IConst, RREF2, is_Triangle, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd ); // Inactive MapWindowSolidAngAtRefPt arg removed
+					//           -------------------
+					// ---------- SUN POSITION LOOP ----------
+					//           -------------------
+
+					// Sun position counter. Used to avoid calculating various quantities
+					// that do not depend on sun position.
 					if ( ! DetailedSolarTimestepIntegration ) {
-						// Loop again over hourly sun positions and calculate daylight factors by adding
-						// direct and inter-reflected illum components, then dividing by exterior horiz illum.
-						// Also calculate corresponding glare factors.
-						ILB = IL;
+						ISunPos = 0;
 						for ( IHR = 1; IHR <= 24; ++IHR ) {
-							FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, IHR, IWin, loopwin, NWX, NWY, ICtrl );
-						} // End of sun position loop, IHR
+							FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, IHR, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
+						} // End of hourly sun position loop, IHR
 					} else {
-						ILB = IL;
-						FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, HourOfDay, IWin, loopwin, NWX, NWY, ICtrl );
+						if ( SunIsUp && ! MySunIsUpFlag ) {
+							ISunPos = 0;
+							MySunIsUpFlag = true;
+						} else if ( SunIsUp && MySunIsUpFlag ) {
+							ISunPos = 1;
+						} else if ( ! SunIsUp && MySunIsUpFlag ) {
+							MySunIsUpFlag = false;
+							ISunPos = -1;
+						} else if ( ! SunIsUp && ! MySunIsUpFlag ) {
+							ISunPos = -1;
+						}
+						FigureDayltgCoeffsAtPointsForSunPosition( ZoneNum, IL, IX, NWX, IY, NWYlim, WinEl, IWin, IWin2, HourOfDay, ISunPos, SkyObstructionMult, RWIN2, Ray, PHRAY, LSHCAL, InShelfSurf, COSB, ObTrans, TVISB, DOMEGA, ICtrl, ShType, BlNum, THRAY, WNORM2, ExtWinType, IConst, AZVIEW, RREF2, hitIntObs, hitExtObs, CalledForMapPoint, TVISIntWin, TVISIntWinDisk, MapNum, MapWindowSolidAngAtRefPtWtd );
 
 					}
+				} // End of window Y-element loop, IY
+			} // End of window X-element loop, IX
 
-				} // End of window loop, loopwin - IWin
+			if ( ! DetailedSolarTimestepIntegration ) {
+				// Loop again over hourly sun positions and calculate daylight factors by adding
+				// direct and inter-reflected illum components, then dividing by exterior horiz illum.
+				// Also calculate corresponding glare factors.
+				ILB = IL;
+				for ( IHR = 1; IHR <= 24; ++IHR ) {
+					FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, IHR, IWin, loopwin, NWX, NWY, ICtrl );
+				} // End of sun position loop, IHR
+			} else {
+				ILB = IL;
+				FigureMapPointDayltgFactorsToAddIllums( ZoneNum, MapNum, ILB, HourOfDay, IWin, loopwin, NWX, NWY, ICtrl );
 
-			} // End of reference point loop, IL
+			}
 
-		} // MapNum
+		} // End of window loop, loopwin - IWin
+
+	}
+
+	bool
+	CanCalcDayltgCoeffsConcurrently( int const ZoneNum )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   October 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines whether the daylighting coefficients of the points in a zone may be
+		// calculated concurrently.
+
+		// METHODOLOGY EMPLOYED:
+		// Points are independent except where the window calculations update shared window state:
+		// exterior screens (SurfaceScreens), TDDs (TDDFluxInc/TDDTransVisBeam and the dome properties),
+		// BSDF windows (ComplexWind daylighting geometry) and the sun-up tracking of the detailed
+		// timestep integration. Zones with any of these are processed serially.
+
+		// Using/Aliasing
+		using DataSystemVariables::DetailedSolarTimestepIntegration;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int loopwin; // Loop index for exterior windows associated with a daylit zone
+		int IWin; // Window surface number
+		int ICtrl; // Window shading control number
+
+		if ( DetailedSolarTimestepIntegration ) return false;
+
+		for ( loopwin = 1; loopwin <= ZoneDaylight( ZoneNum ).NumOfDayltgExtWins; ++loopwin ) {
+			IWin = ZoneDaylight( ZoneNum ).DayltgExtWinSurfNums( loopwin );
+			if ( SurfaceWindow( IWin ).OriginalClass == SurfaceClass_TDD_Diffuser ) return false;
+			if ( SurfaceWindow( IWin ).WindowModelType == WindowBSDFModel ) return false;
+			if ( SurfaceWindow( IWin ).ScreenNumber > 0 ) return false;
+			ICtrl = Surface( IWin ).WindowShadingControlPtr;
+			if ( ICtrl > 0 && WindowShadingControl( ICtrl ).ShadingType == WSC_ST_ExteriorScreen ) return false;
+		}
+
+		return true;
 
 	}
 
@@ -1478,6 +1596,9 @@ namespace DaylightingManager {
 
 		// METHODOLOGY EMPLOYED:
 		// switch as need to serve both reference points and map points based on calledFrom
+		// Window properties that do not depend on the point (SurfaceWindow VisTransSelected, VisTransRatio,
+		// WinCenter, Phi, Theta) are only set for the first point, so that the remaining points can be
+		// processed concurrently. Error reporting is serialized for the same reason.
 
 		// REFERENCES:
 		// na
@@ -1506,21 +1627,23 @@ namespace DaylightingManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int ZoneNumThisWin; // A window's zone number
 		int ShelfNum; // Daylighting shelf object number
+		bool const SetWindowProperties( iRefPoint == 1 ); // Set point-independent window properties
+		static std::mutex ErrorMutex; // Serializes error reporting from concurrently processed points
 
-		static Vector3< Real64 > W1; // First vertex of window (where vertices are numbered
+		static thread_local Vector3< Real64 > W1; // First vertex of window (where vertices are numbered
 		// counter-clockwise starting at upper left as viewed
 		// from inside of room
 		int IConstShaded; // Shaded construction counter
 //		int ScNum; // Window screen number //Unused Set but never used
 		Real64 WW; // Window width (m)
 		Real64 HW; // Window height (m)
-		static Vector3< Real64 > WC; // Center point of window
-		static Vector3< Real64 > REFWC; // Vector from reference point to center of window
-		static Vector3< Real64 > WNORM; // Unit vector normal to window (pointing away from room)
+		static thread_local Vector3< Real64 > WC; // Center point of window
+		static thread_local Vector3< Real64 > REFWC; // Vector from reference point to center of window
+		static thread_local Vector3< Real64 > WNORM; // Unit vector normal to window (pointing away from room)
 		int NDIVX; // Number of window x divisions for daylighting calc
 		int NDIVY; // Number of window y divisions for daylighting calc
 		Real64 ALF; // Distance from reference point to window plane (m)
-		static Vector3< Real64 > W2REF; // Vector from window origin to project of ref. pt. on window plane
+		static thread_local Vector3< Real64 > W2REF; // Vector from window origin to project of ref. pt. on window plane
 		Real64 D1a; // Projection of vector from window origin to reference
 		//  on window X  axis (m)
 		Real64 D1b; // Projection of vector from window origin to reference
@@ -1529,10 +1652,10 @@ namespace DaylightingManager {
 		Real64 SolidAngMinIntWin; // Approx. smallest solid angle subtended by an int. window wrt ref pt
 		Real64 SolidAngRatio; // Ratio of SolidAngExtWin and SolidAngMinIntWin
 		int PipeNum; // TDD pipe object number
-		static Vector3< Real64 > REFD; // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
-		static Vector3< Real64 > VIEWVD; // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
-		static Vector3< Real64 > U1; // First vertex of window for TDD:DOME (if exists)
-		static Vector3< Real64 > U3; // Third vertex of window for TDD:DOME (if exists)
+		static thread_local Vector3< Real64 > REFD; // Vector from ref pt to center of win in TDD:DIFFUSER coord sys (if exists)
+		static thread_local Vector3< Real64 > VIEWVD; // Virtual view vector in TDD:DIFFUSER coord sys (if exists)
+		static thread_local Vector3< Real64 > U1; // First vertex of window for TDD:DOME (if exists)
+		static thread_local Vector3< Real64 > U3; // Third vertex of window for TDD:DOME (if exists)
 		Real64 SinCornerAng; // For triangle, sine of corner angle of window element
 
 		// Complex fenestration variables
@@ -1540,7 +1663,7 @@ namespace DaylightingManager {
 //		int NReflSurf; // Number of blocked beams for complex fenestration //Unused Set but never used
 		int NRefPts; // number of reference points
 //		int WinEl; // Current window element //Unused Set but never used
-		static Vector3< Real64 > RayVector;
+		static thread_local Vector3< Real64 > RayVector;
 //		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable) //Unused Set but never used
 
 		// Complex fenestration variables
@@ -1615,15 +1738,17 @@ namespace DaylightingManager {
 		// Shade/blind calculation flag
 		LSHCAL = 0;
 
-		// Visible transmittance at normal incidence
-		SurfaceWindow( IWin ).VisTransSelected = POLYF( 1.0, Construct( IConst ).TransVisBeamCoef ) * SurfaceWindow( IWin ).GlazedFrac;
-		// For windows with switchable glazing, ratio of visible transmittance at normal
-		// incidence for fully switched (dark) state to that of unswitched state
-		SurfaceWindow( IWin ).VisTransRatio = 1.0;
-		if ( ICtrl > 0 ) {
-			if ( ShType == WSC_ST_SwitchableGlazing ) {
-				IConstShaded = Surface( IWin ).ShadedConstruction;
-				SurfaceWindow( IWin ).VisTransRatio = SafeDivide( POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef ), POLYF( 1.0, Construct( IConst ).TransVisBeamCoef ) );
+		if ( SetWindowProperties ) {
+			// Visible transmittance at normal incidence
+			SurfaceWindow( IWin ).VisTransSelected = POLYF( 1.0, Construct( IConst ).TransVisBeamCoef ) * SurfaceWindow( IWin ).GlazedFrac;
+			// For windows with switchable glazing, ratio of visible transmittance at normal
+			// incidence for fully switched (dark) state to that of unswitched state
+			SurfaceWindow( IWin ).VisTransRatio = 1.0;
+			if ( ICtrl > 0 ) {
+				if ( ShType == WSC_ST_SwitchableGlazing ) {
+					IConstShaded = Surface( IWin ).ShadedConstruction;
+					SurfaceWindow( IWin ).VisTransRatio = SafeDivide( POLYF( 1.0, Construct( IConstShaded ).TransVisBeamCoef ), POLYF( 1.0, Construct( IConst ).TransVisBeamCoef ) );
+				}
 			}
 		}
 
@@ -1638,7 +1763,7 @@ namespace DaylightingManager {
 		} else if ( is_Triangle ) {
 			WC = W2 + ( W23 + W21 ) / 3.0;
 		}
-		SurfaceWindow( IWin ).WinCenter = WC;
+		if ( SetWindowProperties ) SurfaceWindow( IWin ).WinCenter = WC;
 		REFWC = WC - RREF;
 		// Unit vectors
 		W21 /= HW;
@@ -1665,12 +1790,14 @@ namespace DaylightingManager {
 
 				//            ! Error message if ref pt is too close to window.
 				if ( D1a > 0.0 && D1b > 0.0 && D1b <= HW && D1a <= WW ) {
+					std::lock_guard< std::mutex > lock( ErrorMutex );
 					ShowSevereError( "CalcDaylightCoeffRefPoints: Daylighting calculation cannot be done for zone " + Zone( ZoneNum ).Name + " because reference point #" + RoundSigDigits( iRefPoint ) + " is less than 0.15m (6\") from window plane " + Surface( IWin ).Name );
 					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 5 ) + "]. This is too close; check position of reference point." );
 					ShowFatalError( "Program terminates due to preceding condition." );
 				}
 			} else if ( ALF < 0.1524 && ExtWinType == AdjZoneExtWin ) {
 				if ( RefErrIndex( iRefPoint, IWin ) == 0 ) { // only show error message once
+					std::lock_guard< std::mutex > lock( ErrorMutex );
 					ShowWarningError( "CalcDaylightCoeffRefPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" reference point is less than 0.15m (6\") from window plane " );
 					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] to ref point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Daylighting Calcs may result." );
 					RefErrIndex( iRefPoint, IWin ) = 1;
@@ -1679,6 +1806,7 @@ namespace DaylightingManager {
 		} else if ( CalledFrom == CalledForMapPoint ) {
 			if ( ALF < 0.1524 && ExtWinType == AdjZoneExtWin ) {
 				if ( MapErrIndex( iRefPoint, IWin ) == 0 ) { // only show error message once
+					std::lock_guard< std::mutex > lock( ErrorMutex );
 					ShowWarningError( "CalcDaylightCoeffMapPoints: For Zone=\"" + Zone( ZoneNum ).Name + "\" External Window=\"" + Surface( IWin ).Name + "\"in Zone=\"" + Zone( Surface( IWin ).Zone ).Name + "\" map point is less than 0.15m (6\") from window plane " );
 					ShowContinueError( "Distance=[" + RoundSigDigits( ALF, 1 ) + " m] map point=[" + RoundSigDigits( RREF( 1 ), 1 ) + ',' + RoundSigDigits( RREF( 2 ), 1 ) + ',' + RoundSigDigits( RREF( 3 ), 1 ) + "], Inaccuracy in Map Calcs may result." );
 					MapErrIndex( iRefPoint, IWin ) = 1;
@@ -1715,11 +1843,13 @@ namespace DaylightingManager {
 		DWY = HW / NWY;
 
 		// Azimuth and altitude of window normal
-		SurfaceWindow( IWin ).Phi = std::asin( WNORM( 3 ) );
-		if ( std::abs( WNORM( 1 ) ) > 1.0e-5 || std::abs( WNORM( 2 ) ) > 1.0e-5 ) {
-			SurfaceWindow( IWin ).Theta = std::atan2( WNORM( 2 ), WNORM( 1 ) );
-		} else {
-			SurfaceWindow( IWin ).Theta = 0.0;
+		if ( SetWindowProperties ) {
+			SurfaceWindow( IWin ).Phi = std::asin( WNORM( 3 ) );
+			if ( std::abs( WNORM( 1 ) ) > 1.0e-5 || std::abs( WNORM( 2 ) ) > 1.0e-5 ) {
+				SurfaceWindow( IWin ).Theta = std::atan2( WNORM( 2 ), WNORM( 1 ) );
+			} else {
+				SurfaceWindow( IWin ).Theta = 0.0;
+			}
 		}
 
 		// Recalculation of values for TDD:DOME
@@ -1967,7 +2097,7 @@ namespace DaylightingManager {
 		bool hitIntWin; // Ray from ref pt passes through interior window
 		int PipeNum; // TDD pipe object number
 		int IntWin; // Interior window surface index
-		static Vector3< Real64 > HitPtIntWin; // Intersection point on an interior window for ray from ref pt to ext win (m)
+		static thread_local Vector3< Real64 > HitPtIntWin; // Intersection point on an interior window for ray from ref pt to ext win (m)
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
 
@@ -1975,16 +2105,16 @@ namespace DaylightingManager {
 		Real64 Beta; // Intermediate variable
 		Real64 HorDis; // Distance between ground hit point and proj'n of center
 		//  of window element onto ground (m)
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
-		static Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
+		static thread_local Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
+		static thread_local Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
+		static thread_local Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
 
 		// Local complex fenestration variables
 		int CplxFenState; // Current complex fenestration state
 		int NReflSurf; // Number of blocked beams for complex fenestration
 		int ICplxFen; // Complex fenestration counter
 		int RayIndex;
-		static Vector3< Real64 > RayVector;
+		static thread_local Vector3< Real64 > RayVector;
 		Real64 TransBeam; // Obstructions transmittance for incoming BSDF rays (temporary variable)
 
 		++LSHCAL;
@@ -2927,7 +3057,7 @@ namespace DaylightingManager {
 		Real64 ObstrMultiplier;
 
 		// Locals
-		static Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
+		static thread_local Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
 		Real64 DPhi; // Phi increment (radians)
 		Real64 DTheta; // Theta increment (radians)
 		Real64 SkyGndUnObs; // Unobstructed sky irradiance at a ground point
@@ -2942,13 +3072,13 @@ namespace DaylightingManager {
 		Real64 dOmegaGnd; // Solid angle element of ray from ground point (steradians)
 		Real64 IncAngSolidAngFac; // CosIncAngURay*dOmegaGnd/Pi
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
-		static int AltSteps_last( 0 );
-		static Array1D< Real64 > cos_Phi( AltAngStepsForSolReflCalc / 2 ); // cos( Phi ) table
-		static Array1D< Real64 > sin_Phi( AltAngStepsForSolReflCalc / 2 ); // sin( Phi ) table
-		static int AzimSteps_last( 0 );
-		static Array1D< Real64 > cos_Theta( 2 * AzimAngStepsForSolReflCalc ); // cos( Theta ) table
-		static Array1D< Real64 > sin_Theta( 2 * AzimAngStepsForSolReflCalc ); // sin( Theta ) table
+		static thread_local Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
+		static thread_local int AltSteps_last( 0 );
+		static thread_local Array1D< Real64 > cos_Phi( AltAngStepsForSolReflCalc / 2 ); // cos( Phi ) table
+		static thread_local Array1D< Real64 > sin_Phi( AltAngStepsForSolReflCalc / 2 ); // sin( Phi ) table
+		static thread_local int AzimSteps_last( 0 );
+		static thread_local Array1D< Real64 > cos_Theta( 2 * AzimAngStepsForSolReflCalc ); // cos( Theta ) table
+		static thread_local Array1D< Real64 > sin_Theta( 2 * AzimAngStepsForSolReflCalc ); // sin( Theta ) table
 
 		assert( AzimSteps <= AzimAngStepsForSolReflCalc );
 
@@ -2995,7 +3125,7 @@ namespace DaylightingManager {
 				SkyGndUnObs += IncAngSolidAngFac;
 				// Does this ground ray hit an obstruction?
 				hitObs = false;
-				if ( TotSurfaces < octreeCrossover ) { // Linear search through surfaces
+				if ( surfaceBVH.empty() ) { // Linear search through surfaces
 
 					for ( int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
 						if ( Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) {
@@ -3004,21 +3134,21 @@ namespace DaylightingManager {
 						}
 					}
 
-				} else { // Surface octree search
+				} else { // Surface BVH search
 
-					// Lambda function for the octree to test for surface hit
-					auto surfaceHit = [&GroundHitPt,&hitObs]( SurfaceData const & surface ) -> bool {
-						if ( surface.ShadowSurfPossibleObstruction ) {
-							PierceSurface( surface, GroundHitPt, URay, ObsHitPt, hitObs ); // Check if ray pierces surface
+					// Lambda function for the BVH to test for surface hit
+					auto surfaceHit = [&GroundHitPt,&hitObs]( int const ObsSurfNum ) -> bool {
+						if ( Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) {
+							PierceSurface( ObsSurfNum, GroundHitPt, URay, ObsHitPt, hitObs ); // Check if ray pierces surface
 							return hitObs; // Ray pierces surface
 						} else {
 							return false;
 						}
 					};
 
-					// Check octree surface candidates until a hit is found, if any
-					Vector3< Real64 > const URay_inv( SurfaceOctreeCube::safe_inverse( URay ) );
-					surfaceOctree.hasSurfaceRayIntersectsCube( GroundHitPt, URay, URay_inv, surfaceHit );
+					// Check BVH surface candidates until a hit is found, if any
+					Vector3< Real64 > const URay_inv( SurfaceBVH::safe_inverse( URay ) );
+					surfaceBVH.hasSurfaceRayIntersects( GroundHitPt, URay, URay_inv, surfaceHit );
 
 				}
 
@@ -3118,13 +3248,13 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		static Vector3< Real64 > const RREF( 0.0 ); // Location of a reference point in absolute coordinate system //Autodesk Was used uninitialized: Never set here // Made static for performance and const for now until issue addressed
-		static Vector4< Real64 > XEDIRSK; // Illuminance contribution from luminance element, sky-related
+		static thread_local Vector4< Real64 > XEDIRSK; // Illuminance contribution from luminance element, sky-related
 //		Real64 XEDIRSU; // Illuminance contribution from luminance element, sun-related //Unused Set but never used
-		static Vector4< Real64 > XAVWLSK; // Luminance of window element, sky-related
-		static Vector3< Real64 > RAYCOS; // Unit vector from reference point to sun
+		static thread_local Vector4< Real64 > XAVWLSK; // Luminance of window element, sky-related
+		static thread_local Vector3< Real64 > RAYCOS; // Unit vector from reference point to sun
 		int JB; // Slat angle counter
-		static Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
-		static Array1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
+		static thread_local Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Beam-beam transmittance of isolated blind
+		static thread_local Array1D< Real64 > TransBmBmMultRefl( MaxSlatAngs ); // As above but for beam reflected from exterior obstruction
 		Real64 ProfAng; // Solar profile angle on a window (radians)
 		Real64 POSFAC; // Position factor for a window element / ref point / view vector combination
 		Real64 XR; // Horizontal displacement ratio
@@ -3133,7 +3263,7 @@ namespace DaylightingManager {
 
 		Real64 ObTransDisk; // Product of solar transmittances of exterior obstructions hit by ray
 		// from reference point to sun
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits
+		static thread_local Vector3< Real64 > HP; // Hit coordinates, if ray hits
 		Real64 LumAtHitPtFrSun; // Luminance at hit point of obstruction by reflection of direct light from
 		//  sun (cd/m2)
 		int ISky; // Sky type index: 1=clear, 2=clear turbid, 3=intermediate, 4=overcast
@@ -3149,13 +3279,13 @@ namespace DaylightingManager {
 		Real64 SlatAng; // Blind slat angle (rad)
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static Vector3< Real64 > NearestHitPt; // Hit point of ray on nearest obstruction
+		static thread_local Vector3< Real64 > NearestHitPt; // Hit point of ray on nearest obstruction
 //		Real64 SunObstructionMult; // = 1.0 if sun hits a ground point; otherwise = 0.0
 		Real64 Alfa; // Intermediate variables
 //		Real64 Beta; //Unused
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
+		static thread_local Vector3< Real64 > GroundHitPt; // Coordinates of point that ray hits ground (m)
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
+		static thread_local Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by
@@ -3163,16 +3293,16 @@ namespace DaylightingManager {
 		int RecSurfNum; // Receiving surface number
 		int ReflSurfNum; // Reflecting surface number
 		int ReflSurfNumX;
-		static Vector3< Real64 > ReflNorm; // Normal vector to reflecting surface
+		static thread_local Vector3< Real64 > ReflNorm; // Normal vector to reflecting surface
 		Real64 CosIncAngRefl; // Cos of angle of incidence of beam on reflecting surface
-		static Vector3< Real64 > SunVecMir; // Sun ray mirrored in reflecting surface
+		static thread_local Vector3< Real64 > SunVecMir; // Sun ray mirrored in reflecting surface
 		Real64 CosIncAngRec; // Cos of angle of incidence of reflected beam on receiving window
 		bool hitRefl; // True iff ray hits reflecting surface
-		static Vector3< Real64 > HitPtRefl; // Point that ray hits reflecting surface
+		static thread_local Vector3< Real64 > HitPtRefl; // Point that ray hits reflecting surface
 		Real64 ReflDistanceSq; // Distance squared between ref pt and hit point on reflecting surf (m^2)
 		Real64 ReflDistance; // Distance between ref pt and hit point on reflecting surf (m)
 		bool hitObsRefl; // True iff obstruction hit between ref pt and reflection point
-		static Vector3< Real64 > HitPtObs; // Hit point on obstruction
+		static thread_local Vector3< Real64 > HitPtObs; // Hit point on obstruction
 		int ReflSurfRecNum; // Receiving surface number for a reflecting window
 		Real64 SpecReflectance; // Specular reflectance of a reflecting surface
 		Real64 TVisRefl; // Bare window vis trans for reflected beam
@@ -3185,7 +3315,7 @@ namespace DaylightingManager {
 		bool hitIntObsDisk; // True iff ray from ref pt to sun hits an interior obstruction
 //		bool hitExtObsDisk; // True iff ray from ref pt to sun hits an exterior obstruction //Unused Set but never used
 
-		static Vector3< Real64 > HitPtIntWinDisk; // Intersection point on an interior window for ray from ref pt to sun (m)
+		static thread_local Vector3< Real64 > HitPtIntWinDisk; // Intersection point on an interior window for ray from ref pt to sun (m)
 		int IntWinDiskHitNum; // Surface number of int window intersected by ray betw ref pt and sun
 		Real64 COSBIntWin; // Cos of angle between int win outward normal and ray betw ref pt and
 		//  exterior window element or between ref pt and sun
@@ -5479,6 +5609,7 @@ namespace DaylightingManager {
 		//                        doors as obstructors since if they are obstructors their base surfaces will
 		//                        also be obstructors
 		//       RE-ENGINEERED  Sept 2015. Stuart Mentzer. Octree for performance.
+		//                      Oct 2026. Surface BVH replaces the octree.
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Determines the product of the solar transmittances of the obstructions hit by a ray
@@ -5492,7 +5623,7 @@ namespace DaylightingManager {
 
 		// Local declarations
 		int IType; // Surface type/class:  mirror surfaces of shading surfaces
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction
+		static thread_local Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction
 		bool hit; // True iff a particular obstruction is hit
 
 		ObTrans = 1.0;
@@ -5503,7 +5634,7 @@ namespace DaylightingManager {
 		// Loop over potentially obstructing surfaces, which can be building elements, like walls, or shadowing surfaces, like overhangs
 		// Building elements are assumed to be opaque
 		// A shadowing surface is opaque unless its transmittance schedule value is non-zero
-		if ( TotSurfaces < octreeCrossover ) { // Linear search through surfaces
+		if ( surfaceBVH.empty() ) { // Linear search through surfaces
 
 			for ( int ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
 				auto const & surface( Surface( ISurf ) );
@@ -5530,23 +5661,21 @@ namespace DaylightingManager {
 				}
 			}
 
-		} else { // Surface octree search
+		} else { // Surface BVH search
 
-			auto const & window_base( window_iBaseSurf > 0 ? Surface( window_iBaseSurf ) : window );
-			auto const window_base_p( &window_base );
-
-			// Lambda function for the octree to test for surface hit and update transmittance if hit
-			auto solarTransmittance = [=,&R1,&RN,&hit,&ObTrans]( SurfaceData const & surface ) -> bool {
-				if ( ! surface.ShadowSurfPossibleObstruction ) return false; //Do Consider separate octree without filtered surfaces
+			// Lambda function for the BVH to test for surface hit and update transmittance if hit
+			auto solarTransmittance = [=,&R1,&RN,&hit,&ObTrans]( int const ISurf ) -> bool {
+				auto const & surface( Surface( ISurf ) );
+				if ( ! surface.ShadowSurfPossibleObstruction ) return false;
 				auto const sClass( surface.Class );
-				if ( ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && ( &surface != window_base_p ) ) {
-					PierceSurface( surface, R1, RN, HP, hit );
+				if ( ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && ( ISurf != window_iBaseSurf ) ) {
+					PierceSurface( ISurf, R1, RN, HP, hit );
 					if ( hit ) { // Building element is hit (assumed opaque)
 						ObTrans = 0.0;
 						return true;
 					}
 				} else if ( surface.ShadowingSurf ) {
-					PierceSurface( surface, R1, RN, HP, hit );
+					PierceSurface( ISurf, R1, RN, HP, hit );
 					if ( hit ) { // Shading surface is hit
 						// Get solar transmittance of the shading surface
 						Real64 const Trans( surface.SchedShadowSurfIndex > 0 ? LookUpScheduleValue( surface.SchedShadowSurfIndex, IHOUR, 1 ) : 0.0 );
@@ -5562,9 +5691,9 @@ namespace DaylightingManager {
 				return false;
 			};
 
-			// Check octree surface candidates for hits: short circuits if zero transmittance reached
-			Vector3< Real64 > const RN_inv( SurfaceOctreeCube::safe_inverse( RN ) );
-			surfaceOctree.processSomeSurfaceRayIntersectsCube( R1, RN, RN_inv, solarTransmittance );
+			// Check BVH surface candidates for hits: short circuits if zero transmittance reached
+			Vector3< Real64 > const RN_inv( SurfaceBVH::safe_inverse( RN ) );
+			surfaceBVH.hasSurfaceRayIntersects( R1, RN, RN_inv, solarTransmittance );
 
 		}
 
@@ -5584,6 +5713,7 @@ namespace DaylightingManager {
 		//       DATE WRITTEN   July 1997
 		//       MODIFIED       na
 		//       RE-ENGINEERED  Sept 2015. Stuart Mentzer. Octree for performance.
+		//                      Oct 2026. Surface BVH replaces the octree.
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This subroutine checks for interior obstructions between reference point and window element.
@@ -5593,8 +5723,8 @@ namespace DaylightingManager {
 
 		// Local declarations
 		int IType; // Surface type/class
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction
-		static Vector3< Real64 > RN; // Unit vector along ray
+		static thread_local Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction
+		static thread_local Vector3< Real64 > RN; // Unit vector along ray
 
 		hit = false;
 		RN = ( R2 - R1 ).normalize(); // Make unit vector
@@ -5607,7 +5737,7 @@ namespace DaylightingManager {
 		auto const window_base_iExtBoundCond( window_base.ExtBoundCond );
 
 		// Loop over potentially obstructing surfaces, which can be building elements, like walls, or shadowing surfaces, like overhangs
-		if ( TotSurfaces < octreeCrossover ) { // Linear search through surfaces
+		if ( surfaceBVH.empty() ) { // Linear search through surfaces
 
 			for ( int ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
 				auto const & surface( Surface( ISurf ) );
@@ -5622,29 +5752,26 @@ namespace DaylightingManager {
 				}
 			}
 
-		} else { // Surface octree search
-
-			auto const window_base_p( &window_base );
-			auto const & window_base_adjacent( window_base_iExtBoundCond > 0 ? Surface( window_base_iExtBoundCond ) : window_base );
-			auto const window_base_adjacent_p( &window_base_adjacent );
+		} else { // Surface BVH search
 
-			// Lambda function for the octree to test for surface hit
-			auto surfaceHit = [=,&R1,&hit]( SurfaceData const & surface ) -> bool {
+			// Lambda function for the BVH to test for surface hit
+			auto surfaceHit = [=,&R1,&hit]( int const ISurf ) -> bool {
+				auto const & surface( Surface( ISurf ) );
 				auto const sClass( surface.Class );
 				if ( ( surface.ShadowingSurf ) || // Shadowing surface
 				 ( ( surface.Zone == window_Zone ) && // Surface is in same zone as window
 				 ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && // Wall, ceiling/roof, or floor
-				 ( &surface != window_base_p ) && ( &surface != window_base_adjacent_p ) ) ) // Exclude window's base or base-adjacent surfaces
+				 ( ISurf != window_iBaseSurf ) && ( ISurf != window_base_iExtBoundCond ) ) ) // Exclude window's base or base-adjacent surfaces
 				{
-					PierceSurface( surface, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
+					PierceSurface( ISurf, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
 					return hit;
 				} else {
 					return false;
 				}
 			};
 
-			// Check octree surface candidates until a hit is found, if any
-			surfaceOctree.hasSurfaceSegmentIntersectsCube( R1, R2, surfaceHit );
+			// Check BVH surface candidates until a hit is found, if any
+			surfaceBVH.hasSurfaceSegmentIntersects( R1, R2, surfaceHit );
 
 		}
 
@@ -5665,6 +5792,7 @@ namespace DaylightingManager {
 		//       DATE WRITTEN   Feb 2004
 		//       MODIFIED na
 		//       RE-ENGINEERED  Sept 2015. Stuart Mentzer. Octree for performance.
+		//                      Oct 2026. Surface BVH replaces the octree.
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Determines if a ray from point R1 on window IWin1 to point R2
@@ -5675,8 +5803,8 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int IType; // Surface type/class
-		static Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction surface (m)
-		static Vector3< Real64 > RN; // Unit vector along ray from R1 to R2
+		static thread_local Vector3< Real64 > HP; // Hit coordinates, if ray hits an obstruction surface (m)
+		static thread_local Vector3< Real64 > RN; // Unit vector along ray from R1 to R2
 
 		hit = false;
 		RN = ( R2 - R1 ).normalize(); // Unit vector
@@ -5697,7 +5825,7 @@ namespace DaylightingManager {
 //		assert( window1.Zone == window2_Zone ); //? This is violated in PurchAirWithDoubleFacadeDaylighting so then why the asymmetry of only checking for wall/roof/floor for window2 zone below?
 
 		// Loop over potentially obstructing surfaces, which can be building elements, like walls, or shadowing surfaces, like overhangs
-		if ( TotSurfaces < octreeCrossover ) { // Linear search through surfaces
+		if ( surfaceBVH.empty() ) { // Linear search through surfaces
 
 			for ( int ISurf = 1; ISurf <= TotSurfaces; ++ISurf ) {
 				auto const & surface( Surface( ISurf ) );
@@ -5713,34 +5841,27 @@ namespace DaylightingManager {
 				}
 			}
 
-		} else { // Surface octree search
-
-			auto const window1_base_p( &window1_base );
-			auto const & window1_base_adjacent( window1_base_iExtBoundCond > 0 ? Surface( window1_base_iExtBoundCond ) : window1_base );
-			auto const window1_base_adjacent_p( &window1_base_adjacent );
-
-			auto const window2_base_p( &window2_base );
-			auto const & window2_base_adjacent( window2_base_iExtBoundCond > 0 ? Surface( window2_base_iExtBoundCond ) : window2_base );
-			auto const window2_base_adjacent_p( &window2_base_adjacent );
+		} else { // Surface BVH search
 
-			// Lambda function for the octree to test for surface hit
-			auto surfaceHit = [=,&R1,&hit]( SurfaceData const & surface ) -> bool {
+			// Lambda function for the BVH to test for surface hit
+			auto surfaceHit = [=,&R1,&hit]( int const ISurf ) -> bool {
+				auto const & surface( Surface( ISurf ) );
 				auto const sClass( surface.Class );
 				if ( ( surface.ShadowingSurf ) || // Shadowing surface
 				 ( ( surface.Zone == window2_Zone ) && // Surface is in same zone as window
 				 ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && // Wall, ceiling/roof, or floor
-				 ( &surface != window1_base_p ) && ( &surface != window2_base_p ) && // Exclude windows' base surfaces
-				 ( &surface != window1_base_adjacent_p ) && ( &surface != window2_base_adjacent_p ) ) ) // Exclude windows' base-adjacent surfaces
+				 ( ISurf != window1_iBaseSurf ) && ( ISurf != window2_iBaseSurf ) && // Exclude windows' base surfaces
+				 ( ISurf != window1_base_iExtBoundCond ) && ( ISurf != window2_base_iExtBoundCond ) ) ) // Exclude windows' base-adjacent surfaces
 				{
-					PierceSurface( surface, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
+					PierceSurface( ISurf, R1, RN, d12, HP, hit ); // Check if R2-R1 segment pierces surface
 					return hit;
 				} else {
 					return false;
 				}
 			};
 
-			// Check octree surface candidates until a hit is found, if any
-			surfaceOctree.hasSurfaceSegmentIntersectsCube( R1, R2, surfaceHit );
+			// Check BVH surface candidates until a hit is found, if any
+			surfaceBVH.hasSurfaceSegmentIntersects( R1, R2, surfaceHit );
 
 		}
 
@@ -6906,16 +7027,16 @@ namespace DaylightingManager {
 		// In the following I,J arrays:
 		// I = sky type;
 		// J = 1 for bare window, 2 and above for window with shade or blind.
-		static Array2D< Real64 > FLFWSK( MaxSlatAngs+1, 4 ); // Sky-related downgoing luminous flux
-		static Array1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
-		static Array1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
-		static Array2D< Real64 > FLCWSK( MaxSlatAngs+1, 4 ); // Sky-related upgoing luminous flux
-		static Array1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
+		static thread_local Array2D< Real64 > FLFWSK( MaxSlatAngs+1, 4 ); // Sky-related downgoing luminous flux
+		static thread_local Array1D< Real64 > FLFWSU( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, excluding entering beam
+		static thread_local Array1D< Real64 > FLFWSUdisk( MaxSlatAngs+1 ); // Sun-related downgoing luminous flux, due to entering beam
+		static thread_local Array2D< Real64 > FLCWSK( MaxSlatAngs+1, 4 ); // Sky-related upgoing luminous flux
+		static thread_local Array1D< Real64 > FLCWSU( MaxSlatAngs+1 ); // Sun-related upgoing luminous flux
 
 		int ISky; // Sky type index: 1=clear, 2=clear turbid,
 		//  3=intermediate, 4=overcast
-		static Array1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
-		static Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
+		static thread_local Array1D< Real64 > TransMult( MaxSlatAngs ); // Transmittance multiplier
+		static thread_local Array1D< Real64 > TransBmBmMult( MaxSlatAngs ); // Isolated blind beam-beam transmittance
 		Real64 DPH; // Sky/ground element altitude and azimuth increments (radians)
 		Real64 DTH;
 		int IPH; // Sky/ground element altitude and azimuth indices
@@ -6936,12 +7057,12 @@ namespace DaylightingManager {
 		Real64 COSB; // Cosine of angle of incidence of light from sky or ground
 		Real64 TVISBR; // Transmittance of window without shading at COSB
 		//  (times light well efficiency, if appropriate)
-		static Vector4< Real64 > ZSK; // Sky-related and sun-related illuminance on window from sky/ground
+		static thread_local Vector4< Real64 > ZSK; // Sky-related and sun-related illuminance on window from sky/ground
 		Real64 ZSU;
 		//  element for clear and overcast sky
-		static Vector3< Real64 > U; // Unit vector in (PH,TH) direction
+		static thread_local Vector3< Real64 > U; // Unit vector in (PH,TH) direction
 		Real64 ObTrans; // Product of solar transmittances of obstructions seen by a light ray
-		static Array2D< Real64 > ObTransM( NPHMAX, NTHMAX ); // ObTrans value for each (TH,PH) direction
+		static thread_local Array2D< Real64 > ObTransM( NPHMAX, NTHMAX ); // ObTrans value for each (TH,PH) direction
 		//unused  REAL(r64)         :: HitPointLumFrClearSky     ! Luminance of obstruction from clear sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrOvercSky     ! Luminance of obstruction from overcast sky (cd/m2)
 		//unused  REAL(r64)         :: HitPointLumFrSun          ! Luminance of obstruction from sun (cd/m2)
@@ -6993,26 +7114,26 @@ namespace DaylightingManager {
 		//  obstruction (for unit beam normal illuminance)
 		int NearestHitSurfNum; // Surface number of nearest obstruction
 		int NearestHitSurfNumX; // Surface number to use when obstruction is a shadowing surface
-		static Vector3< Real64 > NearestHitPt; // Hit point of ray on nearest obstruction (m)
+		static thread_local Vector3< Real64 > NearestHitPt; // Hit point of ray on nearest obstruction (m)
 		Real64 LumAtHitPtFrSun; // Luminance at hit point on obstruction from solar reflection
 		//  for unit beam normal illuminance (cd/m2)
 		Real64 SunObstructionMult; // = 1 if sun hits a ground point; otherwise = 0
-		static Array2D< Real64 > SkyObstructionMult( NPHMAX, NTHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
+		static thread_local Array2D< Real64 > SkyObstructionMult( NPHMAX, NTHMAX ); // Ratio of obstructed to unobstructed sky diffuse at
 		// a ground point for each (TH,PH) direction
 		Real64 Alfa; // Direction angles for ray heading towards the ground (radians)
 		Real64 Beta;
 		Real64 HorDis; // Distance between ground hit point and proj'n of window center onto ground (m)
-		static Vector3< Real64 > GroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
+		static thread_local Vector3< Real64 > GroundHitPt; // Coordinates of point that ray from window center hits the ground (m)
 		int ObsSurfNum; // Obstruction surface number
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
+		static thread_local Vector3< Real64 > ObsHitPt; // Coordinates of hit point on an obstruction (m)
 		int ObsConstrNum; // Construction number of obstruction
 		Real64 ObsVisRefl; // Visible reflectance of obstruction
 		Real64 SkyReflVisLum; // Reflected sky luminance at hit point divided by unobstructed sky
 		//  diffuse horizontal illuminance [(cd/m2)/lux]
 		Real64 dReflObsSky; // Contribution to sky-related illuminance on window due to sky diffuse
 		//  reflection from an obstruction
-		static Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
+		static thread_local Vector3< Real64 > URay; // Unit vector in (Phi,Theta) direction
 		Real64 TVisSunRefl; // Diffuse vis trans of bare window for beam reflection calc
 		//  (times light well efficiency, if appropriate)
 		Real64 ZSU1refl; // Beam normal illuminance times ZSU1refl = illuminance on window
@@ -8465,12 +8586,12 @@ namespace DaylightingManager {
 		Real64 ElevWin; // Window elevation: angle between window outward normal and horizontal (radians)
 		Real64 AzimWin; // Window azimuth (radians)
 		Real64 AzimSun; // Sun azimuth (radians)
-		static Vector3< Real64 > WinNorm; // Window outward normal unit vector
+		static thread_local Vector3< Real64 > WinNorm; // Window outward normal unit vector
 		Real64 ThWin; // Azimuth angle of WinNorm
-		static Vector3< Real64 > SunPrime; // Projection of sun vector onto plane (perpendicular to
+		static thread_local Vector3< Real64 > SunPrime; // Projection of sun vector onto plane (perpendicular to
 		//  window plane) determined by WinNorm and vector along
 		//  baseline of window
-		static Vector3< Real64 > WinNormCrossBase; // Cross product of WinNorm and vector along window baseline
+		static thread_local Vector3< Real64 > WinNormCrossBase; // Cross product of WinNorm and vector along window baseline
 		//  INTEGER            :: IComp             ! Vector component index
 
 		// FLOW:
@@ -8517,7 +8638,7 @@ namespace DaylightingManager {
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   November 2003
 		//       MODIFIED       na
-		//       RE-ENGINEERED  na
+		//       RE-ENGINEERED  Oct 2026. Surface BVH search for large models.
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Determines surface number and hit point of closest exterior obstruction hit
@@ -8544,7 +8665,7 @@ namespace DaylightingManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		// na
-		static Vector3< Real64 > HitPt; // Hit point on an obstruction (m)
+		static thread_local Vector3< Real64 > HitPt; // Hit point on an obstruction (m)
 		bool hit; // True iff obstruction is hit
 
 		// FLOW:
@@ -8552,7 +8673,7 @@ namespace DaylightingManager {
 		NearestHitSurfNum = 0;
 		Real64 NearestHitDistance_sq( std::numeric_limits< Real64 >::max() ); // Distance squared from receiving point to nearest hit point for a ray (m^2)
 		NearestHitPt = 0.0;
-		if ( TotSurfaces < octreeCrossover ) { // Linear search through surfaces
+		if ( surfaceBVH.empty() ) { // Linear search through surfaces
 
 			for ( int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
 				if ( Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) {
@@ -8577,27 +8698,25 @@ namespace DaylightingManager {
 				}
 			} // End of loop over possible obstructions for this ray
 
-		} else { // Surface octree search
-
-			SurfaceData const * nearestHitSurface( nullptr );
+		} else { // Surface BVH search
 
-			// Lambda function for the octree to test for surface hit
-			auto surfaceHit = [=,&RecPt,&RayVec,&hit,&NearestHitDistance_sq,&nearestHitSurface,&NearestHitPt]( SurfaceData const & surface ) {
-				if ( surface.ShadowSurfPossibleObstruction ) {
+			// Lambda function for the BVH to test for surface hit
+			auto surfaceHit = [=,&RecPt,&RayVec,&hit,&NearestHitDistance_sq,&NearestHitSurfNum,&NearestHitPt]( int const ObsSurfNum ) {
+				if ( Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) {
 					// Determine if this ray hits the surface and, if so, get the distance from the receiving point to the hit
-					PierceSurface( surface, RecPt, RayVec, HitPt, hit ); // Check if ray pierces surface
+					PierceSurface( ObsSurfNum, RecPt, RayVec, HitPt, hit ); // Check if ray pierces surface
 					if ( hit ) { // Ray pierces surface
-						// If obstruction is a window and its base surface is the nearest obstruction hit so far set nearestHitSurface to this window
+						// If obstruction is a window and its base surface is the nearest obstruction hit so far set NearestHitSurfNum to this window
 						// Note that in this case NearestHitDistance_sq has already been calculated, so does not have to be recalculated
-						if ( ( surface.Class == SurfaceClass_Window ) && ( surface.BaseSurf > 0 ) && ( &Surface( surface.BaseSurf ) == nearestHitSurface ) ) {
-							nearestHitSurface = &surface;
+						if ( ( Surface( ObsSurfNum ).Class == SurfaceClass_Window ) && ( Surface( ObsSurfNum ).BaseSurf == NearestHitSurfNum ) ) {
+							NearestHitSurfNum = ObsSurfNum;
 						} else {
 							// Distance squared from receiving point to hit point
 							Real64 const HitDistance_sq( distance_squared( HitPt, RecPt ) );
-							// Reset nearestHitSurface and NearestHitDistance_sq if this hit point is closer than previous closest
+							// Reset NearestHitSurfNum and NearestHitDistance_sq if this hit point is closer than previous closest
 							if ( HitDistance_sq < NearestHitDistance_sq ) {
 								NearestHitDistance_sq = HitDistance_sq;
-								nearestHitSurface = &surface;
+								NearestHitSurfNum = ObsSurfNum;
 								NearestHitPt = HitPt;
 							}
 						}
@@ -8605,18 +8724,9 @@ namespace DaylightingManager {
 				}
 			};
 
-			// Process octree surface candidates
-			Vector3< Real64 > const RayVec_inv( SurfaceOctreeCube::safe_inverse( RayVec ) );
-			surfaceOctree.processSurfaceRayIntersectsCube( RecPt, RayVec, RayVec_inv, surfaceHit );
-			if ( nearestHitSurface != nullptr ) { // Find surface number: This is inefficient: Improve when surfaces know their own number
-				for ( int i = 1; i <= TotSurfaces; ++i ) {
-					if ( &Surface( i ) == nearestHitSurface ) {
-						NearestHitSurfNum = i;
-						break;
-					}
-				}
-				assert( NearestHitSurfNum != 0 );
-			}
+			// Process BVH surface candidates
+			Vector3< Real64 > const RayVec_inv( SurfaceBVH::safe_inverse( RayVec ) );
+			surfaceBVH.processSurfaceRayIntersects( RecPt, RayVec, RayVec_inv, surfaceHit );
 
 		}
 
@@ -8661,10 +8771,10 @@ namespace DaylightingManager {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Vector3< Real64 > ReflNorm; // Unit normal to reflecting surface (m)
+		static thread_local Vector3< Real64 > ReflNorm; // Unit normal to reflecting surface (m)
 		int ObsSurfNum; // Obstruction surface number
 		bool hitObs; // True iff obstruction is hit
-		static Vector3< Real64 > ObsHitPt; // Hit point on obstruction (m)
+		static thread_local Vector3< Real64 > ObsHitPt; // Hit point on obstruction (m)
 		Real64 CosIncAngAtHitPt; // Cosine of angle of incidence of sun at HitPt
 		Real64 DiffVisRefl; // Diffuse visible reflectance of ReflSurfNum
 
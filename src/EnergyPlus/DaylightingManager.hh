@@ -81,16 +81,16 @@ namespace DaylightingManager {
 
 	// Data
 	// MODULE PARAMETER DEFINITIONS:
-	extern int const octreeCrossover; // Surface count crossover for switching to octree algorithm
+	// na
 
 	// MODULE VARIABLE DECLARATIONS:
 	extern int TotWindowsWithDayl; // Total number of exterior windows in all daylit zones
 	extern int OutputFileDFS; // Unit number for daylight factors
 	extern Array1D< Real64 > DaylIllum; // Daylight illuminance at reference points (lux)
-	extern Real64 PHSUN; // Solar altitude (radians)
-	extern Real64 SPHSUN; // Sine of solar altitude
-	extern Real64 CPHSUN; // Cosine of solar altitude
-	extern Real64 THSUN; // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
+	extern thread_local Real64 PHSUN; // Solar altitude (radians)
+	extern thread_local Real64 SPHSUN; // Sine of solar altitude
+	extern thread_local Real64 CPHSUN; // Cosine of solar altitude
+	extern thread_local Real64 THSUN; // Solar azimuth (rad) in Absolute Coordinate System (azimuth=0 along east)
 	extern Array1D< Real64 > PHSUNHR; // Hourly values of PHSUN
 	extern Array1D< Real64 > SPHSUNHR; // Hourly values of the sine of PHSUN
 	extern Array1D< Real64 > CPHSUNHR; // Hourly values of the cosine of PHSUN
@@ -100,24 +100,24 @@ namespace DaylightingManager {
 	// I = 1 for clear sky, 2 for clear turbid, 3 for intermediate, 4 for overcast;
 	// J = 1 for bare window, 2 - 12 for shaded;
 	// K = sun position index.
-	extern Array3D< Real64 > EINTSK; // Sky-related portion of internally reflected illuminance
-	extern Array2D< Real64 > EINTSU; // Sun-related portion of internally reflected illuminance,
+	extern thread_local Array3D< Real64 > EINTSK; // Sky-related portion of internally reflected illuminance
+	extern thread_local Array2D< Real64 > EINTSU; // Sun-related portion of internally reflected illuminance,
 	// excluding entering beam
-	extern Array2D< Real64 > EINTSUdisk; // Sun-related portion of internally reflected illuminance
+	extern thread_local Array2D< Real64 > EINTSUdisk; // Sun-related portion of internally reflected illuminance
 	// due to entering beam
-	extern Array3D< Real64 > WLUMSK; // Sky-related window luminance
-	extern Array2D< Real64 > WLUMSU; // Sun-related window luminance, excluding view of solar disk
-	extern Array2D< Real64 > WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
+	extern thread_local Array3D< Real64 > WLUMSK; // Sky-related window luminance
+	extern thread_local Array2D< Real64 > WLUMSU; // Sun-related window luminance, excluding view of solar disk
+	extern thread_local Array2D< Real64 > WLUMSUdisk; // Sun-related window luminance, due to view of solar disk
 
 	extern Array2D< Real64 > GILSK; // Horizontal illuminance from sky, by sky type, for each hour of the day
 	extern Array1D< Real64 > GILSU; // Horizontal illuminance from sun for each hour of the day
 
-	extern Array3D< Real64 > EDIRSK; // Sky-related component of direct illuminance
-	extern Array2D< Real64 > EDIRSU; // Sun-related component of direct illuminance (excluding beam solar at ref pt)
-	extern Array2D< Real64 > EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
-	extern Array3D< Real64 > AVWLSK; // Sky-related average window luminance
-	extern Array2D< Real64 > AVWLSU; // Sun-related average window luminance, excluding view of solar disk
-	extern Array2D< Real64 > AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
+	extern thread_local Array3D< Real64 > EDIRSK; // Sky-related component of direct illuminance
+	extern thread_local Array2D< Real64 > EDIRSU; // Sun-related component of direct illuminance (excluding beam solar at ref pt)
+	extern thread_local Array2D< Real64 > EDIRSUdisk; // Sun-related component of direct illuminance due to beam solar at ref pt
+	extern thread_local Array3D< Real64 > AVWLSK; // Sky-related average window luminance
+	extern thread_local Array2D< Real64 > AVWLSU; // Sun-related average window luminance, excluding view of solar disk
+	extern thread_local Array2D< Real64 > AVWLSUdisk; // Sun-related average window luminance due to view of solar disk
 
 	// Allocatable daylight factor arrays  -- are in the ZoneDaylight Structure
 
@@ -146,9 +146,31 @@ namespace DaylightingManager {
 	void
 	CalcDayltgCoeffsRefPoints( int const ZoneNum );
 
+	void
+	CalcDayltgCoeffsAtRefPoint(
+		int const ZoneNum,
+		int const IL,
+		Real64 const AZVIEW,
+		Vector3< Real64 > const & VIEWVC,
+		bool & MySunIsUpFlag
+	);
+
 	void
 	CalcDayltgCoeffsMapPoints( int const ZoneNum );
 
+	void
+	CalcDayltgCoeffsAtMapPoint(
+		int const ZoneNum,
+		int const MapNum,
+		int const IL,
+		Real64 const AZVIEW,
+		Vector3< Real64 > const & VIEWVC,
+		bool & MySunIsUpFlag
+	);
+
+	bool
+	CanCalcDayltgCoeffsConcurrently( int const ZoneNum );
+
 	void
 	FigureDayltgCoeffsAtPointsSetupForWindow(
 		int const ZoneNum,
@@ -398,9 +398,29 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( TraceHVACControllerEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TraceHVACControllerEnvFlag = env_var_on( cEnvValue ); // Yes or True
 
+	// Concurrent simulation of independent air loops (uses the threads for parallel calculations below)
+	get_environment_variable( ParallelAirLoopsEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) ParallelAirLoopsEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	// Reuse of plant branch results within a plant solve when the branch states are unchanged
+	get_environment_variable( SkipUnchangedPlantBranchesEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) SkipUnchangedPlantBranchesEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	// Concurrent simulation of independent plant loops (uses the threads for parallel calculations below)
+	get_environment_variable( ParallelPlantLoopsEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) ParallelPlantLoopsEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
+	// Precomputed thermal response of bare multi-pane glazing as the start of the window heat balance
+	get_environment_variable( WindowResponseTablesEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() ) WindowResponseTablesEnvFlag = env_var_on( cEnvValue ); // Yes or True
+
 	get_environment_variable( cDisplayInputInAuditEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) DisplayInputInAudit = env_var_on( cEnvValue ); // Yes or True
 
+	// Threads for parallel calculations (serial unless EP_OMP_NUM_THREADS is set)
+	get_environment_variable( EPNumThreadsEnvVar, cEnvValue );
+	if ( ! cEnvValue.empty() && is_int( cEnvValue ) ) NumberParallelThreads = max( 1, int_of( cEnvValue ) );
+
 	if ( ! filepath.empty() ) {
 		// if filepath is not empty, then we are using E+ as a library API call
 		// change the directory to the specified folder, and pass in dummy args to command line parser
@@ -66,7 +66,12 @@ extern "C" {
 
 // C & C++ Headers
 #include <stdlib.h>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -81,6 +86,7 @@ extern "C" {
 #include <DataStringGlobals.hh>
 #include <DataSystemVariables.hh>
 #include <EMSManager.hh>
+#include <FileSystem.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
@@ -811,7 +817,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Thierry S. Nouidui, Michael Wetter, Wangda Zuo
 		//       DATE WRITTEN   08Aug2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; one fmiGetReal and one fmiSetReal per instance and time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -853,86 +859,39 @@ namespace ExternalInterface {
 						FMU( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue = FMUTemp( i ).Instance( j ).fmuOutputVariableActuator( k ).RealVarValue;
 					}
 				} else {
-					// Get from FMUs, values that will be set in EnergyPlus (Schedule)
-
-					if ( size( FMU(i).Instance(j).fmuOutputVariableSchedule ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec;
-						std::vector<Real64> realVarValueVec;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							valueReferenceVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference );
-							realVarValueVec.push_back( FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue );
+					// Get from FMUs, values that will be set in EnergyPlus (Schedule, then Variable, then Actuator)
+					auto & instance( FMU( i ).Instance( j ) );
+					int const numSchedule( size( instance.fmuOutputVariableSchedule ) );
+					int const numVariable( size( instance.fmuOutputVariableVariable ) );
+					int numOutputs( numSchedule + numVariable + size( instance.fmuOutputVariableActuator ) );
+
+					if ( numOutputs > 0 ) {
+
+						// the value references do not change during the simulation
+						if ( instance.OutputValueReferences.size() != static_cast< std::size_t >( numOutputs ) ) {
+							instance.OutputValueReferences.clear();
+							for ( auto const & var : instance.fmuOutputVariableSchedule ) instance.OutputValueReferences.push_back( var.ValueReference );
+							for ( auto const & var : instance.fmuOutputVariableVariable ) instance.OutputValueReferences.push_back( var.ValueReference );
+							for ( auto const & var : instance.fmuOutputVariableActuator ) instance.OutputValueReferences.push_back( var.ValueReference );
+							instance.OutputValues.resize( numOutputs );
 						}
 
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec[0], &realVarValueVec[0], &FMU( i ).Instance( j ).NumOutputVariablesSchedule, &FMU( i ).Instance( j ).Index );
+						instance.fmistatus = fmiEPlusGetReal( &instance.fmicomponent, instance.OutputValueReferences.data(), instance.OutputValues.data(), &numOutputs, &instance.Index );
 
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableSchedule ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).ValueReference = valueReferenceVec[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableSchedule( x ).RealVarValue = realVarValueVec[x-1];
-						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
+						for ( k = 1; k <= numSchedule; ++k ) {
+							instance.fmuOutputVariableSchedule( k ).RealVarValue = instance.OutputValues[ k - 1 ];
 						}
-
-					}
-
-					// generate vectors here first
-					if ( size(FMU(i).Instance(j).fmuOutputVariableVariable) > 0 ) {
-
-						std::vector<unsigned int> valueReferenceVec2;
-						std::vector<Real64> realVarValueVec2;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							valueReferenceVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference );
-							realVarValueVec2.push_back( FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue );
+						for ( k = 1; k <= numVariable; ++k ) {
+							instance.fmuOutputVariableVariable( k ).RealVarValue = instance.OutputValues[ numSchedule + k - 1 ];
 						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec2[0], &realVarValueVec2[0], &FMU( i ).Instance( j ).NumOutputVariablesVariable, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableVariable ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).ValueReference = valueReferenceVec2[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableVariable( x ).RealVarValue = realVarValueVec2[x-1];
+						for ( k = 1; k <= isize( instance.fmuOutputVariableActuator ); ++k ) {
+							instance.fmuOutputVariableActuator( k ).RealVarValue = instance.OutputValues[ numSchedule + numVariable + k - 1 ];
 						}
 
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
+						if ( instance.fmistatus != fmiOK ) {
 							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
-						}
-
-					}
-
-					if ( size( FMU( i ).Instance( j ).fmuOutputVariableActuator ) > 0 ) {
-
-						// generate vectors here first
-						std::vector<unsigned int> valueReferenceVec3;
-						std::vector<Real64> realVarValueVec3;
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							valueReferenceVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference );
-							realVarValueVec3.push_back( FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue );
-						}
-
-						// pass in the vectors as pointers to the first member of the vector
-						FMU( i ).Instance( j ).fmistatus = fmiEPlusGetReal ( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec3[0], &realVarValueVec3[0], &FMU( i ).Instance( j ).NumOutputVariablesActuator, &FMU( i ).Instance( j ).Index );
-
-						for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuOutputVariableActuator ); ++x ) {
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).ValueReference = valueReferenceVec3[x-1];
-							FMU( i ).Instance( j ).fmuOutputVariableActuator( x ).RealVarValue = realVarValueVec3[x-1];
-						}
-
-						if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
-							ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to get outputs" );
-							ShowContinueError( "in instance \"" + FMU( i ).Instance( j ).Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
-							ShowContinueError( "Error Code = \"" + TrimSigDigits( FMU( i ).Instance( j ).fmistatus ) + "\"" );
+							ShowContinueError( "in instance \"" + instance.Name + "\" of FMU \"" + FMU( i ).Name + "\"" );
+							ShowContinueError( "Error Code = \"" + TrimSigDigits( instance.fmistatus ) + "\"" );
 							ErrorsFound = true;
 							StopExternalInterfaceIfError();
 						}
@@ -969,19 +928,18 @@ namespace ExternalInterface {
 				}
 
 				if ( ! FlagReIni ) {
+					auto & instance( FMU( i ).Instance( j ) );
 
-					// generate vectors here first
-					std::vector<unsigned int> valueReferenceVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).fmuInputVariable ); ++x ) {
-						valueReferenceVec4.push_back( FMU( i ).Instance( j ).fmuInputVariable( x ).ValueReference );
+					// the value references do not change during the simulation
+					if ( instance.InputValueReferences.size() != instance.fmuInputVariable.size() ) {
+						instance.InputValueReferences.clear();
+						for ( auto const & var : instance.fmuInputVariable ) instance.InputValueReferences.push_back( var.ValueReference );
 					}
 
-					std::vector<Real64> rtsValueVec4;
-					for ( unsigned long x = 1; x <= size( FMU( i ).Instance( j ).eplusOutputVariable ); ++x ) {
-						rtsValueVec4.push_back( FMU( i ).Instance( j ).eplusOutputVariable( x ).RTSValue );
-					}
+					instance.InputValues.clear();
+					for ( auto const & var : instance.eplusOutputVariable ) instance.InputValues.push_back( var.RTSValue );
 
-					FMU( i ).Instance( j ).fmistatus = fmiEPlusSetReal( &FMU( i ).Instance( j ).fmicomponent, &valueReferenceVec4[0], &rtsValueVec4[0], &FMU( i ).Instance( j ).NumInputVariablesInIDF, &FMU( i ).Instance( j ).Index );
+					instance.fmistatus = fmiEPlusSetReal( &instance.fmicomponent, instance.InputValueReferences.data(), instance.InputValues.data(), &instance.NumInputVariablesInIDF, &instance.Index );
 
 					if ( FMU( i ).Instance( j ).fmistatus != fmiOK ) {
 						ShowSevereError( "ExternalInterface/GetSetVariablesAndDoStepFMUImport: Error when trying to set inputs" );
@@ -1140,7 +1098,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Thierry S. Nouidui, Michael Wetter, Wangda Zuo
 		//       DATE WRITTEN   08Aug2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; reuse FMUs unpacked by previous runs from EPLUS_FMU_CACHE_DIR
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1165,6 +1123,14 @@ namespace ExternalInterface {
 		using DataStringGlobals::pathChar;
 		using DataStringGlobals::altpathChar;
 		using DataStringGlobals::CurrentWorkingFolder;
+		using FileSystem::copyDirectory;
+		using FileSystem::directoryExists;
+		using FileSystem::getParentDirectoryPath;
+		using FileSystem::getProcessId;
+		using FileSystem::makeDirectory;
+		using FileSystem::moveFile;
+		using FileSystem::pathExists;
+		using FileSystem::removeDirectory;
 
 		// Locals
 		int i, j, k, l, Loop; // Loop counters
@@ -1191,6 +1157,7 @@ namespace ExternalInterface {
 		Array1D_string fullFileName; // entered file name/found
 		std::string::size_type pos;
 		int FOUND;
+		std::string FMUCacheFolder; // Folder of the FMUs unpacked by previous runs; empty if not used
 
 		if ( FirstCallIni ) {
 			DisplayString( "Initializing FunctionalMockupUnitImport interface" );
@@ -1311,6 +1278,27 @@ namespace ExternalInterface {
 				}
 			}
 
+			// Parametric runs over the same FMUs can keep the unpacked FMUs in a cache folder, keyed by the
+			// content of the FMU file only, so identical FMUs share one tree. Each instance of each run works in
+			// its own copy of the cached tree, so that its library is loaded separately.
+			char const * const EPLUS_FMU_CACHE_DIR = getenv( "EPLUS_FMU_CACHE_DIR" );
+			if ( EPLUS_FMU_CACHE_DIR != nullptr && *EPLUS_FMU_CACHE_DIR != '\0' ) {
+				FMUCacheFolder = EPLUS_FMU_CACHE_DIR;
+				while ( FMUCacheFolder.size() > 1 && ( FMUCacheFolder.back() == pathChar || FMUCacheFolder.back() == altpathChar ) ) {
+					FMUCacheFolder.pop_back();
+				}
+				if ( ! directoryExists( FMUCacheFolder ) && pathExists( getParentDirectoryPath( FMUCacheFolder ) ) ) {
+					makeDirectory( FMUCacheFolder );
+				}
+				if ( directoryExists( FMUCacheFolder ) ) {
+					FMUCacheFolder += pathChar;
+				} else {
+					ShowWarningError( "InitExternalInterfaceFMUImport: cannot create the FMU cache folder \"" + FMUCacheFolder + "\" given by EPLUS_FMU_CACHE_DIR." );
+					ShowContinueError( "The FMUs will be unpacked in \"" + FMURootWorkingFolder + "\"." );
+					FMUCacheFolder.clear();
+				}
+			}
+
 			// write output folder where FMUs will be unpacked later on.
 			for ( i = 1; i <= NumFMUObjects; ++i ) {
 				for ( j = 1; j <= FMU( i ).NumInstances; ++j ) {
@@ -1320,27 +1308,47 @@ namespace ExternalInterface {
 
 			// parse the fmu defined in the idf using the fmuUnpack.
 			for ( i = 1; i <= NumFMUObjects; ++i ) {
+				std::string const cacheKey( FMUCacheFolder.empty() ? std::string() : GetFMUCacheKey( fullFileName( i ) ) );
+				std::string const cacheFolder( cacheKey.empty() ? std::string() : FMUCacheFolder + cacheKey );
 				for ( j = 1; j <= FMU( i ).NumInstances; ++j ) {
 					// get the length of working folder trimmed
 					FMU( i ).Instance( j ).LenWorkingFolder = FMU( i ).Instance( j ).WorkingFolder.length();
-					// unpack fmus
+					// unpack fmus, into the cache unless a previous run left them there
 					// preprocess arguments for library call
-					{
+					retVal = 0;
+					if ( cacheFolder.empty() || ! directoryExists( cacheFolder ) ) {
+						// a cache entry is unpacked aside, then renamed, so that concurrent runs only ever see complete trees
+						std::string const unpackFolder( cacheFolder.empty() ? FMU( i ).Instance( j ).WorkingFolder : cacheFolder + ".part" + std::to_string( getProcessId() ) + '_' + std::to_string( std::chrono::system_clock::now().time_since_epoch().count() ) );
 						auto fullFileNameArr( getCharArrayFromString( fullFileName( i ) ) );
-						auto workingFolderArr( getCharArrayFromString( FMU( i ).Instance( j ).WorkingFolder ) );
+						auto workingFolderArr( getCharArrayFromString( unpackFolder ) );
 						int lenFileName( len( fullFileName( i ) ) );
+						int lenUnpackFolder( unpackFolder.length() );
 
 						// make the library call
-						retVal = fmiEPlusUnpack( &fullFileNameArr[0], &workingFolderArr[0], &lenFileName, &FMU( i ).Instance( j ).LenWorkingFolder );
+						retVal = fmiEPlusUnpack( &fullFileNameArr[0], &workingFolderArr[0], &lenFileName, &lenUnpackFolder );
 
-						if ( retVal != 0 ) {
-							ShowSevereError( "ExternalInterface/InitExternalInterfaceFMUImport: Error when trying to" );
-							ShowContinueError( "unpack the FMU \"" + FMU( i ).Name + "\"." );
-							ShowContinueError( "Check if the FMU exists. Also check if the FMU folder is not write protected." );
-							ErrorsFound = true;
-							StopExternalInterfaceIfError();
+						// if another run has just cached the same FMU, its tree is used and this one is removed
+						if ( ! cacheFolder.empty() ) {
+							if ( retVal == 0 ) moveFile( unpackFolder, cacheFolder );
+							if ( directoryExists( unpackFolder ) ) removeDirectory( unpackFolder );
+							if ( ! directoryExists( cacheFolder ) ) retVal = -1;
 						}
+					}
 
+					// concurrent runs share the cached tree, so each run works in its own copy
+					if ( ! cacheFolder.empty() && retVal == 0 ) {
+						if ( directoryExists( FMU( i ).Instance( j ).WorkingFolder ) ) removeDirectory( FMU( i ).Instance( j ).WorkingFolder );
+						if ( ! directoryExists( FMURootWorkingFolder ) ) makeDirectory( FMURootWorkingFolder );
+						copyDirectory( cacheFolder, FMU( i ).Instance( j ).WorkingFolder );
+						if ( ! directoryExists( FMU( i ).Instance( j ).WorkingFolder ) ) retVal = -1;
+					}
+
+					if ( retVal != 0 ) {
+						ShowSevereError( "ExternalInterface/InitExternalInterfaceFMUImport: Error when trying to" );
+						ShowContinueError( "unpack the FMU \"" + FMU( i ).Name + "\"." );
+						ShowContinueError( "Check if the FMU exists. Also check if the FMU folder is not write protected." );
+						ErrorsFound = true;
+						StopExternalInterfaceIfError();
 					}
 
 					{
@@ -1481,7 +1489,8 @@ namespace ExternalInterface {
 							Array1D_string tempSingleStringA( 1, FMU( i ).Instance( j ).eplusOutputVariable( k ).VarKey );
 							Array1D_string tempSingleStringB( 1, FMU( i ).Instance( j ).eplusOutputVariable( k ).Name );
 
-							// Make the call with arrays
+							// Make the call with arrays.  This also flags the variable as read by the external interface,
+							// so its zone time step value is kept current even when no report requests it
 							GetReportVariableKey( tempSingleStringA, 1, tempSingleStringB, keyIndexes, varTypes );
 
 							// Then postprocess the array items back in case they changed
@@ -2146,7 +2155,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   2Dec2007
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; resolve the exchanged report variables once and keep the exchange buffers
 		//       RE-ENGINEERED  na
 
 		// Using/Aliasing
@@ -2173,8 +2182,10 @@ namespace ExternalInterface {
 		Real64 curSimTim; // current simulation time
 		Real64 preSimTim; // previous time step's simulation time
 
-		Array1D< Real64 > dblValWri( nDblMax );
-		Array1D< Real64 > dblValRea( nDblMax );
+		static Array1D< Real64 > dblValWri( nDblMax ); // kept between calls as the exchange runs every zone time step
+		static Array1D< Real64 > dblValRea( nDblMax );
+		static std::vector< Real64 const * > valuePtrWri; // resolved report variable values, nullptr for meters and schedules
+		static std::vector< std::pair< int, int > > valueKeyWri; // variable type and index each valuePtrWri entry was resolved for
 		std::string retValCha;
 		bool continueSimulation; // Flag, true if simulation should continue
 		static bool firstCall( true );
@@ -2212,8 +2223,21 @@ namespace ExternalInterface {
 					dblValWri( i ) = GetInternalVariableValue( varTypes( i ), keyVarIndexes( i ) );
 				}
 			} else {
+				bool valuePtrsCurrent( valueKeyWri.size() == static_cast< std::size_t >( nDblWri ) );
+				for ( i = 1; valuePtrsCurrent && ( i <= nDblWri ); ++i ) {
+					valuePtrsCurrent = ( valueKeyWri[ i - 1 ] == std::make_pair( varTypes( i ), keyVarIndexes( i ) ) );
+				}
+				if ( ! valuePtrsCurrent ) {
+					valuePtrWri.resize( nDblWri );
+					valueKeyWri.resize( nDblWri );
+					for ( i = 1; i <= nDblWri; ++i ) {
+						valuePtrWri[ i - 1 ] = GetInternalVariableValueExternalInterfacePtr( varTypes( i ), keyVarIndexes( i ) );
+						valueKeyWri[ i - 1 ] = std::make_pair( varTypes( i ), keyVarIndexes( i ) );
+					}
+				}
 				for ( i = 1; i <= nDblWri; ++i ) {
-					dblValWri( i ) = GetInternalVariableValueExternalInterface( varTypes( i ), keyVarIndexes( i ) );
+					Real64 const * const valuePtr( valuePtrWri[ i - 1 ] );
+					dblValWri( i ) = valuePtr ? *valuePtr : GetInternalVariableValueExternalInterface( varTypes( i ), keyVarIndexes( i ) );
 				}
 			}
 
@@ -2305,7 +2329,7 @@ namespace ExternalInterface {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   2Dec2007
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; flag the variables read through GetInternalVariableValueExternalInterface
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2337,6 +2361,7 @@ namespace ExternalInterface {
 					if ( NamesOfKeys( iKey ) == varKeys( Loop ) ) {
 						keyVarIndexes( Loop ) = keyIndexes( iKey );
 						varTypes( Loop ) = varType;
+						SetExternalInterfaceVariable( varType, keyIndexes( iKey ) ); // keep its zone time step value current
 						break;
 					}
 				}
@@ -2410,6 +2435,46 @@ namespace ExternalInterface {
 
 	}
 
+	std::string
+	GetFMUCacheKey( std::string const & fileName )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the key of an FMU in the FMU cache folder: a 64-bit FNV-1a hash of the
+		// content of the FMU file followed by its size, in hexadecimal. Returns an empty
+		// string if the file cannot be read.
+
+		std::ifstream fmuFile( fileName, std::ios::binary );
+		if ( ! fmuFile ) return std::string();
+
+		std::uint64_t hash( 14695981039346656037ull ); // FNV offset basis
+		std::uint64_t fileSize( 0 );
+		std::vector< char > buffer( 1 << 16 );
+		while ( fmuFile ) {
+			fmuFile.read( buffer.data(), buffer.size() );
+			std::streamsize const nRead( fmuFile.gcount() );
+			for ( std::streamsize b = 0; b < nRead; ++b ) {
+				hash ^= static_cast< unsigned char >( buffer[ b ] );
+				hash *= 1099511628211ull; // FNV prime
+			}
+			fileSize += nRead;
+		}
+
+		static char const hexDigits[] = "0123456789abcdef";
+		std::string key;
+		for ( int shift = 60; shift >= 0; shift -= 4 ) key += hexDigits[ ( hash >> shift ) & 0xF ];
+		key += '_';
+		for ( int shift = 60; shift >= 0; shift -= 4 ) {
+			if ( ( fileSize >> shift ) != 0 || shift == 0 ) key += hexDigits[ ( fileSize >> shift ) & 0xF ];
+		}
+		return key;
+	}
+
 	std::vector< char >
 	getCharArrayFromString( std::string const & originalString )
 	{
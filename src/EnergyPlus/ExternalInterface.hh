@@ -77,6 +77,7 @@ extern "C" {
 
 // C++ Standard Library Headers
 #include <string>
+#include <vector>
 
 // Objexx Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -285,6 +286,12 @@ namespace ExternalInterface {
 		Array1D< fmuOutputVariableActuatorType > fmuOutputVariableActuator;
 		// Variable Types structure for energyplus input variables from type actuator
 		Array1D< eplusInputVariableActuatorType > eplusInputVariableActuator;
+		// Value references and values of all fmu outputs (schedules, then variables, then actuators) and inputs,
+		// exchanged with one fmiGetReal and one fmiSetReal per time step
+		std::vector< unsigned int > OutputValueReferences;
+		std::vector< Real64 > OutputValues;
+		std::vector< unsigned int > InputValueReferences;
+		std::vector< Real64 > InputValues;
 
 		// Default Constructor
 		InstanceType() :
@@ -408,6 +415,9 @@ namespace ExternalInterface {
 		Array1S_int varTypes
 	);
 
+	std::string
+	GetFMUCacheKey( std::string const & fileName );
+
 	std::vector< char >
 	getCharArrayFromString( std::string const & originalString );
 
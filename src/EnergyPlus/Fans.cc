@@ -163,8 +163,8 @@ namespace Fans {
 	int NumFans( 0 ); // The Number of Fans found in the Input
 	int NumNightVentPerf( 0 ); // number of FAN:NIGHT VENT PERFORMANCE objects found in the input
 	bool GetFanInputFlag( true ); // Flag set to make sure you get input once
-	bool LocalTurnFansOn( false ); // If True, overrides fan schedule and cycles ZoneHVAC component fans on
-	bool LocalTurnFansOff( false ); // If True, overrides fan schedule and LocalTurnFansOn and cycles ZoneHVAC component fans off
+	thread_local bool LocalTurnFansOn( false ); // If True, overrides fan schedule and cycles ZoneHVAC component fans on
+	thread_local bool LocalTurnFansOff( false ); // If True, overrides fan schedule and LocalTurnFansOn and cycles ZoneHVAC component fans off
 
 	namespace {
 	// These were static variables within different functions. They were pulled out into the namespace
@@ -1616,6 +1616,7 @@ namespace Fans {
 		//                      Brent Griffith, May 2009 for EMS
 		//                      Chandan Sharma, March 2011, FSEC: Added LocalTurnFansOn and LocalTurnFansOff
 		//                      Rongpeng Zhang, April 2015, added faulty fan operations due to fouling air filters
+		//                      Oct 2026; no static locals (concurrent air loops)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1660,8 +1661,8 @@ namespace Fans {
 		Real64 PartLoadFrac;
 		//unused0909      REAL(r64) MaxFlowFrac   !Variable Volume Fan Max Flow Fraction [-]
 		Real64 MinFlowFrac; // Variable Volume Fan Min Flow Fraction [-]
-		static Real64 FlowFracForPower( 0.0 ); // Variable Volume Fan Flow Fraction for power calcs[-]
-		static Real64 FlowFracActual( 0.0 ); // actual VAV fan flow fraction
+		Real64 FlowFracForPower( 0.0 ); // Variable Volume Fan Flow Fraction for power calcs[-]
+		Real64 FlowFracActual( 0.0 ); // actual VAV fan flow fraction
 		Real64 FanShaftPower; // power delivered to fan shaft
 		Real64 PowerLossToAir; // fan and motor loss to air stream (watts)
 		int NVPerfNum;
@@ -91,8 +91,8 @@ namespace Fans {
 	extern int NumFans; // The Number of Fans found in the Input
 	extern int NumNightVentPerf; // number of FAN:NIGHT VENT PERFORMANCE objects found in the input
 	extern bool GetFanInputFlag; // Flag set to make sure you get input once
-	extern bool LocalTurnFansOn; // If True, overrides fan schedule and cycles ZoneHVAC component fans on
-	extern bool LocalTurnFansOff; // If True, overrides fan schedule and LocalTurnFansOn and forces ZoneHVAC comp fans off
+	extern thread_local bool LocalTurnFansOn; // If True, overrides fan schedule and cycles ZoneHVAC component fans on
+	extern thread_local bool LocalTurnFansOff; // If True, overrides fan schedule and LocalTurnFansOn and forces ZoneHVAC comp fans off
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -297,5 +297,38 @@ linkFile(std::string const &fileName, std::string const &link)
 #endif
 }
 
+void
+copyDirectory(std::string const &directoryPath, std::string const &destination)
+{
+	// Copy a directory tree; the destination must not exist yet
+#ifdef _WIN32
+	systemCall("xcopy \"" + directoryPath + "\" \"" + destination + "\" /E /I /Q /Y > NUL");
+#else
+	systemCall("cp -R \"" + directoryPath + "\" \"" + destination + "\"");
+#endif
+}
+
+void
+removeDirectory(std::string const &directoryPath)
+{
+	// Remove a directory tree with its contents
+#ifdef _WIN32
+	systemCall("rd /S /Q \"" + directoryPath + "\"");
+#else
+	systemCall("rm -rf \"" + directoryPath + "\"");
+#endif
+}
+
+int
+getProcessId()
+{
+	// Identifier of this process, to give temporary files names no other process uses
+#ifdef _WIN32
+	return static_cast< int >( GetCurrentProcessId() );
+#else
+	return static_cast< int >( getpid() );
+#endif
+}
+
 }
 }
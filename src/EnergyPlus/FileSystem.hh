@@ -111,6 +111,15 @@ removeFile(std::string const &fileName);
 void
 linkFile(std::string const &fileName, std::string const &link);
 
+void
+copyDirectory(std::string const &directoryPath, std::string const &destination);
+
+void
+removeDirectory(std::string const &directoryPath);
+
+int
+getProcessId();
+
 
 }
 }
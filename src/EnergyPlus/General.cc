@@ -58,7 +58,9 @@
 
 // C++ Headers
 #include <cassert>
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <cstdlib>
 
 // ObjexxFCL Headers
@@ -77,6 +79,7 @@
 #include <DataSurfaces.hh>
 #include <InputProcessor.hh>
 #include <UtilityRoutines.hh>
+#include <milo/dtoa.hpp>
 
 #if defined( _WIN32 ) && _MSC_VER < 1900
 #define snprintf _snprintf
@@ -279,6 +282,7 @@ namespace General {
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   March 1999
 		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
+		//                      Oct 2026; iterates with the overload that takes f(X_0) and f(X_1)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -295,21 +299,66 @@ namespace General {
 		// USE STATEMENTS:
 		// na
 
-		// Argument array dimensioning
-
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 		// = -2: f(x0) and f(x1) have the same sign
 		// = -1: no convergence
 		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
 
-		// INTERFACE BLOCK SPECIFICATIONS
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 Y0; // f at X_0
+		Real64 Y1; // f at X_1
 
-		// DERIVED TYPE DEFINITIONS
-		// na
+		Y0 = f( X_0 );
+		Y1 = f( X_1 );
+
+		// No first estimate: X_0 never lies strictly between the bounds
+		SolveRegulaFalsi( Eps, MaxIte, Flag, XRes, f, X_0, Y0, X_1, Y1, X_0 );
+
+	}
+
+	void
+	SolveRegulaFalsi(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x) = 0
+		std::function< Real64( Real64 const ) > f,
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const Y_0, // f(X_0), already evaluated by the caller
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Real64 const Y_1, // f(X_1), already evaluated by the caller
+		Real64 const XGuess // first estimate to try if it lies between X_0 and X_1
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the value of x between x0 and x1 such that f(x)
+		// is equal to zero, for part-load solvers that have already evaluated f at the bounds.
+
+		// METHODOLOGY EMPLOYED:
+		// Uses the Regula Falsi (false position) method (similar to secant method), with f(x0) and
+		// f(x1) supplied by the caller instead of being evaluated again. The first estimate is
+		// XGuess (typically the solution found at the previous call) when it lies strictly between
+		// x0 and x1. Flag counts the function evaluations made after the bounds.
+
+		// REFERENCES:
+		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
+		// 2nd edition, 1992. Page 347 ff.
+
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+		// = -2: f(x0) and f(x1) have the same sign
+		// = -1: no convergence
+		// >  0: number of iterations performed
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const SMALL( 1.e-10 );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		Real64 X0; // present 1st bound
@@ -326,13 +375,13 @@ namespace General {
 
 		X0 = X_0;
 		X1 = X_1;
+		Y0 = Y_0;
+		Y1 = Y_1;
 		Conv = false;
 		StopMaxIte = false;
 		Cont = true;
 		NIte = 0;
 
-		Y0 = f( X0 );
-		Y1 = f( X1 );
 		// check initial values
 		if ( Y0 * Y1 > 0 ) {
 			Flag = -2;
@@ -342,10 +391,14 @@ namespace General {
 
 		while ( Cont ) {
 
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
+			if ( NIte == 0 && XGuess > min( X0, X1 ) && XGuess < max( X0, X1 ) ) {
+				XTemp = XGuess;
+			} else {
+				DY = Y0 - Y1;
+				if ( std::abs( DY ) < SMALL ) DY = SMALL;
+				// new estimation
+				XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
+			}
 			YTemp = f( XTemp );
 
 			++NIte;
@@ -1048,6 +1101,262 @@ namespace General {
 
 	}
 
+	std::string
+	FixedString(
+		Real64 const RealValue,
+		int const Width, // Field width
+		int const Decimals // Digits after the decimal point
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the string that gio produces for a real value with a Fw.d
+		// edit descriptor, without the stream and format parsing overhead of gio.
+
+		// METHODOLOGY EMPLOYED:
+		// printf with the alternate form produces the digits the stream would.  A leading zero
+		// is dropped when the field would otherwise be too wide, and the field is *-filled when
+		// it still does not fit, as Fortran does.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char Buffer[ 352 ]; // Formatted digits (wide enough for any double with 17 decimals)
+		std::string String; // Field
+
+		assert( ( Decimals >= 0 ) && ( Decimals <= 17 ) );
+		int NumChars( std::snprintf( Buffer, sizeof( Buffer ), "%#.*f", Decimals, RealValue ) );
+		char const * Chars( Buffer );
+		if ( NumChars > Width ) { // Trim a lead zero
+			if ( Buffer[ 0 ] == '0' ) {
+				++Chars;
+				--NumChars;
+			} else if ( ( Buffer[ 0 ] == '-' ) && ( Buffer[ 1 ] == '0' ) ) {
+				Buffer[ 1 ] = '-';
+				++Chars;
+				--NumChars;
+			}
+		}
+		if ( NumChars > Width ) { // Too wide: Fortran *-fills
+			String.assign( Width, '*' );
+		} else {
+			String.reserve( Width );
+			String.assign( Width - NumChars, ' ' );
+			String.append( Chars, NumChars );
+		}
+		return String;
+
+	}
+
+	std::string
+	ExponentString(
+		Real64 const RealValue,
+		int const Width, // Field width
+		int const Decimals, // Digits after the decimal point
+		int const ExpDigits, // Exponent digits
+		int const ScaleFactor // Digits before the decimal point
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the string that gio produces for a real value with a kP,Ew.dEe
+		// edit descriptor (k >= 0), without the stream, locale, and format parsing overhead of
+		// gio.  Unlike gio it uses no shared formatting state, so any thread may call it.
+
+		// METHODOLOGY EMPLOYED:
+		// Repeats the mantissa scaling and rounding adjustment of the ObjexxFCL exponent
+		// formatter so that the digits are identical, then prints the mantissa with printf.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		char Buffer[ 64 ]; // Formatted mantissa and exponent
+		std::string String; // Field
+
+		assert( ( ScaleFactor >= 0 ) && ( ScaleFactor <= 1 ) );
+		assert( ( Decimals >= 0 ) && ( Decimals <= 30 ) );
+		bool const Negative( RealValue < 0.0 );
+		Real64 Mantissa( std::abs( RealValue ) );
+		int Exponent( 0 );
+		if ( Mantissa != 0.0 ) {
+			Exponent = static_cast< int >( std::floor( std::log10( Mantissa ) ) ) + 1 - ScaleFactor;
+			if ( -Exponent < 309 ) {
+				Mantissa *= std::pow( 10, -Exponent );
+			} else {
+				Mantissa *= std::pow( (long double) 10, (long double) -Exponent );
+			}
+			if ( Mantissa >= ( ScaleFactor == 0 ? 0.9999994 : 9.999994 ) ) { // Rounding adjustment when the mantissa prints as 10^k at default precision
+				std::snprintf( Buffer, sizeof( Buffer ), "%f", Mantissa );
+				if ( ( Buffer[ 0 ] == '1' ) && ( ScaleFactor == 0 ? Buffer[ 1 ] == '.' : ( Buffer[ 1 ] == '0' ) && ( Buffer[ 2 ] == '.' ) ) ) {
+					Mantissa /= 10.0;
+					++Exponent;
+				}
+			}
+		}
+		int NumChars;
+		if ( ( Exponent != 0 ) && ( static_cast< int >( std::log10( std::abs( Exponent ) ) ) + 1 > ExpDigits ) ) { // Compact exponent without the E
+			NumChars = std::snprintf( Buffer, sizeof( Buffer ), "%.*f%+0*d", Decimals, Mantissa, ExpDigits + 2, Exponent );
+		} else {
+			NumChars = std::snprintf( Buffer, sizeof( Buffer ), "%.*fE%+0*d", Decimals, Mantissa, ExpDigits + 1, Exponent );
+		}
+		char const * Chars( Buffer );
+		int Length( NumChars + ( Negative ? 1 : 0 ) );
+		if ( ( Length > Width ) && ( Buffer[ 0 ] == '0' ) && ( Buffer[ 1 ] == '.' ) ) { // Drop leading 0 to narrow output
+			++Chars;
+			--NumChars;
+			--Length;
+		}
+		if ( Length > Width ) { // Too wide: Fortran *-fills
+			String.assign( Width, '*' );
+		} else {
+			String.reserve( Width );
+			String.assign( Width - Length, ' ' );
+			if ( Negative ) String += '-';
+			String.append( Chars, NumChars );
+		}
+		return String;
+
+	}
+
+	std::string
+	ListDirectedString( Real64 const RealValue )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// This function returns the string that list-directed output (gio "*" format) produces
+		// for a real value, character for character, without the stream, locale, and format
+		// parsing overhead of gio.  Finite values use no shared formatting state, so the
+		// report writer thread may call it.
+
+		// METHODOLOGY EMPLOYED:
+		// List-directed output of a double is G24.15E3 editing with a scale factor of 1.
+		// Values with 0 to 17 digits before the decimal point are F19.d edited (d = 15 less the
+		// digit count, at least 0) and followed by 5 blanks; other values are 1P,E24.15E3 edited.
+		// When the Grisu2 digits (milo dtoa) of an F edited value fit in d decimals they are the
+		// correctly rounded digits and are placed directly, skipping printf.
+
+		// REFERENCES:
+		// Loitsch, F. 2010. Printing Floating-Point Numbers Quickly and Accurately with Integers.
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		static gio::Fmt fmtLD( "*" );
+		int const FieldWidth( 24 ); // List-directed field width
+		int const ExpWidth( 5 ); // Blanks replacing the exponent in F editing
+		int const FWidth( FieldWidth - ExpWidth ); // F editing field width
+		int const Precision( 15 ); // Digits after the decimal point
+
+		// INTERFACE BLOCK SPECIFICATIONS
+		// na
+
+		// DERIVED TYPE DEFINITIONS
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		std::string String; // Field
+
+		if ( ! std::isfinite( RealValue ) ) { // Rare: Leave to gio
+			gio::write( String, fmtLD ) << RealValue;
+			return String;
+		}
+
+		Real64 const AbsValue( std::abs( RealValue ) );
+		if ( AbsValue == 0.0 ) {
+			String = FixedString( RealValue, FWidth, Precision - 1 );
+			String.append( ExpWidth, ' ' );
+			return String;
+		}
+
+		int const IntDigits( static_cast< int >( std::floor( std::log10( AbsValue ) + 1.0 ) ) ); // Digits before the decimal point
+		if ( ( 0 <= IntDigits ) && ( IntDigits <= Precision + 2 ) ) { // F editing
+			int const Decimals( Precision - std::min( IntDigits, Precision ) );
+			if ( IntDigits <= Precision ) { // Spacing of the F digits exceeds the value ulp
+				char Digits[ 32 ]; // Grisu2 digits
+				int Length; // Number of Grisu2 digits
+				int K; // Decimal exponent of the last Grisu2 digit
+				Grisu2( AbsValue, Digits, &Length, &K );
+				if ( ( Length + K == IntDigits ) && ( -K <= Decimals ) ) { // Digits are the F digits padded with zeros
+					char Buffer[ 32 ]; // F digits
+					char * c( Buffer );
+					if ( RealValue < 0.0 ) *c++ = '-';
+					if ( IntDigits == 0 ) *c++ = '0';
+					for ( int i = 0, e = IntDigits + Decimals; i < e; ++i ) {
+						if ( i == IntDigits ) *c++ = '.';
+						*c++ = ( i < Length ? Digits[ i ] : '0' );
+					}
+					if ( Decimals == 0 ) *c++ = '.';
+					int const NumChars( int( c - Buffer ) ); // Never wider than FWidth
+					String.reserve( FieldWidth );
+					String.assign( FWidth - NumChars, ' ' );
+					String.append( Buffer, NumChars );
+					String.append( ExpWidth, ' ' );
+					return String;
+				}
+			}
+			String = FixedString( RealValue, FWidth, Decimals );
+			String.append( ExpWidth, ' ' );
+		} else { // E editing
+			String = ExponentString( RealValue, FieldWidth, Precision, 3, 1 );
+		}
+		return String;
+
+	}
+
 	std::string
 	TrimSigDigits(
 		Real64 const RealValue,
@@ -1058,7 +1367,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; format through ListDirectedString
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1083,7 +1392,6 @@ namespace General {
 		// FUNCTION PARAMETER DEFINITIONS:
 		static std::string const NAN_string( "NAN" );
 		static std::string const ZEROOOO( "0.000000000000000000000000000" );
-		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1097,7 +1405,7 @@ namespace General {
 
 		std::string String; // Working string
 		if ( RealValue != 0.0 ) {
-			gio::write( String, fmtLD ) << RealValue;
+			String = ListDirectedString( RealValue );
 		} else {
 			String = ZEROOOO;
 		}
@@ -1135,7 +1443,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; format with std::to_string
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1156,7 +1464,6 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1165,10 +1472,9 @@ namespace General {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		std::string String; // Working string
+		// na
 
-		gio::write( String, fmtLD ) << IntegerValue;
-		return stripped( String );
+		return std::to_string( IntegerValue );
 	}
 
 	std::string
@@ -1181,7 +1487,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; format through ListDirectedString
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1207,7 +1513,6 @@ namespace General {
 		static std::string const DigitChar( "01234567890" );
 		static std::string const NAN_string( "NAN" );
 		static std::string const ZEROOOO( "0.000000000000000000000000000" );
-		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1221,7 +1526,7 @@ namespace General {
 
 		std::string String; // Working string
 		if ( RealValue != 0.0 ) {
-			gio::write( String, fmtLD ) << RealValue;
+			String = ListDirectedString( RealValue );
 		} else {
 			String = ZEROOOO;
 		}
@@ -1324,7 +1629,7 @@ namespace General {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Linda K. Lawrie
 		//       DATE WRITTEN   March 2002
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; format with std::to_string
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -1345,7 +1650,6 @@ namespace General {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static gio::Fmt fmtLD( "*" );
 
 		// INTERFACE BLOCK SPECIFICATIONS
 		// na
@@ -1354,10 +1658,9 @@ namespace General {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		std::string String; // Working string
+		// na
 
-		gio::write( String, fmtLD ) << IntegerValue;
-		return stripped( String );
+		return std::to_string( IntegerValue );
 	}
 
 	std::string
@@ -2325,6 +2628,48 @@ namespace General {
 
 	}
 
+	void
+	SolveTridiagonal(
+		int const N, // Number of equations
+		Array1< Real64 > const & A, // Sub-diagonal coefficients, A( 1 ) is not used
+		Array1< Real64 > const & B, // Diagonal coefficients
+		Array1< Real64 > const & C, // Super-diagonal coefficients, C( N ) is not used
+		Array1< Real64 > & D, // Right-hand side on entry, solution on exit
+		Array1< Real64 > & W // Work array of at least N elements
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves a tridiagonal system of N linear equations in place.
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm (forward elimination, back substitution) without pivoting, which is stable
+		// for the diagonally dominant systems produced by implicit node heat balances.
+
+		// REFERENCES:
+		// Patankar, S.V. 1980. Numerical Heat Transfer and Fluid Flow, section 4.2-7.
+
+		if ( N <= 0 ) return;
+
+		W( 1 ) = ( N > 1 ) ? C( 1 ) / B( 1 ) : 0.0;
+		D( 1 ) /= B( 1 );
+		for ( int i = 2; i <= N; ++i ) {
+			Real64 const Denom( B( i ) - A( i ) * W( i - 1 ) );
+			W( i ) = ( i < N ) ? C( i ) / Denom : 0.0;
+			D( i ) = ( D( i ) - A( i ) * D( i - 1 ) ) / Denom;
+		}
+		for ( int i = N - 1; i >= 1; --i ) {
+			D( i ) -= W( i ) * D( i + 1 );
+		}
+
+	}
+
 	void
 	Iterate(
 		Real64 & ResultX, // ResultX is the final Iteration result passed back to the calling routine
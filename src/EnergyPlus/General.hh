@@ -122,6 +122,20 @@ namespace General {
 		Real64 const X_1 // 2nd bound of interval that contains the solution
 	);
 
+	void
+	SolveRegulaFalsi(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x) = 0
+		std::function< Real64( Real64 const ) > f,
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const Y_0, // f(X_0), already evaluated by the caller
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		Real64 const Y_1, // f(X_1), already evaluated by the caller
+		Real64 const XGuess // first estimate to try if it lies between X_0 and X_1
+	);
+
 	Real64
 	InterpSw(
 		Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
@@ -204,6 +218,25 @@ namespace General {
 		int & N // number of terms in polynomial
 	);
 
+	std::string
+	FixedString(
+		Real64 const RealValue,
+		int const Width, // Field width
+		int const Decimals // Digits after the decimal point
+	);
+
+	std::string
+	ExponentString(
+		Real64 const RealValue,
+		int const Width, // Field width
+		int const Decimals, // Digits after the decimal point
+		int const ExpDigits, // Exponent digits
+		int const ScaleFactor // Digits before the decimal point
+	);
+
+	std::string
+	ListDirectedString( Real64 const RealValue );
+
 	std::string
 	TrimSigDigits(
 		Real64 const RealValue,
@@ -310,6 +343,16 @@ namespace General {
 		Array2A< Real64 > InverseA // Output 3X3 Matrix - Inverse Of A
 	);
 
+	void
+	SolveTridiagonal(
+		int const N, // Number of equations
+		Array1< Real64 > const & A, // Sub-diagonal coefficients, A( 1 ) is not used
+		Array1< Real64 > const & B, // Diagonal coefficients
+		Array1< Real64 > const & C, // Super-diagonal coefficients, C( N ) is not used
+		Array1< Real64 > & D, // Right-hand side on entry, solution on exit
+		Array1< Real64 > & W // Work array of at least N elements
+	);
+
 	void
 	Iterate(
 		Real64 & ResultX, // ResultX is the final Iteration result passed back to the calling routine
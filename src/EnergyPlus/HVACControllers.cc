@@ -215,6 +215,10 @@ namespace HVACControllers {
 	int const CoilType_Cooling( 1 );
 	int const CoilType_Heating( 2 );
 
+	// Secant candidates tried per controller while bracketing before falling back on the root
+	// finder's own bracketing steps
+	int const MaxSecantSteps( 2 );
+
 	Array1D_string const ControlVariableTypes( {0,4}, { "No control variable", "Temperature", "Humidity ratio", "Temperature and humidity ratio", "Flow rate" } );
 
 	// DERIVED TYPE DEFINITIONS
@@ -1189,6 +1193,9 @@ namespace HVACControllers {
 				e.Mode = iModeNone;
 				e.ActuatedValue = 0.0;
 			}
+			// Forget the sensitivity learned during the previous environment
+			ControllerProps( ControlNum ).SensitivityDefinedFlag = false;
+			ControllerProps( ControlNum ).Sensitivity = 0.0;
 
 			MyEnvrnFlag( ControlNum ) = false;
 		}
@@ -1488,6 +1495,7 @@ namespace HVACControllers {
 		if ( ControllerProps( ControlNum ).NumCalcCalls == 1 ) {
 			// Set min/max boundaries for root finder on first iteration
 			InitializeRootFinder( RootFinders( ControlNum ), ControllerProps( ControlNum ).MinAvailActuated, ControllerProps( ControlNum ).MaxAvailActuated ); // XMin | XMax
+			ControllerProps( ControlNum ).NumSecantSteps = 0;
 
 			// Only allow to reuse initial evaluation if the air loop is up-to-date.
 			// Set in SolveAirLoopControllers()
@@ -1586,7 +1594,7 @@ namespace HVACControllers {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Dimitri Curtil (LBNL)
 		//       DATE WRITTEN   March 2006
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; secant candidates from the controller sensitivity
 		//       MODIFIED       na
 		//       RE-ENGINEERED  na
 
@@ -1626,6 +1634,8 @@ namespace HVACControllers {
 		bool PreviousSolutionDefinedFlag;
 		int PreviousSolutionMode;
 		Real64 PreviousSolutionValue;
+		Real64 Slope;
+		Real64 SecantValue;
 
 		// Obtain actuated and sensed nodes
 		ActuatedNode = ControllerProps( ControlNum ).ActuatedNode;
@@ -1669,12 +1679,27 @@ namespace HVACControllers {
 
 				// Turn off flag since we can only use the previous solution once per HVAC iteration
 				ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+			} else if ( SecantCandidate( ControlNum, SecantValue ) ) {
+				// Step from the current iterate with the stored sensitivity instead of
+				// bracketing with the min/max points
+				ControllerProps( ControlNum ).NextActuatedValue = SecantValue;
 			} else {
 				// By default, use candidate value computed by root finder
 				ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).XCandidate;
 			}
 
 		} else if ( ( SELECT_CASE_var == iStatusOK ) || ( SELECT_CASE_var == iStatusOKRoundOff ) ) {
+			// Save the sensitivity at the root as the secant between the last 2 iterates, which
+			// bracket or closely approach the root. Keep the previous estimate if the secant is
+			// degenerate or inconsistent with the controller action.
+			if ( RootFinders( ControlNum ).Increment.DefinedFlag && RootFinders( ControlNum ).Increment.X != 0.0 ) {
+				Slope = RootFinders( ControlNum ).Increment.Y / RootFinders( ControlNum ).Increment.X;
+				if ( ( RootFinders( ControlNum ).Controls.SlopeType == iSlopeIncreasing && Slope > 0.0 ) || ( RootFinders( ControlNum ).Controls.SlopeType == iSlopeDecreasing && Slope < 0.0 ) ) {
+					ControllerProps( ControlNum ).SensitivityDefinedFlag = true;
+					ControllerProps( ControlNum ).Sensitivity = Slope;
+				}
+			}
+
 			// Indicate convergence with base value (used to obtain DeltaSensed!)
 			ExitCalcController( ControlNum, RootFinders( ControlNum ).XCandidate, iModeActive, IsConvergedFlag, IsUpToDateFlag );
 
@@ -1815,6 +1840,67 @@ namespace HVACControllers {
 
 	}
 
+	bool
+	SecantCandidate(
+		int const ControlNum,
+		Real64 & XNext // Next actuated value to try
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Proposes the next actuated value from the last iterate and the controller sensitivity
+		// while the root finder is still bracketing the root.
+		// Returns TRUE and sets XNext if a candidate is available; else returns FALSE and leaves
+		// XNext unchanged so that the candidate proposed by the root finder is used.
+
+		// METHODOLOGY EMPLOYED:
+		// Secant step X - Y/S with the sensitivity S = dY/dX saved at the root by the last converged
+		// solution of this controller (previous HVAC iteration or time step). Each controller is
+		// treated on its own; the coupling between the controllers of an air loop is still resolved
+		// by the outer controller iterations in SimAirLoop. The bracketing phase of the root finder
+		// otherwise evaluates the min and max actuated values, each of which requires a full
+		// simulation of the air loop components, whereas the root usually lies close to the linear
+		// extrapolation from the first iterate. At most MaxSecantSteps candidates are tried per root
+		// finder initialization, after which the root finder proceeds with its own bracketing and
+		// solution methods so that the convergence tolerances and min/max constraint detection
+		// remain unchanged.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using RootFinder::CheckRootFinderCandidate;
+
+		// Return value
+		bool SecantCandidate;
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 XCandidate;
+
+		SecantCandidate = false;
+
+		if ( ! ControllerProps( ControlNum ).SensitivityDefinedFlag || ControllerProps( ControlNum ).Sensitivity == 0.0 ) return SecantCandidate;
+		if ( ControllerProps( ControlNum ).NumSecantSteps >= MaxSecantSteps ) return SecantCandidate;
+		if ( RootFinders( ControlNum ).CurrentMethodType != iMethodBracket || ! RootFinders( ControlNum ).CurrentPoint.DefinedFlag ) return SecantCandidate;
+
+		XCandidate = RootFinders( ControlNum ).CurrentPoint.X - RootFinders( ControlNum ).CurrentPoint.Y / ControllerProps( ControlNum ).Sensitivity;
+
+		// Candidate must be a new point within the min/max range and the current brackets
+		if ( XCandidate != RootFinders( ControlNum ).CurrentPoint.X && CheckRootFinderCandidate( RootFinders( ControlNum ), XCandidate ) ) {
+			++ControllerProps( ControlNum ).NumSecantSteps;
+			XNext = XCandidate;
+			SecantCandidate = true;
+		}
+
+		return SecantCandidate;
+	}
+
 	void
 	CheckSimpleController(
 		int const ControlNum,
@@ -99,6 +99,8 @@ namespace HVACControllers {
 	extern int const CoilType_Cooling;
 	extern int const CoilType_Heating;
 
+	extern int const MaxSecantSteps; // Max secant candidates per root finder initialization
+
 	extern Array1D_string const ControlVariableTypes;
 
 	// DERIVED TYPE DEFINITIONS
@@ -191,6 +193,11 @@ namespace HVACControllers {
 		// The first tracker is used to track the solution when FirstHVACIteration is TRUE.
 		// The second tracker is used to track the solution at FirstHVACIteration is FALSE.
 		Array1D< SolutionTrackerType > SolutionTrackers;
+		// Sensitivity d(DeltaSensed)/d(ActuatedValue) at the root, saved from the last converged solution
+		// and used to propose secant candidates while the root finder is bracketing.
+		bool SensitivityDefinedFlag;
+		Real64 Sensitivity;
+		int NumSecantSteps; // Number of secant candidates tried since the root finder was initialized
 		// --------------------
 		// Operational limits at min/max avail values for actuated variable and the corresponding sensed values
 		// --------------------
@@ -254,6 +261,9 @@ namespace HVACControllers {
 			ReuseIntermediateSolutionFlag( false ),
 			ReusePreviousSolutionFlag( false ),
 			SolutionTrackers( 2 ),
+			SensitivityDefinedFlag( false ),
+			Sensitivity( 0.0 ),
+			NumSecantSteps( 0 ),
 			MaxAvailActuated( 0.0 ),
 			MaxAvailSensed( 0.0 ),
 			MinAvailActuated( 0.0 ),
@@ -409,6 +419,12 @@ namespace HVACControllers {
 		std::string const & ControllerName // used when errors occur
 	);
 
+	bool
+	SecantCandidate(
+		int const ControlNum,
+		Real64 & XNext
+	);
+
 	void
 	CheckSimpleController(
 		int const ControlNum,
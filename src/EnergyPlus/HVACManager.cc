@@ -545,6 +545,7 @@ namespace HVACManager {
 				}
 				if ( ! BeginDayFlag ) PrintEnvrnStampWarmupPrinted = false;
 				if ( PrintEnvrnStampWarmup ) {
+					OutputProcessor::FlushReportRecords(); // Stamps go after the report records already posted
 					if ( PrintEndDataDictionary && DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EndOfHeaderFormat );
 						gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -569,6 +570,7 @@ namespace HVACManager {
 				}
 				if ( ! BeginDayFlag ) PrintEnvrnStampWarmupPrinted = false;
 				if ( PrintEnvrnStampWarmup ) {
+					OutputProcessor::FlushReportRecords(); // Stamps go after the report records already posted
 					if ( PrintEndDataDictionary && DoOutputReporting && ! PrintedWarmup ) {
 						gio::write( OutputFileStandard, EndOfHeaderFormat );
 						gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -676,6 +678,7 @@ namespace HVACManager {
 		using DataPlant::TotNumLoops;
 		using DataPlant::PlantManageSubIterations;
 		using DataPlant::PlantManageHalfLoopCalls;
+		using DataPlant::PlantReport;
 		using DataPlant::DemandSide;
 		using DataPlant::SupplySide;
 		using DataPlant::PlantLoop;
@@ -766,6 +769,7 @@ namespace HVACManager {
 		HVACManageIteration = 0;
 		PlantManageSubIterations = 0;
 		PlantManageHalfLoopCalls = 0;
+		for ( auto & e : PlantReport ) e.SkippedCompSimulations = 0;
 		SetAllPlantSimFlagsToValue( true );
 		if ( ! SimHVACIterSetup ) {
 			SetupOutputVariable( "HVAC System Solver Iteration Count []", HVACManageIteration, "HVAC", "Sum", "SimHVAC" );
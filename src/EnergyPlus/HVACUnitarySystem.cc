@@ -59,6 +59,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <functional>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -1250,6 +1251,7 @@ namespace HVACUnitarySystem {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   February 2013
+		//       MODIFIED       Oct 2026; reset the part-load memo at each system time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1347,6 +1349,7 @@ namespace HVACUnitarySystem {
 		int OperatingModeMinusOne;
 		int OperatingModeMinusTwo;
 		bool Oscillate; // detection of oscillating operating modes
+		Real64 PartLoadOutputsTime; // start of the current system time step [hr]
 
 		if ( InitLoadBasedControlOneTimeFlag ) {
 
@@ -1419,6 +1422,10 @@ namespace HVACUnitarySystem {
 					InitComponentNodes( 0.0, UnitarySystem( UnitarySysNum ).MaxSuppCoilFluidFlow, UnitarySystem( UnitarySysNum ).SuppCoilFluidInletNode, UnitarySystem( UnitarySysNum ).SuppCoilFluidOutletNodeNum, UnitarySystem( UnitarySysNum ).SuppCoilLoopNum, UnitarySystem( UnitarySysNum ).SuppCoilLoopSide, UnitarySystem( UnitarySysNum ).SuppCoilBranchNum, UnitarySystem( UnitarySysNum ).SuppCoilCompNum );
 				}
 			}
+			UnitarySystem( UnitarySysNum ).PartLoadOutputs.clear();
+			UnitarySystem( UnitarySysNum ).PartLoadOutputsTime = -1.0;
+			UnitarySystem( UnitarySysNum ).LastCoolingPLR = 0.0;
+			UnitarySystem( UnitarySysNum ).LastHeatingPLR = 0.0;
 			MyEnvrnFlag( UnitarySysNum ) = false;
 		}
 
@@ -1426,6 +1433,15 @@ namespace HVACUnitarySystem {
 			MyEnvrnFlag( UnitarySysNum ) = true;
 		}
 
+		// Part-load outputs are memoized and solver iterations are counted per system time step
+		PartLoadOutputsTime = ( DayOfSim - 1 ) * HoursInDay + CurrentTime - TimeStepZone + SysTimeElapsed;
+		if ( PartLoadOutputsTime != UnitarySystem( UnitarySysNum ).PartLoadOutputsTime || TimeStepSys != UnitarySystem( UnitarySysNum ).PartLoadOutputsTimeStepSys ) {
+			UnitarySystem( UnitarySysNum ).PartLoadOutputs.clear();
+			UnitarySystem( UnitarySysNum ).PartLoadOutputsTime = PartLoadOutputsTime;
+			UnitarySystem( UnitarySysNum ).PartLoadOutputsTimeStepSys = TimeStepSys;
+			UnitarySystem( UnitarySysNum ).PartLoadSolverIterations = 0;
+		}
+
 		if ( MyFanFlag( UnitarySysNum ) ) {
 			if ( UnitarySystem( UnitarySysNum ).ActualFanVolFlowRate != AutoSize ) {
 				if ( UnitarySystem( UnitarySysNum ).ActualFanVolFlowRate > 0.0 ) {
@@ -6169,6 +6185,10 @@ namespace HVACUnitarySystem {
 
 			SetupOutputVariable( "Unitary System Frost Control Status []", UnitarySystem( UnitarySysNum ).FrostControlStatus, "System", "Average", UnitarySystem( UnitarySysNum ).Name );
 
+			if ( UnitarySystem( UnitarySysNum ).ControlType == LoadBased ) {
+				SetupOutputVariable( "Unitary System Part Load Solver Iteration Count []", UnitarySystem( UnitarySysNum ).PartLoadSolverIterations, "System", "Sum", UnitarySystem( UnitarySysNum ).Name );
+			}
+
 			if ( UnitarySystem( UnitarySysNum ).HeatCoilExists ) {
 				SetupOutputVariable( "Unitary System Heating Ancillary Electric Energy [J]", UnitarySystem( UnitarySysNum ).HeatingAuxElecConsumption, "System", "Sum", UnitarySystem( UnitarySysNum ).Name, _, "Electric", "Heating", _, "System" );
 			}
@@ -6565,9 +6585,12 @@ namespace HVACUnitarySystem {
 		Real64 LatOutputOn; // latent output at PLR = 1 [W]
 		Real64 CoolPLR; // cooing part load ratio
 		Real64 HeatPLR; // heating part load ratio
-		Array1D< Real64 > Par( 11 ); // parameters passed to RegulaFalsi function
 		int SolFlag; // return flag from RegulaFalsi for sensible load
 		int SolFlagLat; // return flag from RegulaFalsi for latent load
+		Real64 PLRGuess; // first estimate of the sensible part-load ratio
+		Real64 ResidualOff; // sensible load residual at PLR = 0
+		Real64 ResidualOn; // sensible load residual at PLR = 1
+		std::function< Real64( Real64 const ) > LatentLoadResidual; // residual of the latent part-load solve
 		Real64 TempLoad; // represents either a sensible or latent load [W]
 		Real64 TempSysOutput; // represents either a sensible or latent capacity [W]
 		Real64 TempSensOutput; // iterative sensible capacity [W]
@@ -6959,22 +6982,30 @@ namespace HVACUnitarySystem {
 		// must test to see if load is bounded by capacity before calling RegulaFalsi
 		if ( ( HeatingLoad && ZoneLoad < SensOutputOn ) || ( CoolingLoad && ZoneLoad > SensOutputOn ) ) {
 			if ( ( HeatingLoad && ZoneLoad > SensOutputOff ) || ( CoolingLoad && ZoneLoad < SensOutputOff ) ) {
-				Par( 1 ) = double( UnitarySysNum );
-				Par( 2 ) = 0.0; // FLAG, IF 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-				if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-				Par( 3 ) = double( UnitarySystem( UnitarySysNum ).FanOpMode );
-				Par( 4 ) = CompressorONFlag; // CompOp
-				Par( 5 ) = ZoneLoad;
-				Par( 6 ) = 0.0; // FLAG, 0.0 if heating load, 1.0 IF cooling or moisture load
-				if ( CoolingLoad ) Par( 6 ) = 1.0;
-				Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-				Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-				Par( 9 ) = 0.0; // HXUnitOn is always false for HX
-				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
-				Par( 11 ) = double( AirLoopNum );
+				// Sensible load residual; HXUnitOn is always false for HX
+				auto SensibleLoadResidual = [ = ]( Real64 const PLR ) {
+					return CalcUnitarySystemLoadResidual( UnitarySysNum, AirLoopNum, FirstHVACIteration, CompressorONFlag, ZoneLoad, CoolingLoad, true, false, OnOffAirFlowRatio, PLR );
+				};
+
+				// Start from the solution of the previous call, the bounds are usually memoized
+				if ( CoolingLoad ) {
+					PLRGuess = UnitarySystem( UnitarySysNum ).LastCoolingPLR;
+				} else {
+					PLRGuess = UnitarySystem( UnitarySysNum ).LastHeatingPLR;
+				}
+				ResidualOff = SensibleLoadResidual( 0.0 );
+				ResidualOn = SensibleLoadResidual( 1.0 );
 
 				//     Tolerance is in fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( 0.001, MaxIter, SolFlag, PartLoadRatio, SensibleLoadResidual, 0.0, ResidualOff, 1.0, ResidualOn, PLRGuess );
+				SimulateUnitarySystemPartLoadState( UnitarySysNum, AirLoopNum );
+				if ( SolFlag > 0 ) {
+					if ( CoolingLoad ) {
+						UnitarySystem( UnitarySysNum ).LastCoolingPLR = PartLoadRatio;
+					} else {
+						UnitarySystem( UnitarySysNum ).LastHeatingPLR = PartLoadRatio;
+					}
+				}
 
 				if ( SolFlag == -1 ) {
 					if ( HeatingLoad ) {
@@ -7001,7 +7032,8 @@ namespace HVACUnitarySystem {
 							CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, CoolPLR, TempMinPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 						}
 						// Now solve again with tighter PLR limits
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, HeatPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, HeatPLR, SensibleLoadResidual, TempMinPLR, TempMaxPLR );
+						SimulateUnitarySystemPartLoadState( UnitarySysNum, AirLoopNum );
 						CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 					} else if ( CoolingLoad ) {
 						// RegulaFalsi may not find cooling PLR when the latent degradation model is used.
@@ -7030,7 +7062,8 @@ namespace HVACUnitarySystem {
 							TempSysOutput = TempSensOutput;
 						}
 						// Now solve again with tighter PLR limits
-						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+						SolveRegulaFalsi( 0.001, MaxIter, SolFlag, CoolPLR, SensibleLoadResidual, TempMinPLR, TempMaxPLR );
+						SimulateUnitarySystemPartLoadState( UnitarySysNum, AirLoopNum );
 						CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 					} // IF(HeatingLoad)THEN
 					if ( SolFlag == -1 ) {
@@ -7160,30 +7193,19 @@ namespace HVACUnitarySystem {
 
 				// save heating PLR
 				HeatPLR = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
-				Par( 1 ) = double( UnitarySysNum );
-				Par( 2 ) = 0.0; // FLAG, if 1.0 then FirstHVACIteration equals TRUE, if 0.0 then FirstHVACIteration equals false
-				if ( FirstHVACIteration ) Par( 2 ) = 1.0;
-				Par( 3 ) = double( UnitarySystem( UnitarySysNum ).FanOpMode );
-				Par( 4 ) = CompressorONFlag; // CompOp
+				// Multimode meets the sensible load, otherwise the latent load
 				if ( UnitarySystem( UnitarySysNum ).DehumidControlType_Num == DehumidControl_Multimode ) {
-					Par( 5 ) = ZoneLoad;
-					Par( 7 ) = 1.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-				} else {
-					Par( 5 ) = MoistureLoad;
-					Par( 7 ) = 0.0; // FLAG, 0.0 if latent load, 1.0 if sensible load to be met
-				}
-				Par( 6 ) = 1.0; // FLAG, 0.0 if heating load, 1.0 if cooling or moisture load
-				//      IF(HeatingLoad)Par(6)  = 0.0d0
-				Par( 8 ) = OnOffAirFlowRatio; // Ratio of compressor ON mass flow rate to AVERAGE mass flow rate over time step
-				if ( HXUnitOn ) {
-					Par( 9 ) = 1.0;
+					LatentLoadResidual = [ = ]( Real64 const PLR ) {
+						return CalcUnitarySystemLoadResidual( UnitarySysNum, AirLoopNum, FirstHVACIteration, CompressorONFlag, ZoneLoad, true, true, HXUnitOn, OnOffAirFlowRatio, PLR );
+					};
 				} else {
-					Par( 9 ) = 0.0;
+					LatentLoadResidual = [ = ]( Real64 const PLR ) {
+						return CalcUnitarySystemLoadResidual( UnitarySysNum, AirLoopNum, FirstHVACIteration, CompressorONFlag, MoistureLoad, true, false, HXUnitOn, OnOffAirFlowRatio, PLR );
+					};
 				}
-				Par( 10 ) = UnitarySystem( UnitarySysNum ).HeatingPartLoadFrac;
-				Par( 11 ) = double( AirLoopNum );
 				// Tolerance is fraction of load, MaxIter = 30, SolFalg = # of iterations or error as appropriate
-				SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, PartLoadRatio, CalcUnitarySystemLoadResidual, 0.0, 1.0, Par );
+				SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, PartLoadRatio, LatentLoadResidual, 0.0, 1.0 );
+				SimulateUnitarySystemPartLoadState( UnitarySysNum, AirLoopNum );
 				//      IF (HeatingLoad) THEN
 				//        UnitarySystem(UnitarySysNum)%HeatingPartLoadFrac = PartLoadRatio
 				//      ELSE
@@ -7224,7 +7246,8 @@ namespace HVACUnitarySystem {
 				CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, TempMinPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 			}
 			// Now solve again with tighter PLR limits
-			SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, CoolPLR, CalcUnitarySystemLoadResidual, TempMinPLR, TempMaxPLR, Par );
+			SolveRegulaFalsi( 0.001, MaxIter, SolFlagLat, CoolPLR, LatentLoadResidual, TempMinPLR, TempMaxPLR );
+			SimulateUnitarySystemPartLoadState( UnitarySysNum, AirLoopNum );
 			CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, TempSensOutput, TempLatOutput, HXUnitOn, _, _, CompressorONFlag );
 			if ( SolFlagLat == -1 ) {
 				if ( std::abs( MoistureLoad - TempLatOutput ) > SmallLoad ) {
@@ -7406,7 +7429,7 @@ namespace HVACUnitarySystem {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Richard Raustad, FSEC
 		//       DATE WRITTEN   February 2013
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; delegates to the typed residual
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -7414,6 +7437,7 @@ namespace HVACUnitarySystem {
 
 		// METHODOLOGY EMPLOYED:
 		// Use SolveRegulaFalsi to CALL this Function to converge on a solution
+		// Unpacks Par and calls the typed residual below.
 
 		// REFERENCES:
 		// na
@@ -7454,55 +7478,70 @@ namespace HVACUnitarySystem {
 		int UnitarySysNum; // Index to this unitary system
 		int AirLoopNum; // Index to air loop
 		bool FirstHVACIteration; // FirstHVACIteration flag
-		int FanOpMode; // Cycling fan or constant fan
 		int CompOp; // Compressor on/off; 1=on, 0=off
 		Real64 LoadToBeMet; // Sensible or Latent load to be met
 		Real64 OnOffAirFlowRatio; // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
 		bool HXUnitOn; // flag to enable HX based on zone moisture load
-		Real64 HeatPLR; // heating coil part load ratio
-		Real64 CoolPLR; // cooling coil part load ratio
+		bool CoolPLRFlag; // PartLoadRatio is the cooling part-load ratio
 		bool SensibleLoad; // sensible load
-		Real64 SensOutput; // sensible output of system
-		Real64 LatOutput; // latent output of system
 
 		// Convert parameters to usable variables
 		UnitarySysNum = int( Par( 1 ) );
-		if ( Par( 2 ) == 1.0 ) {
-			FirstHVACIteration = true;
-		} else {
-			FirstHVACIteration = false;
-		}
-		FanOpMode = int( Par( 3 ) );
+		FirstHVACIteration = ( Par( 2 ) == 1.0 );
 		CompOp = int( Par( 4 ) );
 		LoadToBeMet = Par( 5 );
+		CoolPLRFlag = ( Par( 6 ) == 1.0 );
+		SensibleLoad = ( Par( 7 ) == 1.0 );
 		OnOffAirFlowRatio = Par( 8 );
+		HXUnitOn = ( Par( 9 ) == 1.0 );
+		AirLoopNum = int( Par( 11 ) );
 
-		if ( Par( 6 ) == 1.0 ) {
-			CoolPLR = PartLoadRatio;
-			HeatPLR = 0.0;
-		} else {
-			CoolPLR = 0.0;
-			HeatPLR = PartLoadRatio;
-		}
+		Residuum = CalcUnitarySystemLoadResidual( UnitarySysNum, AirLoopNum, FirstHVACIteration, CompOp, LoadToBeMet, CoolPLRFlag, SensibleLoad, HXUnitOn, OnOffAirFlowRatio, PartLoadRatio );
 
-		SensibleLoad = false;
-		if ( Par( 7 ) == 1.0 ) SensibleLoad = true;
+		return Residuum;
+	}
 
-		if ( Par( 9 ) == 1.0 ) {
-			HXUnitOn = true;
-		} else {
-			HXUnitOn = false;
-		}
+	Real64
+	CalcUnitarySystemLoadResidual(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const AirLoopNum, // index to air loop
+		bool const FirstHVACIteration, // True when first HVAC iteration
+		int const CompOp, // Compressor on/off; 1=on, 0=off
+		Real64 const LoadToBeMet, // Sensible or Latent load to be met
+		bool const CoolPLRFlag, // TRUE if PartLoadRatio is the cooling part-load ratio (cooling or moisture load)
+		bool const SensibleLoad, // TRUE for a sensible load, FALSE for a latent load
+		bool const HXUnitOn, // Flag to control HX for HXAssisted Cooling Coil
+		Real64 const OnOffAirFlowRatio, // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
+		Real64 const PartLoadRatio // cooling or heating part-load ratio
+	)
+	{
 
-		AirLoopNum = int( Par( 11 ) );
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
 
-		SetSpeedVariables( UnitarySysNum, SensibleLoad, PartLoadRatio );
+		// PURPOSE OF THIS FUNCTION:
+		// Residual of the load to be met by the unitary system at the given part-load ratio,
+		// for the typed (lambda based) part-load solves in ControlUnitarySystemOutput.
+
+		// METHODOLOGY EMPLOYED:
+		// Same residual as the Par based version, with the system outputs obtained from
+		// CalcUnitarySystemPartLoadOutput so that repeated evaluations are memoized.
 
-		CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatio, SensOutput, LatOutput, HXUnitOn, _, _, CompOp );
+		// Return value
+		Real64 Residuum; // Result (force to 0)
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 SensOutput; // sensible output of system
+		Real64 LatOutput; // latent output of system
+
+		CalcUnitarySystemPartLoadOutput( UnitarySysNum, AirLoopNum, FirstHVACIteration, CompOp, CoolPLRFlag, SensibleLoad, HXUnitOn, OnOffAirFlowRatio, PartLoadRatio, true, SensOutput, LatOutput );
 
 		// Calculate residual based on output calculation flag
 		if ( SensibleLoad ) {
-			if ( std::abs( LoadToBeMet ) == 0.0) {
+			if ( std::abs( LoadToBeMet ) == 0.0 ) {
 				Residuum = ( SensOutput - LoadToBeMet ) / 100.0;
 			} else {
 				Residuum = ( SensOutput - LoadToBeMet ) / LoadToBeMet;
@@ -7518,6 +7557,228 @@ namespace HVACUnitarySystem {
 		return Residuum;
 	}
 
+	bool
+	UnitarySystemPartLoadMemoAllowed( int const UnitarySysNum ) // Index of AirloopHVAC:UnitarySystem object
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns TRUE if the outputs of the unitary system only depend on the part-load ratio, the
+		// speed and the inlet and zone air states within a system time step, so that they can be
+		// memoized by CalcUnitarySystemPartLoadOutput.
+
+		// METHODOLOGY EMPLOYED:
+		// Air-to-air DX and fuel or electric coils only. Water, steam and water-to-air heat pump coils
+		// depend on the plant solution, which changes between HVAC iterations; HX assisted, storage,
+		// desuperheater and user defined coils, air terminal mixers, heat recovery and duct losses
+		// depend on other states that are not part of the memo key.
+
+		if ( UnitarySystem( UnitarySysNum ).ATMixerExists || UnitarySystem( UnitarySysNum ).HeatRecActive ) return false;
+		if ( UnitarySystem( UnitarySysNum ).SenLoadLoss != 0.0 || UnitarySystem( UnitarySysNum ).LatLoadLoss != 0.0 ) return false;
+
+		{ auto const SELECT_CASE_var( UnitarySystem( UnitarySysNum ).CoolingCoilType_Num );
+		if ( ( SELECT_CASE_var == 0 ) || ( SELECT_CASE_var == CoilDX_CoolingSingleSpeed ) || ( SELECT_CASE_var == CoilDX_CoolingTwoSpeed ) || ( SELECT_CASE_var == CoilDX_CoolingTwoStageWHumControl ) || ( SELECT_CASE_var == CoilDX_MultiSpeedCooling ) || ( SELECT_CASE_var == Coil_CoolingAirToAirVariableSpeed ) ) {
+		} else {
+			return false;
+		}}
+
+		{ auto const SELECT_CASE_var( UnitarySystem( UnitarySysNum ).HeatingCoilType_Num );
+		if ( ( SELECT_CASE_var == 0 ) || ( SELECT_CASE_var == CoilDX_HeatingEmpirical ) || ( SELECT_CASE_var == CoilDX_MultiSpeedHeating ) || ( SELECT_CASE_var == Coil_HeatingAirToAirVariableSpeed ) || ( SELECT_CASE_var == Coil_HeatingGasOrOtherFuel ) || ( SELECT_CASE_var == Coil_HeatingGas_MultiStage ) || ( SELECT_CASE_var == Coil_HeatingElectric ) || ( SELECT_CASE_var == Coil_HeatingElectric_MultiStage ) ) {
+		} else {
+			return false;
+		}}
+
+		{ auto const SELECT_CASE_var( UnitarySystem( UnitarySysNum ).SuppHeatCoilType_Num );
+		if ( ( SELECT_CASE_var == 0 ) || ( SELECT_CASE_var == Coil_HeatingGasOrOtherFuel ) || ( SELECT_CASE_var == Coil_HeatingElectric ) ) {
+		} else {
+			return false;
+		}}
+
+		return true;
+	}
+
+	bool
+	SamePartLoadConditions(
+		UnitarySystemPartLoadOutputData const & Eval, // Conditions of the current evaluation
+		UnitarySystemPartLoadOutputData const & Prev // Conditions of a memoized evaluation
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns TRUE if the memoized evaluation Prev was made at the same conditions as Eval.
+
+		// METHODOLOGY EMPLOYED:
+		// Exact comparison of every input of CalcUnitarySystemToLoad that may change within a system
+		// time step: the part-load ratio and speed, the inlet and zone air states, the inlet node flow
+		// limits and the flow rates and load flags read by SetAverageAirFlow and SetOnOffMassFlowRate.
+
+		if ( Prev.PartLoadRatio != Eval.PartLoadRatio || Prev.CoolPLRFlag != Eval.CoolPLRFlag || Prev.SensibleLoad != Eval.SensibleLoad || Prev.HXUnitOn != Eval.HXUnitOn || Prev.FirstHVACIteration != Eval.FirstHVACIteration || Prev.CompOp != Eval.CompOp ) return false;
+		if ( Prev.CoolingSpeedNum != Eval.CoolingSpeedNum || Prev.HeatingSpeedNum != Eval.HeatingSpeedNum || Prev.DehumidificationMode != Eval.DehumidificationMode || Prev.OnOffAirFlowRatio != Eval.OnOffAirFlowRatio ) return false;
+		if ( Prev.InletTemp != Eval.InletTemp || Prev.InletHumRat != Eval.InletHumRat || Prev.ZoneTemp != Eval.ZoneTemp || Prev.ZoneHumRat != Eval.ZoneHumRat ) return false;
+		if ( Prev.InletMassFlowRateMaxAvail != Eval.InletMassFlowRateMaxAvail || Prev.InletMassFlowRateMinAvail != Eval.InletMassFlowRateMinAvail ) return false;
+		if ( Prev.CompOnMassFlow != Eval.CompOnMassFlow || Prev.CompOffMassFlow != Eval.CompOffMassFlow || Prev.CompOnFlowRatio != Eval.CompOnFlowRatio || Prev.CompOffFlowRatio != Eval.CompOffFlowRatio ) return false;
+		if ( Prev.HeatingLoad != Eval.HeatingLoad || Prev.CoolingLoad != Eval.CoolingLoad || Prev.MoistureLoad != Eval.MoistureLoad || Prev.TurnFansOn != Eval.TurnFansOn || Prev.TurnFansOff != Eval.TurnFansOff ) return false;
+
+		return true;
+	}
+
+	void
+	CalcUnitarySystemPartLoadOutput(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const AirLoopNum, // index to air loop
+		bool const FirstHVACIteration, // True when first HVAC iteration
+		int const CompOp, // Compressor on/off; 1=on, 0=off
+		bool const CoolPLRFlag, // TRUE if PartLoadRatio is the cooling part-load ratio
+		bool const SensibleLoad, // TRUE for a sensible load, FALSE for a latent load
+		bool const HXUnitOn, // Flag to control HX for HXAssisted Cooling Coil
+		Real64 const OnOffAirFlowRatio, // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
+		Real64 const PartLoadRatio, // cooling or heating part-load ratio
+		bool const UseMemo, // FALSE to always simulate the system
+		Real64 & SensOutput, // sensible capacity (W)
+		Real64 & LatOutput // latent capacity (W)
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates the unitary system at the given part-load ratio and returns its sensible and
+		// latent outputs, reusing the outputs of an identical evaluation made earlier in the same
+		// system time step when possible.
+
+		// METHODOLOGY EMPLOYED:
+		// The outputs are memoized per part-load ratio, speed, compressor and fan settings, inlet
+		// and zone air states and air flow limits in UnitarySystem%PartLoadOutputs, which ControlUnitarySystemOutput
+		// clears at each new system time step. A memoized evaluation does not update the node
+		// states, which is flagged by PartLoadStateSimulated = FALSE so that the caller simulates
+		// the system again at the final part-load ratio.
+		// Only the load based part-load solves of ControlUnitarySystemOutput use this routine. The
+		// coil setpoint solves of this module, and the part-load solves of Furnaces, FanCoilUnits and
+		// HVACVariableRefrigerantFlow, keep their Par based residuals and are neither memoized nor
+		// warm started.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		std::size_t const MaxPartLoadOutputs( 32 ); // Memoized evaluations per system time step
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		UnitarySystemPartLoadOutputData Eval; // Conditions of the current evaluation
+		Real64 CoolPLR; // cooling coil part load ratio
+		Real64 HeatPLR; // heating coil part load ratio
+		Real64 OnOffAirFlowRatioLocal; // Modified by CalcUnitarySystemToLoad
+		bool Memoize; // TRUE if the outputs can be memoized
+
+		Eval.PartLoadRatio = PartLoadRatio;
+		Eval.CoolPLRFlag = CoolPLRFlag;
+		Eval.SensibleLoad = SensibleLoad;
+		Eval.HXUnitOn = HXUnitOn;
+		Eval.FirstHVACIteration = FirstHVACIteration;
+		Eval.CompOp = CompOp;
+		Eval.CoolingSpeedNum = UnitarySystem( UnitarySysNum ).CoolingSpeedNum;
+		Eval.HeatingSpeedNum = UnitarySystem( UnitarySysNum ).HeatingSpeedNum;
+		Eval.DehumidificationMode = UnitarySystem( UnitarySysNum ).DehumidificationMode;
+		Eval.OnOffAirFlowRatio = OnOffAirFlowRatio;
+		Eval.InletTemp = Node( UnitarySystem( UnitarySysNum ).UnitarySystemInletNodeNum ).Temp;
+		Eval.InletHumRat = Node( UnitarySystem( UnitarySysNum ).UnitarySystemInletNodeNum ).HumRat;
+		Eval.ZoneTemp = Node( UnitarySystem( UnitarySysNum ).NodeNumOfControlledZone ).Temp;
+		Eval.ZoneHumRat = Node( UnitarySystem( UnitarySysNum ).NodeNumOfControlledZone ).HumRat;
+		Eval.InletMassFlowRateMaxAvail = Node( UnitarySystem( UnitarySysNum ).UnitarySystemInletNodeNum ).MassFlowRateMaxAvail;
+		Eval.InletMassFlowRateMinAvail = Node( UnitarySystem( UnitarySysNum ).UnitarySystemInletNodeNum ).MassFlowRateMinAvail;
+		Eval.CompOnMassFlow = CompOnMassFlow;
+		Eval.CompOffMassFlow = CompOffMassFlow;
+		Eval.CompOnFlowRatio = CompOnFlowRatio;
+		Eval.CompOffFlowRatio = CompOffFlowRatio;
+		Eval.HeatingLoad = HeatingLoad;
+		Eval.CoolingLoad = CoolingLoad;
+		Eval.MoistureLoad = MoistureLoad;
+		Eval.TurnFansOn = TurnFansOn;
+		Eval.TurnFansOff = TurnFansOff;
+
+		Memoize = UseMemo && UnitarySystemPartLoadMemoAllowed( UnitarySysNum );
+		if ( Memoize ) {
+			for ( auto const & Prev : UnitarySystem( UnitarySysNum ).PartLoadOutputs ) {
+				if ( SamePartLoadConditions( Eval, Prev ) ) {
+					SensOutput = Prev.SensOutput;
+					LatOutput = Prev.LatOutput;
+					UnitarySystem( UnitarySysNum ).PartLoadStateSimulated = false;
+					UnitarySystem( UnitarySysNum ).LastPartLoadOutput = Prev;
+					return;
+				}
+			}
+		}
+
+		if ( CoolPLRFlag ) {
+			CoolPLR = PartLoadRatio;
+			HeatPLR = 0.0;
+		} else {
+			CoolPLR = 0.0;
+			HeatPLR = PartLoadRatio;
+		}
+		OnOffAirFlowRatioLocal = OnOffAirFlowRatio;
+
+		SetSpeedVariables( UnitarySysNum, SensibleLoad, PartLoadRatio );
+
+		CalcUnitarySystemToLoad( UnitarySysNum, AirLoopNum, FirstHVACIteration, CoolPLR, HeatPLR, OnOffAirFlowRatioLocal, SensOutput, LatOutput, HXUnitOn, _, _, CompOp );
+
+		UnitarySystem( UnitarySysNum ).PartLoadStateSimulated = true;
+		++UnitarySystem( UnitarySysNum ).PartLoadSolverIterations;
+
+		Eval.SensOutput = SensOutput;
+		Eval.LatOutput = LatOutput;
+		UnitarySystem( UnitarySysNum ).LastPartLoadOutput = Eval;
+		if ( Memoize && UnitarySystem( UnitarySysNum ).PartLoadOutputs.size() < MaxPartLoadOutputs ) {
+			UnitarySystem( UnitarySysNum ).PartLoadOutputs.push_back( Eval );
+		}
+
+	}
+
+	void
+	SimulateUnitarySystemPartLoadState(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const AirLoopNum // index to air loop
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Leaves the unitary system in the state of the last output evaluation of a part-load solve.
+
+		// METHODOLOGY EMPLOYED:
+		// SolveRegulaFalsi returns after evaluating the residual at its solution, and the code that
+		// follows the solves relies on the speed variables and node states set by that evaluation.
+		// If it was taken from the memo, the system is simulated again at the same conditions.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		UnitarySystemPartLoadOutputData Eval; // Conditions of the last evaluation
+		Real64 SensOutput; // sensible capacity (W)
+		Real64 LatOutput; // latent capacity (W)
+
+		if ( UnitarySystem( UnitarySysNum ).PartLoadStateSimulated ) return;
+
+		Eval = UnitarySystem( UnitarySysNum ).LastPartLoadOutput;
+		CalcUnitarySystemPartLoadOutput( UnitarySysNum, AirLoopNum, Eval.FirstHVACIteration, Eval.CompOp, Eval.CoolPLRFlag, Eval.SensibleLoad, Eval.HXUnitOn, Eval.OnOffAirFlowRatio, Eval.PartLoadRatio, false, SensOutput, LatOutput );
+
+	}
+
 	void
 	CalcUnitarySystemToLoad(
 		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
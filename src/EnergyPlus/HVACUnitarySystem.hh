@@ -59,6 +59,9 @@
 #ifndef HVACUnitarySystem_hh_INCLUDED
 #define HVACUnitarySystem_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Optional.hh>
@@ -186,6 +189,72 @@ namespace HVACUnitarySystem {
 
 	};
 
+	struct UnitarySystemPartLoadOutputData
+	{
+		// Members
+		// Evaluation conditions
+		Real64 PartLoadRatio; // cooling or heating part-load ratio
+		bool CoolPLRFlag; // TRUE if PartLoadRatio is the cooling part-load ratio
+		bool SensibleLoad; // TRUE if the speed variables were set for a sensible load
+		bool HXUnitOn; // Flag to control HX for HXAssisted Cooling Coil
+		bool FirstHVACIteration;
+		int CompOp; // Compressor on/off; 1=on, 0=off
+		int CoolingSpeedNum;
+		int HeatingSpeedNum;
+		int DehumidificationMode;
+		Real64 OnOffAirFlowRatio;
+		Real64 InletTemp; // unitary system inlet node temperature [C]
+		Real64 InletHumRat; // unitary system inlet node humidity ratio [kg-H2O/kg-air]
+		Real64 ZoneTemp; // controlled zone node temperature [C]
+		Real64 ZoneHumRat; // controlled zone node humidity ratio [kg-H2O/kg-air]
+		Real64 InletMassFlowRateMaxAvail; // unitary system inlet node max available mass flow rate [kg/s]
+		Real64 InletMassFlowRateMinAvail; // unitary system inlet node min available mass flow rate [kg/s]
+		Real64 CompOnMassFlow; // Supply air mass flow rate w/ compressor ON [kg/s]
+		Real64 CompOffMassFlow; // Supply air mass flow rate w/ compressor OFF [kg/s]
+		Real64 CompOnFlowRatio; // fan flow ratio when coil on
+		Real64 CompOffFlowRatio; // fan flow ratio when coil off
+		bool HeatingLoad; // True when zone needs heating
+		bool CoolingLoad; // True when zone needs cooling
+		Real64 MoistureLoad; // Dehumidification Load (W)
+		bool TurnFansOn; // If true overrides fan schedule and cycles fans on
+		bool TurnFansOff; // If true overrides fan schedule and turns fans off
+		// Outputs
+		Real64 SensOutput; // sensible capacity [W]
+		Real64 LatOutput; // latent capacity [W]
+
+		// Default Constructor
+		UnitarySystemPartLoadOutputData() :
+			PartLoadRatio( 0.0 ),
+			CoolPLRFlag( false ),
+			SensibleLoad( false ),
+			HXUnitOn( false ),
+			FirstHVACIteration( false ),
+			CompOp( 0 ),
+			CoolingSpeedNum( 0 ),
+			HeatingSpeedNum( 0 ),
+			DehumidificationMode( 0 ),
+			OnOffAirFlowRatio( 0.0 ),
+			InletTemp( 0.0 ),
+			InletHumRat( 0.0 ),
+			ZoneTemp( 0.0 ),
+			ZoneHumRat( 0.0 ),
+			InletMassFlowRateMaxAvail( 0.0 ),
+			InletMassFlowRateMinAvail( 0.0 ),
+			CompOnMassFlow( 0.0 ),
+			CompOffMassFlow( 0.0 ),
+			CompOnFlowRatio( 0.0 ),
+			CompOffFlowRatio( 0.0 ),
+			HeatingLoad( false ),
+			CoolingLoad( false ),
+			MoistureLoad( 0.0 ),
+			TurnFansOn( false ),
+			TurnFansOff( false ),
+			SensOutput( 0.0 ),
+			LatOutput( 0.0 )
+		{}
+
+	};
+
 	struct UnitarySystemData
 	{
 		// Members
@@ -447,6 +516,15 @@ namespace HVACUnitarySystem {
 		int RegulaFalsIFailedIndex; // used in PLR calculations for sensible load
 		int LatMaxIterIndex; // used in PLR calculations for moisture load
 		int LatRegulaFalsIFailedIndex; // used in PLR calculations for moisture load
+		// Part-load solver for load based control
+		std::vector< UnitarySystemPartLoadOutputData > PartLoadOutputs; // Outputs memoized during the current system time step
+		Real64 PartLoadOutputsTime; // Time stamp of the memoized outputs [hr]
+		Real64 PartLoadOutputsTimeStepSys; // System time step of the memoized outputs [hr]
+		bool PartLoadStateSimulated; // FALSE if the last output evaluation was taken from PartLoadOutputs
+		UnitarySystemPartLoadOutputData LastPartLoadOutput; // Conditions of the last output evaluation
+		Real64 LastCoolingPLR; // Cooling part-load ratio of the last sensible load solution
+		Real64 LastHeatingPLR; // Heating part-load ratio of the last sensible load solution
+		int PartLoadSolverIterations; // Simulated residual evaluations during the current system time step
 		// EMS variables
 		bool DesignFanVolFlowRateEMSOverrideOn; // If true, then EMS is calling to override autosize fan flow
 		bool MaxHeatAirVolFlowEMSOverrideOn; // If true, then EMS is calling to override autosize fan flow
@@ -709,6 +787,12 @@ namespace HVACUnitarySystem {
 			RegulaFalsIFailedIndex( 0 ),
 			LatMaxIterIndex( 0 ),
 			LatRegulaFalsIFailedIndex( 0 ),
+			PartLoadOutputsTime( -1.0 ),
+			PartLoadOutputsTimeStepSys( 0.0 ),
+			PartLoadStateSimulated( true ),
+			LastCoolingPLR( 0.0 ),
+			LastHeatingPLR( 0.0 ),
+			PartLoadSolverIterations( 0 ),
 			DesignFanVolFlowRateEMSOverrideOn( false ),
 			MaxHeatAirVolFlowEMSOverrideOn( false ),
 			MaxCoolAirVolFlowEMSOverrideOn( false ),
@@ -888,6 +972,51 @@ namespace HVACUnitarySystem {
 		Array1< Real64 > const & Par // Function parameters
 	);
 
+	Real64
+	CalcUnitarySystemLoadResidual(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const AirLoopNum, // index to air loop
+		bool const FirstHVACIteration, // True when first HVAC iteration
+		int const CompOp, // Compressor on/off; 1=on, 0=off
+		Real64 const LoadToBeMet, // Sensible or Latent load to be met
+		bool const CoolPLRFlag, // TRUE if PartLoadRatio is the cooling part-load ratio (cooling or moisture load)
+		bool const SensibleLoad, // TRUE for a sensible load, FALSE for a latent load
+		bool const HXUnitOn, // Flag to control HX for HXAssisted Cooling Coil
+		Real64 const OnOffAirFlowRatio, // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
+		Real64 const PartLoadRatio // cooling or heating part-load ratio
+	);
+
+	bool
+	UnitarySystemPartLoadMemoAllowed( int const UnitarySysNum ); // Index of AirloopHVAC:UnitarySystem object
+
+	bool
+	SamePartLoadConditions(
+		UnitarySystemPartLoadOutputData const & Eval, // Conditions of the current evaluation
+		UnitarySystemPartLoadOutputData const & Prev // Conditions of a memoized evaluation
+	);
+
+	void
+	CalcUnitarySystemPartLoadOutput(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const AirLoopNum, // index to air loop
+		bool const FirstHVACIteration, // True when first HVAC iteration
+		int const CompOp, // Compressor on/off; 1=on, 0=off
+		bool const CoolPLRFlag, // TRUE if PartLoadRatio is the cooling part-load ratio
+		bool const SensibleLoad, // TRUE for a sensible load, FALSE for a latent load
+		bool const HXUnitOn, // Flag to control HX for HXAssisted Cooling Coil
+		Real64 const OnOffAirFlowRatio, // Ratio of compressor ON air mass flow to AVERAGE air mass flow over time step
+		Real64 const PartLoadRatio, // cooling or heating part-load ratio
+		bool const UseMemo, // FALSE to always simulate the system
+		Real64 & SensOutput, // sensible capacity (W)
+		Real64 & LatOutput // latent capacity (W)
+	);
+
+	void
+	SimulateUnitarySystemPartLoadState(
+		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
+		int const AirLoopNum // index to air loop
+	);
+
 	void
 	CalcUnitarySystemToLoad(
 		int const UnitarySysNum, // Index of AirloopHVAC:UnitarySystem object
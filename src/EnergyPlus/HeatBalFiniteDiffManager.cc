@@ -60,6 +60,7 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -82,6 +83,7 @@
 #include <HeatBalanceMovableInsulation.hh>
 #include <InputProcessor.hh>
 #include <OutputProcessor.hh>
+#include <ParallelFor.hh>
 #include <Psychrometrics.hh>
 #include <UtilityRoutines.hh>
 
@@ -183,6 +185,10 @@ namespace HeatBalFiniteDiffManager {
 	int const FullyImplicitFirstOrder( 2 ); // fully implicit scheme, first order in time.
 	Array1D_string const cCondFDSchemeType( 2, { "CrankNicholsonSecondOrder", "FullyImplicitFirstOrder" } );
 
+	int const GaussSeidelSolution( 1 ); // node equations iterated by Gauss-Seidel sweeps (original method)
+	int const DirectSolution( 2 ); // node equations of constant property surfaces solved directly (tridiagonal)
+	Array1D_string const cCondFDSolutionMethod( 2, { "GaussSeidel", "Direct" } );
+
 	Real64 const TempInitValue( 23.0 ); // Initialization value for Temperature
 	Real64 const RhovInitValue( 0.0115 ); // Initialization value for Rhov
 	Real64 const EnthInitValue( 100.0 ); // Initialization value for Enthalpy
@@ -217,6 +223,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	int CondFDSchemeType( FullyImplicitFirstOrder ); // solution scheme for CondFD - default
+	int CondFDSolutionMethod( GaussSeidelSolution ); // solution method for the node equations - default
 	Real64 SpaceDescritConstant( 3.0 ); // spatial descritization constant,
 	Real64 MinTempLimit( -100.0 ); // lower limit check, degree C
 	Real64 MaxTempLimit( 100.0 ); // upper limit check, degree C
@@ -254,6 +261,7 @@ namespace HeatBalFiniteDiffManager {
 		QHeatInFlux.deallocate();
 		QHeatOutFlux.deallocate();
 		CondFDSchemeType = FullyImplicitFirstOrder;
+		CondFDSolutionMethod = GaussSeidelSolution;
 		SpaceDescritConstant = 3.0;
 		MinTempLimit = -100.0;
 		MaxTempLimit = 100.0;
@@ -321,6 +329,69 @@ namespace HeatBalFiniteDiffManager {
 
 	}
 
+	void
+	ManageHeatBalFiniteDiffSurfaces(
+		std::vector< int > const & SurfNums, // Surfaces to solve, none of them coupled to another surface's nodes
+		Array1< Real64 > & TempSurfInTmp, // INSIDE SURFACE TEMPERATURE OF EACH HEAT TRANSFER SURF.
+		Array1< Real64 > & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the finite difference node equations of a batch of surfaces for one iteration of the
+		// inside surface heat balance, in parallel.
+
+		// METHODOLOGY EMPLOYED:
+		// Within an iteration of the inside heat balance the surfaces only couple through their boundary
+		// conditions, which are set before the surface loop.  A surface passing IndependentFiniteDiffSurface
+		// reads and writes only its own node arrays and surface slots, so the surfaces of the batch may be
+		// solved in any order and on any thread with the same results as the serial surface loop.
+
+		// REFERENCES:
+		// na
+
+		if ( GetHBFiniteDiffInputFlag ) {
+			GetCondFDInput();
+			GetHBFiniteDiffInputFlag = false;
+		}
+
+		ParallelFor( 0, int( SurfNums.size() ) - 1, [&]( int const iSurf ){
+			int const SurfNum( SurfNums[ iSurf ] );
+			CalcHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp( SurfNum ) );
+		} );
+
+	}
+
+	bool
+	IndependentFiniteDiffSurface( int const SurfNum )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the CondFD solution of the surface does not touch any other surface's data, so that
+		// it can be solved with ManageHeatBalFiniteDiffSurfaces.
+
+		// METHODOLOGY EMPLOYED:
+		// Interzone partitions solve the inside face of the other side surface from their exterior boundary
+		// equation, so they stay in the serial surface loop.  Surfaces with outside movable insulation are
+		// also left there, since evaluating the insulation may update the insulation material and issue warnings.
+
+		// REFERENCES:
+		// na
+
+		auto const & surface( Surface( SurfNum ) );
+		return ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) && ( surface.Class != SurfaceClass_Window ) && ( ( surface.ExtBoundCond <= 0 ) || ( surface.ExtBoundCond == SurfNum ) ) && ( surface.MaterialMovInsulExt == 0 );
+	}
+
 	// Get Input Section of the Module
 	//******************************************************************************
 
@@ -416,6 +487,21 @@ namespace HeatBalFiniteDiffManager {
 				MaxAllowedDelTempCondFD = rNumericArgs( 3 );
 			}
 
+			if ( ( NumAlphas > 1 ) && ! lAlphaFieldBlanks( 2 ) ) {
+
+				{ auto const SELECT_CASE_var( cAlphaArgs( 2 ) );
+
+				if ( SELECT_CASE_var == "GAUSSSEIDEL" ) {
+					CondFDSolutionMethod = GaussSeidelSolution;
+				} else if ( SELECT_CASE_var == "DIRECT" ) {
+					CondFDSolutionMethod = DirectSolution;
+				} else {
+					ShowSevereError( cCurrentModuleObject + ": invalid " + cAlphaFieldNames( 2 ) + " entered=" + cAlphaArgs( 2 ) + ", must match GaussSeidel or Direct." );
+					ErrorsFound = true;
+				}}
+
+			}
+
 		} // settings object
 
 		pcMat = GetNumObjectsFound( "MaterialProperty:PhaseChange" );
@@ -967,6 +1053,17 @@ namespace HeatBalFiniteDiffManager {
 			ConstructFD( ConstrNum ).TotNodes = TotNodes;
 			ConstructFD( ConstrNum ).DeltaTime = Delt;
 
+			// Without phase change or temperature dependent conductivity the node equations are linear (see CalcFiniteDiffDirect)
+			ConstructFD( ConstrNum ).ConstantProperties = true;
+			for ( Layer = 1; Layer <= Construct( ConstrNum ).TotLayers; ++Layer ) {
+				auto const & matFD( MaterialFD( Construct( ConstrNum ).LayerPoint( Layer ) ) );
+				auto const lTE( matFD.TempEnth.index( 2, 1 ) );
+				auto const lTC( matFD.TempCond.index( 2, 1 ) );
+				if ( ( matFD.TempEnth[ lTE ] + matFD.TempEnth[ lTE+1 ] + matFD.TempEnth[ lTE+2 ] >= 0.0 ) || ( matFD.TempCond[ lTC ] + matFD.TempCond[ lTC+1 ] + matFD.TempCond[ lTC+2 ] >= 0.0 ) || ( matFD.tk1 != 0.0 ) ) {
+					ConstructFD( ConstrNum ).ConstantProperties = false;
+				}
+			}
+
 		} // End of Construction Loop.  TotNodes in each construction now set
 
 		// now determine x location, or distance that nodes are from the outside face in meters
@@ -1133,6 +1230,7 @@ namespace HeatBalFiniteDiffManager {
 		//                                 update TD and TDT, correct interzone partition
 		//                      May 2011  B. Griffith add logging and errors when inner GS loop does not converge
 		//                      November 2011 P. Tabares fixed problems with adiabatic walls/massless walls and PCM stability problems
+		//                      Oct 2026; optional direct solution for constant property surfaces, no static locals (parallel surfaces)
 
 		//       RE-ENGINEERED  na
 
@@ -1166,7 +1264,7 @@ namespace HeatBalFiniteDiffManager {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-		static Real64 MaxDelTemp( 0.0 );
+		Real64 MaxDelTemp( 0.0 );
 
 		int const ConstrNum( Surface( Surf ).Construction );
 
@@ -1199,11 +1297,17 @@ namespace HeatBalFiniteDiffManager {
 		int RoughIndexMovInsul; // roughness  Movable insulation
 		Real64 AbsExt; // exterior absorptivity  movable insulation
 		EvalOutsideMovableInsulation( Surf, HMovInsul, RoughIndexMovInsul, AbsExt );
+
+		// Linear node equations (no temperature dependent properties) with a boundary condition that does not
+		// depend on other surfaces or on movable insulation can be solved directly instead of iterated
+		bool const SolveDirect( ( CondFDSolutionMethod == DirectSolution ) && ConstructFD( ConstrNum ).ConstantProperties && ( Surface( Surf ).ExtBoundCond <= 0 ) && ( HMovInsul <= 0.0 ) );
+
 		// Start stepping through the slab with time.
 		for ( int J = 1, J_end = nint( TimeStepZoneSec / Delt ); J <= J_end; ++J ) { //PT testing higher time steps
 
 			int GSiter; // iteration counter for implicit repeat calculation
-			for ( GSiter = 1; GSiter <= MaxGSiter; ++GSiter ) { //  Iterate implicit equations
+			if ( SolveDirect ) CalcFiniteDiffDirect( Delt, Surf, HMovInsul ); // skips the iterations below, counted as one
+			for ( GSiter = 1; ( GSiter <= MaxGSiter ) && ! SolveDirect; ++GSiter ) { //  Iterate implicit equations
 				TDTLast = TDT; // Save last iteration's TDT (New temperature) values
 				EnthLast = EnthNew; // Last iterations new enthalpy value
 
@@ -1309,6 +1413,135 @@ namespace HeatBalFiniteDiffManager {
 
 	}
 
+	void
+	CalcFiniteDiffDirect(
+		int const Delt, // Time Increment
+		int const Surf, // Surface number
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solves the node equations of a surface for one time increment without Gauss-Seidel iterations.
+
+		// METHODOLOGY EMPLOYED:
+		// With constant properties each node equation gives the node temperature as an affine function of
+		// its two neighbours, TDT(i) = a + b TDT(i-1) + c TDT(i+1).  The coefficients are taken from the node
+		// equation routines used by the iterations, evaluated with the neighbours set to 0 and 1, and the
+		// tridiagonal system is solved with the Thomas algorithm.  A last sweep of the node equations at the
+		// solution then sets the half-node heat capacities and face fluxes as the last iteration would.
+		// Only valid for surfaces selected in CalcHeatBalFiniteDiff: no outside face coupling to another
+		// surface and no outside movable insulation, whose equation also depends on the node itself.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::SolveTridiagonal;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static thread_local Array1D_int NodeLay; // Layer of each node
+		static thread_local Array1D< Real64 > A; // Sub-diagonal coefficients
+		static thread_local Array1D< Real64 > B; // Diagonal coefficients
+		static thread_local Array1D< Real64 > C; // Super-diagonal coefficients
+		static thread_local Array1D< Real64 > D; // Right-hand side, then node temperatures
+		static thread_local Array1D< Real64 > W; // Work array for SolveTridiagonal
+
+		int const ConstrNum( Surface( Surf ).Construction );
+		int const TotNodes( ConstructFD( ConstrNum ).TotNodes );
+		int const TotLayers( Construct( ConstrNum ).TotLayers );
+		int const NumEqs( TotNodes + 1 ); // Outside face, full nodes and inside face
+
+		// Aliases
+		auto & surfaceFD( SurfaceFD( Surf ) );
+		auto const & T( surfaceFD.T );
+		auto & TT( surfaceFD.TT );
+		auto const & Rhov( surfaceFD.Rhov );
+		auto & RhoT( surfaceFD.RhoT );
+		auto const & TD( surfaceFD.TD );
+		auto & TDT( surfaceFD.TDT );
+		auto & TDreport( surfaceFD.TDreport );
+		auto & RH( surfaceFD.RH );
+		auto & EnthOld( surfaceFD.EnthOld );
+		auto & EnthNew( surfaceFD.EnthNew );
+
+		if ( NodeLay.u() < NumEqs ) {
+			NodeLay.dimension( NumEqs );
+			A.dimension( NumEqs );
+			B.dimension( NumEqs );
+			C.dimension( NumEqs );
+			D.dimension( NumEqs );
+			W.dimension( NumEqs );
+		}
+
+		// Layer of each node, numbered as in the Gauss-Seidel sweep of CalcHeatBalFiniteDiff
+		int i( 1 ); //  Node counter
+		NodeLay( 1 ) = 1;
+		for ( int Lay = 1; Lay <= TotLayers; ++Lay ) {
+			if ( TotNodes != 1 ) {
+				for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
+					NodeLay( ++i ) = Lay;
+				}
+			}
+			if ( ( ( Lay < TotLayers ) && ( TotNodes != 1 ) ) || ( Lay == TotLayers ) ) { // Interface or inside face node
+				NodeLay( ++i ) = Lay;
+			}
+		}
+		assert( i == NumEqs );
+
+		// Node equation of node n: the last node of a layer other than the inside face is an interface node
+		auto NodeEqns = [&]( int const n ) {
+			int const Lay( NodeLay( n ) );
+			if ( n == 1 ) {
+				ExteriorBCEqns( Delt, n, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TotNodes, HMovInsul );
+			} else if ( n == NumEqs ) {
+				InteriorBCEqns( Delt, n, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, TDreport );
+			} else if ( NodeLay( n + 1 ) != Lay ) {
+				IntInterfaceNodeEqns( Delt, n, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew, 1 );
+			} else {
+				InteriorNodeEqns( Delt, n, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+			}
+		};
+
+		// Coefficients of TDT(n) - b TDT(n-1) - c TDT(n+1) = a
+		for ( int n = 1; n <= NumEqs; ++n ) {
+			if ( n > 1 ) TDT( n - 1 ) = 0.0;
+			if ( n < NumEqs ) TDT( n + 1 ) = 0.0;
+			NodeEqns( n );
+			Real64 const a( TDT( n ) );
+			A( n ) = C( n ) = 0.0;
+			if ( n > 1 ) {
+				TDT( n - 1 ) = 1.0;
+				NodeEqns( n );
+				A( n ) = a - TDT( n );
+				TDT( n - 1 ) = 0.0;
+			}
+			if ( n < NumEqs ) {
+				TDT( n + 1 ) = 1.0;
+				NodeEqns( n );
+				C( n ) = a - TDT( n );
+			}
+			B( n ) = 1.0;
+			D( n ) = a;
+		}
+
+		SolveTridiagonal( NumEqs, A, B, C, D, W );
+
+		for ( int n = 1; n <= NumEqs; ++n ) {
+			TDT( n ) = D( n );
+		}
+		for ( int n = 1; n <= NumEqs; ++n ) {
+			NodeEqns( n );
+		}
+
+	}
+
 	void
 	ReportFiniteDiffInits()
 	{
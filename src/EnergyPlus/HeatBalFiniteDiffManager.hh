@@ -59,6 +59,9 @@
 #ifndef HeatBalFiniteDiffManager_hh_INCLUDED
 #define HeatBalFiniteDiffManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -82,6 +85,10 @@ namespace HeatBalFiniteDiffManager {
 	extern int const FullyImplicitFirstOrder; // fully implicit scheme, first order in time.
 	extern Array1D_string const cCondFDSchemeType;
 
+	extern int const GaussSeidelSolution; // node equations iterated by Gauss-Seidel sweeps (original method)
+	extern int const DirectSolution; // node equations of constant property surfaces solved directly (tridiagonal)
+	extern Array1D_string const cCondFDSolutionMethod;
+
 	extern Real64 const TempInitValue; // Initialization value for Temperature
 	extern Real64 const RhovInitValue; // Initialization value for Rhov
 	extern Real64 const EnthInitValue; // Initialization value for Enthalpy
@@ -116,6 +123,7 @@ namespace HeatBalFiniteDiffManager {
 	//                                                                 ! before CR 8280 -- Qdryout         !HeatFlux on Surface for reporting for Sensible only
 
 	extern int CondFDSchemeType; // solution scheme for CondFD - default
+	extern int CondFDSolutionMethod; // solution method for the node equations - default
 	extern Real64 SpaceDescritConstant; // spatial descritization constant,
 	extern Real64 MinTempLimit; // lower limit check, degree C
 	extern Real64 MaxTempLimit; // upper limit check, degree C
@@ -150,11 +158,13 @@ namespace HeatBalFiniteDiffManager {
 		Array1D< Real64 > NodeXlocation; // sized to TotNode, contains X distance in m from outside face
 		int TotNodes;
 		int DeltaTime;
+		bool ConstantProperties; // true if no layer has phase change or temperature dependent conductivity
 
 		// Default Constructor
 		ConstructionDataFD() :
 			TotNodes( 0 ),
-			DeltaTime( 0 )
+			DeltaTime( 0 ),
+			ConstantProperties( false )
 		{}
 
 	};
@@ -249,6 +259,16 @@ namespace HeatBalFiniteDiffManager {
 		Real64 & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
 	);
 
+	void
+	ManageHeatBalFiniteDiffSurfaces(
+		std::vector< int > const & SurfNums, // Surfaces to solve, none of them coupled to another surface's nodes
+		Array1< Real64 > & TempSurfInTmp, // INSIDE SURFACE TEMPERATURE OF EACH HEAT TRANSFER SURF.
+		Array1< Real64 > & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
+	);
+
+	bool
+	IndependentFiniteDiffSurface( int const SurfNum );
+
 	// Get Input Section of the Module
 	//******************************************************************************
 
@@ -268,6 +288,13 @@ namespace HeatBalFiniteDiffManager {
 		Real64 & TempSurfOutTmp // Outside Surface Temperature of each Heat Transfer Surface
 	);
 
+	void
+	CalcFiniteDiffDirect(
+		int const Delt, // Time Increment
+		int const Surf, // Surface number
+		Real64 const HMovInsul // Conductance of movable(transparent) insulation
+	);
+
 	// Beginning of Reporting subroutines
 	// *****************************************************************************
 
@@ -89,7 +89,7 @@ SetupZoneInternalGain(
 	// SUBROUTINE INFORMATION:
 	//       AUTHOR         B. Griffith
 	//       DATE WRITTEN   November 2011
-	//       MODIFIED       na
+	//       MODIFIED       Oct 2026; zone gain sums are out of date until the next gain update
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -170,6 +170,7 @@ SetupZoneInternalGain(
 		}
 	}
 	++ZoneIntGain( ZoneNum ).NumberOfDevices;
+	ZoneIntGainSumsCurrent = false; // the new device is not in the sums yet
 
 	ZoneIntGain( ZoneNum ).Device( ZoneIntGain( ZoneNum ).NumberOfDevices ).CompObjectType = UpperCaseObjectType;
 	ZoneIntGain( ZoneNum ).Device( ZoneIntGain( ZoneNum ).NumberOfDevices ).CompObjectName = UpperCaseObjectName;
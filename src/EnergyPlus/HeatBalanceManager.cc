@@ -105,7 +105,7 @@
 #include <ScheduleManager.hh>
 #include <SolarShading.hh>
 #include <SurfaceGeometry.hh>
-#include <SurfaceOctree.hh>
+#include <SurfaceBVH.hh>
 #include <UtilityRoutines.hh>
 #include <WindowComplexManager.hh>
 #include <WindowEquivalentLayer.hh>
@@ -285,6 +285,7 @@ namespace HeatBalanceManager {
 		CountWarmupDayPoints = int();
 		CurrentModuleObject = std::string();
 		WarmupConvergenceValues.deallocate();
+		surfaceBVH.clear();
 	}
 
 	void
@@ -342,14 +343,11 @@ namespace HeatBalanceManager {
 		if ( ManageHeatBalanceGetInputFlag ) {
 			GetHeatBalanceInput(); // Obtains heat balance related parameters from input file
 
-			// Surface octree setup
-			//  The surface octree holds live references to surfaces so it must be updated
+			// Surface BVH setup for the daylighting and solar reflection obstruction ray queries
+			//  The surface BVH holds surface numbers and bounding boxes so it must be rebuilt
 			//   if in the future surfaces are altered after this point
-			if ( TotSurfaces >= DaylightingManager::octreeCrossover ) { // Octree can be active
-				if ( GetNumObjectsFound( "Daylighting:Controls" ) > 0 ) { // Daylighting is active
-					surfaceOctree.init( DataSurfaces::Surface ); // Set up surface octree
-				}
-			}
+			surfaceBVH.clear();
+			if ( TotSurfaces >= int( SurfaceBVH::crossover ) ) surfaceBVH.init( DataSurfaces::Surface ); // Set up surface BVH
 
 			for ( auto & surface : DataSurfaces::Surface ) surface.set_computed_geometry(); // Set up extra surface geometry info for PierceSurface
 
@@ -5146,6 +5144,7 @@ namespace HeatBalanceManager {
 			}
 			if ( ! BeginDayFlag ) PrintEnvrnStampWarmupPrinted = false;
 			if ( PrintEnvrnStampWarmup ) {
+				OutputProcessor::FlushReportRecords(); // Stamps go after the report records already posted
 				if ( PrintEndDataDictionary && DoOutputReporting ) {
 					gio::write( OutputFileStandard, EndOfHeaderFormat );
 					gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -7419,6 +7418,7 @@ Label1000: ;
 		//       DATE WRITTEN   June 2010
 		//       MODIFIED       January 2012 (Simon Vidanovic)
 		//       MODIFIED       May 2012 (Simon Vidanovic)
+		//       MODIFIED       Oct 2026, store property matrices in compressed form
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -7482,6 +7482,7 @@ Label1000: ;
 		Array1D_string locAlphaArgs;
 		Array1D< Real64 > locNumericArgs;
 		std::string locCurrentModuleObject;
+		Array2D< Real64 > BSDFDenseMtrx; // Property matrix as read from input, before compression
 
 		//Reading WindowThermalModel:Params
 		cCurrentModuleObject = "WindowThermalModel:Params";
@@ -7709,13 +7710,14 @@ Label1000: ;
 					// matrix defines the basis length
 				}
 
-				Construct( ConstrNum ).BSDFInput.SolFrtTrans.allocate( NumCols, NumRows );
+				BSDFDenseMtrx.allocate( NumCols, NumRows );
 				if ( Construct( ConstrNum ).BSDFInput.SolFrtTransIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Solar front transmittance Matrix:TwoDimension = \"" + locAlphaArgs( 6 ) + "\" is missing from the input file." );
 				} else {
-					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolFrtTransIndex, Construct( ConstrNum ).BSDFInput.SolFrtTrans );
+					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolFrtTransIndex, BSDFDenseMtrx );
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.SolFrtTrans );
 				}
 
 				// *******************************************************************************
@@ -7738,13 +7740,14 @@ Label1000: ;
 					ShowContinueError( "Solar bakc reflectance matrix \"" + locAlphaArgs( 7 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.SolBkRefl.allocate( NumCols, NumRows );
+				BSDFDenseMtrx.allocate( NumCols, NumRows );
 				if ( Construct( ConstrNum ).BSDFInput.SolBkReflIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Solar back reflectance Matrix:TwoDimension = \"" + locAlphaArgs( 7 ) + "\" is missing from the input file." );
 				} else {
-					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolBkReflIndex, Construct( ConstrNum ).BSDFInput.SolBkRefl );
+					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolBkReflIndex, BSDFDenseMtrx );
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.SolBkRefl );
 				}
 
 				// *******************************************************************************
@@ -7767,13 +7770,14 @@ Label1000: ;
 					ShowContinueError( "Visible front transmittance matrix \"" + locAlphaArgs( 8 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.VisFrtTrans.allocate( NumCols, NumRows );
+				BSDFDenseMtrx.allocate( NumCols, NumRows );
 				if ( Construct( ConstrNum ).BSDFInput.VisFrtTransIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + cCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Visible front transmittance Matrix:TwoDimension = \"" + locAlphaArgs( 8 ) + "\" is missing from the input file." );
 				} else {
-					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisFrtTransIndex, Construct( ConstrNum ).BSDFInput.VisFrtTrans );
+					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisFrtTransIndex, BSDFDenseMtrx );
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.VisFrtTrans );
 				}
 
 				// *******************************************************************************
@@ -7796,13 +7800,14 @@ Label1000: ;
 					ShowContinueError( "Visible back reflectance \"" + locAlphaArgs( 9 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.VisBkRefl.allocate( NumCols, NumRows );
+				BSDFDenseMtrx.allocate( NumCols, NumRows );
 				if ( Construct( ConstrNum ).BSDFInput.VisBkReflIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Visble back reflectance Matrix:TwoDimension = \"" + locAlphaArgs( 9 ) + "\" is missing from the input file." );
 				} else {
-					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisBkReflIndex, Construct( ConstrNum ).BSDFInput.VisBkRefl );
+					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisBkReflIndex, BSDFDenseMtrx );
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.VisBkRefl );
 				}
 
 				//ALLOCATE(Construct(ConstrNum)%BSDFInput%Layer(NumOfOpticalLayers))
@@ -7902,7 +7907,6 @@ Label1000: ;
 					ShowContinueError( "Solar front transmittance matrix \"" + locAlphaArgs( 6 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.SolFrtTrans.allocate( NBasis, NBasis );
 				if ( Construct( ConstrNum ).BSDFInput.SolFrtTransIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
@@ -7910,10 +7914,11 @@ Label1000: ;
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolFrtTransIndex, BSDFTempMtrx );
 
-					Construct( ConstrNum ).BSDFInput.SolFrtTrans = 0.0;
+					BSDFDenseMtrx.dimension( NBasis, NBasis, 0.0 );
 					for ( I = 1; I <= NBasis; ++I ) {
-						Construct( ConstrNum ).BSDFInput.SolFrtTrans( I, I ) = BSDFTempMtrx( I, 1 );
+						BSDFDenseMtrx( I, I ) = BSDFTempMtrx( I, 1 );
 					}
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.SolFrtTrans );
 				}
 
 				// *******************************************************************************
@@ -7936,17 +7941,17 @@ Label1000: ;
 					ShowContinueError( "Solar back reflectance matrix \"" + locAlphaArgs( 7 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.SolBkRefl.allocate( NBasis, NBasis );
 				if ( Construct( ConstrNum ).BSDFInput.SolBkReflIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Solar back reflectance Matrix:TwoDimension = \"" + locAlphaArgs( 7 ) + "\" is missing from the input file." );
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.SolBkReflIndex, BSDFTempMtrx );
-					Construct( ConstrNum ).BSDFInput.SolBkRefl = 0.0;
+					BSDFDenseMtrx.dimension( NBasis, NBasis, 0.0 );
 					for ( I = 1; I <= NBasis; ++I ) {
-						Construct( ConstrNum ).BSDFInput.SolBkRefl( I, I ) = BSDFTempMtrx( I, 1 );
+						BSDFDenseMtrx( I, I ) = BSDFTempMtrx( I, 1 );
 					}
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.SolBkRefl );
 				}
 
 				// *******************************************************************************
@@ -7969,17 +7974,17 @@ Label1000: ;
 					ShowContinueError( "Visible front transmittance matrix \"" + locAlphaArgs( 8 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.VisFrtTrans.allocate( NBasis, NBasis );
 				if ( Construct( ConstrNum ).BSDFInput.VisFrtTransIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Visible front transmittance Matrix:TwoDimension = \"" + locAlphaArgs( 8 ) + "\" is missing from the input file." );
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisFrtTransIndex, BSDFTempMtrx );
-					Construct( ConstrNum ).BSDFInput.VisFrtTrans = 0.0;
+					BSDFDenseMtrx.dimension( NBasis, NBasis, 0.0 );
 					for ( I = 1; I <= NBasis; ++I ) {
-						Construct( ConstrNum ).BSDFInput.VisFrtTrans( I, I ) = BSDFTempMtrx( I, 1 );
+						BSDFDenseMtrx( I, I ) = BSDFTempMtrx( I, 1 );
 					}
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.VisFrtTrans );
 				}
 
 				// *******************************************************************************
@@ -8002,17 +8007,17 @@ Label1000: ;
 					ShowContinueError( "Visible back reflectance matrix \"" + locAlphaArgs( 9 ) + "\" must have the same number of rows and columns." );
 				}
 
-				Construct( ConstrNum ).BSDFInput.VisBkRefl.allocate( NBasis, NBasis );
 				if ( Construct( ConstrNum ).BSDFInput.VisBkReflIndex == 0 ) {
 					ErrorsFound = true;
 					ShowSevereError( RoutineName + locCurrentModuleObject + "=\"" + locAlphaArgs( 1 ) + ", object. Referenced Matrix:TwoDimension is missing from the input file." );
 					ShowContinueError( "Visible back reflectance Matrix:TwoDimension = \"" + locAlphaArgs( 9 ) + "\" is missing from the input file." );
 				} else {
 					Get2DMatrix( Construct( ConstrNum ).BSDFInput.VisBkReflIndex, BSDFTempMtrx );
-					Construct( ConstrNum ).BSDFInput.VisBkRefl = 0.0;
+					BSDFDenseMtrx.dimension( NBasis, NBasis, 0.0 );
 					for ( I = 1; I <= NBasis; ++I ) {
-						Construct( ConstrNum ).BSDFInput.VisBkRefl( I, I ) = BSDFTempMtrx( I, 1 );
+						BSDFDenseMtrx( I, I ) = BSDFTempMtrx( I, 1 );
 					}
+					CompressBSDFMatrix( BSDFDenseMtrx, Construct( ConstrNum ).BSDFInput.VisBkRefl );
 				}
 
 				//determine number of layers
@@ -8111,6 +8116,7 @@ Label1000: ;
 		if ( allocated( locAlphaFieldBlanks ) ) locAlphaFieldBlanks.deallocate();
 		if ( allocated( locAlphaArgs ) ) locAlphaArgs.deallocate();
 		if ( allocated( locNumericArgs ) ) locNumericArgs.deallocate();
+		if ( allocated( BSDFDenseMtrx ) ) BSDFDenseMtrx.deallocate();
 
 		if ( ErrorsFound ) ShowFatalError( "Error in complex fenestration input." );
 
@@ -5037,6 +5037,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	//                      May 2006 (RR  account for exterior window screen)
 	//                      Jul 2008 (P. Biddulph include calls to HAMT)
 	//                      Sep 2011 LKL/BG - resimulate only zones needing it for Radiant systems
+	//                      Oct 2026; solve independent CondFD surfaces together, in parallel, before the surface loop
 	//       RE-ENGINEERED  Mar 1998 (RKS)
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -5080,6 +5081,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	using HeatBalanceMovableInsulation::EvalInsideMovableInsulation;
 	using WindowManager::CalcWindowHeatBalance;
 	using HeatBalFiniteDiffManager::ManageHeatBalFiniteDiff;
+	using HeatBalFiniteDiffManager::ManageHeatBalFiniteDiffSurfaces;
+	using HeatBalFiniteDiffManager::IndependentFiniteDiffSurface;
 	using HeatBalFiniteDiffManager::SurfaceFD;
 	using HeatBalanceHAMTManager::ManageHeatBalHAMT;
 	using HeatBalanceHAMTManager::UpdateHeatBalHAMT;
@@ -5166,6 +5169,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	Real64 NodeTemp;
 	Real64 CpAir;
 	static Array1D< Real64 > RefAirTemp; // reference air temperatures
+	static Array1D_bool CondFDSurfInBatch; // CondFD surfaces solved together before the surface loop
+	static Array1D< Real64 > TempSurfOutFD; // Outside face temperatures of the CondFD surfaces solved together
 	static bool MyEnvrnFlag( true );
 	//  LOGICAL, SAVE     :: DoThisLoop
 	static int InsideSurfErrCount( 0 );
@@ -5179,6 +5184,15 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	if ( calcHeatBalanceInsideSurfFirstTime ) {
 		TempInsOld.allocate( TotSurfaces );
 		RefAirTemp.allocate( TotSurfaces );
+		// CondFD surfaces that only depend on their own nodes, and for which the surface loop below always calls
+		// the CondFD solution (no interior movable insulation unless a partition), can be solved as a batch
+		CondFDSurfInBatch.dimension( TotSurfaces, false );
+		TempSurfOutFD.dimension( TotSurfaces, 0.0 );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			if ( ! surface.HeatTransSurf || ( surface.Zone == 0 ) || ( surface.Class == SurfaceClass_TDD_Dome ) ) continue;
+			CondFDSurfInBatch( SurfNum ) = IndependentFiniteDiffSurface( SurfNum ) && ( ( surface.ExtBoundCond == SurfNum ) || ( surface.MaterialMovInsulInt == 0 ) );
+		}
 		if ( any_eq( HeatTransferAlgosUsed, UseEMPD ) ) {
 			MinIterations = MinEMPDIterations;
 		} else {
@@ -5327,6 +5341,12 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	}
 
 	bool const useCondFDHTalg( any_eq( HeatTransferAlgosUsed, UseCondFD ) );
+	std::vector< int > CondFDSurfBatch; // CondFD surfaces of this call solved together
+	if ( useCondFDHTalg ) {
+		for ( int const iSurf : HTSurfToResimulate ) {
+			if ( CondFDSurfInBatch( iSurf ) ) CondFDSurfBatch.push_back( iSurf );
+		}
+	}
 	Converged = false;
 	while ( ! Converged ) { // Start of main inside heat balance DO loop...
 
@@ -5344,6 +5364,15 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			InitInteriorConvectionCoeffs( TempSurfIn, ZoneToResimulate );
 		}
 
+		// Within an iteration the CondFD surfaces only couple through the boundary conditions set above, so the
+		// node solutions of the independent ones are done together, in parallel, and used in the surface loop
+		if ( ! CondFDSurfBatch.empty() ) {
+			for ( int const iSurf : CondFDSurfBatch ) {
+				HConvInFD( iSurf ) = HConvIn( iSurf );
+			}
+			ManageHeatBalFiniteDiffSurfaces( CondFDSurfBatch, TempSurfInTmp, TempSurfOutFD );
+		}
+
 		for ( std::vector< int >::size_type iHTSurfToResimulate = 0u; iHTSurfToResimulate < nHTSurfToResimulate; ++iHTSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
 			SurfNum = HTSurfToResimulate[ iHTSurfToResimulate ]; // Heat transfer surfaces only
 			auto & surface( Surface( SurfNum ) );
@@ -5424,7 +5453,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 					if ( surface.HeatTransferAlgorithm == HeatTransferModel_HAMT ) ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp ); //HAMT
 
-					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+					if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+						if ( CondFDSurfInBatch( SurfNum ) ) { // Solved before the surface loop
+							TempSurfOutTmp = TempSurfOutFD( SurfNum );
+						} else {
+							ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+						}
+					}
 
 					TH11 = TempSurfOutTmp;
 
@@ -5507,7 +5542,13 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 								ManageHeatBalHAMT( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
 							}
 
-							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+							if ( surface.HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+								if ( CondFDSurfInBatch( SurfNum ) ) { // Solved before the surface loop
+									TempSurfOutTmp = TempSurfOutFD( SurfNum );
+								} else {
+									ManageHeatBalFiniteDiff( SurfNum, TempSurfInTmp( SurfNum ), TempSurfOutTmp );
+								}
+							}
 
 							TH11 = TempSurfOutTmp;
 
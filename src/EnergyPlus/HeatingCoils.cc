@@ -164,7 +164,7 @@ namespace HeatingCoils {
 	Array1D_bool MySizeFlag;
 	Array1D_bool ValidSourceType; // Used to determine if a source for a desuperheater heating coil is valid
 	bool GetCoilsInputFlag( true ); // Flag set to make sure you get input once
-	bool CoilIsSuppHeater( false ); // Flag set to indicate the heating coil is a supplemental heater
+	thread_local bool CoilIsSuppHeater( false ); // Flag set to indicate the heating coil is a supplemental heater
 	bool MyOneTimeFlag( true ); // one time initialization flag
 	Array1D_bool CheckEquipName;
 	bool InputErrorsFound( false );
@@ -92,7 +92,7 @@ namespace HeatingCoils {
 	extern Array1D_bool MySizeFlag;
 	extern Array1D_bool ValidSourceType; // Used to determine if a source for a desuperheater heating coil is valid
 	extern bool GetCoilsInputFlag; // Flag set to make sure you get input once
-	extern bool CoilIsSuppHeater; // Flag set to indicate the heating coil is a supplemental heater
+	extern thread_local bool CoilIsSuppHeater; // Flag set to indicate the heating coil is a supplemental heater
 	extern Array1D_bool CheckEquipName;
 
 	// Subroutine Specifications for the Module
@@ -4488,14 +4488,16 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; also sum the gain rates by zone and device type
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// <description>
 
 		// METHODOLOGY EMPLOYED:
-		// <description>
+		// The device gain rates are held constant for the entire timestep, so their zone totals
+		// and subtotals by device type are gathered once here into ZoneIntGainSums and the
+		// SumAll... and Sum...ByTypes routines look them up instead of looping over the devices.
 
 		// REFERENCES:
 		// na
@@ -4520,6 +4522,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int Loop;
 		int NZ;
+		int TypeNum;
 		bool DoRadiationUpdate;
 		bool ReSumLatentGains;
 
@@ -4545,7 +4548,40 @@ namespace InternalHeatGains {
 				ZoneIntGain( NZ ).Device( Loop ).CarbonDioxideGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrCarbonDioxideGainRate;
 				ZoneIntGain( NZ ).Device( Loop ).GenericContamGainRate = ZoneIntGain( NZ ).Device( Loop ).PtrGenericContamGainRate;
 			}
-			if ( ReSumLatentGains ) {
+		}
+
+		// gather the zone totals (type 0) and the subtotals by device type
+		if ( ZoneIntGainSums.isize2() != NumOfZones ) {
+			ZoneIntGainSums.allocate( {0,NumZoneIntGainDeviceTypes}, NumOfZones );
+		}
+		for ( NZ = 1; NZ <= NumOfZones; ++NZ ) {
+			for ( TypeNum = 0; TypeNum <= NumZoneIntGainDeviceTypes; ++TypeNum ) {
+				ZoneIntGainSums( TypeNum, NZ ) = ZoneIntGainSumsData();
+			}
+			auto & ZoneTotal( ZoneIntGainSums( 0, NZ ) );
+			for ( Loop = 1; Loop <= ZoneIntGain( NZ ).NumberOfDevices; ++Loop ) {
+				auto const & Device( ZoneIntGain( NZ ).Device( Loop ) );
+				auto & TypeTotal( ZoneIntGainSums( Device.CompTypeOfNum, NZ ) );
+				ZoneTotal.ConvectGainRate += Device.ConvectGainRate;
+				ZoneTotal.ReturnAirConvGainRate += Device.ReturnAirConvGainRate;
+				ZoneTotal.RadiantGainRate += Device.RadiantGainRate;
+				ZoneTotal.LatentGainRate += Device.LatentGainRate;
+				ZoneTotal.ReturnAirLatentGainRate += Device.ReturnAirLatentGainRate;
+				ZoneTotal.CarbonDioxideGainRate += Device.CarbonDioxideGainRate;
+				ZoneTotal.GenericContamGainRate += Device.GenericContamGainRate;
+				TypeTotal.ConvectGainRate += Device.ConvectGainRate;
+				TypeTotal.ReturnAirConvGainRate += Device.ReturnAirConvGainRate;
+				TypeTotal.RadiantGainRate += Device.RadiantGainRate;
+				TypeTotal.LatentGainRate += Device.LatentGainRate;
+				TypeTotal.ReturnAirLatentGainRate += Device.ReturnAirLatentGainRate;
+				TypeTotal.CarbonDioxideGainRate += Device.CarbonDioxideGainRate;
+				TypeTotal.GenericContamGainRate += Device.GenericContamGainRate;
+			}
+		}
+		ZoneIntGainSumsCurrent = true;
+
+		if ( ReSumLatentGains ) {
+			for ( NZ = 1; NZ <= NumOfZones; ++NZ ) {
 				SumAllInternalLatentGains( NZ, ZoneLatentGain( NZ ) );
 			}
 		}
@@ -4569,7 +4605,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4600,6 +4636,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumConvGainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumConvGainRate = ZoneIntGainSums( 0, ZoneNum ).ConvectGainRate;
+			return;
+		}
+
 		tmpSumConvGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4626,7 +4667,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the subtotals gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4664,6 +4705,14 @@ namespace InternalHeatGains {
 		NumberOfTypes = size( GainTypeARR );
 		tmpSumConvGainRate = 0.0;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
+				tmpSumConvGainRate += ZoneIntGainSums( GainTypeARR( TypeNum ), ZoneNum ).ConvectGainRate;
+			}
+			SumConvGainRate = tmpSumConvGainRate;
+			return;
+		}
+
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
 			SumConvGainRate = 0.0;
 			return;
@@ -4693,7 +4742,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4724,6 +4773,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumRetAirGainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumReturnAirGainRate = ZoneIntGainSums( 0, ZoneNum ).ReturnAirConvGainRate;
+			return;
+		}
+
 		tmpSumRetAirGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4750,7 +4804,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the subtotals gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4788,6 +4842,14 @@ namespace InternalHeatGains {
 		NumberOfTypes = size( GainTypeARR );
 		tmpSumRetAirConvGainRate = 0.0;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
+				tmpSumRetAirConvGainRate += ZoneIntGainSums( GainTypeARR( TypeNum ), ZoneNum ).ReturnAirConvGainRate;
+			}
+			SumReturnAirGainRate = tmpSumRetAirConvGainRate;
+			return;
+		}
+
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
 			SumReturnAirGainRate = 0.0;
 			return;
@@ -4817,7 +4879,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4848,6 +4910,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumRadGainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumRadGainRate = ZoneIntGainSums( 0, ZoneNum ).RadiantGainRate;
+			return;
+		}
+
 		tmpSumRadGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4874,7 +4941,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the subtotals gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4912,6 +4979,14 @@ namespace InternalHeatGains {
 		NumberOfTypes = size( GainTypeARR );
 		tmpSumRadiationGainRate = 0.0;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
+				tmpSumRadiationGainRate += ZoneIntGainSums( GainTypeARR( TypeNum ), ZoneNum ).RadiantGainRate;
+			}
+			SumRadiationGainRate = tmpSumRadiationGainRate;
+			return;
+		}
+
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
 			SumRadiationGainRate = 0.0;
 			return;
@@ -4941,7 +5016,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4972,6 +5047,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumLatentGainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumLatentGainRate = ZoneIntGainSums( 0, ZoneNum ).LatentGainRate;
+			return;
+		}
+
 		tmpSumLatentGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -4998,7 +5078,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the subtotals gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5036,6 +5116,14 @@ namespace InternalHeatGains {
 		NumberOfTypes = size( GainTypeARR );
 		tmpSumLatentGainRate = 0.0;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
+				tmpSumLatentGainRate += ZoneIntGainSums( GainTypeARR( TypeNum ), ZoneNum ).LatentGainRate;
+			}
+			SumLatentGainRate = tmpSumLatentGainRate;
+			return;
+		}
+
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
 			SumLatentGainRate = 0.0;
 			return;
@@ -5065,7 +5153,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5096,6 +5184,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumLatentGainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumRetAirLatentGainRate = ZoneIntGainSums( 0, ZoneNum ).ReturnAirLatentGainRate;
+			return;
+		}
+
 		tmpSumLatentGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -5121,7 +5214,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5152,6 +5245,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumCO2GainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumCO2GainRate = ZoneIntGainSums( 0, ZoneNum ).CarbonDioxideGainRate;
+			return;
+		}
+
 		tmpSumCO2GainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
@@ -5178,7 +5276,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Dec. 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the subtotals gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5216,6 +5314,14 @@ namespace InternalHeatGains {
 		NumberOfTypes = size( GainTypeARR );
 		tmpSumCO2GainRate = 0.0;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			for ( TypeNum = 1; TypeNum <= NumberOfTypes; ++TypeNum ) {
+				tmpSumCO2GainRate += ZoneIntGainSums( GainTypeARR( TypeNum ), ZoneNum ).CarbonDioxideGainRate;
+			}
+			SumCO2GainRate = tmpSumCO2GainRate;
+			return;
+		}
+
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
 			SumCO2GainRate = 0.0;
 			return;
@@ -5245,7 +5351,7 @@ namespace InternalHeatGains {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         L. Gu
 		//       DATE WRITTEN   Feb. 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; look up the sum gathered in UpdateInternalGainValues
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -5276,6 +5382,11 @@ namespace InternalHeatGains {
 		Real64 tmpSumGCGainRate;
 		int DeviceNum;
 
+		if ( ZoneIntGainSumsCurrent ) {
+			SumGCGainRate = ZoneIntGainSums( 0, ZoneNum ).GenericContamGainRate;
+			return;
+		}
+
 		tmpSumGCGainRate = 0.0;
 
 		if ( ZoneIntGain( ZoneNum ).NumberOfDevices == 0 ) {
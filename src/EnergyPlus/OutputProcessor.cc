@@ -60,11 +60,15 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <system_error>
+#include <thread>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -293,6 +297,8 @@ namespace OutputProcessor {
 	Array1D< ReqReportVariables > ReqRepVars;
 	Array1D< MeterArrayType > VarMeterArrays;
 	Array1D< MeterType > EnergyMeters;
+	MeterIncidenceType MeterIncidence;
+	ActiveVariableSetType ActiveVariables;
 	Array1D< EndUseCategoryType > EndUseCategory;
 
 	// Routines tagged on the end of this module:
@@ -324,6 +330,7 @@ namespace OutputProcessor {
 	void
 	clear_state()
 	{
+		StopReportWriter();
 		InstMeterCacheSize = 1000;
 		InstMeterCacheSizeInc = 1000;
 		InstMeterCache.deallocate();
@@ -389,6 +396,8 @@ namespace OutputProcessor {
 		ReqRepVars.deallocate();
 		VarMeterArrays.deallocate();
 		EnergyMeters.deallocate();
+		MeterIncidence = MeterIncidenceType();
+		ActiveVariables = ActiveVariableSetType();
 		EndUseCategory.deallocate();
 	}
 
@@ -2286,6 +2295,7 @@ namespace OutputProcessor {
 		}
 
 		if ( Found == 0 ) {
+			MeterIncidence.Current = false;
 			EnergyMeters.redimension( ++NumEnergyMeters );
 			EnergyMeters( NumEnergyMeters ).Name = Name;
 			EnergyMeters( NumEnergyMeters ).ResourceType = ResourceType;
@@ -2424,6 +2434,7 @@ namespace OutputProcessor {
 			ValidateNStandardizeMeterTitles( MtrUnits, ResourceType, EndUse, EndUseSub, Group, ErrorsFound );
 		}
 
+		MeterIncidence.Current = false;
 		VarMeterArrays.redimension( ++NumVarMeterArrays );
 		MeterArrayPtr = NumVarMeterArrays;
 		VarMeterArrays( NumVarMeterArrays ).NumOnMeters = 0;
@@ -2529,6 +2540,8 @@ namespace OutputProcessor {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
+		MeterIncidence.Current = false;
+		ActiveVariables.Current = false;
 		if ( MeterArrayPtr == 0 ) {
 			VarMeterArrays.redimension( ++NumVarMeterArrays );
 			MeterArrayPtr = NumVarMeterArrays;
@@ -2915,34 +2928,195 @@ namespace OutputProcessor {
 	}
 
 	void
-	UpdateMeterValues(
-		Real64 const TimeStepValue, // Value of this variable at the current time step.
-		int const NumOnMeters, // Number of meters this variable is "on".
-		Array1S_int const OnMeters, // Which meters this variable is on (index values)
-		Optional_int_const NumOnCustomMeters, // Number of custom meters this variable is "on".
-		Optional< Array1S_int const > OnCustomMeters // Which custom meters this variable is on (index values)
-	)
+	BuildMeterIncidence()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine builds the sparse incidence matrix between metered report variables
+		// and meters, and the lists of meters that need hourly, daily and monthly roll-ups.
+
+		// METHODOLOGY EMPLOYED:
+		// Columns are the metered real variables, visited zone variables first and then HVAC variables
+		// (the order UpdateDataandReport used when it scattered each variable into its meters).  Rows
+		// are meters, each listing its variables in column order so the gathered sums are added in the
+		// same sequence as before.  The matrix is rebuilt only after variables, meters or reporting
+		// requests have changed.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		auto & Incidence( MeterIncidence );
+
+		Incidence.Vars.clear();
+		for ( int IndexType = 1; IndexType <= 2; ++IndexType ) {
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+				auto & rVar( RVariableTypes( Loop ).VarPtr() );
+				if ( rVar.MeterArrayPtr != 0 ) Incidence.Vars.push_back( &rVar );
+			}
+		}
+		int const NumVars( Incidence.Vars.size() );
+		Incidence.VarValue.assign( NumVars, 0.0 );
+
+		// Count the entries of each meter row, then fill the rows in column order
+		Incidence.RowStart.assign( NumEnergyMeters + 1, 0 );
+		for ( auto const rVar : Incidence.Vars ) {
+			auto const & MeterArray( VarMeterArrays( rVar->MeterArrayPtr ) );
+			for ( int Meter = 1; Meter <= MeterArray.NumOnMeters; ++Meter ) {
+				++Incidence.RowStart[ MeterArray.OnMeters( Meter ) ];
+			}
+			for ( int Meter = 1; Meter <= MeterArray.NumOnCustomMeters; ++Meter ) {
+				++Incidence.RowStart[ MeterArray.OnCustomMeters( Meter ) ];
+			}
+		}
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			Incidence.RowStart[ Meter ] += Incidence.RowStart[ Meter - 1 ];
+		}
+		Incidence.Col.resize( Incidence.RowStart[ NumEnergyMeters ] );
+		std::vector< int > RowFill( Incidence.RowStart.begin(), Incidence.RowStart.end() - 1 );
+		for ( int Var = 0; Var < NumVars; ++Var ) {
+			auto const & MeterArray( VarMeterArrays( Incidence.Vars[ Var ]->MeterArrayPtr ) );
+			for ( int Meter = 1; Meter <= MeterArray.NumOnMeters; ++Meter ) {
+				Incidence.Col[ RowFill[ MeterArray.OnMeters( Meter ) - 1 ]++ ] = Var;
+			}
+			for ( int Meter = 1; Meter <= MeterArray.NumOnCustomMeters; ++Meter ) {
+				Incidence.Col[ RowFill[ MeterArray.OnCustomMeters( Meter ) - 1 ]++ ] = Var;
+			}
+		}
+
+		Incidence.HRMeters.clear();
+		Incidence.DYMeters.clear();
+		Incidence.MNMeters.clear();
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			if ( EnergyMeters( Meter ).RptHR ) Incidence.HRMeters.push_back( Meter );
+			if ( EnergyMeters( Meter ).RptDY ) Incidence.DYMeters.push_back( Meter );
+			if ( EnergyMeters( Meter ).RptMN ) Incidence.MNMeters.push_back( Meter );
+		}
+
+		if ( MeterValue.isize() != NumEnergyMeters ) MeterValue.dimension( NumEnergyMeters, 0.0 );
+		Incidence.Current = true;
+
+	}
+
+	void
+	BuildActiveVariableSet()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine sorts the registered report variables by what consumes them, so
+		// that UpdateDataandReport only visits variables whose record keeping is used.
+
+		// METHODOLOGY EMPLOYED:
+		// Reported variables keep the full record keeping and are also listed by report frequency
+		// for the daily, monthly and run period blocks.  Unreported variables on meters or read by
+		// the external interface only need their zone time step sum (TSValue, EITSValue).  All
+		// lists follow the order of RVariableTypes/IVariableTypes, so output records are written in
+		// the same order as before.  The set is rebuilt only after variables or consumers change.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		auto & Active( ActiveVariables );
+
+		for ( auto & List : Active.ReportedR ) List.clear();
+		for ( auto & List : Active.ReportedI ) List.clear();
+		for ( auto & List : Active.AccumulatedR ) List.clear();
+		for ( auto & List : Active.AccumulatedI ) List.clear();
+		for ( auto & List : Active.ReportedRByFreq ) List.clear();
+		for ( auto & List : Active.ReportedIByFreq ) List.clear();
+
+		for ( int IndexType = 1; IndexType <= 2; ++IndexType ) {
+			for ( int Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+				auto const & rVar( RVariableTypes( Loop ).VarPtr() );
+				if ( rVar.Report ) {
+					Active.ReportedR( IndexType ).push_back( Loop );
+					Active.ReportedRByFreq( rVar.ReportFreq, IndexType ).push_back( Loop );
+				} else if ( rVar.MeterArrayPtr != 0 || rVar.ExternalInterface ) {
+					Active.AccumulatedR( IndexType ).push_back( Loop );
+				}
+			}
+			for ( int Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
+				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
+				auto const & iVar( IVariableTypes( Loop ).VarPtr() );
+				if ( iVar.Report ) {
+					Active.ReportedI( IndexType ).push_back( Loop );
+					Active.ReportedIByFreq( iVar.ReportFreq, IndexType ).push_back( Loop );
+				} else if ( iVar.ExternalInterface ) {
+					Active.AccumulatedI( IndexType ).push_back( Loop );
+				}
+			}
+		}
+
+		Active.Current = true;
+
+	}
+
+	void
+	UpdateMeterValues()
 	{
 
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   January 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; gather all meters through the variable-to-meter incidence matrix
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
-		// This subroutine updates all the meter values in the lists with the current
-		// time step value for this variable.
+		// This subroutine sets the current time step value of every meter from the
+		// time step values of the variables on it.
 
 		// METHODOLOGY EMPLOYED:
 		// Variables, as they are "setup", may or may not be on one or more meters.
-		// All "metered" variables are on the "facility meter".  Index values will be
-		// set from the variables to the appropriate meters.  Then, the updating of
-		// the meter values is quite simple -- just add the time step value of the variable
-		// (which is passed to this routine) to all the values being kept for the meter.
-		// Reporting of the meters is taken care of in a different routine.  During reporting,
-		// some values will also be reset (for example, after reporting the "hour", the new
-		// "hour" value of the meter is reset to 0.0, etc.
+		// All "metered" variables are on the "facility meter".  The time step value of
+		// each metered variable (with its zone multipliers) is collected once, and each
+		// meter is then the sum of its row of the incidence matrix.  Custom decrement and
+		// difference meters get their basic values here -- UpdateMeters then calculates the actual.
+		// Reporting of the meters is taken care of in a different routine.
 
 		// REFERENCES:
 		// na
@@ -2950,8 +3124,6 @@ namespace OutputProcessor {
 		// USE STATEMENTS:
 		// na
 
-		// Argument array dimensioning
-
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
@@ -2965,20 +3137,22 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Meter; // Loop Control
-		int Which; // Index value for the meter
+		auto & Incidence( MeterIncidence );
+
+		if ( ! Incidence.Current ) BuildMeterIncidence();
 
-		for ( Meter = 1; Meter <= NumOnMeters; ++Meter ) {
-			Which = OnMeters( Meter );
-			MeterValue( Which ) += TimeStepValue;
+		int const NumVars( Incidence.Vars.size() );
+		for ( int Var = 0; Var < NumVars; ++Var ) {
+			auto const & rVar( *Incidence.Vars[ Var ] );
+			Incidence.VarValue[ Var ] = rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult;
 		}
 
-		// This calculates the basic values for decrement/difference meters -- UpdateMeters then calculates the actual.
-		if ( present( NumOnCustomMeters ) ) {
-			for ( Meter = 1; Meter <= NumOnCustomMeters; ++Meter ) {
-				Which = OnCustomMeters()( Meter );
-				MeterValue( Which ) += TimeStepValue;
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			Real64 Sum( 0.0 );
+			for ( int Entry = Incidence.RowStart[ Meter - 1 ], EntryEnd = Incidence.RowStart[ Meter ]; Entry < EntryEnd; ++Entry ) {
+				Sum += Incidence.VarValue[ Incidence.Col[ Entry ] ];
 			}
+			MeterValue( Meter ) = Sum;
 		}
 
 	}
@@ -2990,7 +3164,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Linda Lawrie
 		//       DATE WRITTEN   April 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; hourly, daily and monthly roll-ups only for meters reported at those frequencies
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2999,7 +3173,10 @@ namespace OutputProcessor {
 
 		// METHODOLOGY EMPLOYED:
 		// Goes thru the number of meters, setting min/max as appropriate.  Uses timestamp
-		// from calling program.
+		// from calling program.  The time step and run period values feed cumulative and
+		// tabular reports, so they are kept for every meter; the hourly, daily and monthly
+		// values are only read when the meter is reported at that frequency, so they are
+		// accumulated for those meters alone.
 
 		// REFERENCES:
 		// na
@@ -3020,41 +3197,47 @@ namespace OutputProcessor {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int Meter; // Loop Control
+		// na
 
-		for ( Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
-			if ( EnergyMeters( Meter ).TypeOfMeter != MeterType_CustomDec && EnergyMeters( Meter ).TypeOfMeter != MeterType_CustomDiff ) {
-				EnergyMeters( Meter ).TSValue += MeterValue( Meter );
-				EnergyMeters( Meter ).HRValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).HRMaxVal, EnergyMeters( Meter ).HRMaxValDate, EnergyMeters( Meter ).HRMinVal, EnergyMeters( Meter ).HRMinValDate );
-				EnergyMeters( Meter ).DYValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).DYMaxVal, EnergyMeters( Meter ).DYMaxValDate, EnergyMeters( Meter ).DYMinVal, EnergyMeters( Meter ).DYMinValDate );
-				EnergyMeters( Meter ).MNValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).MNMaxVal, EnergyMeters( Meter ).MNMaxValDate, EnergyMeters( Meter ).MNMinVal, EnergyMeters( Meter ).MNMinValDate );
-				EnergyMeters( Meter ).SMValue += MeterValue( Meter );
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).SMMaxVal, EnergyMeters( Meter ).SMMaxValDate, EnergyMeters( Meter ).SMMinVal, EnergyMeters( Meter ).SMMinValDate );
-				if ( isFinalYear ){
-					EnergyMeters( Meter ).FinYrSMValue += MeterValue( Meter );
-					SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).FinYrSMMaxVal, EnergyMeters( Meter ).FinYrSMMaxValDate, EnergyMeters( Meter ).FinYrSMMinVal, EnergyMeters( Meter ).FinYrSMMinValDate );
-				}
+		if ( ! MeterIncidence.Current ) BuildMeterIncidence();
+
+		// Amount added to the roll-ups this time step
+		auto const MeterIncrement = []( int const Which ) -> Real64 {
+			auto const & meter( EnergyMeters( Which ) );
+			if ( meter.TypeOfMeter != MeterType_CustomDec && meter.TypeOfMeter != MeterType_CustomDiff ) return MeterValue( Which );
+			return meter.TSValue;
+		};
+
+		for ( int Meter = 1; Meter <= NumEnergyMeters; ++Meter ) {
+			auto & meter( EnergyMeters( Meter ) );
+			if ( meter.TypeOfMeter != MeterType_CustomDec && meter.TypeOfMeter != MeterType_CustomDiff ) {
+				meter.TSValue += MeterValue( Meter );
 			} else {
-				EnergyMeters( Meter ).TSValue = EnergyMeters( EnergyMeters( Meter ).SourceMeter ).TSValue - MeterValue( Meter );
-				EnergyMeters( Meter ).HRValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).HRMaxVal, EnergyMeters( Meter ).HRMaxValDate, EnergyMeters( Meter ).HRMinVal, EnergyMeters( Meter ).HRMinValDate );
-				EnergyMeters( Meter ).DYValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).DYMaxVal, EnergyMeters( Meter ).DYMaxValDate, EnergyMeters( Meter ).DYMinVal, EnergyMeters( Meter ).DYMinValDate );
-				EnergyMeters( Meter ).MNValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).MNMaxVal, EnergyMeters( Meter ).MNMaxValDate, EnergyMeters( Meter ).MNMinVal, EnergyMeters( Meter ).MNMinValDate );
-				EnergyMeters( Meter ).SMValue += EnergyMeters( Meter ).TSValue;
-				SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).SMMaxVal, EnergyMeters( Meter ).SMMaxValDate, EnergyMeters( Meter ).SMMinVal, EnergyMeters( Meter ).SMMinValDate );
-				if ( isFinalYear ){
-					EnergyMeters( Meter ).FinYrSMValue += EnergyMeters( Meter ).TSValue;
-					SetMinMax( EnergyMeters( Meter ).TSValue, TimeStamp, EnergyMeters( Meter ).FinYrSMMaxVal, EnergyMeters( Meter ).FinYrSMMaxValDate, EnergyMeters( Meter ).FinYrSMMinVal, EnergyMeters( Meter ).FinYrSMMinValDate );
-				}
+				meter.TSValue = EnergyMeters( meter.SourceMeter ).TSValue - MeterValue( Meter );
+			}
+			meter.SMValue += MeterIncrement( Meter );
+			SetMinMax( meter.TSValue, TimeStamp, meter.SMMaxVal, meter.SMMaxValDate, meter.SMMinVal, meter.SMMinValDate );
+			if ( isFinalYear ) {
+				meter.FinYrSMValue += MeterIncrement( Meter );
+				SetMinMax( meter.TSValue, TimeStamp, meter.FinYrSMMaxVal, meter.FinYrSMMaxValDate, meter.FinYrSMMinVal, meter.FinYrSMMinValDate );
 			}
 		}
 
-		MeterValue = 0.0; // Ready for next update
+		for ( int const Meter : MeterIncidence.HRMeters ) {
+			auto & meter( EnergyMeters( Meter ) );
+			meter.HRValue += MeterIncrement( Meter );
+			SetMinMax( meter.TSValue, TimeStamp, meter.HRMaxVal, meter.HRMaxValDate, meter.HRMinVal, meter.HRMinValDate );
+		}
+		for ( int const Meter : MeterIncidence.DYMeters ) {
+			auto & meter( EnergyMeters( Meter ) );
+			meter.DYValue += MeterIncrement( Meter );
+			SetMinMax( meter.TSValue, TimeStamp, meter.DYMaxVal, meter.DYMaxValDate, meter.DYMinVal, meter.DYMinValDate );
+		}
+		for ( int const Meter : MeterIncidence.MNMeters ) {
+			auto & meter( EnergyMeters( Meter ) );
+			meter.MNValue += MeterIncrement( Meter );
+			SetMinMax( meter.TSValue, TimeStamp, meter.MNMaxVal, meter.MNMaxValDate, meter.MNMinVal, meter.MNMinValDate );
+		}
 
 	}
 
@@ -3996,6 +4179,337 @@ namespace OutputProcessor {
 
 	}
 
+	namespace {
+		// Report record writer.  The time stamp and value lines of the eso and mtr files are queued as raw
+		// records in one of two preallocated buffers while a writer thread formats and writes the other one,
+		// so the time step loop does not wait on number formatting or the disk.  Without a running writer
+		// (unit tests, single threaded runs) each record is formatted and written as soon as it is posted.
+		// Anything else written to these files must call FlushReportRecords first to keep the line order.
+
+		int const ReportRecordTimeStamp( 1 ); // Time stamp line
+		int const ReportRecordValue( 2 ); // Real value, with min/max for daily and longer intervals
+		int const ReportRecordNumeric( 3 ); // Real value written as is
+		int const ReportRecordInteger( 4 ); // Integer value written as is
+		int const ReportRecordIntegerAverage( 5 ); // Integer variable value, with min/max for daily and longer intervals
+
+		std::size_t const ReportRecordBufferSize( 16384 ); // Records per buffer
+
+		struct ReportRecordType
+		{
+			// Members
+			int Kind; // Record kind (see ReportRecordTimeStamp etc.)
+			std::ostream * Stream; // Output stream
+			std::ostream * EchoStream; // Second stream for the same line (meters also written to the eso) or nullptr
+			int ReportingInterval; // Reporting interval (ReportEach, ReportTimeStep, ReportHourly, etc.)
+			std::string ReportIDChr; // Report ID of the variable or time stamp
+			Real64 Value; // Real value
+			int64_t IntValue; // Integer value
+			Real64 MinValue; // Minimum value during the reporting interval
+			int MinValueDate; // Date of the minimum value
+			Real64 MaxValue; // Maximum value during the reporting interval
+			int MaxValueDate; // Date of the maximum value
+			std::string DayOfSimChr; // Time stamp: days simulated so far
+			int Month; // Time stamp: month
+			int DayOfMonth; // Time stamp: day of month
+			int Hour; // Time stamp: hour
+			Real64 StartMinute; // Time stamp: starting minute
+			Real64 EndMinute; // Time stamp: ending minute
+			int DST; // Time stamp: daylight savings time indicator
+			std::string DayType; // Time stamp: day type
+
+			// Default Constructor
+			ReportRecordType() :
+				Kind( 0 ),
+				Stream( nullptr ),
+				EchoStream( nullptr ),
+				ReportingInterval( 0 ),
+				Value( 0.0 ),
+				IntValue( 0 ),
+				MinValue( 0.0 ),
+				MinValueDate( 0 ),
+				MaxValue( 0.0 ),
+				MaxValueDate( 0 ),
+				Month( 0 ),
+				DayOfMonth( 0 ),
+				Hour( 0 ),
+				StartMinute( 0.0 ),
+				EndMinute( 0.0 ),
+				DST( 0 )
+			{}
+
+		};
+
+		struct ReportWriterType
+		{
+			// Members
+			bool Running; // Writer thread is running (only touched by the simulation thread)
+			bool Pending; // Back buffer is handed off and not yet written
+			bool Stop; // Writer thread should exit once the back buffer is written
+			std::vector< ReportRecordType > FrontBuffer; // Buffer filled by the simulation
+			std::vector< ReportRecordType > BackBuffer; // Buffer written by the writer thread
+			std::size_t FrontCount; // Records in the front buffer
+			std::size_t BackCount; // Records in the back buffer
+			ReportRecordType Scratch; // Record used when the writer is not running
+			std::mutex Mutex;
+			std::condition_variable Ready; // Back buffer handed off or stop requested
+			std::condition_variable Written; // Back buffer written
+			std::thread Thread;
+
+			// Default Constructor
+			ReportWriterType() :
+				Running( false ),
+				Pending( false ),
+				Stop( false ),
+				FrontCount( 0 ),
+				BackCount( 0 )
+			{}
+
+			// Destructor
+			~ReportWriterType()
+			{
+				if ( Thread.joinable() ) { // Not stopped through StopReportWriter: let the thread exit
+					{
+						std::lock_guard< std::mutex > lock( Mutex );
+						Stop = true;
+					}
+					Ready.notify_one();
+					Thread.join();
+				}
+			}
+
+		};
+
+		ReportWriterType ReportWriter;
+
+		void
+		WriteReportRecord( ReportRecordType const & record )
+		{
+			// Formats a report record and writes it to its streams
+
+			using DataStringGlobals::NL;
+			using General::ListDirectedString;
+			using General::strip_trailing_zeros;
+
+			int const N( 129 );
+			char s[ N ];
+			std::string NumberOut;
+			std::string MinOut;
+			std::string MaxOut;
+
+			std::ostream * const out_stream_p( record.Stream );
+			int const reportingInterval( record.ReportingInterval );
+			bool const withMinMax( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ); //  2, 3, 4
+
+			if ( record.Kind == ReportRecordTimeStamp ) {
+				if ( ( ! out_stream_p ) || ( ! *out_stream_p ) ) return;
+				assert( record.ReportIDChr.length() + record.DayOfSimChr.length() + record.DayType.length() + 26 < N ); // Check will fit in stamp size
+				if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
+					std::sprintf( s, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", record.ReportIDChr.c_str(), record.DayOfSimChr.c_str(), record.Month, record.DayOfMonth, record.DST, record.Hour, record.StartMinute, record.EndMinute, record.DayType.c_str() );
+				} else if ( reportingInterval == ReportHourly ) {
+					std::sprintf( s, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", record.ReportIDChr.c_str(), record.DayOfSimChr.c_str(), record.Month, record.DayOfMonth, record.DST, record.Hour, 0.0, 60.0, record.DayType.c_str() );
+				} else if ( reportingInterval == ReportDaily ) {
+					std::sprintf( s, "%s,%s,%2d,%2d,%2d,%s", record.ReportIDChr.c_str(), record.DayOfSimChr.c_str(), record.Month, record.DayOfMonth, record.DST, record.DayType.c_str() );
+				} else if ( reportingInterval == ReportMonthly ) {
+					std::sprintf( s, "%s,%s,%2d", record.ReportIDChr.c_str(), record.DayOfSimChr.c_str(), record.Month );
+				} else { // ReportSim
+					std::sprintf( s, "%s,%s", record.ReportIDChr.c_str(), record.DayOfSimChr.c_str() );
+				}
+				*out_stream_p << s << NL;
+				return;
+			}
+
+			if ( record.Kind == ReportRecordValue ) {
+				if ( record.Value == 0.0 ) {
+					NumberOut = "0.0";
+				} else {
+					dtoa( record.Value, s );
+					NumberOut = s;
+				}
+				if ( withMinMax ) {
+					if ( record.MinValue == 0.0 ) {
+						MinOut = "0.0";
+					} else {
+						dtoa( record.MinValue, s );
+						MinOut = s;
+					}
+					if ( record.MaxValue == 0.0 ) {
+						MaxOut = "0.0";
+					} else {
+						dtoa( record.MaxValue, s );
+						MaxOut = s;
+					}
+				}
+			} else if ( record.Kind == ReportRecordNumeric ) {
+				dtoa( record.Value, s );
+				NumberOut = s;
+			} else if ( record.Kind == ReportRecordInteger ) {
+				i64toa( record.IntValue, s );
+				NumberOut = s;
+			} else if ( record.Kind == ReportRecordIntegerAverage ) {
+				if ( record.Value == 0.0 ) {
+					NumberOut = "0.0";
+				} else {
+					NumberOut = ListDirectedString( record.Value );
+					strip_trailing_zeros( strip( NumberOut ) );
+				}
+				if ( withMinMax ) {
+					i32toa( static_cast< int >( record.MinValue ), s );
+					MinOut = s;
+					i32toa( static_cast< int >( record.MaxValue ), s );
+					MaxOut = s;
+				}
+			}
+
+			if ( withMinMax && ( record.Kind != ReportRecordNumeric ) && ( record.Kind != ReportRecordInteger ) ) {
+				// Append the min and max strings with date information
+				ProduceMinMaxString( MinOut, record.MinValueDate, reportingInterval );
+				ProduceMinMaxString( MaxOut, record.MaxValueDate, reportingInterval );
+				if ( out_stream_p ) *out_stream_p << record.ReportIDChr << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
+				if ( record.EchoStream ) *record.EchoStream << record.ReportIDChr << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
+			} else {
+				if ( out_stream_p ) *out_stream_p << record.ReportIDChr << ',' << NumberOut << NL;
+				if ( record.EchoStream ) *record.EchoStream << record.ReportIDChr << ',' << NumberOut << NL;
+			}
+		}
+
+		void
+		RunReportWriter()
+		{
+			// Writer thread: writes each handed off back buffer until asked to stop
+
+			std::unique_lock< std::mutex > lock( ReportWriter.Mutex );
+			while ( true ) {
+				ReportWriter.Ready.wait( lock, [](){ return ReportWriter.Pending || ReportWriter.Stop; } );
+				if ( ReportWriter.Pending ) {
+					lock.unlock();
+					for ( std::size_t i = 0; i < ReportWriter.BackCount; ++i ) WriteReportRecord( ReportWriter.BackBuffer[ i ] );
+					lock.lock();
+					ReportWriter.Pending = false;
+					ReportWriter.Written.notify_all();
+				} else { // Stop
+					return;
+				}
+			}
+		}
+
+		void
+		HandOffReportRecords()
+		{
+			// Swaps the filled front buffer with the back buffer once the writer is done with it
+
+			std::unique_lock< std::mutex > lock( ReportWriter.Mutex );
+			ReportWriter.Written.wait( lock, [](){ return ! ReportWriter.Pending; } );
+			std::swap( ReportWriter.FrontBuffer, ReportWriter.BackBuffer );
+			ReportWriter.BackCount = ReportWriter.FrontCount;
+			ReportWriter.FrontCount = 0;
+			ReportWriter.Pending = true;
+			lock.unlock();
+			ReportWriter.Ready.notify_one();
+		}
+
+		ReportRecordType &
+		NextReportRecord()
+		{
+			// Record to fill in for the next line: pass it to PostReportRecord when done
+			return ( ReportWriter.Running ? ReportWriter.FrontBuffer[ ReportWriter.FrontCount ] : ReportWriter.Scratch );
+		}
+
+		void
+		PostReportRecord()
+		{
+			if ( ReportWriter.Running ) {
+				if ( ++ReportWriter.FrontCount == ReportWriter.FrontBuffer.size() ) HandOffReportRecords();
+			} else {
+				WriteReportRecord( ReportWriter.Scratch );
+			}
+		}
+
+	}
+
+	void
+	StartReportWriter()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Starts the thread that formats and writes the eso and mtr report records.
+		// Once it is running the files must not be written directly without calling
+		// FlushReportRecords first, and StopReportWriter must be called before they are closed.
+
+		// METHODOLOGY EMPLOYED:
+		// If the thread cannot be created the records keep being written synchronously.
+
+		if ( ReportWriter.Running ) return;
+		ReportWriter.FrontBuffer.resize( ReportRecordBufferSize );
+		ReportWriter.BackBuffer.resize( ReportRecordBufferSize );
+		ReportWriter.FrontCount = 0;
+		ReportWriter.BackCount = 0;
+		ReportWriter.Pending = false;
+		ReportWriter.Stop = false;
+		try {
+			ReportWriter.Thread = std::thread( RunReportWriter );
+			ReportWriter.Running = true;
+		} catch ( std::system_error const & ) {
+			std::vector< ReportRecordType >().swap( ReportWriter.FrontBuffer );
+			std::vector< ReportRecordType >().swap( ReportWriter.BackBuffer );
+		}
+
+	}
+
+	void
+	FlushReportRecords()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Waits until every report record posted so far has been written to the eso and mtr files.
+
+		if ( ! ReportWriter.Running ) return;
+		if ( ReportWriter.FrontCount > 0 ) HandOffReportRecords();
+		std::unique_lock< std::mutex > lock( ReportWriter.Mutex );
+		ReportWriter.Written.wait( lock, [](){ return ! ReportWriter.Pending; } );
+
+	}
+
+	void
+	StopReportWriter()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the outstanding report records and stops the writer thread.
+		// Later records are written synchronously.
+
+		if ( ! ReportWriter.Running ) return;
+		FlushReportRecords();
+		{
+			std::lock_guard< std::mutex > lock( ReportWriter.Mutex );
+			ReportWriter.Stop = true;
+		}
+		ReportWriter.Ready.notify_one();
+		ReportWriter.Thread.join();
+		ReportWriter.Running = false;
+		ReportWriter.Stop = false;
+		std::vector< ReportRecordType >().swap( ReportWriter.FrontBuffer );
+		std::vector< ReportRecordType >().swap( ReportWriter.BackBuffer );
+
+	}
+
 	void
 	WriteTimeStampFormatData(
 		std::ostream * out_stream_p, // Output stream pointer
@@ -4018,7 +4532,7 @@ namespace OutputProcessor {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         Greg Stark
 		//       DATE WRITTEN   July 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -4028,14 +4542,13 @@ namespace OutputProcessor {
 		// to the SQL database
 
 		// METHODOLOGY EMPLOYED:
-		// na
+		// The line itself is formatted and written by WriteReportRecord.
 
 		// REFERENCES:
 		// na
 
 		// Using/Aliasing
 		using namespace DataPrecisionGlobals;
-		using DataStringGlobals::NL;
 
 		// Locals
 		// FUNCTION ARGUMENT DEFINITIONS:
@@ -4050,39 +4563,50 @@ namespace OutputProcessor {
 		// na
 
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		static int const N( 100 );
-		static char stamp[ N ];
-		assert( reportIDString.length() + DayOfSimChr.length() + ( DayType.present() ? DayType().length() : 0u ) + 26 < N ); // Check will fit in stamp size
 
-		if ( ( ! out_stream_p ) || ( ! *out_stream_p ) ) return; // Stream
+		if ( ! out_stream_p ) return; // Stream
 
-		std::ostream & out_stream( *out_stream_p );
-		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
-			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), Hour(), StartMinute(), EndMinute(), DayType().c_str() );
-			out_stream << stamp << NL;
-			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, EndMinute, StartMinute, DST, DayType, DataGlobals::WarmupFlag );
-		} else if ( reportingInterval == ReportHourly ) {
-			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%2d,%5.2f,%5.2f,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), Hour(), 0.0, 60.0, DayType().c_str() );
-			out_stream << stamp << NL;
-			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, _, _, DST, DayType, DataGlobals::WarmupFlag );
-		} else if ( reportingInterval == ReportDaily ) {
-			std::sprintf( stamp, "%s,%s,%2d,%2d,%2d,%s", reportIDString.c_str(), DayOfSimChr.c_str(), Month(), DayOfMonth(), DST(), DayType().c_str() );
-			out_stream << stamp << NL;
-			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, _, _, _, DST, DayType, DataGlobals::WarmupFlag );
-		} else if ( reportingInterval == ReportMonthly ) {
-			std::sprintf( stamp, "%s,%s,%2d", reportIDString.c_str(), DayOfSimChr.c_str(), Month() );
-			out_stream << stamp << NL;
-			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( ReportMonthly, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month );
-		} else if ( reportingInterval == ReportSim ) {
-			std::sprintf( stamp, "%s,%s", reportIDString.c_str(), DayOfSimChr.c_str() );
-			out_stream << stamp << NL;
-			if ( writeToSQL && sqlite ) sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum );
-		} else {
+		if ( ( reportingInterval < ReportEach ) || ( reportingInterval > ReportSim ) ) {
 			std::ostringstream ss;
 			ss << "Illegal reportingInterval passed to WriteTimeStampFormatData: " << reportingInterval;
 			if ( sqlite ) {
 				sqlite->sqliteWriteMessage( ss.str() );
 			}
+			return;
+		}
+
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordTimeStamp;
+		record.Stream = out_stream_p;
+		record.EchoStream = nullptr;
+		record.ReportingInterval = reportingInterval;
+		record.ReportIDChr = reportIDString;
+		record.DayOfSimChr = DayOfSimChr;
+		if ( reportingInterval != ReportSim ) record.Month = Month();
+		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) || ( reportingInterval == ReportDaily ) ) {
+			record.DayOfMonth = DayOfMonth();
+			record.DST = DST();
+			record.DayType = DayType();
+			if ( reportingInterval != ReportDaily ) record.Hour = Hour();
+		}
+		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
+			record.StartMinute = StartMinute();
+			record.EndMinute = EndMinute();
+		}
+		PostReportRecord();
+
+		if ( writeToSQL && sqlite ) {
+			if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) ) {
+				sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, EndMinute, StartMinute, DST, DayType, DataGlobals::WarmupFlag );
+			} else if ( reportingInterval == ReportHourly ) {
+				sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, Hour, _, _, DST, DayType, DataGlobals::WarmupFlag );
+			} else if ( reportingInterval == ReportDaily ) {
+				sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month, DayOfMonth, _, _, _, DST, DayType, DataGlobals::WarmupFlag );
+			} else if ( reportingInterval == ReportMonthly ) {
+				sqlite->createSQLiteTimeIndexRecord( ReportMonthly, reportID, DayOfSim, DataEnvironment::CurEnvirNum, Month );
+			} else { // ReportSim
+				sqlite->createSQLiteTimeIndexRecord( reportingInterval, reportID, DayOfSim, DataEnvironment::CurEnvirNum );
+			}
 		}
 	}
 
@@ -4136,6 +4660,8 @@ namespace OutputProcessor {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		std::string FreqString;
 
+		FlushReportRecords(); // Keep the dictionary line after the report records already posted
+
 		FreqString = FreqNotice( storeType, reportingInterval );
 
 		if ( present( ScheduleName ) ) {
@@ -4219,6 +4745,8 @@ namespace OutputProcessor {
 
 		std::string const FreqString( FreqNotice( storeType, reportingInterval ) );
 
+		FlushReportRecords(); // Keep the dictionary line after the report records already posted
+
 		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
 			if ( ! cumulativeMeterFlag ) {
 				if ( mtr_stream ) *mtr_stream << reportIDChr << ",1," << meterName << " [" << UnitsString << ']' << FreqString << NL;
@@ -4370,6 +4898,7 @@ namespace OutputProcessor {
 		//       AUTHOR         Greg Stark
 		//       DATE WRITTEN   July 2008
 		//       MODIFIED       April 2011; Linda Lawrie
+		//                      Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4379,52 +4908,26 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
-		std::string NumberOut; // Character for producing "number out"
 		Real64 repVal( repValue ); // The variable's value
 
 		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
-		if ( repVal == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			dtoa( repVal, s );
-			NumberOut = std::string( s );
-		}
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate );
 		}
 
-		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
-			if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-
-		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
-			std::string MaxOut; // Character for Max out string
-			std::string MinOut; // Character for Min out string
-
-			if ( MaxValue == 0.0 ) {
-				MaxOut = "0.0";
-			} else {
-				dtoa( MaxValue, s );
-				MaxOut = std::string( s );
-			}
-
-			if ( minValue == 0.0 ) {
-				MinOut = "0.0";
-			} else {
-				dtoa( minValue, s );
-				MinOut = std::string( s );
-			}
-
-			// Append the min and max strings with date information
-			ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
-			ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
-
-			if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << DataStringGlobals::NL;
-
-		}
-
+		if ( ( ! DataGlobals::eso_stream ) || ( reportingInterval < ReportEach ) || ( reportingInterval > ReportSim ) ) return;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordValue;
+		record.Stream = DataGlobals::eso_stream;
+		record.EchoStream = nullptr;
+		record.ReportingInterval = reportingInterval;
+		record.ReportIDChr = creportID;
+		record.Value = repVal;
+		record.MinValue = minValue;
+		record.MinValueDate = minValueDate;
+		record.MaxValue = MaxValue;
+		record.MaxValueDate = maxValueDate;
+		PostReportRecord();
 	}
 
 	void
@@ -4439,35 +4942,27 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Greg Stark
 		//       DATE WRITTEN   July 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// This subroutine writes the cumulative meter data to the output files and
 		// SQL database.
 
-		static char s[ 129 ];
-		std::string NumberOut; // Character for producing "number out"
-
-		if ( repValue == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			dtoa( repValue, s );
-			NumberOut = std::string( s );
-		}
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::mtr_stream ) *DataGlobals::mtr_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordValue;
+		record.Stream = DataGlobals::mtr_stream;
+		record.EchoStream = ( meterOnlyFlag ? nullptr : DataGlobals::eso_stream );
+		record.ReportingInterval = ReportEach;
+		record.ReportIDChr = creportID;
+		record.Value = repValue;
+		PostReportRecord();
 		++DataGlobals::StdMeterRecordCount;
-
-		if ( ! meterOnlyFlag ) {
-			if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-			++DataGlobals::StdOutputRecordCount;
-		}
-
+		if ( ! meterOnlyFlag ) ++DataGlobals::StdOutputRecordCount;
 	}
 
 	void
@@ -4487,7 +4982,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Greg Stark
 		//       DATE WRITTEN   July 2008
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4506,57 +5001,25 @@ namespace OutputProcessor {
 		using DataGlobals::StdOutputRecordCount;
 		using DataGlobals::StdMeterRecordCount;
 
-		static char s[ 129 ];
-		std::string NumberOut; // Character for producing "number out"
-
-		if ( repValue == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			dtoa( repValue, s );
-			NumberOut = std::string( s );
-		}
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue, reportingInterval, minValue, minValueDate, MaxValue, maxValueDate, MinutesPerTimeStep );
 		}
 
-		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
-			if ( mtr_stream ) *mtr_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-			++StdMeterRecordCount;
-			if ( eso_stream && ! meterOnlyFlag ) {
-				*eso_stream << creportID << ',' << NumberOut << DataStringGlobals::NL;
-				++StdOutputRecordCount;
-			}
-		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
-			std::string MaxOut; // Character for Max out string
-			std::string MinOut; // Character for Min out string
-
-			if ( MaxValue == 0.0 ) {
-				MaxOut = "0.0";
-			} else {
-				dtoa( MaxValue, s );
-				MaxOut = std::string( s );
-			}
-
-			if ( minValue == 0.0 ) {
-				MinOut = "0.0";
-			} else {
-				dtoa( minValue, s );
-				MinOut = std::string( s );
-			}
-
-			// Append the min and max strings with date information
-			ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
-			ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
-
-			if ( mtr_stream ) *mtr_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << DataStringGlobals::NL;
-			++StdMeterRecordCount;
-			if ( eso_stream && ! meterOnlyFlag ) {
-				*eso_stream << creportID << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << DataStringGlobals::NL;
-				++StdOutputRecordCount;
-			}
-		}
-
+		if ( ( reportingInterval < ReportEach ) || ( reportingInterval > ReportSim ) ) return;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordValue;
+		record.Stream = mtr_stream;
+		record.EchoStream = ( meterOnlyFlag ? nullptr : eso_stream );
+		record.ReportingInterval = reportingInterval;
+		record.ReportIDChr = creportID;
+		record.Value = repValue;
+		record.MinValue = minValue;
+		record.MinValueDate = minValueDate;
+		record.MaxValue = MaxValue;
+		record.MaxValueDate = maxValueDate;
+		PostReportRecord();
+		++StdMeterRecordCount;
+		if ( eso_stream && ! meterOnlyFlag ) ++StdOutputRecordCount;
 	}
 
 	void
@@ -4608,7 +5071,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Mark Adams
 		//       DATE WRITTEN   May 2016
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE:
@@ -4620,19 +5083,23 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
 		if ( DataSystemVariables::UpdateDataDuringWarmupExternalInterface &&
 			! DataSystemVariables::ReportDuringWarmup )
 			return;
 
-		dtoa( repValue, s );
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
+		if ( ! DataGlobals::eso_stream ) return;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordNumeric;
+		record.Stream = DataGlobals::eso_stream;
+		record.EchoStream = nullptr;
+		record.ReportingInterval = ReportEach;
+		record.ReportIDChr = creportID;
+		record.Value = repValue;
+		PostReportRecord();
 	}
 
 	void
@@ -4645,7 +5112,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Mark Adams
 		//       DATE WRITTEN   May 2016
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE:
@@ -4657,16 +5124,19 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
-		i32toa( repValue, s );
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
-
+		if ( ! DataGlobals::eso_stream ) return;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordInteger;
+		record.Stream = DataGlobals::eso_stream;
+		record.EchoStream = nullptr;
+		record.ReportingInterval = ReportEach;
+		record.ReportIDChr = creportID;
+		record.IntValue = repValue;
+		PostReportRecord();
 	}
 
 	void
@@ -4679,7 +5149,7 @@ namespace OutputProcessor {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Mark Adams
 		//       DATE WRITTEN   May 2016
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE:
@@ -4691,16 +5161,19 @@ namespace OutputProcessor {
 		// of the UpdateDataandReport subroutine. The code was moved to facilitate
 		// easier maintenance and writing of data to the SQL database.
 
-		static char s[ 129 ];
-
-		i64toa( repValue, s );
-
 		if ( sqlite ) {
 			sqlite->createSQLiteReportDataRecord( reportID, repValue );
 		}
 
-		if ( DataGlobals::eso_stream ) *DataGlobals::eso_stream << creportID << ',' << s << DataStringGlobals::NL;
-
+		if ( ! DataGlobals::eso_stream ) return;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordInteger;
+		record.Stream = DataGlobals::eso_stream;
+		record.EchoStream = nullptr;
+		record.ReportingInterval = ReportEach;
+		record.ReportIDChr = creportID;
+		record.IntValue = repValue;
+		PostReportRecord();
 	}
 
 	void
@@ -4783,6 +5256,7 @@ namespace OutputProcessor {
 		//       AUTHOR         Greg Stark
 		//       DATE WRITTEN   July 2008
 		//       MODIFIED       April 2011; Linda Lawrie
+		//                      Oct 2026; posts a report record instead of formatting the line
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -4799,57 +5273,31 @@ namespace OutputProcessor {
 		// na
 
 		// Using/Aliasing
-		using namespace DataPrecisionGlobals;
 		using DataGlobals::eso_stream;
-		using DataStringGlobals::NL;
-		using General::strip_trailing_zeros;
-
-		// Locals
-
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-
-		// SUBROUTINE PARAMETER DEFINITIONS:
-
-		// INTERFACE BLOCK SPECIFICATIONS:
-		// na
-
-		// DERIVED TYPE DEFINITIONS:
-		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		std::string NumberOut; // Character for producing "number out"
-		std::string MaxOut; // Character for Max out string
-		std::string MinOut; // Character for Min out string
-		Real64 rmaxValue;
-		Real64 rminValue;
-		Real64 repVal; // The variable's value
-
-		repVal = repValue;
-		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
-		if ( repValue == 0.0 ) {
-			NumberOut = "0.0";
-		} else {
-			gio::write( NumberOut, fmtLD ) << repVal;
-			strip_trailing_zeros( strip( NumberOut ) );
-		}
-
-		// Append the min and max strings with date information
-		gio::write( MinOut, fmtLD ) << minValue;
-		gio::write( MaxOut, fmtLD ) << MaxValue;
-		ProduceMinMaxString( MinOut, minValueDate, reportingInterval );
-		ProduceMinMaxString( MaxOut, maxValueDate, reportingInterval );
+		Real64 repVal( repValue ); // The variable's value
 
-		rminValue = minValue;
-		rmaxValue = MaxValue;
+		if ( storeType == AveragedVar ) repVal /= numOfItemsStored;
 		if ( sqlite ) {
+			Real64 const rminValue( minValue );
+			Real64 const rmaxValue( MaxValue );
 			sqlite->createSQLiteReportDataRecord( reportID, repVal, reportingInterval, rminValue, minValueDate, rmaxValue, maxValueDate );
 		}
 
-		if ( ( reportingInterval == ReportEach ) || ( reportingInterval == ReportTimeStep ) || ( reportingInterval == ReportHourly ) ) { // -1, 0, 1
-			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << NL;
-		} else if ( ( reportingInterval == ReportDaily ) || ( reportingInterval == ReportMonthly ) || ( reportingInterval == ReportSim ) ) { //  2, 3, 4
-			if ( eso_stream ) *eso_stream << reportIDString << ',' << NumberOut << ',' << MinOut << ',' << MaxOut << NL;
-		}
+		if ( ( ! eso_stream ) || ( reportingInterval < ReportEach ) || ( reportingInterval > ReportSim ) ) return;
+		ReportRecordType & record( NextReportRecord() );
+		record.Kind = ReportRecordIntegerAverage;
+		record.Stream = eso_stream;
+		record.EchoStream = nullptr;
+		record.ReportingInterval = reportingInterval;
+		record.ReportIDChr = reportIDString;
+		record.Value = ( repValue == 0.0 ? 0.0 : repVal );
+		record.MinValue = minValue;
+		record.MinValueDate = minValueDate;
+		record.MaxValue = MaxValue;
+		record.MaxValueDate = maxValueDate;
+		PostReportRecord();
 
 	}
 
@@ -5225,6 +5673,7 @@ SetupOutputVariable(
 		if ( ! OnMeter && ! ThisOneOnTheList ) continue;
 
 		++NumOfRVariable;
+		ActiveVariables.Current = false;
 		if ( Loop == 1 && VariableType == SummedVar ) {
 			++NumOfRVariable_Sum;
 			if ( present( ResourceTypeKey ) ) {
@@ -5453,6 +5902,7 @@ SetupOutputVariable(
 		if ( ! ThisOneOnTheList ) continue;
 
 		++NumOfIVariable;
+		ActiveVariables.Current = false;
 		if ( Loop == 1 && VariableType == SummedVar ) {
 			++NumOfIVariable_Sum;
 		}
@@ -5593,6 +6043,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	//       DATE WRITTEN   December 1998
 	//       MODIFIED       January 2001; Resolution integrated at the Zone TimeStep intervals
 	//       MODIFIED       August 2008; Added SQL output capability
+	//       MODIFIED       Oct 2026; Visit only the active variable set
 	//       RE-ENGINEERED  na
 
 	// PURPOSE OF THIS SUBROUTINE:
@@ -5600,7 +6051,9 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	// Report Variables) strings to the standard output file.
 
 	// METHODOLOGY EMPLOYED:
-	// na
+	// Loops run over the variable lists built by BuildActiveVariableSet: reported variables
+	// get full record keeping, unreported variables on meters or read by the external
+	// interface only accumulate their zone time step value, and all others are skipped.
 
 	// REFERENCES:
 	// na
@@ -5631,7 +6084,6 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop; // Loop Variable
 	int IndexType; // Translate Zone=>1, HVAC=>2
 	Real64 CurVal; // Current value for real variables
 	Real64 ICurVal; // Current value for integer variables
@@ -5674,12 +6126,13 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 		rxTime = ( MinuteNow - StartMinute ) / double( MinutesPerTimeStep );
 
+		if ( ! ActiveVariables.Current ) BuildActiveVariableSet();
+
 		// Main "Record Keeping" Loops for R and I variables
-		for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-			if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
+		for ( int const Var : ActiveVariables.ReportedR( IndexType ) ) {
 
 			// Act on the RVariables variable using the RVar structure
-			RVar >>= RVariableTypes( Loop ).VarPtr;
+			RVar >>= RVariableTypes( Var ).VarPtr;
 			auto & rVar( RVar() );
 			rVar.Stored = true;
 			if ( rVar.StoreType == AveragedVar ) {
@@ -5710,7 +6163,6 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			}
 
 			// End of "record keeping"  Report if applicable
-			if ( ! rVar.Report ) continue;
 			ReportNow = true;
 			if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); // SetReportNow(RVar%SchedPtr)
 			if ( ! ReportNow ) continue;
@@ -5741,11 +6193,22 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			}
 		}
 
-		for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-			if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
+		// Unreported variables on meters or read by the external interface only need their time step sum
+		for ( int const Var : ActiveVariables.AccumulatedR( IndexType ) ) {
+			RVar >>= RVariableTypes( Var ).VarPtr;
+			auto & rVar( RVar() );
+			if ( rVar.StoreType == AveragedVar ) {
+				rVar.TSValue += rVar.Which * rxTime;
+			} else {
+				rVar.TSValue += rVar.Which;
+			}
+			rVar.EITSValue = rVar.TSValue;
+		}
+
+		for ( int const Var : ActiveVariables.ReportedI( IndexType ) ) {
 
 			// Act on the IVariables variable using the IVar structure
-			IVar >>= IVariableTypes( Loop ).VarPtr;
+			IVar >>= IVariableTypes( Var ).VarPtr;
 			auto & iVar( IVar() );
 			iVar.Stored = true;
 			//      ICurVal=IVar%Which
@@ -5774,7 +6237,6 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				iVar.EITSValue = iVar.TSValue; //CR - 8481 fix - 09/06/2011
 			}
 
-			if ( ! iVar.Report ) continue;
 			ReportNow = true;
 			if ( iVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( iVar.SchedPtr ) != 0.0 ); //SetReportNow(IVar%SchedPtr)
 			if ( ! ReportNow ) continue;
@@ -5804,6 +6266,17 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			}
 		}
 
+		for ( int const Var : ActiveVariables.AccumulatedI( IndexType ) ) {
+			IVar >>= IVariableTypes( Var ).VarPtr;
+			auto & iVar( IVar() );
+			if ( iVar.StoreType == AveragedVar ) {
+				iVar.TSValue += iVar.Which * rxTime;
+			} else {
+				iVar.TSValue += iVar.Which;
+			}
+			iVar.EITSValue = iVar.TSValue;
+		}
+
 	} else {
 		ShowSevereError( "Illegal Index passed to Report Variables" );
 	}
@@ -5814,22 +6287,16 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 	if ( EndTimeStepFlag ) {
 
+		// Update meters on the TimeStep  (Zone)
+		UpdateMeterValues();
+
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
-				RVar >>= RVariableTypes( Loop ).VarPtr;
+			for ( int const Var : ActiveVariables.ReportedR( IndexType ) ) {
+				RVar >>= RVariableTypes( Var ).VarPtr;
 				auto & rVar( RVar() );
-				// Update meters on the TimeStep  (Zone)
-				if ( rVar.MeterArrayPtr != 0 ) {
-					if ( VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters <= 0 ) {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters );
-					} else {
-						UpdateMeterValues( rVar.TSValue * rVar.ZoneMult * rVar.ZoneListMult, VarMeterArrays( rVar.MeterArrayPtr ).NumOnMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnMeters, VarMeterArrays( rVar.MeterArrayPtr ).NumOnCustomMeters, VarMeterArrays( rVar.MeterArrayPtr ).OnCustomMeters );
-					}
-				}
 				ReportNow = true;
 				if ( rVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( rVar.SchedPtr ) != 0.0 ); //SetReportNow(RVar%SchedPtr)
-				if ( ! ReportNow || ! rVar.Report ) {
+				if ( ! ReportNow ) {
 					rVar.TSValue = 0.0;
 				}
 				//        IF (RVar%StoreType == AveragedVar) THEN
@@ -5838,7 +6305,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.Value += rVar.TSValue;
 				//        ENDIF
 
-				if ( ! ReportNow || ! rVar.Report ) continue;
+				if ( ! ReportNow ) continue;
 
 				if ( rVar.ReportFreq == ReportTimeStep ) {
 					if ( TimePrint ) {
@@ -5862,9 +6329,13 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.thisTSStored = false;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-				IVar >>= IVariableTypes( Loop ).VarPtr;
+			for ( int const Var : ActiveVariables.AccumulatedR( IndexType ) ) {
+				RVar >>= RVariableTypes( Var ).VarPtr;
+				RVar().TSValue = 0.0;
+			}
+
+			for ( int const Var : ActiveVariables.ReportedI( IndexType ) ) {
+				IVar >>= IVariableTypes( Var ).VarPtr;
 				auto & iVar( IVar() );
 				ReportNow = true;
 				if ( iVar.SchedPtr > 0 ) ReportNow = ( GetCurrentScheduleValue( iVar.SchedPtr ) != 0.0 ); // SetReportNow(IVar%SchedPtr)
@@ -5877,7 +6348,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				iVar.Value += iVar.TSValue;
 				//        ENDIF
 
-				if ( ! ReportNow || ! iVar.Report ) continue;
+				if ( ! ReportNow ) continue;
 
 				if ( iVar.ReportFreq == ReportTimeStep ) {
 					if ( TimePrint ) {
@@ -5900,6 +6371,11 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				iVar.TSValue = 0.0;
 				iVar.thisTSStored = false;
 			} // Number of I Variables
+
+			for ( int const Var : ActiveVariables.AccumulatedI( IndexType ) ) {
+				IVar >>= IVariableTypes( Var ).VarPtr;
+				IVar().TSValue = 0.0;
+			}
 		} // Index Type (Zone or HVAC)
 
 		UpdateMeters( MDHM );
@@ -5921,9 +6397,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
 			TimeValue( IndexType ).CurMinute = 0.0;
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType != IndexType ) continue;
-				RVar >>= RVariableTypes( Loop ).VarPtr;
+			for ( int const Var : ActiveVariables.ReportedR( IndexType ) ) {
+				RVar >>= RVariableTypes( Var ).VarPtr;
 				auto & rVar( RVar() );
 				//        ReportNow=.TRUE.
 				//        IF (RVar%SchedPtr > 0) &
@@ -5934,7 +6409,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 					if ( rVar.StoreType == AveragedVar ) {
 						rVar.Value /= double( rVar.thisTSCount );
 					}
-					if ( rVar.Report && rVar.ReportFreq == ReportHourly && rVar.Stored ) {
+					if ( rVar.ReportFreq == ReportHourly && rVar.Stored ) {
 						WriteNumericData( rVar.ReportID, rVar.ReportIDChr, rVar.Value );
 						++StdOutputRecordCount;
 						rVar.Stored = false;
@@ -5948,9 +6423,8 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 				rVar.Value = 0.0;
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType != IndexType ) continue;
-				IVar >>= IVariableTypes( Loop ).VarPtr;
+			for ( int const Var : ActiveVariables.ReportedI( IndexType ) ) {
+				IVar >>= IVariableTypes( Var ).VarPtr;
 				auto & iVar( IVar() );
 				//        ReportNow=.TRUE.
 				//        IF (IVar%SchedPtr > 0) &
@@ -5960,7 +6434,7 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 					if ( iVar.StoreType == AveragedVar ) {
 						iVar.Value /= double( iVar.thisTSCount );
 					}
-					if ( iVar.Report && iVar.ReportFreq == ReportHourly && iVar.Stored ) {
+					if ( iVar.ReportFreq == ReportHourly && iVar.Stored ) {
 						WriteNumericData( iVar.ReportID, iVar.ReportIDChr, iVar.Value );
 						++StdOutputRecordCount;
 						iVar.Stored = false;
@@ -5993,18 +6467,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		}
 		NumHoursInMonth += 24;
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) {
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportDaily );
-				}
+			for ( int const Var : ActiveVariables.ReportedRByFreq( ReportDaily, IndexType ) ) {
+				RVar >>= RVariableTypes( Var ).VarPtr;
+				WriteRealVariableOutput( ReportDaily );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportDaily );
-				}
+			for ( int const Var : ActiveVariables.ReportedIByFreq( ReportDaily, IndexType ) ) {
+				IVar >>= IVariableTypes( Var ).VarPtr;
+				WriteIntegerVariableOutput( ReportDaily );
 			} // Number of I Variables
 		} // Index type (Zone or HVAC)
 
@@ -6024,18 +6494,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 		NumHoursInSim += NumHoursInMonth;
 		EndMonthFlag = false;
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportMonthly );
-				}
+			for ( int const Var : ActiveVariables.ReportedRByFreq( ReportMonthly, IndexType ) ) {
+				RVar >>= RVariableTypes( Var ).VarPtr;
+				WriteRealVariableOutput( ReportMonthly );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportMonthly );
-				}
+			for ( int const Var : ActiveVariables.ReportedIByFreq( ReportMonthly, IndexType ) ) {
+				IVar >>= IVariableTypes( Var ).VarPtr;
+				WriteIntegerVariableOutput( ReportMonthly );
 			} // Number of I Variables
 		} // IndexType (Zone, HVAC)
 
@@ -6051,18 +6517,14 @@ UpdateDataandReport( int const IndexTypeKey ) // What kind of data to update (Zo
 			TimePrint = false;
 		}
 		for ( IndexType = 1; IndexType <= 2; ++IndexType ) { // Zone, HVAC
-			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
-				if ( RVariableTypes( Loop ).IndexType == IndexType ) {
-					RVar >>= RVariableTypes( Loop ).VarPtr;
-					WriteRealVariableOutput( ReportSim );
-				}
+			for ( int const Var : ActiveVariables.ReportedRByFreq( ReportSim, IndexType ) ) {
+				RVar >>= RVariableTypes( Var ).VarPtr;
+				WriteRealVariableOutput( ReportSim );
 			} // Number of R Variables
 
-			for ( Loop = 1; Loop <= NumOfIVariable; ++Loop ) {
-				if ( IVariableTypes( Loop ).IndexType == IndexType ) {
-					IVar >>= IVariableTypes( Loop ).VarPtr;
-					WriteIntegerVariableOutput( ReportSim );
-				}
+			for ( int const Var : ActiveVariables.ReportedIByFreq( ReportSim, IndexType ) ) {
+				IVar >>= IVariableTypes( Var ).VarPtr;
+				WriteIntegerVariableOutput( ReportSim );
 			} // Number of I Variables
 		} // Index Type (Zone, HVAC)
 
@@ -6506,6 +6968,8 @@ SetInitialMeterReportingAndOutputNames(
 	int indexGroupKey;
 	std::string indexGroup;
 
+	MeterIncidence.Current = false; // Hourly, daily and monthly roll-ups follow the reporting requests
+
 	if ( ( FrequencyIndicator >= -1 ) && ( FrequencyIndicator <= 0 ) ) { // roll "detailed" into TimeStep
 		if ( ! CumulativeIndicator ) {
 			if ( MeterFileOnlyIndicator ) {
@@ -7192,6 +7656,77 @@ GetInternalVariableValueExternalInterface(
 	return resultVal;
 }
 
+void
+SetExternalInterfaceVariable(
+	int const varType, // 1=integer, 2=REAL(r64), 3=meter
+	int const keyVarIndex // Array index
+)
+{
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Marks an integer or REAL(r64) report variable as read through
+	// GetInternalVariableValueExternalInterface, so its zone time step value keeps
+	// being accumulated even when the variable is not reported.
+
+	// METHODOLOGY EMPLOYED:
+	// na
+
+	// REFERENCES:
+	// na
+
+	// Using/Aliasing
+	using namespace OutputProcessor;
+
+	if ( varType == 1 && keyVarIndex >= 1 && keyVarIndex <= NumOfIVariable ) {
+		IVariableTypes( keyVarIndex ).VarPtr().ExternalInterface = true;
+		ActiveVariables.Current = false;
+	} else if ( varType == 2 && keyVarIndex >= 1 && keyVarIndex <= NumOfRVariable ) {
+		RVariableTypes( keyVarIndex ).VarPtr().ExternalInterface = true;
+		ActiveVariables.Current = false;
+	}
+
+}
+
+Real64 const *
+GetInternalVariableValueExternalInterfacePtr(
+	int const varType, // 1=integer, 2=REAL(r64), 3=meter
+	int const keyVarIndex // Array index
+)
+{
+
+	// FUNCTION INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   Oct 2026
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS FUNCTION:
+	// Returns the address of the value GetInternalVariableValueExternalInterface
+	// reads, so callers exchanging the same variables every zone time step can
+	// resolve them once. Returns nullptr for meters, schedules and invalid indexes,
+	// which must still go through GetInternalVariableValueExternalInterface.
+
+	// METHODOLOGY EMPLOYED:
+	// The report variable records are allocated one by one when set up and are not
+	// moved afterwards, so the address of EITSValue stays valid.
+
+	// Using/Aliasing
+	using namespace OutputProcessor;
+
+	if ( varType == 1 && keyVarIndex >= 1 && keyVarIndex <= NumOfIVariable ) {
+		return &IVariableTypes( keyVarIndex ).VarPtr().EITSValue;
+	} else if ( varType == 2 && keyVarIndex >= 1 && keyVarIndex <= NumOfRVariable ) {
+		return &RVariableTypes( keyVarIndex ).VarPtr().EITSValue;
+	}
+	return nullptr;
+
+}
+
 int
 GetNumMeteredVariables(
 	std::string const & EP_UNUSED( ComponentType ), // Given Component Type
@@ -7864,6 +8399,7 @@ InitPollutionMeterReporting( std::string const & ReportFreqName )
 
 	NumReqMeters = 29;
 	DetermineFrequency( ReportFreqName, ReportFreq );
+	MeterIncidence.Current = false;
 
 	for ( Loop = 1; Loop <= NumReqMeters; ++Loop ) {
 
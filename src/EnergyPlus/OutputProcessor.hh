@@ -61,6 +61,7 @@
 
 // C++ Headers
 #include <iosfwd>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -241,6 +242,7 @@ namespace OutputProcessor {
 		int MeterArrayPtr; // If metered, this points to an array of applicable meters
 		int ZoneMult; // If metered, Zone Multiplier is applied
 		int ZoneListMult; // If metered, Zone List Multiplier is applied
+		bool ExternalInterface; // EITSValue is read by the external interface
 
 		// Default Constructor
 		RealVariables() :
@@ -264,7 +266,8 @@ namespace OutputProcessor {
 			SchedPtr( 0 ),
 			MeterArrayPtr( 0 ),
 			ZoneMult( 1 ),
-			ZoneListMult( 1 )
+			ZoneListMult( 1 ),
+			ExternalInterface( false )
 		{}
 
 	};
@@ -292,6 +295,7 @@ namespace OutputProcessor {
 		int ReportID; // Report variable ID number
 		std::string ReportIDChr; // Report variable ID number (character -- for printing)
 		int SchedPtr; // If scheduled, this points to the schedule
+		bool ExternalInterface; // EITSValue is read by the external interface
 
 		// Default Constructor
 		IntegerVariables() :
@@ -312,7 +316,8 @@ namespace OutputProcessor {
 			MinValue( 9999 ),
 			minValueDate( 0 ),
 			ReportID( 0 ),
-			SchedPtr( 0 )
+			SchedPtr( 0 ),
+			ExternalInterface( false )
 		{}
 
 	};
@@ -421,6 +426,55 @@ namespace OutputProcessor {
 
 	};
 
+	struct MeterIncidenceType
+	{
+		// Members
+		// Sparse variable-to-meter incidence matrix stored as compressed rows: row m lists the metered
+		// variables summed into meter m, in the order the zone time step update visits them.
+		bool Current; // False when variables, meters or meter requests have changed since the last build
+		std::vector< RealVariables * > Vars; // Metered report variables (columns)
+		std::vector< Real64 > VarValue; // Time step value of each column, including zone multipliers
+		std::vector< int > RowStart; // Start of each meter row in Col, zero based (NumEnergyMeters + 1 entries)
+		std::vector< int > Col; // Column of each nonzero
+		std::vector< int > HRMeters; // Meters accumulated for hourly reporting
+		std::vector< int > DYMeters; // Meters accumulated for daily reporting
+		std::vector< int > MNMeters; // Meters accumulated for monthly reporting
+
+		// Default Constructor
+		MeterIncidenceType() :
+			Current( false )
+		{}
+
+	};
+
+	struct ActiveVariableSetType
+	{
+		// Members
+		// Indices into RVariableTypes/IVariableTypes of the variables UpdateDataandReport has to visit, in
+		// registration order.  Reported variables get the full record keeping; unreported variables that
+		// are on meters or read by the external interface only accumulate their zone time step value.
+		// Anything else (such as EMS sensors, which read the variable directly) is skipped.
+		bool Current; // False when variables or their consumers have changed since the last build
+		Array1D< std::vector< int > > ReportedR; // Reported real variables by index type (zone, HVAC)
+		Array1D< std::vector< int > > ReportedI; // Reported integer variables by index type
+		Array1D< std::vector< int > > AccumulatedR; // Unreported real variables still consumed, by index type
+		Array1D< std::vector< int > > AccumulatedI; // Unreported integer variables still consumed, by index type
+		Array2D< std::vector< int > > ReportedRByFreq; // Reported real variables by report frequency and index type
+		Array2D< std::vector< int > > ReportedIByFreq; // Reported integer variables by report frequency and index type
+
+		// Default Constructor
+		ActiveVariableSetType() :
+			Current( false ),
+			ReportedR( 2 ),
+			ReportedI( 2 ),
+			AccumulatedR( 2 ),
+			AccumulatedI( 2 ),
+			ReportedRByFreq( {-1,4}, 2 ),
+			ReportedIByFreq( {-1,4}, 2 )
+		{}
+
+	};
+
 	struct MeterType
 	{
 		// Members
@@ -603,6 +657,8 @@ namespace OutputProcessor {
 	extern Array1D< ReqReportVariables > ReqRepVars;
 	extern Array1D< MeterArrayType > VarMeterArrays;
 	extern Array1D< MeterType > EnergyMeters;
+	extern MeterIncidenceType MeterIncidence;
+	extern ActiveVariableSetType ActiveVariables;
 	extern Array1D< EndUseCategoryType > EndUseCategory;
 
 	// Functions
@@ -777,13 +833,13 @@ namespace OutputProcessor {
 	);
 
 	void
-	UpdateMeterValues(
-		Real64 const TimeStepValue, // Value of this variable at the current time step.
-		int const NumOnMeters, // Number of meters this variable is "on".
-		Array1S_int const OnMeters, // Which meters this variable is on (index values)
-		Optional_int_const NumOnCustomMeters = _, // Number of custom meters this variable is "on".
-		Optional< Array1S_int const > OnCustomMeters = _ // Which custom meters this variable is on (index values)
-	);
+	BuildMeterIncidence();
+
+	void
+	BuildActiveVariableSet();
+
+	void
+	UpdateMeterValues();
 
 	void
 	UpdateMeters( int const TimeStamp ); // Current TimeStamp (for max/min)
@@ -849,6 +905,15 @@ namespace OutputProcessor {
 		std::string const & EndUseSubName
 	);
 
+	void
+	StartReportWriter();
+
+	void
+	FlushReportRecords();
+
+	void
+	StopReportWriter();
+
 	void
 	WriteTimeStampFormatData(
 		std::ostream * out_stream_p, // Output stream pointer
@@ -1097,6 +1162,18 @@ GetInternalVariableValueExternalInterface(
 	int const keyVarIndex // Array index
 );
 
+void
+SetExternalInterfaceVariable(
+	int const varType, // 1=integer, 2=REAL(r64), 3=meter
+	int const keyVarIndex // Array index
+);
+
+Real64 const *
+GetInternalVariableValueExternalInterfacePtr(
+	int const varType, // 1=integer, 2=REAL(r64), 3=meter
+	int const keyVarIndex // Array index
+);
+
 int
 GetNumMeteredVariables(
 	std::string const & ComponentType, // Given Component Type
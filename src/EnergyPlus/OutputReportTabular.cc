@@ -57,6 +57,7 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iomanip>
@@ -479,15 +480,48 @@ namespace OutputReportTabular {
 
 	namespace {
 		bool GatherMonthlyResultsForTimestepRunOnce( true );
+		bool GatherBinResultsForTimestepRunOnce( true );
 		bool UpdateTabularReportsGetInput( true );
 		bool GatherHeatGainReportfirstTime( true );
 		bool AllocateLoadComponentArraysDoAllocate( true );
+
+		// A gathered value compiled at the first timestep: where the value comes from and where it goes
+		struct GatherItemType
+		{
+			// Members
+			Real64 const * realVar; // real output variable holding the value (null for other sources)
+			int const * intVar; // integer output variable holding the value (null for other sources)
+			int typeOfVar; // 0=not found, 1=integer, 2=real, 3=meter
+			int varNum; // variable or meter number
+			int slot; // MonthlyColumns index or BinResults table index receiving the result
+			int aggType; // index to the type of aggregation (monthly only)
+			bool isSum; // summed variable
+			std::size_t firstDependent; // MonthlyGatherDependents range set when a maximum, minimum, or hours item triggers
+			std::size_t lastDependent;
+		};
+
+		// A run of gather items sharing a time step type and an aggregation type (monthly) or bin object (bins)
+		struct GatherGroupType
+		{
+			// Members
+			int stepType; // Zone=1 or HVAC=2
+			int kind; // aggregation type (monthly) or OutputTableBinned index (bins)
+			std::size_t first; // item range
+			std::size_t last;
+		};
+
+		std::vector< GatherItemType > MonthlyGatherItems; // monthly columns that aggregate on their own
+		std::vector< GatherItemType > MonthlyGatherDependents; // value-when-max/min and hours-shown columns
+		std::vector< GatherGroupType > MonthlyGatherGroups;
+		std::vector< GatherItemType > BinGatherItems;
+		std::vector< GatherGroupType > BinGatherGroups;
 	}
 
 	// Functions
 	void
 	clear_state(){
 		GatherMonthlyResultsForTimestepRunOnce =  true;
+		GatherBinResultsForTimestepRunOnce = true;
 		UpdateTabularReportsGetInput = true;
 		GatherHeatGainReportfirstTime = true;
 		AllocateLoadComponentArraysDoAllocate = true;
@@ -652,6 +686,11 @@ namespace OutputReportTabular {
 		MonthlyInput.deallocate();
 		MonthlyTables.deallocate();
 		MonthlyColumns.deallocate();
+		MonthlyGatherItems.clear();
+		MonthlyGatherDependents.clear();
+		MonthlyGatherGroups.clear();
+		BinGatherItems.clear();
+		BinGatherGroups.clear();
 		TOCEntries.deallocate();
 		UnitConv.deallocate();
 
@@ -3683,13 +3722,105 @@ namespace OutputReportTabular {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	namespace {
+
+		// Value of a compiled gather item's source
+		inline
+		Real64
+		GatherValue( GatherItemType const & item )
+		{
+			if ( item.realVar ) return *item.realVar;
+			if ( item.intVar ) return double( *item.intVar );
+			return GetInternalVariableValue( item.typeOfVar, item.varNum );
+		}
+
+		// Gather item reading real and integer output variables directly and other sources through GetInternalVariableValue
+		GatherItemType
+		MakeGatherItem(
+			int const typeOfVar,
+			int const varNum,
+			int const slot,
+			int const aggType,
+			bool const isSum
+		)
+		{
+			GatherItemType item;
+			item.realVar = nullptr;
+			item.intVar = nullptr;
+			if ( ( typeOfVar == 2 ) && ( varNum >= 1 ) && ( varNum <= OutputProcessor::NumOfRVariable ) ) {
+				item.realVar = &OutputProcessor::RVariableTypes( varNum ).VarPtr().Which();
+			} else if ( ( typeOfVar == 1 ) && ( varNum >= 1 ) && ( varNum <= OutputProcessor::NumOfIVariable ) ) {
+				item.intVar = &OutputProcessor::IVariableTypes( varNum ).VarPtr().Which();
+			}
+			item.typeOfVar = typeOfVar;
+			item.varNum = varNum;
+			item.slot = slot;
+			item.aggType = aggType;
+			item.isSum = isSum;
+			item.firstDependent = 0;
+			item.lastDependent = 0;
+			return item;
+		}
+
+		bool
+		isMaxMinAggType( int const aggType )
+		{
+			return ( aggType == aggTypeMaximum ) || ( aggType == aggTypeMinimum );
+		}
+
+		bool
+		isHoursAggType( int const aggType )
+		{
+			return ( aggType >= aggTypeHoursZero ) && ( aggType <= aggTypeHoursNonNegative );
+		}
+
+	}
+
+	void
+	CompileBinGathering()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Compiles the binned tables into the flat list of values GatherBinResultsForTimestep
+		//   visits, so the per timestep work does not depend on the tables of the other step type.
+
+		// METHODOLOGY EMPLOYED:
+		//   One item per binned table, holding the source of its value and its result index,
+		//   grouped by time step type and then by OutputTableBinned object so the object schedule
+		//   is checked once per group.
+
+		BinGatherItems.clear();
+		BinGatherGroups.clear();
+		for ( int stepType = stepTypeZone; stepType <= stepTypeHVAC; ++stepType ) {
+			for ( int iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
+				auto const & binned( OutputTableBinned( iInObj ) );
+				if ( binned.stepType != stepType || binned.numTables < 1 ) continue;
+				GatherGroupType group;
+				group.stepType = stepType;
+				group.kind = iInObj;
+				group.first = BinGatherItems.size();
+				for ( int jTable = 1; jTable <= binned.numTables; ++jTable ) {
+					int const repIndex( binned.resIndex + ( jTable - 1 ) );
+					BinGatherItems.push_back( MakeGatherItem( binned.typeOfVar, BinObjVarID( repIndex ).varMeterNum, repIndex, 0, binned.avgSum == isSum ) );
+				}
+				group.last = BinGatherItems.size();
+				BinGatherGroups.push_back( group );
+			}
+		}
+	}
+
 	void
 	GatherBinResultsForTimestep( int const IndexTypeKey ) // What kind of data to update (Zone, HVAC)
 	{
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; visit the tables compiled by CompileBinGathering
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3714,101 +3845,174 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iInObj;
-		int jTable;
 		Real64 curValue;
 		// values of OutputTableBinned array for current index
 		Real64 curIntervalStart;
 		Real64 curIntervalSize;
-		int curIntervalCount;
-		int curResIndex;
-		int curNumTables;
-		int curTypeOfVar;
 		int curScheduleIndex;
 		Real64 elapsedTime;
-		bool gatherThisTime;
 		Real64 topValue;
 		int binNum;
 		int repIndex;
-		int curStepType;
-
-		//REAL(r64), external :: GetInternalVariableValue
 
 		if ( ! DoWeathSim ) return;
 		elapsedTime = TimeStepSys;
 		timeInYear += elapsedTime;
-		for ( iInObj = 1; iInObj <= OutputTableBinnedCount; ++iInObj ) {
-			// get values of array for current object being referenced
-			curIntervalStart = OutputTableBinned( iInObj ).intervalStart;
-			curIntervalSize = OutputTableBinned( iInObj ).intervalSize;
-			curIntervalCount = OutputTableBinned( iInObj ).intervalCount;
-			curResIndex = OutputTableBinned( iInObj ).resIndex;
-			curNumTables = OutputTableBinned( iInObj ).numTables;
-			topValue = curIntervalStart + curIntervalSize * curIntervalCount;
-			curTypeOfVar = OutputTableBinned( iInObj ).typeOfVar;
-			curStepType = OutputTableBinned( iInObj ).stepType;
-			curScheduleIndex = OutputTableBinned( iInObj ).scheduleIndex;
+
+		if ( GatherBinResultsForTimestepRunOnce ) {
+			CompileBinGathering();
+			GatherBinResultsForTimestepRunOnce = false;
+		}
+
+		// per MJW when a summed variable is used divide it by the length of the time step
+		if ( IndexTypeKey == HVACTSReporting ) {
+			elapsedTime = TimeStepSys;
+		} else {
+			elapsedTime = TimeStepZone;
+		}
+		for ( auto const & group : BinGatherGroups ) {
+			if ( group.stepType != IndexTypeKey ) continue;
+			auto const & binned( OutputTableBinned( group.kind ) );
+			curIntervalStart = binned.intervalStart;
+			curIntervalSize = binned.intervalSize;
+			topValue = curIntervalStart + curIntervalSize * binned.intervalCount;
+			curScheduleIndex = binned.scheduleIndex;
 			//if a schedule was used, check if it was non-zero value
 			if ( curScheduleIndex != 0 ) {
-				if ( GetCurrentScheduleValue( curScheduleIndex ) != 0.0 ) {
-					gatherThisTime = true;
+				if ( GetCurrentScheduleValue( curScheduleIndex ) == 0.0 ) continue;
+			}
+			for ( std::size_t iItem = group.first; iItem < group.last; ++iItem ) {
+				auto const & item( BinGatherItems[ iItem ] );
+				repIndex = item.slot;
+				// put actual value from OutputProcesser arrays
+				curValue = GatherValue( item );
+				if ( item.isSum ) { // if it is a summed variable
+					curValue /= ( elapsedTime * SecInHour );
+				}
+				// round the value to the number of signficant digits used in the final output report
+				if ( curIntervalSize < 1 ) {
+					curValue = round( curValue * 10000.0 ) / 10000.0; // four significant digits
+				}
+				else if ( curIntervalSize >= 10 ) {
+					curValue = round( curValue ); // zero significant digits
+				}
+				else {
+					curValue = round( curValue * 100.0 ) / 100.0; // two significant digits
+				}
+				// check if the value is above the maximum or below the minimum value
+				// first before binning the value within the range.
+				if ( curValue < curIntervalStart ) {
+					BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
+					BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
+				} else if ( curValue >= topValue ) {
+					BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
+					BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
 				} else {
-					gatherThisTime = false;
+					// determine which bin the results are in
+					binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
+					BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
+					BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
 				}
-			} else {
-				gatherThisTime = true;
-			}
-			if ( gatherThisTime ) {
-				for ( jTable = 1; jTable <= curNumTables; ++jTable ) {
-					repIndex = curResIndex + ( jTable - 1 );
-					if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-						// put actual value from OutputProcesser arrays
-						curValue = GetInternalVariableValue( curTypeOfVar, BinObjVarID( repIndex ).varMeterNum );
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( IndexTypeKey == HVACTSReporting ) {
-							elapsedTime = TimeStepSys;
-						} else {
-							elapsedTime = TimeStepZone;
-						}
-						if ( OutputTableBinned( iInObj ).avgSum == isSum ) { // if it is a summed variable
-							curValue /= ( elapsedTime * SecInHour );
-						}
-						// round the value to the number of signficant digits used in the final output report
-						if ( curIntervalSize < 1 ) {
-							curValue = round( curValue * 10000.0 ) / 10000.0; // four significant digits
-						}
-						else if ( curIntervalSize >= 10 ) {
-							curValue = round( curValue ); // zero significant digits
-						}
-						else {
-							curValue = round( curValue * 100.0 ) / 100.0; // two significant digits
-						}
-						// check if the value is above the maximum or below the minimum value
-						// first before binning the value within the range.
-						if ( curValue < curIntervalStart ) {
-							BinResultsBelow( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsBelow( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else if ( curValue >= topValue ) {
-							BinResultsAbove( repIndex ).mnth( Month ) += elapsedTime;
-							BinResultsAbove( repIndex ).hrly( HourOfDay ) += elapsedTime;
-						} else {
-							// determine which bin the results are in
-							binNum = int( ( curValue - curIntervalStart ) / curIntervalSize ) + 1;
-							BinResults( binNum, repIndex ).mnth( Month ) += elapsedTime;
-							BinResults( binNum, repIndex ).hrly( HourOfDay ) += elapsedTime;
-						}
-						// add to statistics array
-						++BinStatistics( repIndex ).n;
-						BinStatistics( repIndex ).sum += curValue;
-						BinStatistics( repIndex ).sum2 += curValue * curValue;
-						if ( curValue < BinStatistics( repIndex ).minimum ) {
-							BinStatistics( repIndex ).minimum = curValue;
+				// add to statistics array
+				auto & stats( BinStatistics( repIndex ) );
+				++stats.n;
+				stats.sum += curValue;
+				stats.sum2 += curValue * curValue;
+				if ( curValue < stats.minimum ) {
+					stats.minimum = curValue;
+				}
+				if ( curValue > stats.maximum ) {
+					stats.maximum = curValue;
+				}
+			}
+		}
+	}
+
+	void
+	CompileMonthlyGathering()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Compiles the monthly tables into the flat lists GatherMonthlyResultsForTimestep
+		//   visits: one item per column that aggregates on its own (sum or average, maximum,
+		//   minimum, and the hours types), grouped by time step type and aggregation type.
+
+		// METHODOLOGY EMPLOYED:
+		//   The value-when-max/min and hours-shown columns only change when an earlier column
+		//   of their table triggers, through the column scans in the original table loop. Those
+		//   scans are replayed here once per trigger column and time step type: the scan runs
+		//   to the next maximum/minimum (or hours) column of the table, and while the trigger
+		//   flag stays set it continues from the next column of the same step type, as the table
+		//   loop did. The columns found become the trigger's dependents. Dependents of
+		//   different triggers never overlap and each column is written by a single item, so
+		//   the groups may be visited in any order.
+
+		// Aggregation types with work of their own, in visiting order
+		static int const aggTypes[] = { aggTypeSumOrAvg, aggTypeMaximum, aggTypeMinimum, aggTypeHoursZero, aggTypeHoursNonZero, aggTypeHoursPositive, aggTypeHoursNonPositive, aggTypeHoursNegative, aggTypeHoursNonNegative };
+
+		MonthlyGatherItems.clear();
+		MonthlyGatherDependents.clear();
+		MonthlyGatherGroups.clear();
+		std::vector< int > dependents; // dependent columns of the current trigger
+		for ( int stepType = stepTypeZone; stepType <= stepTypeHVAC; ++stepType ) {
+			for ( int const aggType : aggTypes ) {
+				GatherGroupType group;
+				group.stepType = stepType;
+				group.kind = aggType;
+				group.first = MonthlyGatherItems.size();
+				for ( int iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
+					int const firstColumn( MonthlyTables( iTable ).firstColumn );
+					int const numColumns( MonthlyTables( iTable ).numColumns );
+					auto const colAggType = [&]( int const k ) -> int { return MonthlyColumns( firstColumn + k - 1 ).aggType; };
+					auto const colStepType = [&]( int const k ) -> int { return MonthlyColumns( firstColumn + k - 1 ).stepType; };
+					for ( int jColumn = 1; jColumn <= numColumns; ++jColumn ) {
+						if ( colAggType( jColumn ) != aggType || colStepType( jColumn ) != stepType ) continue;
+						auto const & col( MonthlyColumns( firstColumn + jColumn - 1 ) );
+						GatherItemType item( MakeGatherItem( col.typeOfVar, col.varNum, firstColumn + jColumn - 1, aggType, col.avgSum == isSum ) );
+						dependents.clear();
+						if ( isMaxMinAggType( aggType ) || isHoursAggType( aggType ) ) {
+							bool const maxMin( isMaxMinAggType( aggType ) );
+							int pos( jColumn );
+							while ( true ) {
+								bool scanned( false ); // an hours scan went past its first column
+								for ( int kOtherColumn = pos + 1; kOtherColumn <= numColumns; ++kOtherColumn ) {
+									int const scanAggType( colAggType( kOtherColumn ) );
+									if ( maxMin ) {
+										if ( isMaxMinAggType( scanAggType ) ) break;
+										if ( scanAggType != aggTypeValueWhenMaxMin ) continue;
+									} else {
+										if ( isHoursAggType( scanAggType ) ) break;
+										scanned = true;
+										if ( scanAggType < aggTypeSumOrAverageHoursShown || scanAggType > aggTypeMinimumDuringHoursShown ) continue;
+									}
+									int const scanColumn( firstColumn + kOtherColumn - 1 );
+									if ( std::find( dependents.begin(), dependents.end(), scanColumn ) == dependents.end() ) dependents.push_back( scanColumn );
+								}
+								if ( scanned ) break; // the hours flag was cleared by the scan
+								// The flag stays set until the next column of this step type
+								int next( pos + 1 );
+								while ( next <= numColumns && colStepType( next ) != stepType ) ++next;
+								if ( next > numColumns ) break;
+								if ( maxMin ? isMaxMinAggType( colAggType( next ) ) : isHoursAggType( colAggType( next ) ) ) break; // resets the flag
+								pos = next;
+							}
 						}
-						if ( curValue > BinStatistics( repIndex ).maximum ) {
-							BinStatistics( repIndex ).maximum = curValue;
+						item.firstDependent = MonthlyGatherDependents.size();
+						for ( int const scanColumn : dependents ) {
+							auto const & scanCol( MonthlyColumns( scanColumn ) );
+							MonthlyGatherDependents.push_back( MakeGatherItem( scanCol.typeOfVar, scanCol.varNum, scanColumn, scanCol.aggType, scanCol.avgSum == isSum ) );
 						}
+						item.lastDependent = MonthlyGatherDependents.size();
+						MonthlyGatherItems.push_back( item );
 					}
 				}
+				group.last = MonthlyGatherItems.size();
+				if ( group.last > group.first ) MonthlyGatherGroups.push_back( group );
 			}
 		}
 	}
@@ -3819,7 +4023,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; visit the columns compiled by CompileMonthlyGathering
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3846,299 +4050,118 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		int iTable; // loop variable for monthlyTables
-		int jColumn; // loop variable for monthlyColumns
-		int curCol;
 		Real64 curValue;
-		int curTypeOfVar;
-		int curVarNum;
 		Real64 elapsedTime;
-		Real64 oldResultValue;
-		int oldTimeStamp;
-		Real64 oldDuration;
-		Real64 newResultValue;
-		int newTimeStamp;
-		Real64 newDuration;
+		Real64 stepSeconds; // length of the time step, for dividing summed variables in maxima and minima
 		int timestepTimeStamp;
-		bool activeMinMax;
-		//LOGICAL,SAVE  :: activeHoursShown=.FALSE.  !fix by LKL addressing CR6482
-		bool activeHoursShown;
-		bool activeNewValue;
-		int curStepType;
 		int minuteCalculated;
-		int kOtherColumn; // variable used in loop to scan through additional columns
-		int scanColumn;
 		Real64 scanValue;
-		int scanTypeOfVar;
-		int scanVarNum;
-		Real64 oldScanValue;
-		// local copies of some of the MonthlyColumns array references since
-		// profiling showed that they were slow.
-
-		static Array1D_int MonthlyColumnsTypeOfVar;
-		static Array1D_int MonthlyColumnsStepType;
-		static Array1D_int MonthlyColumnsAggType;
-		static Array1D_int MonthlyColumnsVarNum;
-		static Array1D_int MonthlyTablesNumColumns;
-		static int curFirstColumn( 0 );
 
 		if ( ! DoWeathSim ) return;
 
-		// create temporary arrays to speed processing of these arrays
+		// compile the columns into the lists visited each time step
 		if ( GatherMonthlyResultsForTimestepRunOnce ) {
-			// MonthlyColumns
-			MonthlyColumnsTypeOfVar.allocate( MonthlyColumns.I() );
-			MonthlyColumnsStepType.allocate( MonthlyColumns.I() );
-			MonthlyColumnsAggType.allocate( MonthlyColumns.I() );
-			MonthlyColumnsVarNum.allocate( MonthlyColumns.I() );
-			for ( int i = MonthlyColumns.l(), e = MonthlyColumns.u(); i <= e; ++i ) {
-				auto const & col( MonthlyColumns( i ) );
-				MonthlyColumnsTypeOfVar( i ) = col.typeOfVar;
-				MonthlyColumnsStepType( i ) = col.stepType;
-				MonthlyColumnsAggType( i ) = col.aggType;
-				MonthlyColumnsVarNum( i ) = col.varNum;
-			}
-
-			// MonthlyTables
-			MonthlyTablesNumColumns.allocate( MonthlyTables.I() );
-			for ( int i = MonthlyTables.l(), e = MonthlyTables.u(); i <= e; ++i ) {
-				MonthlyTablesNumColumns( i ) = MonthlyTables( i ).numColumns;
-			}
+			CompileMonthlyGathering();
 
 			// set flag so this block is only executed once
 			GatherMonthlyResultsForTimestepRunOnce = false;
 		}
 
-		elapsedTime = TimeStepSys;
 		if ( IndexTypeKey == HVACTSReporting ) {
 			elapsedTime = TimeStepSys;
+			stepSeconds = TimeStepSys * SecInHour;
 		} else {
 			elapsedTime = TimeStepZone;
+			stepSeconds = TimeStepZoneSec;
 		}
 		IsMonthGathered( Month ) = true;
-		for ( iTable = 1; iTable <= MonthlyTablesCount; ++iTable ) {
-			activeMinMax = false; //at the beginning of the new timestep
-			activeHoursShown = false; //fix by JG addressing CR6482
-			curFirstColumn = MonthlyTables( iTable ).firstColumn;
-			for ( jColumn = 1; jColumn <= MonthlyTablesNumColumns( iTable ); ++jColumn ) {
-				curCol = jColumn + curFirstColumn - 1;
-				curTypeOfVar = MonthlyColumnsTypeOfVar( curCol );
-				curStepType = MonthlyColumnsStepType( curCol );
-				if ( ( ( curStepType == stepTypeZone ) && ( IndexTypeKey == ZoneTSReporting ) ) || ( ( curStepType == stepTypeHVAC ) && ( IndexTypeKey == HVACTSReporting ) ) ) {
-					//  the above condition used to include the following prior to new scan method
-					//  (MonthlyColumns(curCol)%aggType .EQ. aggTypeValueWhenMaxMin)
-					curVarNum = MonthlyColumnsVarNum( curCol );
-					curValue = GetInternalVariableValue( curTypeOfVar, curVarNum );
-					// Get the value from the result array
-					oldResultValue = MonthlyColumns( curCol ).reslt( Month );
-					oldTimeStamp = MonthlyColumns( curCol ).timeStamp( Month );
-					oldDuration = MonthlyColumns( curCol ).duration( Month );
-					// Zero the revised values (as default if not set later in SELECT)
-					newResultValue = 0.0;
-					newTimeStamp = 0;
-					newDuration = 0.0;
-					activeNewValue = false;
-					// the current timestamp
-					minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
-					//      minuteCalculated = (CurrentTime - INT(CurrentTime))*60
-					//      IF (IndexTypeKey .EQ. stepTypeHVAC) minuteCalculated = minuteCalculated + SysTimeElapsed * 60
-					//      minuteCalculated = INT((TimeStep-1) * TimeStepZone * 60) + INT((SysTimeElapsed + TimeStepSys) * 60)
-					EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
-					// perform the selected aggregation type
-					// use next lines since it is faster was: SELECT CASE (MonthlyColumns(curCol)%aggType)
-					{ auto const SELECT_CASE_var( MonthlyColumnsAggType( curCol ) );
-					if ( SELECT_CASE_var == aggTypeSumOrAvg ) {
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							newResultValue = oldResultValue + curValue;
-						} else {
-							newResultValue = oldResultValue + curValue * elapsedTime; //for averaging - weight by elapsed time
+		if ( MonthlyGatherItems.empty() ) return;
+
+		// the current timestamp
+		minuteCalculated = DetermineMinuteForReporting( IndexTypeKey );
+		EncodeMonDayHrMin( timestepTimeStamp, Month, DayOfMonth, HourOfDay, minuteCalculated );
+
+		for ( auto const & group : MonthlyGatherGroups ) {
+			if ( group.stepType != IndexTypeKey ) continue;
+			int const aggType( group.kind );
+			if ( aggType == aggTypeSumOrAvg ) {
+				for ( std::size_t iItem = group.first; iItem < group.last; ++iItem ) {
+					auto const & item( MonthlyGatherItems[ iItem ] );
+					auto & col( MonthlyColumns( item.slot ) );
+					curValue = GatherValue( item );
+					if ( item.isSum ) { // if it is a summed variable
+						col.reslt( Month ) += curValue;
+					} else {
+						col.reslt( Month ) += curValue * elapsedTime; //for averaging - weight by elapsed time
+					}
+					col.timeStamp( Month ) = 0;
+					col.duration( Month ) += elapsedTime;
+				}
+			} else if ( isMaxMinAggType( aggType ) ) {
+				bool const isMax( aggType == aggTypeMaximum );
+				for ( std::size_t iItem = group.first; iItem < group.last; ++iItem ) {
+					auto const & item( MonthlyGatherItems[ iItem ] );
+					auto & col( MonthlyColumns( item.slot ) );
+					curValue = GatherValue( item );
+					// per MJW when a summed variable is used divide it by the length of the time step
+					if ( item.isSum ) curValue /= stepSeconds;
+					if ( isMax ? ( curValue > col.reslt( Month ) ) : ( curValue < col.reslt( Month ) ) ) {
+						col.reslt( Month ) = curValue;
+						col.timeStamp( Month ) = timestepTimeStamp;
+						col.duration( Month ) = 0.0;
+						// set the value when max/min columns that follow in the table
+						for ( std::size_t iDep = item.firstDependent; iDep < item.lastDependent; ++iDep ) {
+							auto const & dep( MonthlyGatherDependents[ iDep ] );
+							scanValue = GatherValue( dep );
+							// When a summed variable is used divide it by the length of the time step
+							if ( dep.isSum ) scanValue /= stepSeconds;
+							MonthlyColumns( dep.slot ).reslt( Month ) = scanValue;
 						}
-						newDuration = oldDuration + elapsedTime;
-						activeNewValue = true;
-					} else if ( SELECT_CASE_var == aggTypeMaximum ) {
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							if ( IndexTypeKey == HVACTSReporting ) {
-								curValue /= ( TimeStepSys * SecInHour );
+					}
+				}
+			} else { // hours types
+				for ( std::size_t iItem = group.first; iItem < group.last; ++iItem ) {
+					auto const & item( MonthlyGatherItems[ iItem ] );
+					curValue = GatherValue( item );
+					bool shown;
+					if ( aggType == aggTypeHoursZero ) {
+						shown = ( curValue == 0 );
+					} else if ( aggType == aggTypeHoursNonZero ) {
+						shown = ( curValue != 0 );
+					} else if ( aggType == aggTypeHoursPositive ) {
+						shown = ( curValue > 0 );
+					} else if ( aggType == aggTypeHoursNonPositive ) {
+						shown = ( curValue <= 0 );
+					} else if ( aggType == aggTypeHoursNegative ) {
+						shown = ( curValue < 0 );
+					} else { // aggTypeHoursNonNegative
+						shown = ( curValue >= 0 );
+					}
+					if ( ! shown ) continue;
+					auto & col( MonthlyColumns( item.slot ) );
+					col.reslt( Month ) += elapsedTime;
+					col.timeStamp( Month ) = 0;
+					col.duration( Month ) = 0.0;
+					// accumulate the hours shown columns that follow in the table
+					for ( std::size_t iDep = item.firstDependent; iDep < item.lastDependent; ++iDep ) {
+						auto const & dep( MonthlyGatherDependents[ iDep ] );
+						auto & scanCol( MonthlyColumns( dep.slot ) );
+						scanValue = GatherValue( dep );
+						if ( dep.aggType == aggTypeSumOrAverageHoursShown ) {
+							if ( dep.isSum ) { // if it is a summed variable
+								scanCol.reslt( Month ) += scanValue;
 							} else {
-								curValue /= TimeStepZoneSec;
+								//for averaging - weight by elapsed time
+								scanCol.reslt( Month ) += scanValue * elapsedTime;
 							}
-						}
-						if ( curValue > oldResultValue ) {
-							newResultValue = curValue;
-							newTimeStamp = timestepTimeStamp;
-							activeMinMax = true;
-							activeNewValue = true;
+							scanCol.duration( Month ) += elapsedTime;
 						} else {
-							activeMinMax = false; //reset this
-						}
-					} else if ( SELECT_CASE_var == aggTypeMinimum ) {
-						// per MJW when a summed variable is used divide it by the length of the time step
-						if ( MonthlyColumns( curCol ).avgSum == isSum ) { // if it is a summed variable
-							if ( IndexTypeKey == HVACTSReporting ) {
-								curValue /= ( TimeStepSys * SecInHour );
-							} else {
-								curValue /= TimeStepZoneSec;
+							if ( dep.isSum ) scanValue /= stepSeconds;
+							if ( ( dep.aggType == aggTypeMaximumDuringHoursShown ) ? ( scanValue > scanCol.reslt( Month ) ) : ( scanValue < scanCol.reslt( Month ) ) ) {
+								scanCol.reslt( Month ) = scanValue;
+								scanCol.timeStamp( Month ) = timestepTimeStamp;
 							}
 						}
-						if ( curValue < oldResultValue ) {
-							newResultValue = curValue;
-							newTimeStamp = timestepTimeStamp;
-							activeMinMax = true;
-							activeNewValue = true;
-						} else {
-							activeMinMax = false; //reset this
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursZero ) {
-						if ( curValue == 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonZero ) {
-						if ( curValue != 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursPositive ) {
-						if ( curValue > 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonPositive ) {
-						if ( curValue <= 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNegative ) {
-						if ( curValue < 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-					} else if ( SELECT_CASE_var == aggTypeHoursNonNegative ) {
-						if ( curValue >= 0 ) {
-							newResultValue = oldResultValue + elapsedTime;
-							activeHoursShown = true;
-							activeNewValue = true;
-						} else {
-							activeHoursShown = false;
-						}
-						// The valueWhenMaxMin is picked up now during the activeMinMax if block below.
-						//CASE (aggTypeValueWhenMaxMin)
-						//CASE (aggTypeSumOrAverageHoursShown)
-						//CASE (aggTypeMaximumDuringHoursShown)
-						//CASE (aggTypeMinimumDuringHoursShown)
-					}}
-					// if the new value has been set then set the monthly values to the
-					// new columns. This skips the aggregation types that don't even get
-					// triggered now such as valueWhenMinMax and all the agg*HoursShown
-					if ( activeNewValue ) {
-						MonthlyColumns( curCol ).reslt( Month ) = newResultValue;
-						MonthlyColumns( curCol ).timeStamp( Month ) = newTimeStamp;
-						MonthlyColumns( curCol ).duration( Month ) = newDuration;
-					}
-					// if a minimum or maximum value was set this timeStep then
-					// scan the remaining columns of the table looking for values
-					// that are aggregation type "ValueWhenMaxMin" and set their values
-					// if another minimum or maximum column is found then end
-					// the scan (it will be taken care of when that column is done)
-					if ( activeMinMax ) {
-						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
-							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
-							if ( ( SELECT_CASE_var == aggTypeMaximum ) || ( SELECT_CASE_var == aggTypeMinimum ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( SELECT_CASE_var == aggTypeValueWhenMaxMin ) {
-								// this case is when the value should be set
-								scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-								scanVarNum = MonthlyColumns( scanColumn ).varNum;
-								scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
-								// When a summed variable is used divide it by the length of the time step
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= TimeStepZoneSec;
-									}
-								}
-								MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-							} else {
-								// do nothing
-							}}
-						}
-					}
-					// If the hours variable is active then scan through the rest of the variables
-					// and accumulate
-					if ( activeHoursShown ) {
-						for ( kOtherColumn = jColumn + 1; kOtherColumn <= MonthlyTables( iTable ).numColumns; ++kOtherColumn ) {
-							scanColumn = kOtherColumn + MonthlyTables( iTable ).firstColumn - 1;
-							scanTypeOfVar = MonthlyColumns( scanColumn ).typeOfVar;
-							scanVarNum = MonthlyColumns( scanColumn ).varNum;
-							scanValue = GetInternalVariableValue( scanTypeOfVar, scanVarNum );
-							oldScanValue = MonthlyColumns( scanColumn ).reslt( Month );
-							{ auto const SELECT_CASE_var( MonthlyColumns( scanColumn ).aggType );
-							if ( ( SELECT_CASE_var == aggTypeHoursZero ) || ( SELECT_CASE_var == aggTypeHoursNonZero ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( ( SELECT_CASE_var == aggTypeHoursPositive ) || ( SELECT_CASE_var == aggTypeHoursNonPositive ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( ( SELECT_CASE_var == aggTypeHoursNegative ) || ( SELECT_CASE_var == aggTypeHoursNonNegative ) ) {
-								// end scanning since these might reset
-								break; //do
-							} else if ( SELECT_CASE_var == aggTypeSumOrAverageHoursShown ) {
-								// this case is when the value should be set
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue;
-								} else {
-									//for averaging - weight by elapsed time
-									MonthlyColumns( scanColumn ).reslt( Month ) = oldScanValue + scanValue * elapsedTime;
-								}
-								MonthlyColumns( scanColumn ).duration( Month ) += elapsedTime;
-							} else if ( SELECT_CASE_var == aggTypeMaximumDuringHoursShown ) {
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= TimeStepZoneSec;
-									}
-								}
-								if ( scanValue > oldScanValue ) {
-									MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-									MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
-								}
-							} else if ( SELECT_CASE_var == aggTypeMinimumDuringHoursShown ) {
-								if ( MonthlyColumns( scanColumn ).avgSum == isSum ) { // if it is a summed variable
-									if ( IndexTypeKey == HVACTSReporting ) {
-										scanValue /= ( TimeStepSys * SecInHour );
-									} else {
-										scanValue /= TimeStepZoneSec;
-									}
-								}
-								if ( scanValue < oldScanValue ) {
-									MonthlyColumns( scanColumn ).reslt( Month ) = scanValue;
-									MonthlyColumns( scanColumn ).timeStamp( Month ) = timestepTimeStamp;
-								}
-							} else {
-								// do nothing
-							}}
-							activeHoursShown = false; //fixed CR8317
-						}
 					}
 				}
 			}
@@ -11256,13 +11279,69 @@ namespace OutputReportTabular {
 	}
 
 
+	namespace {
+		// Numeric cells of the peak load component tables, formatted only as they are streamed
+		struct LoadComponentCellsType
+		{
+			// Members
+			Array2D< Real64 > value; // column, row
+			Array2D_bool shown; // cells left blank in the report are false
+
+			void
+			allocate(
+				int const numColumns,
+				int const numRows
+			)
+			{
+				value.dimension( numColumns, numRows, 0.0 );
+				shown.dimension( numColumns, numRows, false );
+			}
+
+			void
+			set(
+				int const column,
+				int const row,
+				Real64 const cellValue
+			)
+			{
+				value( column, row ) = cellValue;
+				shown( column, row ) = true;
+			}
+
+		};
+
+		void
+		WriteLoadComponentCells(
+			LoadComponentCellsType const & cells,
+			Array1D_string const & rowHead,
+			Array1D_string const & columnHead,
+			Array1D_int & columnWidth,
+			std::string const & zoneName,
+			std::string const & tableName
+		)
+		{
+			TableStreamWriter table( rowHead, columnHead, columnWidth );
+			table.setSQLiteTable( "ZoneComponentLoadSummary", zoneName, tableName );
+			for ( int jRow = 1, jRow_end = isize( cells.value, 2 ); jRow <= jRow_end; ++jRow ) {
+				for ( int iCol = 1, iCol_end = isize( cells.value, 1 ); iCol <= iCol_end; ++iCol ) {
+					if ( cells.shown( iCol, jRow ) ) {
+						table.addCell( cells.value( iCol, jRow ), 2 );
+					} else {
+						table.addCell( std::string() );
+					}
+				}
+			}
+			table.finish();
+		}
+	}
+
 	void
 	WriteZoneLoadComponentTable()
 	{
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   March 2012
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; stream the peak load component tables without a string body
 		//       RE-ENGINEERED  Amir Roth, Feb 2016 (unified with ComputeDelayedComponents to simplify code and debugging)
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -11406,6 +11485,7 @@ namespace OutputReportTabular {
 		Array1D_int columnWidth;
 		Array1D_string rowHead;
 		Array2D_string tableBody;
+		LoadComponentCellsType loadCells; // peak load component tables
 
 		// Delayed components are moved into this function so that we can calculate them one zone at a time
 		// with Array1D
@@ -11644,7 +11724,7 @@ namespace OutputReportTabular {
 			rowHead.allocate( rGrdTot );
 			columnHead.allocate( cPerc );
 			columnWidth.dimension( cPerc, 14 ); //array assignment - same for all columns
-			tableBody.allocate( cPerc, rGrdTot );
+			loadCells.allocate( cPerc, rGrdTot );
 
 			if ( unitsStyle != unitsStyleInchPound ) {
 				columnHead( cSensInst ) = "Sensible - Instant [W]";
@@ -11694,7 +11774,6 @@ namespace OutputReportTabular {
 			rowHead( rOpqDoor ) = "Opaque Door";
 			rowHead( rGrdTot ) = "Grand Total";
 
-			tableBody = "";
 			totalColumn = 0.0;
 			percentColumn = 0.0;
 			grandTotalRow = 0.0;
@@ -11706,170 +11785,170 @@ namespace OutputReportTabular {
 				//PEOPLE
 				seqData = peopleInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rPeople ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rPeople, AvgData( timeCoolMax ) );
 				totalColumn( rPeople ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = peopleLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rPeople ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rPeople, AvgData( timeCoolMax ) );
 				totalColumn( rPeople ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				seqData = peopleDelaySeqCool( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rPeople ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensDelay, rPeople, AvgData( timeCoolMax ) );
 				totalColumn( rPeople ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeCoolMax );
 
 				//LIGHTS
 				seqData = lightInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rLights ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rLights, AvgData( timeCoolMax ) );
 				totalColumn( rLights ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = lightRetAirSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensRA, rLights ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensRA, rLights, AvgData( timeCoolMax ) );
 				totalColumn( rLights ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensRA ) += AvgData( timeCoolMax );
 
 				seqData = lightDelaySeqCool( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rLights ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensDelay, rLights, AvgData( timeCoolMax ) );
 				totalColumn( rLights ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeCoolMax );
 
 				//EQUIPMENT
 				seqData = equipInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rEquip ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rEquip, AvgData( timeCoolMax ) );
 				totalColumn( rEquip ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = equipLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rEquip ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rEquip, AvgData( timeCoolMax ) );
 				totalColumn( rEquip ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				seqData = equipDelaySeqCool( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rEquip ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensDelay, rEquip, AvgData( timeCoolMax ) );
 				totalColumn( rEquip ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeCoolMax );
 
 				//REFRIGERATION EQUIPMENT
 				seqData = refrigInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rRefrig ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rRefrig, AvgData( timeCoolMax ) );
 				totalColumn( rRefrig ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = refrigRetAirSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensRA, rRefrig ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensRA, rRefrig, AvgData( timeCoolMax ) );
 				totalColumn( rRefrig ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensRA ) += AvgData( timeCoolMax );
 
 				seqData = refrigLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rRefrig ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rRefrig, AvgData( timeCoolMax ) );
 				totalColumn( rRefrig ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				//WATER USE EQUIPMENT
 				seqData = waterUseInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rWaterUse ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rWaterUse, AvgData( timeCoolMax ) );
 				totalColumn( rWaterUse ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = waterUseLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rWaterUse ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rWaterUse, AvgData( timeCoolMax ) );
 				totalColumn( rWaterUse ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				//HVAC EQUIPMENT LOSSES
 				seqData = hvacLossInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rHvacLoss ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rHvacLoss, AvgData( timeCoolMax ) );
 				totalColumn( rHvacLoss ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = hvacLossDelaySeqCool( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rHvacLoss ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensDelay, rHvacLoss, AvgData( timeCoolMax ) );
 				totalColumn( rHvacLoss ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeCoolMax );
 
 				//POWER GENERATION EQUIPMENT
 				seqData = powerGenInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rPowerGen ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rPowerGen, AvgData( timeCoolMax ) );
 				totalColumn( rPowerGen ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = powerGenDelaySeqCool( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rPowerGen ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensDelay, rPowerGen, AvgData( timeCoolMax ) );
 				totalColumn( rPowerGen ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeCoolMax );
 
 				//DOAS
-				tableBody( cSensInst, rDOAS ) = RealToStr( CalcZoneSizing( CoolDesSelected, iZone ).DOASHeatAddSeq( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rDOAS, CalcZoneSizing( CoolDesSelected, iZone ).DOASHeatAddSeq( timeCoolMax ) );
 				totalColumn( rDOAS ) += CalcZoneSizing( CoolDesSelected, iZone ).DOASHeatAddSeq( timeCoolMax );
 				grandTotalRow( cSensInst ) += CalcZoneSizing( CoolDesSelected, iZone ).DOASHeatAddSeq( timeCoolMax );
 
-				tableBody( cLatent, rDOAS ) = RealToStr( CalcZoneSizing( CoolDesSelected, iZone ).DOASLatAddSeq( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rDOAS, CalcZoneSizing( CoolDesSelected, iZone ).DOASLatAddSeq( timeCoolMax ) );
 				totalColumn( rDOAS ) += CalcZoneSizing( CoolDesSelected, iZone ).DOASLatAddSeq( timeCoolMax );
 				grandTotalRow( cLatent ) += CalcZoneSizing( CoolDesSelected, iZone ).DOASLatAddSeq( timeCoolMax );
 
 				//INFILTRATION
 				seqData = infilInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rInfil ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rInfil, AvgData( timeCoolMax ) );
 				totalColumn( rInfil ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = infilLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rInfil ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rInfil, AvgData( timeCoolMax ) );
 				totalColumn( rInfil ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				//ZONE VENTILATION
 				seqData = zoneVentInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rZoneVent ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rZoneVent, AvgData( timeCoolMax ) );
 				totalColumn( rZoneVent ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = zoneVentLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rZoneVent ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rZoneVent, AvgData( timeCoolMax ) );
 				totalColumn( rZoneVent ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				//INTERZONE MIXING
 				seqData = interZoneMixInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rIntZonMix ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rIntZonMix, AvgData( timeCoolMax ) );
 				totalColumn( rIntZonMix ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
 				seqData = interZoneMixLatentSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rIntZonMix ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cLatent, rIntZonMix, AvgData( timeCoolMax ) );
 				totalColumn( rIntZonMix ) += AvgData( timeCoolMax );
 				grandTotalRow( cLatent ) += AvgData( timeCoolMax );
 
 				//FENESTRATION CONDUCTION
 				seqData = feneCondInstantSeq( CoolDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rFeneCond ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensInst, rFeneCond, AvgData( timeCoolMax ) );
 				totalColumn( rFeneCond ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensInst ) += AvgData( timeCoolMax );
 
@@ -11882,7 +11961,7 @@ namespace OutputReportTabular {
 
 				seqData = feneSolarDelaySeqCool( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rFeneSolr ) = RealToStr( AvgData( timeCoolMax ), 2 );
+				loadCells.set( cSensDelay, rFeneSolr, AvgData( timeCoolMax ) );
 				totalColumn( rFeneSolr ) += AvgData( timeCoolMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeCoolMax );
 
@@ -11940,35 +12019,32 @@ namespace OutputReportTabular {
 				}
 			}
 			for ( int k = rRoof; k <= rOtherFlr; ++k ) {
-				tableBody( cSensDelay, k ) = RealToStr( delayOpaque( k ), 2 );
+				loadCells.set( cSensDelay, k, delayOpaque( k ) );
 				totalColumn( k ) += delayOpaque( k );
 				grandTotalRow( cSensDelay ) += delayOpaque( k );
 			}
-			tableBody( cSensDelay, rOpqDoor ) = RealToStr( delayOpaque( rOpqDoor ), 2 );
+			loadCells.set( cSensDelay, rOpqDoor, delayOpaque( rOpqDoor ) );
 			totalColumn( rOpqDoor ) += delayOpaque( rOpqDoor );
 			grandTotalRow( cSensDelay ) += delayOpaque( rOpqDoor );
 
 			//GRAND TOTAL ROW
 			totalGrandTotal = 0.0;
 			for ( int k = 1; k <= cLatent; ++k ) {
-				tableBody( k, rGrdTot ) = RealToStr( grandTotalRow( k ), 2 );
+				loadCells.set( k, rGrdTot, grandTotalRow( k ) );
 				totalGrandTotal += grandTotalRow( k );
 			}
-			tableBody( cTotal, rGrdTot ) = RealToStr( totalGrandTotal, 2 );
+			loadCells.set( cTotal, rGrdTot, totalGrandTotal );
 
 			//TOTAL COLUMN AND PERCENT COLUMN
 			for ( int k = 1; k <= rOpqDoor; ++k ) { //to last row before total
-				tableBody( cTotal, k ) = RealToStr( totalColumn( k ), 2 );
+				loadCells.set( cTotal, k, totalColumn( k ) );
 				if ( totalGrandTotal != 0.0 ) {
-					tableBody( cPerc, k ) = RealToStr( 100 * totalColumn( k ) / totalGrandTotal, 2 );
+					loadCells.set( cPerc, k, 100 * totalColumn( k ) / totalGrandTotal );
 				}
 			}
 
 			WriteSubtitle( "Estimated Cooling Peak Load Components" );
-			WriteTable( tableBody, rowHead, columnHead, columnWidth );
-			if ( sqlite ) {
-				sqlite->createSQLiteTabularDataRecords( tableBody, rowHead, columnHead, "ZoneComponentLoadSummary", Zone( iZone ).Name, "Estimated Cooling Peak Load Components" );
-			}
+			WriteLoadComponentCells( loadCells, rowHead, columnHead, columnWidth, Zone( iZone ).Name, "Estimated Cooling Peak Load Components" );
 
 			//---- Cooling Peak Conditions
 
@@ -12121,7 +12197,7 @@ namespace OutputReportTabular {
 			rowHead.allocate( rGrdTot );
 			columnHead.allocate( cPerc );
 			columnWidth.dimension( cPerc, 14 ); //array assignment - same for all columns
-			tableBody.allocate( cPerc, rGrdTot );
+			loadCells.allocate( cPerc, rGrdTot );
 
 			if ( unitsStyle != unitsStyleInchPound ) {
 				columnHead( cSensInst ) = "Sensible - Instant [W]";
@@ -12171,7 +12247,6 @@ namespace OutputReportTabular {
 			rowHead( rOpqDoor ) = "Opaque Door";
 			rowHead( rGrdTot ) = "Grand Total";
 
-			tableBody = "";
 			totalColumn = 0.0;
 			percentColumn = 0.0;
 			grandTotalRow = 0.0;
@@ -12183,170 +12258,170 @@ namespace OutputReportTabular {
 				//PEOPLE
 				seqData = peopleInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rPeople ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rPeople, AvgData( timeHeatMax ) );
 				totalColumn( rPeople ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = peopleLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rPeople ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rPeople, AvgData( timeHeatMax ) );
 				totalColumn( rPeople ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				seqData = peopleDelaySeqHeat( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rPeople ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensDelay, rPeople, AvgData( timeHeatMax ) );
 				totalColumn( rPeople ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeHeatMax );
 
 				//LIGHTS
 				seqData = lightInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rLights ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rLights, AvgData( timeHeatMax ) );
 				totalColumn( rLights ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = lightRetAirSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensRA, rLights ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensRA, rLights, AvgData( timeHeatMax ) );
 				totalColumn( rLights ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensRA ) += AvgData( timeHeatMax );
 
 				seqData = lightDelaySeqHeat( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rLights ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensDelay, rLights, AvgData( timeHeatMax ) );
 				totalColumn( rLights ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeHeatMax );
 
 				//EQUIPMENT
 				seqData = equipInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rEquip ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rEquip, AvgData( timeHeatMax ) );
 				totalColumn( rEquip ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = equipLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rEquip ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rEquip, AvgData( timeHeatMax ) );
 				totalColumn( rEquip ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				seqData = equipDelaySeqHeat( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rEquip ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensDelay, rEquip, AvgData( timeHeatMax ) );
 				totalColumn( rEquip ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeHeatMax );
 
 				//REFRIGERATION EQUIPMENT
 				seqData = refrigInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rRefrig ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rRefrig, AvgData( timeHeatMax ) );
 				totalColumn( rRefrig ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = refrigRetAirSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensRA, rRefrig ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensRA, rRefrig, AvgData( timeHeatMax ) );
 				totalColumn( rRefrig ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensRA ) += AvgData( timeHeatMax );
 
 				seqData = refrigLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rRefrig ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rRefrig, AvgData( timeHeatMax ) );
 				totalColumn( rRefrig ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				//WATER USE EQUIPMENT
 				seqData = waterUseInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rWaterUse ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rWaterUse, AvgData( timeHeatMax ) );
 				totalColumn( rWaterUse ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = waterUseLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rWaterUse ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rWaterUse, AvgData( timeHeatMax ) );
 				totalColumn( rWaterUse ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				//HVAC EQUIPMENT LOSSES
 				seqData = hvacLossInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rHvacLoss ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rHvacLoss, AvgData( timeHeatMax ) );
 				totalColumn( rHvacLoss ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = hvacLossDelaySeqHeat( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rHvacLoss ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensDelay, rHvacLoss, AvgData( timeHeatMax ) );
 				totalColumn( rHvacLoss ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeHeatMax );
 
 				//POWER GENERATION EQUIPMENT
 				seqData = powerGenInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rPowerGen ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rPowerGen, AvgData( timeHeatMax ) );
 				totalColumn( rPowerGen ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = powerGenDelaySeqHeat( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rPowerGen ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensDelay, rPowerGen, AvgData( timeHeatMax ) );
 				totalColumn( rPowerGen ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeHeatMax );
 
 				//DOAS
-				tableBody( cSensInst, rDOAS ) = RealToStr( CalcZoneSizing( HeatDesSelected, iZone ).DOASHeatAddSeq( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rDOAS, CalcZoneSizing( HeatDesSelected, iZone ).DOASHeatAddSeq( timeHeatMax ) );
 				totalColumn( rDOAS ) += CalcZoneSizing( HeatDesSelected, iZone ).DOASHeatAddSeq( timeHeatMax );
 				grandTotalRow( cSensDelay ) += CalcZoneSizing( HeatDesSelected, iZone ).DOASHeatAddSeq( timeHeatMax );
 
-				tableBody( cLatent, rDOAS ) = RealToStr( CalcZoneSizing( HeatDesSelected, iZone ).DOASLatAddSeq( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rDOAS, CalcZoneSizing( HeatDesSelected, iZone ).DOASLatAddSeq( timeHeatMax ) );
 				totalColumn( rDOAS ) += CalcZoneSizing( HeatDesSelected, iZone ).DOASLatAddSeq( timeHeatMax );
 				grandTotalRow( cLatent ) += CalcZoneSizing( HeatDesSelected, iZone ).DOASLatAddSeq( timeHeatMax );
 
 				//INFILTRATION
 				seqData = infilInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rInfil ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rInfil, AvgData( timeHeatMax ) );
 				totalColumn( rInfil ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = infilLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rInfil ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rInfil, AvgData( timeHeatMax ) );
 				totalColumn( rInfil ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				//ZONE VENTILATION
 				seqData = zoneVentInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rZoneVent ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rZoneVent, AvgData( timeHeatMax ) );
 				totalColumn( rZoneVent ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = zoneVentLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rZoneVent ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rZoneVent, AvgData( timeHeatMax ) );
 				totalColumn( rZoneVent ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				//INTERZONE MIXING
 				seqData = interZoneMixInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rIntZonMix ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rIntZonMix, AvgData( timeHeatMax ) );
 				totalColumn( rIntZonMix ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
 				seqData = interZoneMixLatentSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cLatent, rIntZonMix ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cLatent, rIntZonMix, AvgData( timeHeatMax ) );
 				totalColumn( rIntZonMix ) += AvgData( timeHeatMax );
 				grandTotalRow( cLatent ) += AvgData( timeHeatMax );
 
 				//FENESTRATION CONDUCTION
 				seqData = feneCondInstantSeq( HeatDesSelected, _, iZone ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensInst, rFeneCond ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensInst, rFeneCond, AvgData( timeHeatMax ) );
 				totalColumn( rFeneCond ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensInst ) += AvgData( timeHeatMax );
 
@@ -12359,7 +12434,7 @@ namespace OutputReportTabular {
 
 				seqData = feneSolarDelaySeqHeat( _ ) * powerConversion;
 				MovingAvg( seqData, NumOfTimeStepInDay, NumTimeStepsInAvg, AvgData );
-				tableBody( cSensDelay, rFeneSolr ) = RealToStr( AvgData( timeHeatMax ), 2 );
+				loadCells.set( cSensDelay, rFeneSolr, AvgData( timeHeatMax ) );
 				totalColumn( rFeneSolr ) += AvgData( timeHeatMax );
 				grandTotalRow( cSensDelay ) += AvgData( timeHeatMax );
 
@@ -12417,35 +12492,32 @@ namespace OutputReportTabular {
 				}
 			}
 			for ( int k = rRoof; k <= rOtherFlr; ++k ) {
-				tableBody( cSensDelay, k ) = RealToStr( delayOpaque( k ), 2 );
+				loadCells.set( cSensDelay, k, delayOpaque( k ) );
 				totalColumn( k ) += delayOpaque( k );
 				grandTotalRow( cSensDelay ) += delayOpaque( k );
 			}
-			tableBody( cSensDelay, rOpqDoor ) = RealToStr( delayOpaque( rOpqDoor ), 2 );
+			loadCells.set( cSensDelay, rOpqDoor, delayOpaque( rOpqDoor ) );
 			totalColumn( rOpqDoor ) += delayOpaque( rOpqDoor );
 			grandTotalRow( cSensDelay ) += delayOpaque( rOpqDoor );
 
 			//GRAND TOTAL ROW
 			totalGrandTotal = 0.0;
 			for ( int k = 1; k <= cLatent; ++k ) {
-				tableBody( k, rGrdTot ) = RealToStr( grandTotalRow( k ), 2 );
+				loadCells.set( k, rGrdTot, grandTotalRow( k ) );
 				totalGrandTotal += grandTotalRow( k );
 			}
-			tableBody( cTotal, rGrdTot ) = RealToStr( totalGrandTotal, 2 );
+			loadCells.set( cTotal, rGrdTot, totalGrandTotal );
 
 			//TOTAL COLUMN AND PERCENT COLUMN
 			for ( int k = 1; k <= rOpqDoor; ++k ) { //to last row before total
-				tableBody( cTotal, k ) = RealToStr( totalColumn( k ), 2 );
+				loadCells.set( cTotal, k, totalColumn( k ) );
 				if ( totalGrandTotal != 0.0 ) {
-					tableBody( cPerc, k ) = RealToStr( 100 * totalColumn( k ) / totalGrandTotal, 2 );
+					loadCells.set( cPerc, k, 100 * totalColumn( k ) / totalGrandTotal );
 				}
 			}
 
 			WriteSubtitle( "Estimated Heating Peak Load Components" );
-			WriteTable( tableBody, rowHead, columnHead, columnWidth );
-			if ( sqlite ) {
-				sqlite->createSQLiteTabularDataRecords( tableBody, rowHead, columnHead, "ZoneComponentLoadSummary", Zone( iZone ).Name, "Estimated Heating Peak Load Components" );
-			}
+			WriteLoadComponentCells( loadCells, rowHead, columnHead, columnWidth, Zone( iZone ).Name, "Estimated Heating Peak Load Components" );
 
 			//---- Heating Peak Conditions Sub-Table
 
@@ -12803,7 +12875,7 @@ namespace OutputReportTabular {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; stream the body through TableStreamWriter
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -12819,13 +12891,17 @@ namespace OutputReportTabular {
 		//   symbol for the currency will be included. For TXT files, the ASCII symbol
 		//   will be used.
 
+		// METHODOLOGY EMPLOYED:
+		//   Feed the body one row at a time to a TableStreamWriter which writes all of
+		//   the styles in a single pass.
+
 		// Argument array dimensioning
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		static std::string const blank;
+		// na
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -12834,47 +12910,12 @@ namespace OutputReportTabular {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Array2D_string colLabelMulti;
-		std::string workColumn;
-		Array1D_string rowLabelTags;
-		Array1D_string columnLabelTags;
-		Array1D_string rowUnitStrings;
-		Array1D_string columnUnitStrings;
-		Array2D_string bodyEsc;
-
-		int numColLabelRows;
-		int maxNumColLabelRows;
-		std::string::size_type widthRowLabel;
-		std::string::size_type maxWidthRowLabel;
-
 		int rowsBody;
 		int colsBody;
 		int colsColumnLabels;
 		int colsWidthColumn;
 		int rowsRowLabels;
 
-		int iCol;
-		int jRow;
-		int colWidthLimit;
-		std::string::size_type barLoc;
-
-		std::string outputLine;
-		std::string spaces;
-		int iStyle;
-		std::string curDel;
-		std::string tagWithAttrib;
-		std::string::size_type col1start;
-		bool doTransposeXML;
-		bool isTableBlank;
-		bool isRecordBlank;
-
-		if ( present( transposeXML ) ) {
-			doTransposeXML = transposeXML;
-		} else {
-			doTransposeXML = false; //if not present assume that the XML table should not be transposed
-		}
-		// create blank string
-		spaces = blank; // REPEAT(' ',1000)
 		// get sizes of arrays
 		rowsBody = isize( body, 2 );
 		colsBody = isize( body, 1 );
@@ -12886,134 +12927,151 @@ namespace OutputReportTabular {
 		if ( rowsBody != rowsRowLabels ) {
 			ShowWarningError( "REPORT:TABLE Inconsistant number of rows." );
 			rowsBody = min( rowsBody, rowsRowLabels );
-			rowsRowLabels = rowsBody;
 		}
 		if ( ( colsBody != colsColumnLabels ) || ( colsBody != colsWidthColumn ) ) {
 			ShowWarningError( "REPORT:TABLE Inconsistant number of columns." );
 			colsBody = min( colsBody, min( colsColumnLabels, colsWidthColumn ) );
-			colsWidthColumn = colsBody;
-			colsColumnLabels = colsBody;
-		}
-		// create arrays to hold the XML tags
-		rowLabelTags.allocate( rowsBody );
-		columnLabelTags.allocate( colsBody );
-		rowUnitStrings.allocate( rowsBody );
-		columnUnitStrings.allocate( colsBody );
-		bodyEsc.allocate( colsBody, rowsBody );
-		// create new array to hold multiple line column lables
-		colLabelMulti.allocate( colsColumnLabels, 50 );
+		}
+
+		TableStreamWriter table( rowLabels( { 1, rowsBody } ), columnLabels( { 1, colsBody } ), widthColumn( { 1, colsBody } ), present( transposeXML ) && transposeXML(), present( footnoteText ) ? footnoteText() : std::string() );
+		for ( int jRow = 1; jRow <= rowsBody; ++jRow ) {
+			for ( int iCol = 1; iCol <= colsBody; ++iCol ) {
+				table.addCell( body( iCol, jRow ) );
+			}
+		}
+		table.finish();
+	}
+
+	TableStreamWriter::TableStreamWriter(
+		Array1S_string const rowLabels,
+		Array1S_string const columnLabels,
+		Array1S_int widthColumn,
+		bool const transposeXML,
+		std::string const & footnoteText
+	) :
+		m_rowLabels( rowLabels ),
+		m_columnLabels( columnLabels ),
+		m_numRows( isize( rowLabels ) ),
+		m_numColumns( isize( columnLabels ) ),
+		m_footnoteText( footnoteText ),
+		m_transposeXML( transposeXML ),
+		m_maxWidthRowLabel( 0 ),
+		m_hasXML( false ),
+		m_curRow( 0 ),
+		m_curColumn( 0 ),
+		m_isTableBlank( true ),
+		m_writeSQLite( false ),
+		m_isFinished( false )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Prepare the column labels once for all styles and write the column
+		//   headers of the comma, tab, fixed and html styles.
+
+		// METHODOLOGY EMPLOYED:
+		//   Same label handling as the original WriteTable: column labels are broken
+		//   into lines at each bar '|' and the widths are grown to fit the labels.
+		//   The widthColumn argument is updated as WriteTable always did.
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static std::string const blank;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Array2D_string colLabelMulti;
+		Array2D_string colLabelFixed;
+		std::string workColumn;
+		std::string outputLine;
+		std::string curDel;
+		std::string::size_type barLoc;
+		std::string::size_type col1start;
+		int numColLabelRows;
+		int maxNumColLabelRows;
+		int iCol;
+		int jRow;
+
+		if ( isize( widthColumn ) != m_numColumns ) {
+			ShowWarningError( "REPORT:TABLE Inconsistant number of columns." );
+			m_numColumns = min( m_numColumns, isize( widthColumn ) );
+		}
+		m_widthColumn.resize( m_numColumns );
+		m_cells.resize( m_numColumns );
+
+		// go through the columns and break them into multiple lines
+		// if bar '|' is found in a row then break into two lines
+		colLabelMulti.allocate( m_numColumns, 50 );
 		colLabelMulti = blank; //set array to blank
-		numColLabelRows = 0; //default value
 		maxNumColLabelRows = 0;
-		for ( iStyle = 1; iStyle <= numStyles; ++iStyle ) {
-			std::ostream & tbl_stream( *TabularOutputFile( iStyle ) );
-			curDel = del( iStyle );
-			// go through the columns and break them into multiple lines
-			// if bar '|' is found in a row then break into two lines
-			// if longer than the column width break into two lines for fixed style only
-			for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-				numColLabelRows = 0;
-				workColumn = columnLabels( iCol );
-				widthColumn( iCol ) = max( widthColumn( iCol ), static_cast< int >( len( columnLabels( iCol ) ) ) );
-				while ( true ) {
-					barLoc = index( workColumn, '|' );
-					if ( barLoc != std::string::npos ) {
-						++numColLabelRows;
-						colLabelMulti( iCol, numColLabelRows ) = workColumn.substr( 0, barLoc );
-						workColumn.erase( 0, barLoc + 1 );
-					} else {
-						++numColLabelRows;
-						colLabelMulti( iCol, numColLabelRows ) = workColumn;
-						break; //inner do loop
-					}
-				}
-				if ( numColLabelRows > maxNumColLabelRows ) {
-					maxNumColLabelRows = numColLabelRows;
+		for ( iCol = 1; iCol <= m_numColumns; ++iCol ) {
+			numColLabelRows = 0;
+			workColumn = columnLabels( iCol );
+			widthColumn( iCol ) = max( widthColumn( iCol ), static_cast< int >( len( columnLabels( iCol ) ) ) );
+			m_widthColumn[ iCol - 1 ] = widthColumn( iCol );
+			while ( true ) {
+				barLoc = index( workColumn, '|' );
+				if ( barLoc != std::string::npos ) {
+					++numColLabelRows;
+					colLabelMulti( iCol, numColLabelRows ) = workColumn.substr( 0, barLoc );
+					workColumn.erase( 0, barLoc + 1 );
+				} else {
+					++numColLabelRows;
+					colLabelMulti( iCol, numColLabelRows ) = workColumn;
+					break; //inner do loop
 				}
 			}
-			// extra preprocessing for fixed style reports
-			if ( TableStyle( iStyle ) == tableStyleFixed ) {
-				// break column headings into multiple rows if long (for fixed) or contain two spaces in a row.
-				for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-					colWidthLimit = widthColumn( iCol );
-					for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
-						pare( colLabelMulti( iCol, jRow ), colWidthLimit );
-					}
-				}
-				maxWidthRowLabel = 0;
-				for ( jRow = 1; jRow <= rowsRowLabels; ++jRow ) {
-					widthRowLabel = len( rowLabels( jRow ) );
-					if ( widthRowLabel > maxWidthRowLabel ) {
-						maxWidthRowLabel = widthRowLabel;
-					}
-				}
+			if ( numColLabelRows > maxNumColLabelRows ) {
+				maxNumColLabelRows = numColLabelRows;
 			}
-			// output depending on style of format
+		}
+
+		for ( int iStyle = 1; iStyle <= numStyles; ++iStyle ) {
+			std::ostream & tbl_stream( *TabularOutputFile( iStyle ) );
+			curDel = del( iStyle );
 			auto const style( TableStyle( iStyle ) );
 			if ( ( style == tableStyleComma ) || ( style == tableStyleTab ) ) {
 				// column headers
 				for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
 					outputLine = curDel; // one leading delimiters on column header lines
-					for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+					for ( iCol = 1; iCol <= m_numColumns; ++iCol ) {
 						outputLine += curDel + stripped( colLabelMulti( iCol, jRow ) );
 					}
 					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
 				}
-				// body with row headers
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					outputLine = curDel + rowLabels( jRow ); // one leading delimiters on table body lines
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						outputLine += curDel + stripped( body( iCol, jRow ) );
+			} else if ( style == tableStyleFixed ) {
+				// shorten column headings that are longer than the column width
+				colLabelFixed = colLabelMulti;
+				for ( iCol = 1; iCol <= m_numColumns; ++iCol ) {
+					for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
+						pare( colLabelFixed( iCol, jRow ), widthColumn( iCol ) );
 					}
-					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
 				}
-				if ( present( footnoteText ) ) {
-					if ( ! footnoteText().empty() ) {
-						tbl_stream << footnoteText() << '\n';
-					}
+				m_maxWidthRowLabel = 0;
+				for ( jRow = 1; jRow <= m_numRows; ++jRow ) {
+					m_maxWidthRowLabel = max( m_maxWidthRowLabel, len( rowLabels( jRow ) ) );
 				}
-				tbl_stream << "\n\n";
-
-			} else if ( style == tableStyleFixed ) {
 				// column headers
 				for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
 					outputLine = blank; // spaces(:maxWidthRowLabel+2)  // two extra spaces and leave blank area for row labels
-					col1start = max( maxWidthRowLabel + 2u, static_cast< std::string::size_type >( 3u ) );
-					for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
-						if ( iCol != 1 ) {
-							outputLine += "  " + rjustified( sized( colLabelMulti( iCol, jRow ), widthColumn( iCol ) ) );
-						} else {
-							outputLine = std::string( col1start - 1, ' ' ) + "  " + rjustified( sized( colLabelMulti( iCol, jRow ), widthColumn( iCol ) ) );
-						}
-					}
-					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
-				}
-				// body with row headers
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					outputLine = "  " + rjustified( sized( rowLabels( jRow ), maxWidthRowLabel ) ); // two blank spaces on table body lines
-					//col1start = max( len( outputLine ) + 2u, maxWidthRowLabel + 2u );
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
+					col1start = max( m_maxWidthRowLabel + 2u, static_cast< std::string::size_type >( 3u ) );
+					for ( iCol = 1; iCol <= m_numColumns; ++iCol ) {
 						if ( iCol != 1 ) {
-							outputLine += "  " + rjustified( sized( body( iCol, jRow ), widthColumn( iCol ) ) );
+							outputLine += "  " + rjustified( sized( colLabelFixed( iCol, jRow ), widthColumn( iCol ) ) );
 						} else {
-							outputLine += "   " + rjustified( sized( body( iCol, jRow ), widthColumn( iCol ) ) );
+							outputLine = std::string( col1start - 1, ' ' ) + "  " + rjustified( sized( colLabelFixed( iCol, jRow ), widthColumn( iCol ) ) );
 						}
 					}
 					tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
 				}
-				if ( present( footnoteText ) ) {
-					if ( ! footnoteText().empty() ) {
-						tbl_stream << footnoteText() << '\n';
-					}
-				}
-				tbl_stream << "\n\n";
-
 			} else if ( style == tableStyleHTML ) {
 				// set up it being a table
 				tbl_stream << "<table border=\"1\" cellpadding=\"4\" cellspacing=\"0\">\n";
 				// column headers
 				tbl_stream << "  <tr><td></td>\n"; // start new row and leave empty cell
-				for ( iCol = 1; iCol <= colsColumnLabels; ++iCol ) {
+				for ( iCol = 1; iCol <= m_numColumns; ++iCol ) {
 					outputLine = "    <td align=\"right\">";
 					for ( jRow = 1; jRow <= maxNumColLabelRows; ++jRow ) {
 						outputLine += colLabelMulti( iCol, jRow );
@@ -13024,162 +13082,303 @@ namespace OutputReportTabular {
 					tbl_stream << InsertCurrencySymbol( outputLine, true ) << "</td>\n";
 				}
 				tbl_stream << "  </tr>\n";
-				// body with row headers
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					tbl_stream << "  <tr>\n";
-					if ( rowLabels( jRow ) != "" ) {
-						tbl_stream << "    <td align=\"right\">" << InsertCurrencySymbol( rowLabels( jRow ), true ) << "</td>\n";
+			} else if ( style == tableStyleXML ) {
+				m_hasXML = true;
+			}
+		}
+
+		if ( m_hasXML ) {
+			// the element names are only committed to activeSubTableName if the table turns out not to be blank
+			//if report name and subtable name the same add "record" to the end
+			m_subTableTag = ConvertToElementTag( activeSubTableName );
+			m_reportTagNoSpace = ConvertToElementTag( activeReportName );
+			if ( SameString( m_subTableTag, m_reportTagNoSpace ) ) {
+				m_subTableTag += "Record";
+			}
+			//if no subtable name use the report name and add "record" to the end
+			if ( len( m_subTableTag ) == 0 ) {
+				m_subTableTag = m_reportTagNoSpace + "Record";
+			}
+			// if a single column table, transpose it automatically
+			if ( ( m_numColumns == 1 ) && ( m_numRows > 1 ) ) {
+				m_transposeXML = true;
+			}
+			// convert the column headers into tags compatible with XML strings
+			m_columnTags.resize( m_numColumns );
+			m_columnUnits.resize( m_numColumns );
+			for ( iCol = 1; iCol <= m_numColumns; ++iCol ) {
+				m_columnTags[ iCol - 1 ] = ConvertToElementTag( columnLabels( iCol ) );
+				if ( len( m_columnTags[ iCol - 1 ] ) == 0 ) {
+					m_columnTags[ iCol - 1 ] = "none";
+				}
+				m_columnUnits[ iCol - 1 ] = GetUnitSubString( columnLabels( iCol ) );
+				if ( SameString( m_columnUnits[ iCol - 1 ], "Invalid/Undefined" ) ) {
+					m_columnUnits[ iCol - 1 ] = "";
+				}
+			}
+			m_cellsEscaped.resize( m_numColumns );
+			if ( m_transposeXML ) {
+				m_columnXML.resize( m_numColumns );
+			}
+		}
+	}
+
+	void
+	TableStreamWriter::setSQLiteTable(
+		std::string const & reportName,
+		std::string const & reportForString,
+		std::string const & tableName
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Also send the cells to the SQLite tabular data, replacing a separate
+		//   call to createSQLiteTabularDataRecords with the whole body.
+
+		assert( m_curRow == 0 && m_curColumn == 0 );
+		m_writeSQLite = ( sqlite != nullptr );
+		m_sqlReportName = reportName;
+		m_sqlReportForString = reportForString;
+		m_sqlTableName = tableName;
+	}
+
+	void
+	TableStreamWriter::addCell( std::string const & cell )
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Add the next cell of the body, writing the row once it is complete.
+		//   Cells beyond the last row are ignored.
+
+		if ( m_isFinished || ( m_curRow >= m_numRows ) || ( m_numColumns == 0 ) ) return;
+		m_cells[ m_curColumn ] = cell;
+		++m_curColumn;
+		if ( m_curColumn == m_numColumns ) {
+			writeRow();
+		}
+	}
+
+	void
+	TableStreamWriter::addCell(
+		Real64 const value,
+		int const numDigits
+	)
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Add the next cell of the body formatted with RealToStr.
+
+		addCell( RealToStr( value, numDigits ) );
+	}
+
+	void
+	TableStreamWriter::writeRow()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Write the current row to every style and advance to the next row.
+
+		// METHODOLOGY EMPLOYED:
+		//   The per style output matches the body loops of the original WriteTable.
+		//   Transposed XML records hold one column each so their elements are kept
+		//   until finish.
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		std::string outputLine;
+		std::string rowLabelTag;
+		std::string rowUnitString;
+		std::string tagWithAttrib;
+		bool isRecordBlank;
+		int iCol;
+
+		std::string const & rowLabel( m_rowLabels( m_curRow + 1 ) );
+
+		for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+			if ( ! m_cells[ iCol ].empty() ) {
+				m_isTableBlank = false;
+				break;
+			}
+		}
+
+		isRecordBlank = true;
+		if ( m_hasXML ) {
+			// convert the row to one with escape characters (no " ' < > &)
+			for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+				m_cellsEscaped[ iCol ] = ConvertToEscaped( m_cells[ iCol ] );
+				if ( len( m_cellsEscaped[ iCol ] ) > 0 ) isRecordBlank = false;
+			}
+			if ( ! isRecordBlank ) {
+				rowLabelTag = ConvertToElementTag( rowLabel );
+				if ( len( rowLabelTag ) == 0 ) {
+					rowLabelTag = "none";
+				}
+			}
+			if ( ! isRecordBlank && m_transposeXML ) { // each column becomes a record written by finish
+				rowUnitString = GetUnitSubString( rowLabel );
+				if ( SameString( rowUnitString, "Invalid/Undefined" ) ) {
+					rowUnitString = "";
+				}
+				for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+					if ( len( m_cellsEscaped[ iCol ] ) > 0 ) { // skip blank cells
+						tagWithAttrib = "<" + rowLabelTag;
+						if ( len( rowUnitString ) > 0 ) {
+							tagWithAttrib += std::string( " units=" ) + char( 34 ) + rowUnitString + char( 34 ) + ">\n"; // if units are present add them as an attribute
+						} else {
+							tagWithAttrib += ">";
+						}
+						m_columnXML[ iCol ] += "    " + tagWithAttrib + stripped( m_cellsEscaped[ iCol ] ) + "</" + rowLabelTag + ">\n";
+					}
+				}
+			}
+		}
+
+		for ( int iStyle = 1; iStyle <= numStyles; ++iStyle ) {
+			std::ostream & tbl_stream( *TabularOutputFile( iStyle ) );
+			auto const style( TableStyle( iStyle ) );
+			if ( ( style == tableStyleComma ) || ( style == tableStyleTab ) ) {
+				std::string const & curDel( del( iStyle ) );
+				outputLine = curDel + rowLabel; // one leading delimiters on table body lines
+				for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+					outputLine += curDel + stripped( m_cells[ iCol ] );
+				}
+				tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
+			} else if ( style == tableStyleFixed ) {
+				outputLine = "  " + rjustified( sized( rowLabel, m_maxWidthRowLabel ) ); // two blank spaces on table body lines
+				for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+					if ( iCol != 0 ) {
+						outputLine += "  " + rjustified( sized( m_cells[ iCol ], m_widthColumn[ iCol ] ) );
+					} else {
+						outputLine += "   " + rjustified( sized( m_cells[ iCol ], m_widthColumn[ iCol ] ) );
+					}
+				}
+				tbl_stream << InsertCurrencySymbol( outputLine, false ) << '\n';
+			} else if ( style == tableStyleHTML ) {
+				tbl_stream << "  <tr>\n";
+				if ( rowLabel != "" ) {
+					tbl_stream << "    <td align=\"right\">" << InsertCurrencySymbol( rowLabel, true ) << "</td>\n";
+				} else {
+					tbl_stream << "    <td align=\"right\">&nbsp;</td>\n";
+				}
+				for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+					if ( m_cells[ iCol ] != "" ) {
+						tbl_stream << "    <td align=\"right\">" << InsertCurrencySymbol( m_cells[ iCol ], true ) << "</td>\n";
 					} else {
 						tbl_stream << "    <td align=\"right\">&nbsp;</td>\n";
 					}
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						if ( body( iCol, jRow ) != "" ) {
-							tbl_stream << "    <td align=\"right\">" << InsertCurrencySymbol( body( iCol, jRow ), true ) << "</td>\n";
+				}
+				tbl_stream << "  </tr>\n";
+			} else if ( ( style == tableStyleXML ) && ! m_transposeXML && ! isRecordBlank ) {
+				tbl_stream << "  <" << m_subTableTag << ">\n";
+				if ( len( rowLabelTag ) > 0 ) {
+					tbl_stream << "    <name>" << rowLabelTag << "</name>\n";
+				}
+				for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+					if ( len( stripped( m_cellsEscaped[ iCol ] ) ) > 0 ) { // skip blank cells
+						tagWithAttrib = "<" + m_columnTags[ iCol ];
+						if ( len( m_columnUnits[ iCol ] ) > 0 ) {
+							tagWithAttrib += std::string( " units=" ) + char( 34 ) + m_columnUnits[ iCol ] + char( 34 ) + '>'; // if units are present add them as an attribute
 						} else {
-							tbl_stream << "    <td align=\"right\">&nbsp;</td>\n";
+							tagWithAttrib += ">";
 						}
+						tbl_stream << "    " << tagWithAttrib << stripped( m_cellsEscaped[ iCol ] ) << "</" << m_columnTags[ iCol ] << ">\n";
 					}
-					tbl_stream << "  </tr>\n";
 				}
+				tbl_stream << "  </" << m_subTableTag << ">\n";
+			}
+		}
+
+		if ( m_writeSQLite ) {
+			for ( iCol = 0; iCol < m_numColumns; ++iCol ) {
+				sqlite->createSQLiteTabularDataRecord( m_cells[ iCol ], rowLabel, m_columnLabels( iCol + 1 ), m_curRow, iCol, m_sqlReportName, m_sqlReportForString, m_sqlTableName );
+			}
+		}
+
+		m_curColumn = 0;
+		++m_curRow;
+	}
+
+	void
+	TableStreamWriter::finish()
+	{
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Complete the table: blank fill the rows that were not given, then write
+		//   the footnote and table endings of each style.
+
+		if ( m_isFinished ) return;
+		while ( m_curRow < m_numRows ) {
+			std::fill( m_cells.begin() + m_curColumn, m_cells.end(), std::string() );
+			writeRow();
+		}
+		m_isFinished = true;
+
+		for ( int iStyle = 1; iStyle <= numStyles; ++iStyle ) {
+			std::ostream & tbl_stream( *TabularOutputFile( iStyle ) );
+			auto const style( TableStyle( iStyle ) );
+			if ( ( style == tableStyleComma ) || ( style == tableStyleTab ) || ( style == tableStyleFixed ) ) {
+				if ( ! m_footnoteText.empty() ) {
+					tbl_stream << m_footnoteText << '\n';
+				}
+				tbl_stream << "\n\n";
+			} else if ( style == tableStyleHTML ) {
 				// end the table
 				tbl_stream << "</table>\n";
-				if ( present( footnoteText ) ) {
-					if ( ! footnoteText().empty() ) {
-						tbl_stream << "<i>" << footnoteText() << "</i>\n";
-					}
+				if ( ! m_footnoteText.empty() ) {
+					tbl_stream << "<i>" << m_footnoteText << "</i>\n";
 				}
 				tbl_stream << "<br><br>\n";
 			} else if ( style == tableStyleXML ) {
-				//check if entire table is blank and it if is skip generating anything
-				isTableBlank = true;
-				for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						if ( len( body( iCol, jRow ) ) > 0 ) {
-							isTableBlank = false;
-							break;
-						}
-					}
-					if ( ! isTableBlank ) break;
-				}
-				// if non-blank cells in the table body were found create the table.
-				if ( ! isTableBlank ) {
-					//if report name and subtable name the same add "record" to the end
-					activeSubTableName = ConvertToElementTag( activeSubTableName );
-					activeReportNameNoSpace = ConvertToElementTag( activeReportName );
-					if ( SameString( activeSubTableName, activeReportNameNoSpace ) ) {
-						activeSubTableName += "Record";
-					}
-					//if no subtable name use the report name and add "record" to the end
-					if ( len( activeSubTableName ) == 0 ) {
-						activeSubTableName = activeReportNameNoSpace + "Record";
-					}
-					// if a single column table, transpose it automatically
-					if ( ( colsBody == 1 ) && ( rowsBody > 1 ) ) {
-						doTransposeXML = true;
-					}
-					// first convert all row and column headers into tags compatible with XML strings
-					for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-						rowLabelTags( jRow ) = ConvertToElementTag( rowLabels( jRow ) );
-						if ( len( rowLabelTags( jRow ) ) == 0 ) {
-							rowLabelTags( jRow ) = "none";
-						}
-						rowUnitStrings( jRow ) = GetUnitSubString( rowLabels( jRow ) );
-						if ( SameString( rowUnitStrings( jRow ), "Invalid/Undefined" ) ) {
-							rowUnitStrings( jRow ) = "";
-						}
-					}
-					for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-						columnLabelTags( iCol ) = ConvertToElementTag( columnLabels( iCol ) );
-						if ( len( columnLabelTags( iCol ) ) == 0 ) {
-							columnLabelTags( iCol ) = "none";
-						}
-						columnUnitStrings( iCol ) = GetUnitSubString( columnLabels( iCol ) );
-						if ( SameString( columnUnitStrings( iCol ), "Invalid/Undefined" ) ) {
-							columnUnitStrings( iCol ) = "";
-						}
-					}
-					// convert entire table body to one with escape characters (no " ' < > &)
-					for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-						for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-							bodyEsc( iCol, jRow ) = ConvertToEscaped( body( iCol, jRow ) );
-						}
-					}
-					if ( ! doTransposeXML ) {
-						// body with row headers
-						for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-							// check if record is blank and it if is skip generating anything
-							isRecordBlank = true;
-							for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-								if ( len( bodyEsc( iCol, jRow ) ) > 0 ) {
-									isRecordBlank = false;
-									break;
-								}
-							}
-							if ( ! isRecordBlank ) {
-								tbl_stream << "  <" << activeSubTableName << ">\n";
-								if ( len( rowLabelTags( jRow ) ) > 0 ) {
-									tbl_stream << "    <name>" << rowLabelTags( jRow ) << "</name>\n";
-								}
-								for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-									if ( len( stripped( bodyEsc( iCol, jRow ) ) ) > 0 ) { // skip blank cells
-										tagWithAttrib = "<" + columnLabelTags( iCol );
-										if ( len( columnUnitStrings( iCol ) ) > 0 ) {
-											tagWithAttrib += std::string( " units=" ) + char( 34 ) + columnUnitStrings( iCol ) + char( 34 ) + '>'; // if units are present add them as an attribute
-										} else {
-											tagWithAttrib += ">";
-										}
-										tbl_stream << "    " << tagWithAttrib << stripped( bodyEsc( iCol, jRow ) ) << "</" << columnLabelTags( iCol ) << ">\n";
-									}
-								}
-								tbl_stream << "  </" << activeSubTableName << ">\n";
-							}
-						}
-					} else { // transpose XML table
-						// body with row headers
-						for ( iCol = 1; iCol <= colsBody; ++iCol ) {
-							// check if record is blank and it if is skip generating anything
-							isRecordBlank = true;
-							for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-								if ( len( bodyEsc( iCol, jRow ) ) > 0 ) {
-									isRecordBlank = false;
-									break;
-								}
-							}
-							if ( ! isRecordBlank ) {
-								tbl_stream << "  <" << activeSubTableName << ">\n";
-								// if the column has units put them into the name tag
-								if ( len( columnLabelTags( iCol ) ) > 0 ) {
-									if ( len( columnUnitStrings( iCol ) ) > 0 ) {
-										tbl_stream << "    <name units=" << char( 34 ) << columnUnitStrings( iCol ) << char( 34 ) << '>' << columnLabelTags( iCol ) << "</name>\n";
-									} else {
-										tbl_stream << "    <name>" << columnLabelTags( iCol ) << "</name>\n";
-									}
-								}
-								for ( jRow = 1; jRow <= rowsBody; ++jRow ) {
-									if ( len( bodyEsc( iCol, jRow ) ) > 0 ) { // skip blank cells
-										tagWithAttrib = "<" + rowLabelTags( jRow );
-										if ( len( rowUnitStrings( jRow ) ) > 0 ) {
-											tagWithAttrib += std::string( " units=" ) + char( 34 ) + rowUnitStrings( jRow ) + char( 34 ) + ">\n"; // if units are present add them as an attribute
-										} else {
-											tagWithAttrib += ">";
-										}
-										tbl_stream << "    " << tagWithAttrib << stripped( bodyEsc( iCol, jRow ) ) << "</" << rowLabelTags( jRow ) << ">\n";
-									}
-								}
-								tbl_stream << "  </" << activeSubTableName << ">\n";
-							}
-						}
-					}
-					if ( present( footnoteText ) ) {
-						if ( ! footnoteText().empty() ) {
-							tbl_stream << "  <footnote>" << footnoteText() << "</footnote>\n";
+				//if the entire table is blank nothing was generated
+				if ( m_isTableBlank ) continue;
+				if ( m_transposeXML ) {
+					for ( int iCol = 0; iCol < m_numColumns; ++iCol ) {
+						if ( m_columnXML[ iCol ].empty() ) continue; // blank record
+						tbl_stream << "  <" << m_subTableTag << ">\n";
+						// if the column has units put them into the name tag
+						if ( len( m_columnUnits[ iCol ] ) > 0 ) {
+							tbl_stream << "    <name units=" << char( 34 ) << m_columnUnits[ iCol ] << char( 34 ) << '>' << m_columnTags[ iCol ] << "</name>\n";
+						} else {
+							tbl_stream << "    <name>" << m_columnTags[ iCol ] << "</name>\n";
 						}
+						tbl_stream << m_columnXML[ iCol ];
+						tbl_stream << "  </" << m_subTableTag << ">\n";
 					}
 				}
-			} else {
-
+				if ( ! m_footnoteText.empty() ) {
+					tbl_stream << "  <footnote>" << m_footnoteText << "</footnote>\n";
+				}
 			}
 		}
+
+		if ( m_hasXML && ! m_isTableBlank ) {
+			activeSubTableName = m_subTableTag;
+			activeReportNameNoSpace = m_reportTagNoSpace;
+		}
 	}
 
 	std::string
@@ -14011,6 +14210,7 @@ namespace OutputReportTabular {
 		//       AUTHOR         Jason Glazer
 		//       DATE WRITTEN   August 2003
 		//       MODIFIED       November 2008; LKL - prevent errors
+		//                      Oct 2026; format with FixedString and ExponentString instead of gio
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -14023,7 +14223,8 @@ namespace OutputReportTabular {
 		// na
 
 		// USE STATEMENTS:
-		// na
+		using General::ExponentString;
+		using General::FixedString;
 
 		// Return value
 		std::string StringOut;
@@ -14032,9 +14233,8 @@ namespace OutputReportTabular {
 		// FUNCTION ARGUMENT DEFINITIONS:
 
 		// FUNCTION PARAMETER DEFINITIONS:
-		static Array1D< gio::Fmt > formDigits( {0,9}, { "(F12.0)", "(F12.1)", "(F12.2)", "(F12.3)", "(F12.4)", "(F12.5)", "(F12.6)", "(F12.7)", "(F12.8)", "(F12.9)" } ); // formDigits(0) | formDigits(1) | formDigits(2) | formDigits(3) | formDigits(4) | formDigits(5) | formDigits(6) | formDigits(7) | formDigits(8) | formDigits(9)
 		static Array1D< Real64 > const maxvalDigits( {0,9}, { 9999999999.0, 999999999.0, 99999999.0, 9999999.0, 999999.0, 99999.0, 9999.0, 999.0, 99.0, 9.0 } ); // maxvalDigits(0) | maxvalDigits(1) | maxvalDigits(2) | maxvalDigits(3) | maxvalDigits(4) | maxvalDigits(5) | maxvalDigits(6) | maxvalDigits(7) | maxvalDigits(8) | maxvalDigits(9)
-		static gio::Fmt fmtd( "(E12.6)" );
+		int const fieldWidth( 12 ); // Width of the F12.n and E12.6 fields
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -14051,9 +14251,9 @@ namespace OutputReportTabular {
 		if ( nDigits < 0 ) nDigits = 0;
 
 		if ( std::abs( RealIn ) > maxvalDigits( nDigits ) ) {
-			gio::write( StringOut, fmtd ) << RealIn;
+			StringOut = ExponentString( RealIn, fieldWidth, 6, 2, 0 );
 		} else {
-			gio::write( StringOut, formDigits( nDigits ) ) << RealIn;
+			StringOut = FixedString( RealIn, fieldWidth, nDigits );
 		}
 		//  WRITE(FMT=, UNIT=stringOut) RealIn
 		// check if it did not fit
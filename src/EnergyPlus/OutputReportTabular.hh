@@ -62,6 +62,7 @@
 // C++ Headers
 #include <fstream>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -590,6 +591,80 @@ namespace OutputReportTabular {
 
 	};
 
+	// Writes one table to every requested style (and optionally to SQLite) in a single pass.
+	// Cells are added row by row, left to right; only the current row is held in memory,
+	// except for transposed XML tables which keep one element string per column.
+	// The label and width arrays are referenced, not copied, and must outlive the writer.
+	class TableStreamWriter
+	{
+
+	public: // Creation
+
+		TableStreamWriter(
+			Array1S_string const rowLabels,
+			Array1S_string const columnLabels,
+			Array1S_int widthColumn,
+			bool const transposeXML = false,
+			std::string const & footnoteText = std::string()
+		);
+
+	public: // Methods
+
+		// Also write each cell as a tabular data record, must be called before the first cell
+		void
+		setSQLiteTable(
+			std::string const & reportName,
+			std::string const & reportForString,
+			std::string const & tableName
+		);
+
+		void
+		addCell( std::string const & cell );
+
+		void
+		addCell(
+			Real64 const value,
+			int const numDigits
+		);
+
+		// Fills any missing cells with blanks and writes the table endings
+		void
+		finish();
+
+	private: // Methods
+
+		void
+		writeRow();
+
+	private: // Data
+
+		Array1S_string m_rowLabels;
+		Array1S_string m_columnLabels;
+		int m_numRows;
+		int m_numColumns;
+		std::string m_footnoteText;
+		bool m_transposeXML;
+		std::vector< int > m_widthColumn;
+		std::string::size_type m_maxWidthRowLabel; // fixed style only
+		bool m_hasXML;
+		std::string m_subTableTag; // xml record element
+		std::string m_reportTagNoSpace;
+		std::vector< std::string > m_columnTags;
+		std::vector< std::string > m_columnUnits;
+		std::vector< std::string > m_columnXML; // transposed xml records
+		std::vector< std::string > m_cells; // current row
+		std::vector< std::string > m_cellsEscaped;
+		int m_curRow; // zero based
+		int m_curColumn; // zero based
+		bool m_isTableBlank;
+		bool m_writeSQLite;
+		std::string m_sqlReportName;
+		std::string m_sqlReportForString;
+		std::string m_sqlTableName;
+		bool m_isFinished;
+
+	};
+
 	// Object Data
 	extern Array1D< OutputTableBinnedType > OutputTableBinned;
 	extern Array2D< BinResultsType > BinResults; // table number, number of intervals
@@ -693,9 +768,15 @@ namespace OutputReportTabular {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	CompileBinGathering();
+
 	void
 	GatherBinResultsForTimestep( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
+	void
+	CompileMonthlyGathering();
+
 	void
 	GatherMonthlyResultsForTimestep( int const IndexTypeKey ); // What kind of data to update (Zone, HVAC)
 
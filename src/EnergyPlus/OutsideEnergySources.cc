@@ -489,7 +489,7 @@ namespace OutsideEnergySources {
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		int TempTypeFlag( 0 );
-		static Real64 TempPlantMdot( 0.0 ); // local copy of plant flow
+		Real64 TempPlantMdot( 0.0 ); // local copy of plant flow
 		int LoopNum;
 		int LoopSideNum;
 		int BranchIndex;
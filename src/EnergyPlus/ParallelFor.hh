@@ -0,0 +1,143 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+#ifndef EnergyPlus_ParallelFor_hh_INCLUDED
+#define EnergyPlus_ParallelFor_hh_INCLUDED
+
+// Purpose: Parallel loop over a range of independent work items
+//
+// History:
+//  Oct 2026: Initial release
+//
+// Notes:
+//  Each index is processed exactly once: worker threads and the calling thread pull the next index from a shared counter
+//  With one thread (the default for unit tests and library use) this is the plain serial loop on the calling thread
+//  The loop body must only write to storage owned by its index, or to thread_local scratch, so that results
+//   do not depend on the thread count or on scheduling: reductions belong in a serial pass after the loop
+//  The first exception thrown by the body (e.g., FatalError from ShowFatalError) is rethrown on the calling thread
+//   once all threads have joined
+//  The thread count is DataSystemVariables::NumberParallelThreads, 1 unless set from EP_OMP_NUM_THREADS
+
+// EnergyPlus Headers
+#include <EnergyPlus.hh>
+#include <DataSystemVariables.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Number of threads to use for a loop of nItems work items
+inline
+int
+ParallelForThreads( int const nItems )
+{
+	return std::max( std::min( DataSystemVariables::NumberParallelThreads, nItems ), 1 );
+}
+
+// Call body( i ) for i = first, ..., last
+template< typename Body >
+void
+ParallelFor(
+	int const first, // First index
+	int const last, // Last index (inclusive)
+	Body const & body // Loop body: body( i )
+)
+{
+	if ( last < first ) return;
+	int const nThreads( ParallelForThreads( last - first + 1 ) );
+	if ( nThreads == 1 ) {
+		for ( int i = first; i <= last; ++i ) body( i );
+		return;
+	}
+
+	std::atomic_int next( first ); // Next index to process
+	std::atomic_bool failed( false ); // Set when the body has thrown: remaining items are skipped
+	std::exception_ptr error; // First exception thrown by the body
+	std::mutex errorMutex;
+	auto work = [&]() {
+		try {
+			for ( int i = next++; ( i <= last ) && ( ! failed.load() ); i = next++ ) body( i );
+		} catch ( ... ) {
+			std::lock_guard< std::mutex > lock( errorMutex );
+			if ( ! error ) error = std::current_exception();
+			failed = true;
+		}
+	};
+
+	std::vector< std::thread > threads;
+	threads.reserve( nThreads - 1 );
+	try {
+		for ( int iThread = 1; iThread < nThreads; ++iThread ) threads.emplace_back( work );
+	} catch ( std::system_error const & ) {
+		// Thread creation failed: the threads already running and the calling thread still cover every index
+	}
+	work();
+	for ( auto & thread : threads ) thread.join();
+	if ( error ) std::rethrow_exception( error );
+}
+
+} // EnergyPlus
+
+#endif
@@ -2649,6 +2649,7 @@ namespace PlantCondLoopOperation {
 		//       AUTHOR         B. Griffith
 		//       DATE WRITTEN   Nov 2011
 		//       MODIFIED       March 2012, B. Griffith add controls for free cooling heat exchanger overrides of chillers
+		//                      Oct 2026, locals instead of statics, for concurrent plant loops
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2681,15 +2682,15 @@ namespace PlantCondLoopOperation {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		static Real64 CurMassFlowRate( 0.0 );
-		static Real64 ToutLowLimit( 0.0 );
-		static Real64 ToutHiLimit( 0.0 );
-		static Real64 TinLowLimit( 0.0 );
-		static Real64 Tinlet( 0.0 );
-		static Real64 Tsensor( 0.0 );
-		static Real64 CurSpecHeat( 0.0 );
-		static Real64 QdotTmp( 0.0 );
-		static int ControlNodeNum( 0 );
+		Real64 CurMassFlowRate( 0.0 );
+		Real64 ToutLowLimit( 0.0 );
+		Real64 ToutHiLimit( 0.0 );
+		Real64 TinLowLimit( 0.0 );
+		Real64 Tinlet( 0.0 );
+		Real64 Tsensor( 0.0 );
+		Real64 CurSpecHeat( 0.0 );
+		Real64 QdotTmp( 0.0 );
+		int ControlNodeNum( 0 );
 
 		auto & this_component( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ).Comp( CompNum ) );
 
@@ -75,6 +75,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <HVACInterfaceManager.hh>
@@ -110,11 +111,11 @@ namespace PlantLoopSolver {
 	// DERIVED TYPE DEFINITIONS
 
 	// MODULE VARIABLE DEFINITIONS
-	Real64 InitialDemandToLoopSetPoint;
-	Real64 CurrentAlterationsToDemand;
-	Real64 UpdatedDemandToLoopSetPoint;
-	Real64 LoadToLoopSetPointThatWasntMet; // Unmet Demand
-	Real64 InitialDemandToLoopSetPointSAVED;
+	thread_local Real64 InitialDemandToLoopSetPoint;
+	thread_local Real64 CurrentAlterationsToDemand;
+	thread_local Real64 UpdatedDemandToLoopSetPoint;
+	thread_local Real64 LoadToLoopSetPointThatWasntMet; // Unmet Demand
+	thread_local Real64 InitialDemandToLoopSetPointSAVED;
 	int RefrigIndex( 0 ); // Index denoting refrigerant used (possibly steam)
 
 	static std::string const fluidNameSteam( "STEAM" );
@@ -666,7 +667,7 @@ namespace PlantLoopSolver {
 		Real64 InletBranchRequestNeedAndTurnOn;
 		Real64 InletBranchRequestNeedIfOn;
 //		static Array2D< Real64 > LoadedConstantSpeedBranchFlowRateSteps; // Values never used
-		static Array2D< Real64 > NoLoadConstantSpeedBranchFlowRateSteps;
+		static thread_local Array2D< Real64 > NoLoadConstantSpeedBranchFlowRateSteps;
 		int ParallelBranchIndex;
 		Real64 OutletBranchRequestNeedAndTurnOn;
 		Real64 OutletBranchRequestNeedIfOn;
@@ -675,12 +676,12 @@ namespace PlantLoopSolver {
 		bool ThisLoopHasCommonPipe( false );
 
 		//Tuned Made static: Set before use
-		static Array1D_bool ThisLoopHasConstantSpeedBranchPumps( 2 );
-		static Array1D< Real64 > EachSideFlowRequestNeedAndTurnOn( 2 ); // 2 for SupplySide/DemandSide
-		static Array1D< Real64 > EachSideFlowRequestNeedIfOn( 2 ); // 2 for SupplySide/DemandSide
-		static Array1D< Real64 > EachSideFlowRequestFinal( 2 ); // 2 for SupplySide/DemandSide
+		static thread_local Array1D_bool ThisLoopHasConstantSpeedBranchPumps( 2 );
+		static thread_local Array1D< Real64 > EachSideFlowRequestNeedAndTurnOn( 2 ); // 2 for SupplySide/DemandSide
+		static thread_local Array1D< Real64 > EachSideFlowRequestNeedIfOn( 2 ); // 2 for SupplySide/DemandSide
+		static thread_local Array1D< Real64 > EachSideFlowRequestFinal( 2 ); // 2 for SupplySide/DemandSide
 
-		static bool AllocatedParallelArray( false );
+		static thread_local bool AllocatedParallelArray( false );
 		int MaxParallelBranchCount;
 		int FlowPriorityStatus;
 		Real64 tmpLoopFlow;
@@ -1132,7 +1133,7 @@ namespace PlantLoopSolver {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Edwin Lee
 		//       DATE WRITTEN   July 2010
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; reuse of the last simulation of unchanged branches
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1148,6 +1149,8 @@ namespace PlantLoopSolver {
 		//  load distribution engine will be called again before the next component.
 		// After all load distribution is done and those components are complete, the simulation moves back to do any
 		//  remaining components that may be downstream.
+		// When requested, a branch that only holds demand and uncontrolled components is not simulated again in the
+		//  first pass if its nodes are still as the last simulation of the branch in this plant solve left them.
 
 		// Using/Aliasing
 		using DataPlant::PlantLoop;
@@ -1169,16 +1172,17 @@ namespace PlantLoopSolver {
 		using PlantLoopEquip::SimPlantEquip;
 		using PlantPressureSystem::SimPressureDropSystem;
 		using General::TrimSigDigits;
+		using DataSystemVariables::SkipUnchangedPlantBranchesEnvFlag;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 		//~ History values
-		static int LastLoopNum( -1 );
-		static int LastLoopSideNum( -1 );
-		static int LastFirstBranchNum( -1 );
-		static int LastLastBranchNum( -1 );
+		static thread_local int LastLoopNum( -1 );
+		static thread_local int LastLoopSideNum( -1 );
+		static thread_local int LastFirstBranchNum( -1 );
+		static thread_local int LastLastBranchNum( -1 );
 
 		//~ Indexing variables
 		int BranchCounter; // ~ This contains the index for the %Branch(:) structure
@@ -1196,7 +1200,7 @@ namespace PlantLoopSolver {
 		static Array1D_string const LoopSideNames( 2, { "Demand", "Supply" } );
 
 		//~ General variables
-		static Array1D_int LastComponentSimulated;
+		static thread_local Array1D_int LastComponentSimulated;
 		Real64 LoadToLoopSetPoint;
 
 		int curCompOpSchemePtr;
@@ -1256,6 +1260,20 @@ namespace PlantLoopSolver {
 			//~  try to make it all the way to the end of the loop
 			StartingComponent = LastComponentSimulated( BranchIndex ) + 1;
 			EndingComponent = branch.TotalComponents;
+
+			//~ Reuse the last simulation of the branch if none of its nodes have changed since
+			bool const SaveBranchState( SkipUnchangedPlantBranchesEnvFlag && ( StartingComponent == 1 ) && BranchSimStateReusable( LoopNum, LoopSideNum, BranchCounter ) );
+			bool BranchStateReused( false );
+			if ( SaveBranchState ) {
+				BranchStateReused = ReuseBranchSimState( LoopNum, LoopSideNum, BranchCounter );
+				if ( BranchStateReused ) {
+					LastComponentSimulated( BranchIndex ) = EndingComponent;
+					StartingComponent = EndingComponent + 1;
+				} else {
+					SaveBranchSimState( LoopNum, LoopSideNum, BranchCounter, false );
+				}
+			}
+
 			for ( CompCounter = StartingComponent; CompCounter <= EndingComponent; ++CompCounter ) {
 
 				auto & this_comp( branch.Comp( CompCounter ) );
@@ -1308,6 +1326,10 @@ namespace PlantLoopSolver {
 			} //~ CompCounter
 			components_end: ;
 
+			if ( SaveBranchState && ! BranchStateReused ) {
+				SaveBranchSimState( LoopNum, LoopSideNum, BranchCounter, true );
+			}
+
 			if ( loop.FlowLock == FlowLocked ) {
 				SimPressureDropSystem( LoopNum, FirstHVACIteration, PressureCall_Calc, LoopSideNum, BranchCounter );
 			}
@@ -1439,6 +1461,179 @@ namespace PlantLoopSolver {
 
 	}
 
+	bool
+	BranchSimStateReusable(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines whether the result of the last simulation of a branch may be reused when its nodes are unchanged.
+
+		// METHODOLOGY EMPLOYED:
+		// Only demand side equipment (coils, etc.) and uncontrolled components (pipes, etc.) qualify: they do not take part
+		//  in the load distribution, and within one plant solve their outcome depends only on the branch nodes.  Pumps,
+		//  dispatched equipment, components connecting this loop side to another loop, and user defined components, which
+		//  run EMS programs, are always simulated.
+
+		// Using/Aliasing
+		using DataPlant::PlantLoop;
+		using DataPlant::DemandOpSchemeType;
+		using DataPlant::NoControlOpSchemeType;
+		using DataPlant::FlowUnlocked;
+		using DataPlant::FlowLocked;
+		using DataPlant::TypeOf_PlantComponentUserDefined;
+		using DataGlobals::BeginEnvrnFlag;
+
+		if ( BeginEnvrnFlag ) return false;
+
+		auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+		if ( ( loop_side.FlowLock != FlowUnlocked ) && ( loop_side.FlowLock != FlowLocked ) ) return false;
+
+		auto const & branch( loop_side.Branch( BranchNum ) );
+		if ( branch.EMSCtrlOverrideOn || ( branch.TotalComponents == 0 ) ) return false;
+
+		for ( int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+			auto const & this_comp( branch.Comp( CompNum ) );
+			if ( ( this_comp.CurOpSchemeType != DemandOpSchemeType ) && ( this_comp.CurOpSchemeType != NoControlOpSchemeType ) ) return false;
+			if ( this_comp.TypeOf_Num == TypeOf_PlantComponentUserDefined ) return false;
+			for ( int ConnectedNum = 1; ConnectedNum <= loop_side.TotalConnected; ++ConnectedNum ) {
+				if ( this_comp.TypeOf_Num == loop_side.Connected( ConnectedNum ).ConnectorTypeOf_Num ) return false;
+			}
+		}
+
+		return true;
+
+	}
+
+	void
+	SaveBranchSimState(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum,
+		bool const AfterSimulation // TRUE once the components of the branch have been simulated
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Saves the component nodes and loads of a branch before and after its components are simulated,
+		//  for the current flow lock state of the loop side.
+
+		// Using/Aliasing
+		using DataPlant::PlantLoop;
+		using DataPlant::PlantManageCalls;
+		using DataLoopNode::Node;
+
+		auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+		auto & branch( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ) );
+		auto & state( branch.SimState( loop_side.FlowLock + 1 ) );
+		int const NumComps( branch.TotalComponents );
+
+		if ( ! AfterSimulation ) {
+			if ( state.MyLoad.isize() != NumComps ) {
+				state.NodesBefore.allocate( 2 * NumComps );
+				state.NodesAfter.allocate( 2 * NumComps );
+				state.MyLoad.allocate( NumComps );
+			}
+			state.PlantManageCall = 0; // Not usable until the simulation of the branch is complete
+			for ( int CompNum = 1; CompNum <= NumComps; ++CompNum ) {
+				auto const & this_comp( branch.Comp( CompNum ) );
+				state.NodesBefore( 2 * CompNum - 1 ) = Node( this_comp.NodeNumIn );
+				state.NodesBefore( 2 * CompNum ) = Node( this_comp.NodeNumOut );
+				state.MyLoad( CompNum ) = this_comp.MyLoad;
+			}
+		} else {
+			for ( int CompNum = 1; CompNum <= NumComps; ++CompNum ) {
+				auto const & this_comp( branch.Comp( CompNum ) );
+				state.NodesAfter( 2 * CompNum - 1 ) = Node( this_comp.NodeNumIn );
+				state.NodesAfter( 2 * CompNum ) = Node( this_comp.NodeNumOut );
+			}
+			state.PlantManageCall = PlantManageCalls;
+		}
+
+	}
+
+	bool
+	ReuseBranchSimState(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Reuses the last simulation of a branch, made in the current plant solve with the same flow lock state,
+		//  if the component nodes and loads of the branch are the same as they were before that simulation.
+
+		// METHODOLOGY EMPLOYED:
+		// The nodes are compared on the values the plant components read: temperatures and set points, flow rates,
+		//  flow requests and limits, pressure, quality and enthalpy.  If none changed, the nodes are set back to their
+		//  state after the last simulation and the loop demand alterations of the components are updated, as they
+		//  would have been by simulating the components again.
+
+		// Return value
+		bool Reused( false );
+
+		// Using/Aliasing
+		using DataPlant::PlantLoop;
+		using DataPlant::PlantManageCalls;
+		using DataPlant::PlantReport;
+		using DataLoopNode::Node;
+		using DataLoopNode::NodeData;
+
+		auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+		auto const & branch( loop_side.Branch( BranchNum ) );
+		auto const & state( branch.SimState( loop_side.FlowLock + 1 ) );
+		int const NumComps( branch.TotalComponents );
+
+		if ( state.PlantManageCall != PlantManageCalls ) return Reused;
+
+		auto NodeUnchanged = []( NodeData const & Saved, NodeData const & Current ) {
+			return ( Saved.Temp == Current.Temp ) && ( Saved.TempSetPoint == Current.TempSetPoint ) && ( Saved.TempSetPointHi == Current.TempSetPointHi ) && ( Saved.TempSetPointLo == Current.TempSetPointLo ) && ( Saved.MassFlowRate == Current.MassFlowRate ) && ( Saved.MassFlowRateRequest == Current.MassFlowRateRequest ) && ( Saved.MassFlowRateMin == Current.MassFlowRateMin ) && ( Saved.MassFlowRateMax == Current.MassFlowRateMax ) && ( Saved.MassFlowRateMinAvail == Current.MassFlowRateMinAvail ) && ( Saved.MassFlowRateMaxAvail == Current.MassFlowRateMaxAvail ) && ( Saved.MassFlowRateSetPoint == Current.MassFlowRateSetPoint ) && ( Saved.Press == Current.Press ) && ( Saved.Quality == Current.Quality ) && ( Saved.Enthalpy == Current.Enthalpy );
+		};
+
+		for ( int CompNum = 1; CompNum <= NumComps; ++CompNum ) {
+			auto const & this_comp( branch.Comp( CompNum ) );
+			if ( this_comp.MyLoad != state.MyLoad( CompNum ) ) return Reused;
+			if ( ! NodeUnchanged( state.NodesBefore( 2 * CompNum - 1 ), Node( this_comp.NodeNumIn ) ) ) return Reused;
+			if ( ! NodeUnchanged( state.NodesBefore( 2 * CompNum ), Node( this_comp.NodeNumOut ) ) ) return Reused;
+		}
+
+		for ( int CompNum = 1; CompNum <= NumComps; ++CompNum ) {
+			auto const & this_comp( branch.Comp( CompNum ) );
+			Node( this_comp.NodeNumIn ) = state.NodesAfter( 2 * CompNum - 1 );
+			Node( this_comp.NodeNumOut ) = state.NodesAfter( 2 * CompNum );
+		}
+		for ( int CompNum = 1; CompNum <= NumComps; ++CompNum ) {
+			UpdateAnyLoopDemandAlterations( LoopNum, LoopSideNum, BranchNum, CompNum );
+		}
+		PlantReport( LoopNum ).SkippedCompSimulations += NumComps;
+
+		Reused = true;
+		return Reused;
+
+	}
+
 	//==================================================================!
 	//==================================================================!
 	//==================================================================!
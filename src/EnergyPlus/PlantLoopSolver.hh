@@ -74,11 +74,11 @@ namespace PlantLoopSolver {
 	// DERIVED TYPE DEFINITIONS
 
 	// MODULE VARIABLE DEFINITIONS
-	extern Real64 InitialDemandToLoopSetPoint;
-	extern Real64 CurrentAlterationsToDemand;
-	extern Real64 UpdatedDemandToLoopSetPoint;
-	extern Real64 LoadToLoopSetPointThatWasntMet; // Unmet Demand
-	extern Real64 InitialDemandToLoopSetPointSAVED;
+	extern thread_local Real64 InitialDemandToLoopSetPoint;
+	extern thread_local Real64 CurrentAlterationsToDemand;
+	extern thread_local Real64 UpdatedDemandToLoopSetPoint;
+	extern thread_local Real64 LoadToLoopSetPointThatWasntMet; // Unmet Demand
+	extern thread_local Real64 InitialDemandToLoopSetPointSAVED;
 	extern int RefrigIndex; // Index denoting refrigerant used (possibly steam)
 
 	// SUBROUTINE SPECIFICATIONS:
@@ -197,6 +197,28 @@ namespace PlantLoopSolver {
 		bool const StartingNewLoopSidePass = false
 	);
 
+	bool
+	BranchSimStateReusable(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum
+	);
+
+	void
+	SaveBranchSimState(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum,
+		bool const AfterSimulation // TRUE once the components of the branch have been simulated
+	);
+
+	bool
+	ReuseBranchSimState(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum
+	);
+
 	//==================================================================!
 	//==================================================================!
 	//==================================================================!
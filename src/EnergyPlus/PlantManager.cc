@@ -59,6 +59,7 @@
 // C++ Headers
 #include <algorithm>
 #include <cassert>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -77,6 +78,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <EMSManager.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
@@ -85,8 +87,10 @@
 #include <InputProcessor.hh>
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
+#include <ParallelFor.hh>
 #include <PipeHeatTransfer.hh>
 #include <Pipes.hh>
+#include <PlantHeatExchangerFluidToFluid.hh>
 #include <PlantLoadProfile.hh>
 #include <PlantLoopEquip.hh>
 #include <PlantLoopSolver.hh>
@@ -159,6 +163,20 @@ namespace PlantManager {
 	Array1D_int SupplySideOutletNode; // Node number for the supply side outlet
 	Array1D_int DemandSideInletNode; // Inlet node on the demand side
 
+	namespace {
+	// These are purposefully not in the header file as an extern variable. No one outside of this should
+	// use these. They are cleared by clear_state() for use by unit tests, but normal simulations should be unaffected.
+	// This is purposefully in an anonymous namespace so nothing outside this implementation file can use it.
+		std::vector< int > AllHalfLoops; // All half loops, as indexes in PlantCallingOrderInfo
+		bool ConcurrentPlantLoopsChecked( false ); // TRUE once the plant loops that may be simulated concurrently are known
+		std::vector< std::vector< int > > ConcurrentHalfLoopGroups; // Half loops of each group of connected plant loops
+		// simulated concurrently, in calling order (see SetupConcurrentPlantLoopGroups)
+		std::vector< int > SequentialHalfLoops; // Half loops of the other plant loops, in calling order
+		Array1D_bool ConcurrentSimFlags; // Results of the concurrently simulated groups,
+		Array1D_int ConcurrentSubIterations; // merged by ManagePlantLoops
+		Array1D_int ConcurrentHalfLoopCalls;
+	}
+
 	// SUBROUTINE SPECIFICATIONS:
 	//The following public routines are called from HVAC Manager
 	//PUBLIC  CheckPlantLoopData      !called from SimHVAC
@@ -183,6 +201,13 @@ namespace PlantManager {
 		DemandSideInletNode.deallocate();
 		LoopPipe.deallocate();
 		TempLoop = TempLoopData();
+		AllHalfLoops.clear();
+		ConcurrentPlantLoopsChecked = false;
+		ConcurrentHalfLoopGroups.clear();
+		SequentialHalfLoops.clear();
+		ConcurrentSimFlags.deallocate();
+		ConcurrentSubIterations.deallocate();
+		ConcurrentHalfLoopCalls.deallocate();
 	}
 
 	void
@@ -199,7 +224,8 @@ namespace PlantManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Sankaranarayanan K P
 		//       DATE WRITTEN   Apr 2005
-		//       MODIFIED
+		//       MODIFIED       Oct 2026; count the calls for the reuse of unchanged branch states
+		//                      Oct 2026; concurrent simulation of independent groups of plant loops
 		//       RE-ENGINEERED  B. Griffith, Feb. 2010
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -209,6 +235,12 @@ namespace PlantManager {
 		// Set up the while iteration block for the plant loop simulation.
 		// Calls half loop sides to be simulated in predetermined order.
 		// Reset the flags as necessary
+		// When PARALLEL_PLANTLOOPS is set, the groups of connected plant loops that share no state with the
+		// rest of the simulation (see SetupConcurrentPlantLoopGroups) are iterated concurrently, each group
+		// until its own half loops have converged. The other plant loops are then iterated in calling order,
+		// and the iteration statistics of all groups are merged. Only loops served by pipes, pumps, load
+		// profiles, district heating and cooling and fluid to fluid heat exchangers qualify, so plants with
+		// chillers, boilers or water coils are simulated in sequence as before.
 
 		// REFERENCES:
 		// na
@@ -218,7 +250,8 @@ namespace PlantManager {
 		// Using/Aliasing
 		using PlantUtilities::LogPlantConvergencePoints;
 		using DataConvergParams::MinPlantSubIterations;
-		using DataConvergParams::MaxPlantSubIterations;
+		using DataSystemVariables::ParallelPlantLoopsEnvFlag;
+		using DataSystemVariables::NumberParallelThreads;
 
 		// SUBROUTINE ARGUMENT DEFINITIONS
 
@@ -226,14 +259,11 @@ namespace PlantManager {
 		// SUBROUTINE PARAMETER DEFINITIONS
 
 		// SUBROUTINE VARIABLE DEFINITIONS
-		int IterPlant;
 		int LoopNum;
 		int LoopSide;
-		int LoopSideNum;
-		int OtherSide;
-		bool SimHalfLoopFlag;
-		int HalfLoopNum;
 		int CurntMinPlantSubIterations;
+		int SubIterations( 0 ); // Sub-iterations performed (maximum over the concurrent groups)
+		int HalfLoopCalls( 0 ); // Half loop simulations performed
 
 		if ( std::any_of( PlantLoop.begin(), PlantLoop.end(), []( DataPlant::PlantLoopData const & e ){ return ( e.CommonPipeType == DataPlant::CommonPipe_Single ) || ( e.CommonPipeType == DataPlant::CommonPipe_TwoWay ); } ) ) {
 			CurntMinPlantSubIterations = max( 7, MinPlantSubIterations );
@@ -246,12 +276,106 @@ namespace PlantManager {
 			return;
 		}
 
-		IterPlant = 0;
 		InitializeLoops( FirstHVACIteration );
+		++PlantManageCalls; // branch states saved by earlier calls are not reused
+
+		// Simulate the independent groups of plant loops concurrently; the first HVAC iteration (which distributes
+		// the loads over all plant loops), sizing and one-time initializations are done with all half loops in sequence
+		bool const SimConcurrent( ParallelPlantLoopsEnvFlag && ( NumberParallelThreads > 1 ) && ! FirstHVACIteration && ! BeginEnvrnFlag && ! KickOffSimulation && ! DoingSizing && ! AnyEMSPlantOpSchemesInModel );
+		if ( SimConcurrent && ! ConcurrentPlantLoopsChecked ) {
+			SetupConcurrentPlantLoopGroups( ConcurrentHalfLoopGroups, SequentialHalfLoops );
+			ConcurrentSimFlags.dimension( ConcurrentHalfLoopGroups.size(), false );
+			ConcurrentSubIterations.dimension( ConcurrentHalfLoopGroups.size(), 0 );
+			ConcurrentHalfLoopCalls.dimension( ConcurrentHalfLoopGroups.size(), 0 );
+			ConcurrentPlantLoopsChecked = true;
+		}
+
+		if ( SimConcurrent && ! ConcurrentHalfLoopGroups.empty() ) {
+			int const NumGroups( ConcurrentHalfLoopGroups.size() );
+			bool const SimPlantLoopsIn( SimPlantLoops );
+			ParallelFor( 1, NumGroups, [&]( int const GroupNum ){
+				ConcurrentSimFlags( GroupNum ) = SimPlantLoopsIn;
+				SimPlantLoopGroup( FirstHVACIteration, ConcurrentHalfLoopGroups[ GroupNum - 1 ], CurntMinPlantSubIterations, ConcurrentSimFlags( GroupNum ), ConcurrentSubIterations( GroupNum ), ConcurrentHalfLoopCalls( GroupNum ) );
+			} );
+			SimPlantLoops = false;
+			if ( SimPlantLoopsIn && ! SequentialHalfLoops.empty() ) {
+				SimPlantLoops = true;
+				SimPlantLoopGroup( FirstHVACIteration, SequentialHalfLoops, CurntMinPlantSubIterations, SimPlantLoops, SubIterations, HalfLoopCalls );
+			}
+			for ( int GroupNum = 1; GroupNum <= NumGroups; ++GroupNum ) {
+				if ( ConcurrentSimFlags( GroupNum ) ) SimPlantLoops = true;
+				SubIterations = max( SubIterations, ConcurrentSubIterations( GroupNum ) );
+				HalfLoopCalls += ConcurrentHalfLoopCalls( GroupNum );
+			}
+		} else {
+			// go through all half loops in predetermined calling order
+			if ( int( AllHalfLoops.size() ) != TotNumHalfLoops ) {
+				AllHalfLoops.clear();
+				for ( int HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) AllHalfLoops.push_back( HalfLoopNum );
+			}
+			SimPlantLoopGroup( FirstHVACIteration, AllHalfLoops, CurntMinPlantSubIterations, SimPlantLoops, SubIterations, HalfLoopCalls );
+		}
+		PlantManageSubIterations += SubIterations; // these are summed across all half loops for reporting
+		PlantManageHalfLoopCalls += HalfLoopCalls;
+
+		// add check for non-plant system sim flag updates
+		//  could set SimAirLoops, SimElecCircuits, SimZoneEquipment flags for now
+		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			for ( LoopSide = DemandSide; LoopSide <= SupplySide; ++LoopSide ) {
+			auto & this_loop_side( PlantLoop(LoopNum).LoopSide(LoopSide) );
+			if ( this_loop_side.SimAirLoopsNeeded ) SimAirLoops = true;
+				if ( this_loop_side.SimZoneEquipNeeded ) SimZoneEquipment = true;
+				//  IF (this_loop_side.SimNonZoneEquipNeeded) SimNonZoneEquipment = .TRUE.
+				if ( this_loop_side.SimElectLoadCentrNeeded ) SimElecCircuits = true;
+			}
+		}
+
+		//Also log the convergence history of all loopsides once complete
+		LogPlantConvergencePoints( FirstHVACIteration );
+
+	}
+
+	void
+	SimPlantLoopGroup(
+		bool const FirstHVACIteration,
+		std::vector< int > const & HalfLoopNums, // Half loops to simulate, as indexes in PlantCallingOrderInfo
+		int const CurntMinPlantSubIterations, // Minimum number of sub-iterations
+		bool & SimPlantLoops, // True when some of these half loops need to be (re)simulated
+		int & SubIterations, // Number of sub-iterations performed
+		int & HalfLoopCalls // Number of half loop simulations performed
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Sankaranarayanan K P
+		//       DATE WRITTEN   Apr 2005
+		//       MODIFIED       na
+		//       RE-ENGINEERED  This is code that used to be part of ManagePlantLoops()
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Iterates the simulation of the given half loops, in the given order, until they have converged.
+
+		// METHODOLOGY EMPLOYED:
+		// Only updates the given half loops and the counters passed in, so that groups of plant loops
+		// that are not connected to each other may be iterated concurrently.
+
+		// Using/Aliasing
+		using DataConvergParams::MaxPlantSubIterations;
+
+		// SUBROUTINE VARIABLE DEFINITIONS
+		int IterPlant;
+		int LoopNum;
+		int LoopSide;
+		int OtherSide;
+		bool SimHalfLoopFlag;
+
+		IterPlant = 0;
+		SubIterations = 0;
+		HalfLoopCalls = 0;
 
 		while ( ( SimPlantLoops ) && ( IterPlant <= MaxPlantSubIterations ) ) {
 			// go through half loops in predetermined calling order
-			for ( HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+			for ( int const HalfLoopNum : HalfLoopNums ) {
 
 				LoopNum = PlantCallingOrderInfo( HalfLoopNum ).LoopIndex;
 				LoopSide = PlantCallingOrderInfo( HalfLoopNum ).LoopSide;
@@ -280,42 +404,148 @@ namespace PlantManager {
 					// Update the report variable
 					PlantReport( LoopNum ).LastLoopSideSimulated = LoopSide;
 
-					++PlantManageHalfLoopCalls;
+					++HalfLoopCalls;
 				}
 
 			} // half loop based calling order...
 
-			// decide new status for SimPlantLoops flag
+			// decide new status for SimPlantLoops flag; the half loops hold both sides of their plant loops
 			SimPlantLoops = false;
-			for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
-				for ( LoopSideNum = 1; LoopSideNum <= 2; ++LoopSideNum ) {
-					if ( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).SimLoopSideNeeded ) {
-						SimPlantLoops = true;
-						goto LoopLevel_exit;
-					}
+			for ( int const HalfLoopNum : HalfLoopNums ) {
+				if ( PlantLoop( PlantCallingOrderInfo( HalfLoopNum ).LoopIndex ).LoopSide( PlantCallingOrderInfo( HalfLoopNum ).LoopSide ).SimLoopSideNeeded ) {
+					SimPlantLoops = true;
+					break;
 				}
 			}
-			LoopLevel_exit: ;
 
 			++IterPlant; // Increment the iteration counter
 			if ( IterPlant < CurntMinPlantSubIterations ) SimPlantLoops = true;
-			++PlantManageSubIterations; // these are summed across all half loops for reporting
+			++SubIterations;
 		} //while
 
-		// add check for non-plant system sim flag updates
-		//  could set SimAirLoops, SimElecCircuits, SimZoneEquipment flags for now
-		for ( LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
-			for ( LoopSide = DemandSide; LoopSide <= SupplySide; ++LoopSide ) {
-			auto & this_loop_side( PlantLoop(LoopNum).LoopSide(LoopSide) );
-			if ( this_loop_side.SimAirLoopsNeeded ) SimAirLoops = true;
-				if ( this_loop_side.SimZoneEquipNeeded ) SimZoneEquipment = true;
-				//  IF (this_loop_side.SimNonZoneEquipNeeded) SimNonZoneEquipment = .TRUE.
-				if ( this_loop_side.SimElectLoadCentrNeeded ) SimElecCircuits = true;
+	}
+
+	bool
+	ConcurrentPlantLoop( int const LoopNum )
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the plant loop can be simulated concurrently with the plant loops it is not connected to.
+
+		// METHODOLOGY EMPLOYED:
+		// The loop must be a water loop without common pipe or pressure simulation, and all of its components
+		// must be models that only update their own data and the nodes of the plant loops they are on: adiabatic
+		// pipes, pumps, load profiles, district heating and cooling, and fluid to fluid heat exchangers that do
+		// not override another component. Chillers, boilers, storage and the coils of the air side update
+		// module level data of their own, or the air side, and are always simulated in sequence.
+		// Called after the components have been simulated once, so that their indexes are known.
+
+		// Using/Aliasing
+		using PlantHeatExchangerFluidToFluid::FluidHX;
+		using PlantHeatExchangerFluidToFluid::CoolingSetPointOnOffWithComponentOverride;
+
+		auto const & loop( PlantLoop( LoopNum ) );
+		if ( loop.FluidType != NodeType_Water ) return false;
+		if ( loop.CommonPipeType != CommonPipe_No ) return false;
+		if ( ( loop.PressureSimType != Press_NoPressure ) || loop.HasPressureComponents ) return false;
+		for ( int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+			auto const & loop_side( loop.LoopSide( LoopSideNum ) );
+			for ( int BranchNum = 1; BranchNum <= loop_side.TotalBranches; ++BranchNum ) {
+				auto const & branch( loop_side.Branch( BranchNum ) );
+				for ( int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+					auto const & comp( branch.Comp( CompNum ) );
+					{ auto const SELECT_CASE_var( comp.TypeOf_Num );
+					if ( ( SELECT_CASE_var == TypeOf_Pipe ) || ( SELECT_CASE_var == TypeOf_PumpVariableSpeed ) || ( SELECT_CASE_var == TypeOf_PumpConstantSpeed ) || ( SELECT_CASE_var == TypeOf_PumpBankVariableSpeed ) || ( SELECT_CASE_var == TypeOf_PumpBankConstantSpeed ) || ( SELECT_CASE_var == TypeOf_PlantLoadProfile ) || ( SELECT_CASE_var == TypeOf_PurchChilledWater ) || ( SELECT_CASE_var == TypeOf_PurchHotWater ) ) {
+					} else if ( SELECT_CASE_var == TypeOf_FluidToFluidPlantHtExchg ) {
+						if ( comp.CompNum <= 0 ) return false;
+						if ( FluidHX( comp.CompNum ).ControlMode == CoolingSetPointOnOffWithComponentOverride ) return false;
+					} else {
+						return false;
+					}}
+				}
 			}
 		}
+		return true;
 
-		//Also log the convergence history of all loopsides once complete
-		LogPlantConvergencePoints( FirstHVACIteration );
+	}
+
+	void
+	SetupConcurrentPlantLoopGroups(
+		std::vector< std::vector< int > > & HalfLoopGroups, // Half loops of each group simulated concurrently
+		std::vector< int > & SequentialHalfLoopNums // Half loops simulated in sequence
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sorts the half loops into the groups of plant loops that are simulated concurrently
+		// and the half loops that are simulated in sequence.
+
+		// METHODOLOGY EMPLOYED:
+		// Plant loops connected by a component (connected loop sides, e.g. through a heat exchanger or the
+		// condenser of a chiller) are put in the same group, so that a group never updates the data of another.
+		// A group is simulated concurrently if all of its loops can be (see ConcurrentPlantLoop). Each list
+		// keeps the half loops in calling order. Connected loops are not level scheduled: the loops of a group
+		// are always simulated one after the other, and only separate groups run concurrently. Nothing is
+		// simulated concurrently with less than two groups.
+
+		// SUBROUTINE VARIABLE DEFINITIONS
+		Array1D_int LoopGroup( TotNumLoops ); // Lowest loop number of the group of connected plant loops
+		Array1D_bool GroupConcurrent( TotNumLoops, true ); // TRUE if all the loops of the group may be simulated concurrently
+		Array1D_int GroupIndex( TotNumLoops, 0 ); // Index of the group in HalfLoopGroups
+		bool GroupsChanged( true );
+
+		for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) LoopGroup( LoopNum ) = LoopNum;
+		while ( GroupsChanged ) {
+			GroupsChanged = false;
+			for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+				for ( int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+					auto const & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+					for ( int ConnctNum = 1; ConnctNum <= loop_side.TotalConnected; ++ConnctNum ) {
+						int const OtherLoopNum( loop_side.Connected( ConnctNum ).LoopNum );
+						if ( ( OtherLoopNum <= 0 ) || ( LoopGroup( OtherLoopNum ) == LoopGroup( LoopNum ) ) ) continue;
+						LoopGroup( LoopNum ) = LoopGroup( OtherLoopNum ) = min( LoopGroup( LoopNum ), LoopGroup( OtherLoopNum ) );
+						GroupsChanged = true;
+					}
+				}
+			}
+		}
+
+		for ( int LoopNum = 1; LoopNum <= TotNumLoops; ++LoopNum ) {
+			if ( ! ConcurrentPlantLoop( LoopNum ) ) GroupConcurrent( LoopGroup( LoopNum ) ) = false;
+		}
+
+		HalfLoopGroups.clear();
+		SequentialHalfLoopNums.clear();
+		for ( int HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+			int const GroupNum( LoopGroup( PlantCallingOrderInfo( HalfLoopNum ).LoopIndex ) );
+			if ( GroupConcurrent( GroupNum ) ) {
+				if ( GroupIndex( GroupNum ) == 0 ) {
+					HalfLoopGroups.emplace_back();
+					GroupIndex( GroupNum ) = HalfLoopGroups.size();
+				}
+				HalfLoopGroups[ GroupIndex( GroupNum ) - 1 ].push_back( HalfLoopNum );
+			} else {
+				SequentialHalfLoopNums.push_back( HalfLoopNum );
+			}
+		}
+
+		// Nothing to gain from a single independent group
+		if ( HalfLoopGroups.size() < 2u ) {
+			HalfLoopGroups.clear();
+			SequentialHalfLoopNums.clear();
+		}
 
 	}
 
@@ -1948,7 +2178,7 @@ namespace PlantManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Rick Strand
 		//       DATE WRITTEN   July 2001
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; skipped component simulation count
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1970,6 +2200,7 @@ namespace PlantManager {
 		using DataPlant::SupplySide;
 		using DataPlant::DemandOpSchemeType;
 		using DataGlobals::DisplayAdvancedReportVariables;
+		using DataSystemVariables::SkipUnchangedPlantBranchesEnvFlag;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -2043,6 +2274,9 @@ namespace PlantManager {
 			//    CALL SetupOutputVariable('Debug SSOutletNode Temperature[C]', &
 			//           PlantReport(LoopNum)%OutletNodeTemperature,'System','Average',PlantLoop(LoopNum)%Name)
 			SetupOutputVariable( "Debug Plant Last Simulated Loop Side []", PlantReport( LoopNum ).LastLoopSideSimulated, "System", "Average", PlantLoop( LoopNum ).Name );
+			if ( SkipUnchangedPlantBranchesEnvFlag ) {
+				SetupOutputVariable( "Plant Solver Skipped Component Simulation Count []", PlantReport( LoopNum ).SkippedCompSimulations, "HVAC", "Sum", PlantLoop( LoopNum ).Name );
+			}
 		}
 
 		// setup more variables inside plant data structure
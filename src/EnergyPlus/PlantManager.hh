@@ -59,6 +59,9 @@
 #ifndef PlantManager_hh_INCLUDED
 #define PlantManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -164,6 +167,25 @@ namespace PlantManager {
 		bool & SimElecCircuits // True when electic circuits need to be (re)simulated
 	);
 
+	void
+	SimPlantLoopGroup(
+		bool const FirstHVACIteration,
+		std::vector< int > const & HalfLoopNums, // Half loops to simulate, as indexes in PlantCallingOrderInfo
+		int const CurntMinPlantSubIterations, // Minimum number of sub-iterations
+		bool & SimPlantLoops, // True when some of these half loops need to be (re)simulated
+		int & SubIterations, // Number of sub-iterations performed
+		int & HalfLoopCalls // Number of half loop simulations performed
+	);
+
+	bool
+	ConcurrentPlantLoop( int const LoopNum );
+
+	void
+	SetupConcurrentPlantLoopGroups(
+		std::vector< std::vector< int > > & HalfLoopGroups, // Half loops of each group simulated concurrently
+		std::vector< int > & SequentialHalfLoopNums // Half loops simulated in sequence
+	);
+
 	void
 	GetPlantLoopData();
 
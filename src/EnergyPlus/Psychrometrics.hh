@@ -378,7 +378,7 @@ namespace Psychrometrics {
 		// FUNCTION INFORMATION:
 		//       AUTHOR         J. C. VanderZee
 		//       DATE WRITTEN   Feb. 1994
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; per thread saved values (concurrent air loops)
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS FUNCTION:
@@ -391,10 +391,10 @@ namespace Psychrometrics {
 		// see PsyHFnTdbW ref. to ASHRAE Fundamentals
 		// USAGE:  cpa = PsyCpAirFnWTdb(w,T)
 
-		// Static locals
-		static Real64 dwSave( -100.0 );
-		static Real64 Tsave( -100.0 );
-		static Real64 cpaSave( -100.0 );
+		// Static locals (per thread, so that the function can be called concurrently)
+		static thread_local Real64 dwSave( -100.0 );
+		static thread_local Real64 Tsave( -100.0 );
+		static thread_local Real64 cpaSave( -100.0 );
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
@@ -421,10 +421,10 @@ namespace Psychrometrics {
 		// Faster version with humidity ratio already adjusted
 		assert( dw >= 1.0e-5 );
 
-		// Static locals
-		static Real64 dwSave( -100.0 );
-		static Real64 Tsave( -100.0 );
-		static Real64 cpaSave( -100.0 );
+		// Static locals (per thread, so that the function can be called concurrently)
+		static thread_local Real64 dwSave( -100.0 );
+		static thread_local Real64 Tsave( -100.0 );
+		static thread_local Real64 cpaSave( -100.0 );
 
 		// check if last call had the same input and if it did just use the saved output
 		if ( ( Tsave == T ) && ( dwSave == dw ) ) return cpaSave;
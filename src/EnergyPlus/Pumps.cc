@@ -169,12 +169,12 @@ namespace Pumps {
 
 	//simulation and reporting variables
 	//  REAL(r64)           :: OutletTemp                   = 0.0d0  ! pump outlet temperature
-	Real64 PumpMassFlowRate( 0.0 ); // mass flow rate at pump inlet node
+	thread_local Real64 PumpMassFlowRate( 0.0 ); // mass flow rate at pump inlet node
 	//  REAL(r64)           :: PumpPress                    = 0.0d0  ! For Passing around the steam loops
 	//  REAL(r64)           :: PumpQuality                  = 0.0d0  ! For Passing around the steam loops=0.0 here
-	Real64 PumpHeattoFluid( 0.0 ); // Pump Power dissipated in fluid stream
-	Real64 Power( 0.0 ); // Pump Electric power
-	Real64 ShaftPower( 0.0 ); // Power passing through pump shaft
+	thread_local Real64 PumpHeattoFluid( 0.0 ); // Pump Power dissipated in fluid stream
+	thread_local Real64 Power( 0.0 ); // Pump Electric power
+	thread_local Real64 ShaftPower( 0.0 ); // Power passing through pump shaft
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 
@@ -112,12 +112,12 @@ namespace Pumps {
 
 	//simulation and reporting variables
 	//  REAL(r64)           :: OutletTemp                   = 0.0d0  ! pump outlet temperature
-	extern Real64 PumpMassFlowRate; // mass flow rate at pump inlet node
+	extern thread_local Real64 PumpMassFlowRate; // mass flow rate at pump inlet node
 	//  REAL(r64)           :: PumpPress                    = 0.0d0  ! For Passing around the steam loops
 	//  REAL(r64)           :: PumpQuality                  = 0.0d0  ! For Passing around the steam loops=0.0 here
-	extern Real64 PumpHeattoFluid; // Pump Power dissipated in fluid stream
-	extern Real64 Power; // Pump Electric power
-	extern Real64 ShaftPower; // Power passing through pump shaft
+	extern thread_local Real64 PumpHeattoFluid; // Pump Power dissipated in fluid stream
+	extern thread_local Real64 Power; // Pump Electric power
+	extern thread_local Real64 ShaftPower; // Power passing through pump shaft
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 
@@ -1954,6 +1954,53 @@ void SQLite::createSQLiteTabularDataRecords(
 	}
 }
 
+void SQLite::createSQLiteTabularDataRecord(
+	std::string const & cell,
+	std::string const & rowLabel,
+	std::string const & columnLabel,
+	int const rowIndex, // zero based
+	int const columnIndex, // zero based
+	std::string const & reportName,
+	std::string const & reportForString,
+	std::string const & tableName
+)
+{
+	// Single cell form of createSQLiteTabularDataRecords used when tables are streamed
+	if ( m_writeTabularDataToSQLite ) {
+		int const reportNameIndex = createSQLiteStringTableRecord(reportName, ReportNameId);
+		int const reportForStringIndex = createSQLiteStringTableRecord(reportForString, ReportForStringId);
+		int const tableNameIndex = createSQLiteStringTableRecord(tableName, TableNameId);
+
+		std::string colUnits;
+		std::string colDescription;
+		parseUnitsAndDescription(columnLabel, colUnits, colDescription);
+		int const columnLabelIndex = createSQLiteStringTableRecord(colDescription, ColumnNameId);
+
+		std::string rowUnits;
+		std::string rowDescription;
+		parseUnitsAndDescription(rowLabel, rowUnits, rowDescription);
+		int const rowLabelIndex = createSQLiteStringTableRecord(rowDescription, RowNameId);
+
+		int const unitsIndex = createSQLiteStringTableRecord(colUnits.empty() ? rowUnits : colUnits, UnitsId);
+
+		++m_tabularDataIndex;
+		sqliteBindInteger(m_tabularDataInsertStmt,1,m_tabularDataIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,2,reportNameIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,3,reportForStringIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,4,tableNameIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,5,rowLabelIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,6,columnLabelIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,7,unitsIndex);
+		sqliteBindForeignKey(m_tabularDataInsertStmt,8,1);
+		sqliteBindInteger(m_tabularDataInsertStmt,9,rowIndex);
+		sqliteBindInteger(m_tabularDataInsertStmt,10,columnIndex);
+		sqliteBindText(m_tabularDataInsertStmt,11,cell);
+
+		sqliteStepCommand(m_tabularDataInsertStmt);
+		sqliteResetCommand(m_tabularDataInsertStmt);
+	}
+}
+
 int SQLite::createSQLiteStringTableRecord(std::string const & stringValue, int const stringType)
 {
 	int rowId = -1;
@@ -248,6 +248,17 @@ public:
 		std::string const & TableName
 	);
 
+	void createSQLiteTabularDataRecord(
+		std::string const & cell,
+		std::string const & rowLabel,
+		std::string const & columnLabel,
+		int const rowIndex, // zero based
+		int const columnIndex, // zero based
+		std::string const & reportName,
+		std::string const & reportForString,
+		std::string const & tableName
+	);
+
 	void createSQLiteSimulationsRecord( int const ID, const std::string& verString, const std::string& currentDateTime );
 
 	void createSQLiteErrorRecord(
@@ -70,6 +70,7 @@
 // EnergyPlus Headers
 #include <SimAirServingZones.hh>
 #include <BranchInputManager.hh>
+#include <DataAirflowNetwork.hh>
 #include <DataAirLoop.hh>
 #include <DataAirSystems.hh>
 #include <DataContaminantBalance.hh>
@@ -109,6 +110,7 @@
 #include <NodeInputManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <ParallelFor.hh>
 #include <Psychrometrics.hh>
 #include <ReportSizingManager.hh>
 #include <SplitterComponent.hh>
@@ -220,6 +222,56 @@ namespace SimAirServingZones {
 		bool InitAirLoopsBranchSizingFlag( true );
 		Array1D< Real64 > FaByZoneCool; // triggers allocation in UpdateSysSizing
 		Array1D< Real64 > SensCoolCapTemp; // triggers allocation in UpdateSysSizing
+		bool ConcurrentAirLoopsChecked( false ); // TRUE once the air loops that may be simulated concurrently are known
+		Array1D_bool AirLoopSimConcurrent; // TRUE if the air loop is simulated concurrently (see ConcurrentAirLoop)
+		Array1D_int ConcurrentRunLast; // Last air loop of the run of concurrent air loops starting at the air loop, else 0
+		Array1D_int ConcurrentIterMax; // Controller iteration statistics of the concurrently simulated air loops,
+		Array1D_int ConcurrentIterTot; // merged in air loop order by SimAirLoops
+		Array1D_int ConcurrentNumCalls;
+
+		// The module variables the air loop components use to pass values to each other or to the zone
+		// equipment (the fan on/off flags, CurSysNum and the branch being simulated, the last fan and coil
+		// power and run time fractions) are thread_local, since air loops may be simulated concurrently and
+		// each air loop must see its own. The calling thread also works through the concurrent air loops, so
+		// its copies would be left by whichever air loop it happened to simulate last: SimAirLoops saves the
+		// copies each concurrent air loop leaves and passes them to the calling thread in air loop order,
+		// which leaves the values a serial simulation would leave.
+		struct AirLoopThreadState
+		{
+			// Members
+			bool TurnFansOn;
+			bool TurnFansOff;
+			bool NightVentOn;
+			bool LocalTurnFansOn;
+			bool LocalTurnFansOff;
+			bool CoilIsSuppHeater;
+			int CurSysNum;
+			int CurBranchNum;
+			int CurDuctType;
+			Real64 FanElecPower;
+			Real64 ElecHeatingCoilPower;
+			Real64 LoopHeatingCoilMaxRTF;
+			Real64 LoopOnOffFanRTF;
+
+			// Default Constructor
+			AirLoopThreadState() :
+				TurnFansOn( false ),
+				TurnFansOff( false ),
+				NightVentOn( false ),
+				LocalTurnFansOn( false ),
+				LocalTurnFansOff( false ),
+				CoilIsSuppHeater( false ),
+				CurSysNum( 0 ),
+				CurBranchNum( 0 ),
+				CurDuctType( 0 ),
+				FanElecPower( 0.0 ),
+				ElecHeatingCoilPower( 0.0 ),
+				LoopHeatingCoilMaxRTF( 0.0 ),
+				LoopOnOffFanRTF( 0.0 )
+			{}
+
+		};
+		Array1D< AirLoopThreadState > ConcurrentThreadState; // State left by each concurrently simulated air loop
 	}
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -247,6 +299,13 @@ namespace SimAirServingZones {
 		TestUniqueNodesNum = 0;
 		FaByZoneCool.deallocate(); // triggers allocation in UpdateSysSizing
 		SensCoolCapTemp.deallocate(); // triggers allocation in UpdateSysSizing
+		ConcurrentAirLoopsChecked = false;
+		AirLoopSimConcurrent.deallocate();
+		ConcurrentRunLast.deallocate();
+		ConcurrentIterMax.deallocate();
+		ConcurrentIterTot.deallocate();
+		ConcurrentNumCalls.deallocate();
+		ConcurrentThreadState.deallocate();
 	}
 
 	void
@@ -2118,6 +2177,8 @@ namespace SimAirServingZones {
 		//           MODIFIED:  Dec 1999 Fred Buhl
 		//           MODIFIED:  Feb 2006 Dimitri Curtil (LBNL)
 		//                      - Moved air loop simulation to SimAirLoop() routine.
+		//           MODIFIED:  Oct 2026
+		//                      - Independent air loops may be simulated concurrently (PARALLEL_AIRLOOPS).
 		//      RE-ENGINEERED:  This is new code, not reengineered
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2135,12 +2196,25 @@ namespace SimAirServingZones {
 		// (4) A mass balance check is performed; if it fails, mass balance is imposed
 		//     and steps 1, 2, and 3 are repeated. At the end we should have a correct,
 		//     self consistent primary air system simulation.
+		// When PARALLEL_AIRLOOPS is set, each run of consecutive air loops that share no state with the
+		// rest of the simulation (see ConcurrentAirLoop) is simulated concurrently when the loop over the
+		// air loops reaches it. Their statistics, outlet conditions and thread_local state are then passed
+		// on in air loop order, so results do not depend on the number of threads. Air loops with an
+		// outdoor air system, DX coils or water coils never qualify, so typical packaged VAV and central
+		// VAV models are simulated in sequence as before.
 
 		// REFERENCES: None
 
 		// Using/Aliasing
 		using HVACInterfaceManager::UpdateHVACInterface;
 		using General::GetPreviousHVACTime;
+		using DataSystemVariables::ParallelAirLoopsEnvFlag;
+		using DataSystemVariables::NumberParallelThreads;
+		using DataSystemVariables::TrackAirLoopEnvFlag;
+		using DataSystemVariables::TraceAirLoopEnvFlag;
+		using DataSystemVariables::TraceHVACControllerEnvFlag;
+		using DataAirflowNetwork::SimulateAirflowNetwork;
+		using DataAirflowNetwork::AirflowNetworkControlSimple;
 		using DataConvergParams::CalledFromAirSystemSupplySideDeck1;
 		using DataConvergParams::CalledFromAirSystemSupplySideDeck2;
 
@@ -2176,12 +2250,8 @@ namespace SimAirServingZones {
 		int AirLoopNumCalls;
 		// Primary air system outlet DO loop index
 		int AirSysOutNum;
-		// DO loop index; there are 2 passes - the 2nd is done only if mass balance fails
-		int AirLoopPass;
 		// Output variable setup flag
 		static bool OutputSetupFlag( false );
-		// Flag set by ResolveSysFlow; if TRUE, mass balance failed and there must be a second pass
-		bool SysReSim;
 		int CalledFrom;
 
 		// FLOW:
@@ -2212,53 +2282,94 @@ namespace SimAirServingZones {
 			}
 		}
 
+		// Simulate the independent air loops concurrently; one-time initializations, sizing and
+		// debugging traces are done with all air loops in sequence
+		bool const SimConcurrent( ParallelAirLoopsEnvFlag && ( NumberParallelThreads > 1 ) && ! BeginEnvrnFlag && ! KickOffSimulation && ! DoingSizing && ! ZoneSizingCalc && ! SysSizingCalc && ! TrackAirLoopEnvFlag && ! TraceAirLoopEnvFlag && ! TraceHVACControllerEnvFlag && ( SimulateAirflowNetwork <= AirflowNetworkControlSimple ) );
+		if ( SimConcurrent ) {
+			if ( ! ConcurrentAirLoopsChecked ) {
+				AirLoopSimConcurrent.dimension( NumPrimaryAirSys, false );
+				ConcurrentRunLast.dimension( NumPrimaryAirSys, 0 );
+				ConcurrentIterMax.dimension( NumPrimaryAirSys, 0 );
+				ConcurrentIterTot.dimension( NumPrimaryAirSys, 0 );
+				ConcurrentNumCalls.dimension( NumPrimaryAirSys, 0 );
+				ConcurrentThreadState.allocate( NumPrimaryAirSys );
+				for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+					AirLoopSimConcurrent( AirLoopNum ) = ConcurrentAirLoop( AirLoopNum );
+				}
+				// Group the concurrent air loops into runs of consecutive air loops, so that the air loops
+				// are still simulated in order; nothing to gain from a run of a single air loop
+				for ( int RunFirst = 1, RunLast; RunFirst <= NumPrimaryAirSys; RunFirst = RunLast + 1 ) {
+					RunLast = RunFirst;
+					if ( ! AirLoopSimConcurrent( RunFirst ) ) continue;
+					while ( ( RunLast < NumPrimaryAirSys ) && AirLoopSimConcurrent( RunLast + 1 ) ) ++RunLast;
+					if ( RunLast > RunFirst ) {
+						ConcurrentRunLast( RunFirst ) = RunLast;
+					} else {
+						AirLoopSimConcurrent( RunFirst ) = false;
+					}
+				}
+				ConcurrentAirLoopsChecked = true;
+			}
+		}
+
 		// Loop over all the primary air loop; simulate their components (equipment)
 		// and controllers
 		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) { // NumPrimaryAirSys is the number of primary air loops
 
-			// Check to see if System Availability Managers are asking for fans to cycle on or shut off
-			// and set fan on/off flags accordingly.
-			TurnFansOn = false;
-			TurnFansOff = false;
-			NightVentOn = false;
-			if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == CycleOn ) {
-				TurnFansOn = true;
+			// Simulate a run of concurrent air loops when reaching its first air loop
+			if ( SimConcurrent && ( ConcurrentRunLast( AirLoopNum ) > 0 ) ) {
+				ParallelFor( AirLoopNum, ConcurrentRunLast( AirLoopNum ), [&]( int const LoopNum ){
+					SetAirLoopSimFlags( LoopNum );
+					SimAirLoopPasses( FirstHVACIteration, LoopNum, ConcurrentIterMax( LoopNum ), ConcurrentIterTot( LoopNum ), ConcurrentNumCalls( LoopNum ) );
+					auto & state( ConcurrentThreadState( LoopNum ) );
+					state.TurnFansOn = TurnFansOn;
+					state.TurnFansOff = TurnFansOff;
+					state.NightVentOn = NightVentOn;
+					state.LocalTurnFansOn = Fans::LocalTurnFansOn;
+					state.LocalTurnFansOff = Fans::LocalTurnFansOff;
+					state.CoilIsSuppHeater = HeatingCoils::CoilIsSuppHeater;
+					state.CurSysNum = CurSysNum;
+					state.CurBranchNum = CurBranchNum;
+					state.CurDuctType = CurDuctType;
+					state.FanElecPower = FanElecPower;
+					state.ElecHeatingCoilPower = ElecHeatingCoilPower;
+					state.LoopHeatingCoilMaxRTF = LoopHeatingCoilMaxRTF;
+					state.LoopOnOffFanRTF = LoopOnOffFanRTF;
+				} );
 			}
-			if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == ForceOff ) {
-				TurnFansOff = true;
-			}
-			if ( AirLoopControlInfo( AirLoopNum ).NightVent ) {
-				NightVentOn = true;
-			}
-
-			//   Set current system number for sizing routines
-			CurSysNum = AirLoopNum;
 
-			// 2 passes; 1 usually suffices; 2 is done if ResolveSysFlow detects a failure of mass balance
-			for ( AirLoopPass = 1; AirLoopPass <= 2; ++AirLoopPass ) {
-
-				SysReSim = false;
-
-				// Simulate controllers on air loop with current air mass flow rates
-				SimAirLoop( FirstHVACIteration, AirLoopNum, AirLoopPass, AirLoopIterMax, AirLoopIterTot, AirLoopNumCalls );
-
-				// Update tracker for maximum number of iterations needed by any controller on all air loops
-				IterMax = max( IterMax, AirLoopIterMax );
-				// Update tracker for aggregated number of iterations needed by all controllers on all air loops
-				IterTot += AirLoopIterTot;
-				// Update tracker for total number of times SimAirLoopComponents() has been invoked across all air loops
-				NumCallsTot += AirLoopNumCalls;
-
-				// At the end of the first pass, check whether a second pass is needed or not
-				if ( AirLoopPass == 1 ) {
-					// If simple system, skip second pass
-					if ( AirLoopControlInfo( AirLoopNum ).Simple ) break;
-					ResolveSysFlow( AirLoopNum, SysReSim );
-					// If mass balance OK, skip second pass
-					if ( ! SysReSim ) break;
-				}
+			if ( SimConcurrent && AirLoopSimConcurrent( AirLoopNum ) ) {
+				// Pass on the state left by the air loop as if it had been simulated here
+				auto const & state( ConcurrentThreadState( AirLoopNum ) );
+				TurnFansOn = state.TurnFansOn;
+				TurnFansOff = state.TurnFansOff;
+				NightVentOn = state.NightVentOn;
+				Fans::LocalTurnFansOn = state.LocalTurnFansOn;
+				Fans::LocalTurnFansOff = state.LocalTurnFansOff;
+				HeatingCoils::CoilIsSuppHeater = state.CoilIsSuppHeater;
+				CurSysNum = state.CurSysNum;
+				CurBranchNum = state.CurBranchNum;
+				CurDuctType = state.CurDuctType;
+				FanElecPower = state.FanElecPower;
+				ElecHeatingCoilPower = state.ElecHeatingCoilPower;
+				LoopHeatingCoilMaxRTF = max( LoopHeatingCoilMaxRTF, state.LoopHeatingCoilMaxRTF ); // maximum over all the air loops
+				LoopOnOffFanRTF = state.LoopOnOffFanRTF;
+				AirLoopIterMax = ConcurrentIterMax( AirLoopNum );
+				AirLoopIterTot = ConcurrentIterTot( AirLoopNum );
+				AirLoopNumCalls = ConcurrentNumCalls( AirLoopNum );
+			} else {
+				// Fan on/off flags and current system number
+				SetAirLoopSimFlags( AirLoopNum );
+				SimAirLoopPasses( FirstHVACIteration, AirLoopNum, AirLoopIterMax, AirLoopIterTot, AirLoopNumCalls );
 			}
 
+			// Update tracker for maximum number of iterations needed by any controller on all air loops
+			IterMax = max( IterMax, AirLoopIterMax );
+			// Update tracker for aggregated number of iterations needed by all controllers on all air loops
+			IterTot += AirLoopIterTot;
+			// Update tracker for total number of times SimAirLoopComponents() has been invoked across all air loops
+			NumCallsTot += AirLoopNumCalls;
+
 			// Air system side has been simulated, now transfer conditions across to
 			// the zone equipment side, looping through all supply air paths for this
 			// air loop.
@@ -2275,6 +2386,165 @@ namespace SimAirServingZones {
 
 	}
 
+	void
+	SetAirLoopSimFlags( int const AirLoopNum )
+	{
+
+		// SUBROUTINE INFORMATION
+		//             AUTHOR:  na
+		//       DATE WRITTEN:  Oct 2026
+		//           MODIFIED:
+		//      RE-ENGINEERED:  This is code that used to be part of SimAirLoops()
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the fan on/off flags and the current system number before simulating an air loop.
+
+		// METHODOLOGY EMPLOYED:
+		// The flags are thread_local, so an air loop simulated concurrently sets its own copy.
+
+		// REFERENCES: None
+
+		// Check to see if System Availability Managers are asking for fans to cycle on or shut off
+		// and set fan on/off flags accordingly.
+		TurnFansOn = false;
+		TurnFansOff = false;
+		NightVentOn = false;
+		if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == CycleOn ) {
+			TurnFansOn = true;
+		}
+		if ( PriAirSysAvailMgr( AirLoopNum ).AvailStatus == ForceOff ) {
+			TurnFansOff = true;
+		}
+		if ( AirLoopControlInfo( AirLoopNum ).NightVent ) {
+			NightVentOn = true;
+		}
+
+		//   Set current system number for sizing routines
+		CurSysNum = AirLoopNum;
+
+	}
+
+	void
+	SimAirLoopPasses(
+		bool const FirstHVACIteration,
+		int const AirLoopNum,
+		int & AirLoopIterMax,
+		int & AirLoopIterTot,
+		int & AirLoopNumCalls
+	)
+	{
+
+		// SUBROUTINE INFORMATION
+		//             AUTHOR:  na
+		//       DATE WRITTEN:  Oct 2026
+		//           MODIFIED:
+		//      RE-ENGINEERED:  This is code that used to be part of SimAirLoops()
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Simulates one air loop with its controllers, with a second pass if the mass balance fails.
+
+		// METHODOLOGY EMPLOYED:
+		// Only touches the data of this air loop, so that independent air loops can be simulated
+		// concurrently. The controller statistics are returned summed (maximum) over the passes.
+
+		// REFERENCES: None
+
+		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
+		// Max number of iterations performed by controllers in one pass
+		int PassIterMax;
+		// Aggregated number of iterations across all controllers in one pass
+		int PassIterTot;
+		// Number of times SimAirLoopComponents() has been invoked in one pass
+		int PassNumCalls;
+		// Flag set by ResolveSysFlow; if TRUE, mass balance failed and there must be a second pass
+		bool SysReSim;
+
+		AirLoopIterMax = 0;
+		AirLoopIterTot = 0;
+		AirLoopNumCalls = 0;
+
+		// 2 passes; 1 usually suffices; 2 is done if ResolveSysFlow detects a failure of mass balance
+		for ( int AirLoopPass = 1; AirLoopPass <= 2; ++AirLoopPass ) {
+
+			SysReSim = false;
+
+			// Simulate controllers on air loop with current air mass flow rates
+			SimAirLoop( FirstHVACIteration, AirLoopNum, AirLoopPass, PassIterMax, PassIterTot, PassNumCalls );
+
+			AirLoopIterMax = max( AirLoopIterMax, PassIterMax );
+			AirLoopIterTot += PassIterTot;
+			AirLoopNumCalls += PassNumCalls;
+
+			// At the end of the first pass, check whether a second pass is needed or not
+			if ( AirLoopPass == 1 ) {
+				// If simple system, skip second pass
+				if ( AirLoopControlInfo( AirLoopNum ).Simple ) break;
+				ResolveSysFlow( AirLoopNum, SysReSim );
+				// If mass balance OK, skip second pass
+				if ( ! SysReSim ) break;
+			}
+		}
+
+	}
+
+	bool
+	ConcurrentAirLoop( int const AirLoopNum )
+	{
+
+		// FUNCTION INFORMATION
+		//             AUTHOR:  na
+		//       DATE WRITTEN:  Oct 2026
+		//           MODIFIED:
+		//      RE-ENGINEERED:  This is new code
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns true if the air loop can be simulated concurrently with other air loops.
+
+		// METHODOLOGY EMPLOYED:
+		// The air loop must not have controllers (which actuate plant demand side flows) and all of
+		// its components must be models that only update their own data and the nodes of the air loop:
+		// constant volume and variable volume fans without fouling air filter, electric heating coils and
+		// fuel heating coils without part load curve (curve evaluation updates the shared curve data),
+		// and ducts. The outdoor air system, DX systems, unitary systems and water coils update
+		// module level data of their own and are always simulated in sequence.
+		// Called after the components have been simulated once, so that their indexes are known.
+
+		// REFERENCES: None
+
+		// Using/Aliasing
+		using DataHVACGlobals::FanType_SimpleConstVolume;
+		using DataHVACGlobals::FanType_SimpleVAV;
+		using DataHVACGlobals::Coil_HeatingElectric;
+		using DataHVACGlobals::Coil_HeatingGasOrOtherFuel;
+
+		auto const & airLoop( PrimaryAirSystem( AirLoopNum ) );
+		if ( airLoop.NumControllers > 0 ) return false;
+		for ( int BranchNum = 1; BranchNum <= airLoop.NumBranches; ++BranchNum ) {
+			for ( int CompNum = 1; CompNum <= airLoop.Branch( BranchNum ).TotalComponents; ++CompNum ) {
+				auto const & comp( airLoop.Branch( BranchNum ).Comp( CompNum ) );
+				if ( comp.CompIndex <= 0 ) return false;
+				{ auto const SELECT_CASE_var( comp.CompType_Num );
+				if ( ( SELECT_CASE_var == Fan_Simple_CV ) || ( SELECT_CASE_var == Fan_Simple_VAV ) ) {
+					auto const & fan( Fans::Fan( comp.CompIndex ) );
+					if ( ( fan.FanType_Num != FanType_SimpleConstVolume ) && ( fan.FanType_Num != FanType_SimpleVAV ) ) return false;
+					if ( fan.FaultyFilterFlag ) return false;
+				} else if ( ( SELECT_CASE_var == Coil_ElectricHeat ) || ( SELECT_CASE_var == Coil_GasHeat ) ) {
+					auto const & coil( HeatingCoils::HeatingCoil( comp.CompIndex ) );
+					if ( coil.HCoilType_Num == Coil_HeatingGasOrOtherFuel ) {
+						if ( coil.PLFCurveIndex > 0 ) return false;
+					} else if ( coil.HCoilType_Num != Coil_HeatingElectric ) {
+						return false;
+					}
+				} else if ( SELECT_CASE_var == Duct ) {
+				} else {
+					return false;
+				}}
+			}
+		}
+		return true;
+
+	}
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
@@ -2292,6 +2562,8 @@ namespace SimAirServingZones {
 		//                      - Fine-tuned outer loop over controllers.
 		//                      - Added convergence tracing for air loop controllers.
 		//                      - Added mechanism for speculative warm restart after first iteration.
+		//           MODIFIED:  Oct 2026
+		//                      - No static locals (concurrent air loops).
 		//      RE-ENGINEERED:  This is new code based on the code that used to be part
 		//                      of SimAirLoops().
 
@@ -2333,19 +2605,19 @@ namespace SimAirServingZones {
 
 		// SUBROUTINE LOCAL VARIABLE DEFINITIONS
 		// Maximum number of iterations performed by each controller on this air loop
-		static int IterMax( 0 );
+		int IterMax( 0 );
 		// Aggregated number of iterations performed by each controller on this air loop
-		static int IterTot( 0 );
+		int IterTot( 0 );
 		// Number of times SimAirLoopComponents() has been invoked per air loop for either Solve or ReSolve operations
-		static int NumCalls( 0 );
+		int NumCalls( 0 );
 		// TRUE when primary air system & controllers simulation has converged;
-		static bool AirLoopConvergedFlag( false );
+		bool AirLoopConvergedFlag( false );
 		// TRUE when speculative warm restart is allowed; FALSE otherwise.
-		static bool DoWarmRestartFlag( false );
+		bool DoWarmRestartFlag( false );
 		// If Status<0, no speculative warm restart attempted.
 		// If Status==0, warm restart failed.
 		// If Status>0, warm restart succeeded.
-		static int WarmRestartStatus( iControllerWarmRestartNone );
+		int WarmRestartStatus( iControllerWarmRestartNone );
 
 		// FLOW:
 
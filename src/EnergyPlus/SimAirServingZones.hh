@@ -158,6 +158,21 @@ namespace SimAirServingZones {
 		bool & SimZoneEquipment
 	);
 
+	void
+	SetAirLoopSimFlags( int const AirLoopNum );
+
+	void
+	SimAirLoopPasses(
+		bool const FirstHVACIteration,
+		int const AirLoopNum,
+		int & AirLoopIterMax,
+		int & AirLoopIterTot,
+		int & AirLoopNumCalls
+	);
+
+	bool
+	ConcurrentAirLoop( int const AirLoopNum );
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
@@ -1361,6 +1361,9 @@ namespace SimulationManager {
 		}
 		gio::write( OutputFileBNDetails, fmtA ) << "Program Version," + VerString;
 
+		// Format and write the eso/mtr report records on their own thread
+		if ( DataSystemVariables::NumberParallelThreads > 1 ) OutputProcessor::StartReportWriter();
+
 	}
 
 	void
@@ -1437,6 +1440,8 @@ namespace SimulationManager {
 		std::string cepEnvSetThreads;
 		std::string cIDFSetThreads;
 
+		OutputProcessor::StopReportWriter(); // Write the outstanding eso/mtr report records first
+
 		EchoInputFile = FindUnitNumber( DataStringGlobals::outputAuditFileName );
 		// Record some items on the audit file
 		gio::write( EchoInputFile, fmtLD ) << "NumOfRVariable=" << NumOfRVariable_Setup;
@@ -75,6 +75,7 @@
 #include <General.hh>
 #include <PierceSurface.hh>
 #include <ScheduleManager.hh>
+#include <SurfaceBVH.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -642,7 +643,7 @@ namespace SolarReflectionManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann, derived from original CalcBeamSolDiffuseReflFactors
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, surface BVH search for obstructions
 		//       RE-ENGINEERED  B. Griffith, October 2012, revised for timestep integrated solar
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -786,33 +787,61 @@ namespace SolarReflectionManager {
 					// To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
 					//  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
 					hit = false;
-					for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-						//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
-						//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
-
-						//CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
-						if ( HitPtSurfNum > 0 ) {
-							if ( Surface( HitPtSurfNum ).MirroredSurf ) {
-								if ( ObsSurfNum == HitPtSurfNum - 1 ) continue;
+					if ( surfaceBVH.empty() ) { // Linear search through surfaces
+						for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+							//        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
+							//          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
+
+							//CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
+							if ( HitPtSurfNum > 0 ) {
+								if ( Surface( HitPtSurfNum ).MirroredSurf ) {
+									if ( ObsSurfNum == HitPtSurfNum - 1 ) continue;
+								}
 							}
+
+							// skip the hit surface
+							if ( ObsSurfNum == HitPtSurfNum ) continue;
+
+							// skip mirrored surfaces
+							if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
+							//IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
+							//  CYCLE
+							//ENDIF
+
+							// skip interior surfaces
+							if ( Surface( ObsSurfNum ).ExtBoundCond >= 1 ) continue;
+
+							// For now it is assumed that obstructions that are shading surfaces are opaque.
+							// An improvement here would be to allow these to have transmittance.
+							PierceSurface( ObsSurfNum, OriginThisRay, SunVec, ObsHitPt, hit );
+							if ( hit ) break; // An obstruction was hit
 						}
+					} else { // Surface BVH search
+						// Lambda function for the BVH to test for an obstruction hit
+						auto obstructionHit = [&]( int const iObsSurf ) -> bool {
+							// The other side of a mirrored surface cannot obstruct the mirrored surface
+							if ( HitPtSurfNum > 0 ) {
+								if ( Surface( HitPtSurfNum ).MirroredSurf ) {
+									if ( iObsSurf == HitPtSurfNum - 1 ) return false;
+								}
+							}
+
+							// skip the hit surface
+							if ( iObsSurf == HitPtSurfNum ) return false;
 
-						// skip the hit surface
-						if ( ObsSurfNum == HitPtSurfNum ) continue;
+							// skip mirrored surfaces
+							if ( Surface( iObsSurf ).MirroredSurf ) return false;
 
-						// skip mirrored surfaces
-						if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
-						//IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
-						//  CYCLE
-						//ENDIF
+							// skip interior surfaces
+							if ( Surface( iObsSurf ).ExtBoundCond >= 1 ) return false;
 
-						// skip interior surfaces
-						if ( Surface( ObsSurfNum ).ExtBoundCond >= 1 ) continue;
+							// Shading surfaces are assumed to be opaque as in the linear search
+							PierceSurface( iObsSurf, OriginThisRay, SunVec, ObsHitPt, hit );
+							return hit;
+						};
 
-						// For now it is assumed that obstructions that are shading surfaces are opaque.
-						// An improvement here would be to allow these to have transmittance.
-						PierceSurface( ObsSurfNum, OriginThisRay, SunVec, ObsHitPt, hit );
-						if ( hit ) break; // An obstruction was hit
+						// Check BVH surface candidates until a hit is found, if any
+						surfaceBVH.hasSurfaceRayIntersects( OriginThisRay, SunVec, obstructionHit );
 					}
 					if ( hit ) continue; // Sun does not reach this ray's hit point
 
@@ -923,7 +952,7 @@ namespace SolarReflectionManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   September 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, surface BVH search for obstructions
 		//       RE-ENGINEERED  B. Griffith, October 2012, for timestep integrated solar
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1050,19 +1079,40 @@ namespace SolarReflectionManager {
 										}
 									}
 								} else { // Reflecting surface is a building shade
-									for ( int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
-										if ( ObsSurfNum == ReflSurfNum ) continue;
+									if ( surfaceBVH.empty() ) { // Linear search through surfaces
+										for ( int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+											if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
+											if ( ObsSurfNum == ReflSurfNum ) continue;
+
+											//TH2 CR8959 -- Skip mirrored surfaces
+											if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
+											//TH2 CR8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
+											if ( Surface( ReflSurfNum ).MirroredSurf ) {
+												if ( ObsSurfNum == ReflSurfNum - 1 ) continue;
+											}
 
-										//TH2 CR8959 -- Skip mirrored surfaces
-										if ( Surface( ObsSurfNum ).MirroredSurf ) continue;
-										//TH2 CR8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
-										if ( Surface( ReflSurfNum ).MirroredSurf ) {
-											if ( ObsSurfNum == ReflSurfNum - 1 ) continue;
+											PierceSurface( ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs );
+											if ( hitObs ) break;
 										}
+									} else { // Surface BVH search
+										// Lambda function for the BVH to test for an obstruction hit
+										auto obstructionHit = [&]( int const ObsSurfNum ) -> bool {
+											if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) return false;
+											if ( ObsSurfNum == ReflSurfNum ) return false;
+
+											// Skip mirrored surfaces
+											if ( Surface( ObsSurfNum ).MirroredSurf ) return false;
+											// The other side of a mirrored surface cannot obstruct the mirrored surface
+											if ( Surface( ReflSurfNum ).MirroredSurf ) {
+												if ( ObsSurfNum == ReflSurfNum - 1 ) return false;
+											}
 
-										PierceSurface( ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs );
-										if ( hitObs ) break;
+											PierceSurface( ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs );
+											return hitObs;
+										};
+
+										// Check BVH surface candidates until a hit is found, if any
+										surfaceBVH.hasSurfaceRayIntersects( HitPtRefl, SunVec, obstructionHit );
 									}
 								}
 
@@ -1115,7 +1165,7 @@ namespace SolarReflectionManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Fred Winkelmann
 		//       DATE WRITTEN   October 2003
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, surface BVH search for obstructions
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1250,22 +1300,46 @@ namespace SolarReflectionManager {
 								URay.y = CPhi * std::sin( Theta );
 								// Does this ray hit an obstruction?
 								hitObs = false;
-								for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
-									if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
-									// Horizontal roof surfaces cannot be obstructions for rays from ground
-									if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
-									if ( ! Surface( ObsSurfNum ).ShadowingSurf ) {
-										if ( dot( URay, Surface( ObsSurfNum ).OutNormVec ) >= 0.0 ) continue;
-										// Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
-										// case where ground hit point is in back of ObsSurfNum
-										if ( Surface( ObsSurfNum ).Tilt > 89.0 && Surface( ObsSurfNum ).Tilt < 91.0 ) {
-											SurfVert = Surface( ObsSurfNum ).Vertex( 2 );
-											SurfVertToGndPt = HitPtRefl - SurfVert;
-											if ( dot( SurfVertToGndPt, Surface( ObsSurfNum ).OutNormVec ) < 0.0 ) continue;
+								if ( surfaceBVH.empty() ) { // Linear search through surfaces
+									for ( ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum ) {
+										if ( ! Surface( ObsSurfNum ).ShadowSurfPossibleObstruction ) continue;
+										// Horizontal roof surfaces cannot be obstructions for rays from ground
+										if ( Surface( ObsSurfNum ).Tilt < 5.0 ) continue;
+										if ( ! Surface( ObsSurfNum ).ShadowingSurf ) {
+											if ( dot( URay, Surface( ObsSurfNum ).OutNormVec ) >= 0.0 ) continue;
+											// Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
+											// case where ground hit point is in back of ObsSurfNum
+											if ( Surface( ObsSurfNum ).Tilt > 89.0 && Surface( ObsSurfNum ).Tilt < 91.0 ) {
+												SurfVert = Surface( ObsSurfNum ).Vertex( 2 );
+												SurfVertToGndPt = HitPtRefl - SurfVert;
+												if ( dot( SurfVertToGndPt, Surface( ObsSurfNum ).OutNormVec ) < 0.0 ) continue;
+											}
 										}
+										PierceSurface( ObsSurfNum, HitPtRefl, URay, HitPtObs, hitObs );
+										if ( hitObs ) break;
 									}
-									PierceSurface( ObsSurfNum, HitPtRefl, URay, HitPtObs, hitObs );
-									if ( hitObs ) break;
+								} else { // Surface BVH search
+									// Lambda function for the BVH to test for an obstruction hit
+									auto obstructionHit = [&]( int const iObsSurf ) -> bool {
+										if ( ! Surface( iObsSurf ).ShadowSurfPossibleObstruction ) return false;
+										// Horizontal roof surfaces cannot be obstructions for rays from ground
+										if ( Surface( iObsSurf ).Tilt < 5.0 ) return false;
+										if ( ! Surface( iObsSurf ).ShadowingSurf ) {
+											if ( dot( URay, Surface( iObsSurf ).OutNormVec ) >= 0.0 ) return false;
+											// Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
+											// case where ground hit point is in back of iObsSurf
+											if ( Surface( iObsSurf ).Tilt > 89.0 && Surface( iObsSurf ).Tilt < 91.0 ) {
+												SurfVert = Surface( iObsSurf ).Vertex( 2 );
+												SurfVertToGndPt = HitPtRefl - SurfVert;
+												if ( dot( SurfVertToGndPt, Surface( iObsSurf ).OutNormVec ) < 0.0 ) return false;
+											}
+										}
+										PierceSurface( iObsSurf, HitPtRefl, URay, HitPtObs, hitObs );
+										return hitObs;
+									};
+
+									// Check BVH surface candidates until a hit is found, if any
+									surfaceBVH.hasSurfaceRayIntersects( HitPtRefl, URay, obstructionHit );
 								}
 								if ( hitObs ) continue; // Obstruction hit
 								// Sky is hit
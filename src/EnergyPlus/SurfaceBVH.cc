@@ -0,0 +1,181 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus Headers
+#include <EnergyPlus/SurfaceBVH.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1.hh>
+
+// C++ Headers
+#include <algorithm>
+
+namespace EnergyPlus {
+
+// Package: Surface Bounding Volume Hierarchy
+//
+// Purpose: Spatial sort of surfaces for fast ray and segment obstruction queries in daylighting and solar reflection
+//
+// History:
+//  Oct 2026: Initial release
+//
+// Notes:
+//  Binary tree of axis-aligned bounding boxes built once from the surface vertices after the surface input is processed
+//  Each surface is in exactly one leaf so a query visits a surface at most once: no candidate set deduplication is needed
+//  Interior nodes are split at the median surface box center along the longest axis of the box center extent
+//  Nodes are stored depth-first in a flat array with the first child following its parent for cache-friendly traversal
+//  Queries report surface numbers so callers can apply the same filters as their linear search loops:
+//   The BVH only culls surfaces whose bounding box the ray or segment misses, so PierceSurface still decides hits
+//   Transparent surfaces are included since some callers treat them as obstructions
+//  Surfaces without vertices are omitted
+//  Bounding boxes are padded slightly so rays grazing a surface edge are still passed to PierceSurface
+//  The BVH holds surface numbers into the array it was built from so it must be rebuilt if surfaces are added or moved
+//  Compared to the octree it replaces the tighter, overlapping boxes give fewer candidate surfaces per ray and the
+//   surfaces straddling octree cube boundaries no longer accumulate in the upper cubes
+
+	// Surfaces Initialization
+	void
+	SurfaceBVH::
+	init( ObjexxFCL::Array1< Surface > const & surfaces )
+	{
+		clear();
+		Items items;
+		items.reserve( surfaces.size() );
+		for ( int iSurf = surfaces.l(), eSurf = surfaces.u(); iSurf <= eSurf; ++iSurf ) {
+			auto const & vertices( surfaces( iSurf ).Vertex );
+			if ( vertices.size() < 3u ) continue; // Skip no-vertex "surfaces"
+			Item item;
+			item.l = item.u = vertices[ 0 ];
+			for ( auto const & vertex : vertices ) { // Expand box to hold surface vertices
+				item.l.min( vertex );
+				item.u.max( vertex );
+			}
+			item.l -= pad_;
+			item.u += pad_;
+			item.c = cen( item.l, item.u );
+			item.iSurf = iSurf;
+			items.push_back( item );
+		}
+		if ( items.empty() ) return;
+
+		nodes_.reserve( 2 * items.size() );
+		build( items, 0u, items.size(), 0 );
+		surfaceNums_.reserve( items.size() );
+		for ( Item const & item : items ) surfaceNums_.push_back( item.iSurf );
+	}
+
+	// Build Sub-Tree for Items [b,e) and Return its Node Index
+	int
+	SurfaceBVH::
+	build( Items & items, size_type const b, size_type const e, int const depth )
+	{
+		assert( b < e );
+		int const iNode( static_cast< int >( nodes_.size() ) );
+		nodes_.push_back( Node() );
+
+		// Bounding box of the surfaces and of their centers
+		Vertex l( items[ b ].l ), u( items[ b ].u );
+		Vertex cl( items[ b ].c ), cu( items[ b ].c );
+		for ( size_type k = b + 1; k < e; ++k ) {
+			Item const & item( items[ k ] );
+			l.min( item.l );
+			u.max( item.u );
+			cl.min( item.c );
+			cu.max( item.c );
+		}
+		nodes_[ iNode ].l = l;
+		nodes_[ iNode ].u = u;
+
+		// Split axis is the longest extent of the box centers
+		Vertex const extent( cu - cl );
+		std::uint8_t const axis( extent.x >= extent.y ? ( extent.x >= extent.z ? 0u : 2u ) : ( extent.y >= extent.z ? 1u : 2u ) );
+		if ( ( e - b <= maxLeafSurfaces_ ) || ( depth >= maxDepth_ ) || ( extent[ axis ] == 0.0 ) ) { // Leaf
+			nodes_[ iNode ].i = static_cast< int >( b );
+			nodes_[ iNode ].n = static_cast< int >( e - b );
+			nodes_[ iNode ].axis = 0u;
+			return iNode;
+		}
+
+		// Split at the median box center
+		size_type const m( b + ( ( e - b ) / 2 ) );
+		std::nth_element( items.begin() + b, items.begin() + m, items.begin() + e, [axis]( Item const & i1, Item const & i2 ){ return i1.c[ axis ] < i2.c[ axis ]; } );
+		build( items, b, m, depth + 1 ); // First child follows this node
+		int const i2( build( items, m, e, depth + 1 ) );
+		nodes_[ iNode ].i = i2;
+		nodes_[ iNode ].n = 0;
+		nodes_[ iNode ].axis = axis;
+		return iNode;
+	}
+
+	// Static Data Member Definitions
+	int const SurfaceBVH::maxDepth_; // Max tree depth
+	SurfaceBVH::size_type const SurfaceBVH::maxLeafSurfaces_ = 4u; // Max surfaces in a leaf
+	SurfaceBVH::Real const SurfaceBVH::pad_ = 1.0e-6; // Bounding box padding (m)
+
+	// Surface count crossover for using the BVH
+	// The BVH gives lower computational complexity for much higher performance as the surface count
+	//  increases but its traversal has some overhead so the direct loop can be faster for small models.
+	// This is the crossover that was used for the octree that the BVH replaces: it is conservative
+	//  since the BVH culls more surfaces per ray than the octree did.
+	SurfaceBVH::size_type const SurfaceBVH::crossover = 100u;
+
+// Globals
+SurfaceBVH surfaceBVH;
+
+} // EnergyPlus
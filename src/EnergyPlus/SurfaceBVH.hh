@@ -0,0 +1,345 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+#ifndef EnergyPlus_SurfaceBVH_hh_INCLUDED
+#define EnergyPlus_SurfaceBVH_hh_INCLUDED
+
+// EnergyPlus Headers
+#include <EnergyPlus/EnergyPlus.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1.fwd.hh>
+#include <ObjexxFCL/Vector3.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace EnergyPlus {
+
+// Forward
+namespace DataSurfaces { struct SurfaceData; }
+
+// Package: Surface Bounding Volume Hierarchy
+//
+// Purpose: Spatial sort of surfaces for fast ray and segment obstruction queries in daylighting and solar reflection
+//
+// History:
+//  Oct 2026: Initial release
+//
+// Notes: See the .cc file
+
+class SurfaceBVH
+{
+
+public: // Types
+
+	using Real = Real64;
+	using Surface = DataSurfaces::SurfaceData;
+	using Vertex = ObjexxFCL::Vector3< Real >;
+	using size_type = std::size_t;
+
+	// Tree Node
+	struct Node
+	{
+		Vertex l; // Bounding box lower corner
+		Vertex u; // Bounding box upper corner
+		int i; // Interior node: Index of second child (first child follows this node) | Leaf node: Index of first surface
+		int n; // Number of surfaces (0 for interior nodes)
+		std::uint8_t axis; // Split axis of interior node (0,1,2 for x,y,z)
+	};
+
+	using Nodes = std::vector< Node >;
+	using SurfaceNums = std::vector< int >;
+
+public: // Creation
+
+	// Default Constructor
+	SurfaceBVH()
+	{}
+
+	// Surfaces Constructor
+	explicit
+	SurfaceBVH( ObjexxFCL::Array1< Surface > const & surfaces )
+	{
+		init( surfaces );
+	}
+
+public: // Properties
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return nodes_.empty();
+	}
+
+	// Number of Surfaces
+	size_type
+	size() const
+	{
+		return surfaceNums_.size();
+	}
+
+	// Nodes
+	Nodes const &
+	nodes() const
+	{
+		return nodes_;
+	}
+
+	// Surface Numbers in Leaf Order
+	SurfaceNums const &
+	surfaceNums() const
+	{
+		return surfaceNums_;
+	}
+
+public: // Methods
+
+	// Surfaces Initialization
+	void
+	init( ObjexxFCL::Array1< Surface > const & surfaces );
+
+	// Clear
+	void
+	clear()
+	{
+		nodes_.clear();
+		surfaceNums_.clear();
+	}
+
+	// Seek a Surface that Ray May Intersect and that Satisfies Predicate
+	template< typename Predicate >
+	bool
+	hasSurfaceRayIntersects( Vertex const & a, Vertex const & dir, Vertex const & dir_inv, Predicate const & predicate ) const
+	{
+		return traverse( a, dir, dir_inv, std::numeric_limits< Real >::max(), predicate );
+	}
+
+	// Seek a Surface that Ray May Intersect and that Satisfies Predicate
+	template< typename Predicate >
+	bool
+	hasSurfaceRayIntersects( Vertex const & a, Vertex const & dir, Predicate const & predicate ) const
+	{
+		return hasSurfaceRayIntersects( a, dir, safe_inverse( dir ), predicate ); // Inefficient if called in loop with same dir
+	}
+
+	// Seek a Surface that Line Segment May Intersect and that Satisfies Predicate
+	template< typename Predicate >
+	bool
+	hasSurfaceSegmentIntersects( Vertex const & a, Vertex const & b, Predicate const & predicate ) const
+	{
+		Vertex const ab( b - a ); // Segment is the [0,1] parameter range of the unnormalized direction
+		return traverse( a, ab, safe_inverse( ab ), 1.0, predicate );
+	}
+
+	// Process Surfaces that Ray May Intersect with Function
+	template< typename Function >
+	void
+	processSurfaceRayIntersects( Vertex const & a, Vertex const & dir, Vertex const & dir_inv, Function const & function ) const
+	{
+		traverse( a, dir, dir_inv, std::numeric_limits< Real >::max(), [&function]( int const iSurf ) -> bool { function( iSurf ); return false; } );
+	}
+
+	// Process Surfaces that Ray May Intersect with Function
+	template< typename Function >
+	void
+	processSurfaceRayIntersects( Vertex const & a, Vertex const & dir, Function const & function ) const
+	{
+		processSurfaceRayIntersects( a, dir, safe_inverse( dir ), function ); // Inefficient if called in loop with same dir
+	}
+
+public: // Static Data
+
+	static size_type const crossover; // Surface count at which the BVH is used instead of a linear search
+
+public: // Static Methods
+
+	// Ray Segment Intersects Box?
+	static
+	bool
+	rayIntersectsBox(
+	 Vertex const & l, // Box lower corner
+	 Vertex const & u, // Box upper corner
+	 Vertex const & a, // Ray origin
+	 Vertex const & dir, // Ray direction
+	 Vertex const & dir_inv, // Ray direction inverse (see safe_inverse)
+	 Real const tMax // Max ray parameter
+	)
+	{
+		// Slab method over the ray parameter range [0,tMax]
+		Real tl( 0.0 ), tu( tMax );
+		if ( ! slab( l.x, u.x, a.x, dir.x, dir_inv.x, tl, tu ) ) return false;
+		if ( ! slab( l.y, u.y, a.y, dir.y, dir_inv.y, tl, tu ) ) return false;
+		return slab( l.z, u.z, a.z, dir.z, dir_inv.z, tl, tu );
+	}
+
+	// BVH-Safe Vector Inverse
+	static
+	Vertex
+	safe_inverse( Vertex const & v )
+	{
+		return Vertex(
+		 ( v.x != 0.0 ? 1.0 / v.x : 0.0 ),
+		 ( v.y != 0.0 ? 1.0 / v.y : 0.0 ),
+		 ( v.z != 0.0 ? 1.0 / v.z : 0.0 )
+		);
+	}
+
+private: // Types
+
+	// Surface Build Item
+	struct Item
+	{
+		Vertex l; // Bounding box lower corner
+		Vertex u; // Bounding box upper corner
+		Vertex c; // Bounding box center
+		int iSurf; // Surface number
+	};
+
+	using Items = std::vector< Item >;
+
+private: // Methods
+
+	// Build Sub-Tree for Items [b,e) and Return its Node Index
+	int
+	build( Items & items, size_type const b, size_type const e, int const depth );
+
+	// Visit Surfaces in Leaves Whose Boxes the Ray Segment Intersects Until Visitor Returns true
+	template< typename Visitor >
+	bool
+	traverse( Vertex const & a, Vertex const & dir, Vertex const & dir_inv, Real const tMax, Visitor const & visitor ) const
+	{
+		if ( nodes_.empty() ) return false;
+		int stack[ maxDepth_ + 1 ]; // Pending node indexes
+		int nStack( 0 );
+		int iNode( 0 );
+		while ( true ) {
+			Node const & node( nodes_[ iNode ] );
+			if ( rayIntersectsBox( node.l, node.u, a, dir, dir_inv, tMax ) ) {
+				if ( node.n > 0 ) { // Leaf
+					for ( int i = node.i, e = node.i + node.n; i < e; ++i ) {
+						if ( visitor( surfaceNums_[ i ] ) ) return true;
+					}
+				} else { // Interior: Visit the child nearer the ray origin first
+					assert( nStack < maxDepth_ );
+					if ( dir[ node.axis ] < 0.0 ) {
+						stack[ nStack++ ] = iNode + 1;
+						iNode = node.i;
+					} else {
+						stack[ nStack++ ] = node.i;
+						++iNode;
+					}
+					continue;
+				}
+			}
+			if ( nStack == 0 ) break;
+			iNode = stack[ --nStack ];
+		}
+		return false;
+	}
+
+private: // Static Methods
+
+	// Clip Ray Parameter Range to Slab Between Two Planes Normal to an Axis
+	static
+	bool
+	slab(
+	 Real const l, // Slab lower coordinate
+	 Real const u, // Slab upper coordinate
+	 Real const a, // Ray origin coordinate
+	 Real const d, // Ray direction coordinate
+	 Real const d_inv, // Ray direction coordinate inverse
+	 Real & tl, // Ray parameter range lower limit
+	 Real & tu // Ray parameter range upper limit
+	)
+	{
+		if ( d == 0.0 ) { // Ray is parallel to slab
+			return ( l <= a ) && ( a <= u );
+		} else {
+			Real t1( ( l - a ) * d_inv ), t2( ( u - a ) * d_inv );
+			if ( d_inv < 0.0 ) std::swap( t1, t2 );
+			if ( t1 > tl ) tl = t1;
+			if ( t2 < tu ) tu = t2;
+			return tl <= tu;
+		}
+	}
+
+private: // Static Data
+
+	static int const maxDepth_ = 48; // Max tree depth
+	static size_type const maxLeafSurfaces_; // Max surfaces in a leaf
+	static Real const pad_; // Bounding box padding (m)
+
+private: // Data
+
+	Nodes nodes_; // Tree nodes: Root is node 0
+	SurfaceNums surfaceNums_; // Surface numbers in leaf order
+
+}; // SurfaceBVH
+
+// Globals
+extern SurfaceBVH surfaceBVH;
+
+} // EnergyPlus
+
+#endif
@@ -93,6 +93,7 @@ extern "C" {
 #include <General.hh>
 #include <GeneralRoutines.hh>
 #include <NodeInputManager.hh>
+#include <OutputProcessor.hh>
 #include <OutputReports.hh>
 #include <PlantManager.hh>
 #include <SimulationManager.hh>
@@ -316,6 +317,7 @@ CloseMiscOpenFiles()
 	//      INTEGER :: UnitNumber
 	//      INTEGER :: ios
 
+	OutputProcessor::StopReportWriter();
 	CloseReportIllumMaps();
 	CloseDFSFile();
 
@@ -1626,6 +1628,9 @@ ShowErrorMessage(
 	} else {
 		gio::write( CacheIPErrorFile, fmtA ) << ErrorMessage;
 	}
+	if ( present( OutUnit1 ) || present( OutUnit2 ) ) {
+		OutputProcessor::FlushReportRecords(); // The unit may be the eso or mtr file
+	}
 	if ( present( OutUnit1 ) ) {
 		gio::write( OutUnit1, ErrorFormat ) << ErrorMessage;
 	}
@@ -6552,16 +6552,20 @@ namespace WaterThermalTanks {
 		//       DATE WRITTEN   January 2007
 		//       MODIFIED       na
 		//                      Nov 2011, BAN; modified the use and source outlet temperature calculation
+		//                      Oct 2026; implicit node heat balance with variable sub time step
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Simulates a stratified, multi-node water heater tank with up to two heating elements.
 
 		// METHODOLOGY EMPLOYED:
-		// This model uses a numerical calculation based on the forward Euler method.  A heat balance is calculated for each
-		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
-		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
-		// time step.  Heat transfer rates are averages over the time step.
+		// This model uses an implicit numerical calculation (Crank-Nicolson, or backward Euler while a temperature inversion
+		// is being mixed).  The heat balances of all nodes are solved together as a tridiagonal system for each sub time
+		// step.  Sub time steps are whole seconds,
+		// limited by the shortest node time constant and shortened to end where a heating element switches, so heater
+		// control keeps the one second resolution of the original forward Euler formulation.  Temperatures and energies
+		// change dynamically over the system time step.  Final node temperatures are reported as final instantaneous
+		// values as well as averages over the time step.  Heat transfer rates are averages over the time step.
 
 		// Using/Aliasing
 		using DataGlobals::TimeStep;
@@ -6571,12 +6575,16 @@ namespace WaterThermalTanks {
 		using DataHVACGlobals::TimeStepSys;
 		using FluidProperties::GetDensityGlycol;
 		using FluidProperties::GetSpecificHeatGlycol;
+		using General::SolveTridiagonal;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const dt( 1.0 ); // Sub time step interval (s)
+		Real64 const dt( 1.0 ); // Minimum sub time step interval and heater control resolution (s)
+		Real64 const MaxStratSubStep( 60.0 ); // Maximum sub time step interval (s)
+		Real64 const SubStepTimeConstFrac( 0.25 ); // Maximum sub time step as a fraction of the shortest node time constant
+		Real64 const InversionTempTol( 0.01 ); // Inversions smaller than this do not limit the sub time step (deltaC)
 		static std::string const RoutineName( "CalcWaterThermalTankStratified" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
@@ -6586,8 +6594,6 @@ namespace WaterThermalTanks {
 		int NodeNum; // Node number index
 		Real64 NodeMass; // Mass of water in a node (kg)
 		Real64 NodeTemp; // Instantaneous node temperature (C)
-		Real64 TempUp; // Temperature of the upper node (C)
-		Real64 TempDn; // Temperature of the lower node (C)
 		Real64 InvMixUp; // Inversion mixing rate with the upper node (kg/s)
 		Real64 InvMixDn; // Inversion mixing rate with the lower node (kg/s)
 		Real64 Cp; // Specific heat of water (J/kg K)
@@ -6600,12 +6606,8 @@ namespace WaterThermalTanks {
 		Real64 MaxTemp; // Maximum tank temperature before venting (C)
 		Real64 Quse; // Heating rate due to use side mass flow (W)
 		Real64 Qsource; // Heating rate due to source side mass flow (W)
-		Real64 Qcond; // Heating rate due to vertical conduction between nodes
-		Real64 Qflow; // Heating rate due to fluid flow between inlet and outlet nodes
-		Real64 Qmix; // Heating rate due to temperature inversion mixing between nodes
 		Real64 Qloss; // Heating rate due to ambient environment (W)
 		Real64 Qlosszone; // Heating rate of fraction of losses added to the zone as a gain (W)
-		Real64 Qheat; // Net heating rate for non-temp dependent sources, i.e. heater and parasitics (W)
 		Real64 Qheater1; // Heating rate of burner or electric heating element 1 (W)
 		Real64 Qheater2; // Heating rate of burner or electric heating element 2 (W)
 		Real64 Qheater; // Combined heating rate of heater 1 and 2 (W)
@@ -6705,10 +6707,7 @@ namespace WaterThermalTanks {
 		} else {
 			Cp = GetSpecificHeatGlycol( fluidNameWater, Tank.TankTemp, DummyWaterIndex, RoutineName );
 		}
-		Real64 const dt_Cp( dt / Cp );
 
-		TempUp = 0.0;
-		TempDn = 0.0;
 		Eloss = 0.0;
 		Elosszone = 0.0;
 		Euse = 0.0;
@@ -6731,8 +6730,60 @@ namespace WaterThermalTanks {
 		if ( Tank.InletMode == InletModeFixed ) CalcNodeMassFlows( WaterThermalTankNum, InletModeFixed );
 
 		TimeRemaining = SecInTimeStep;
-		Real64 & tank_node1_newTemp( Tank.Node( 1 ).NewTemp );
+		int const nTankNodes( Tank.Nodes );
 		Real64 const & tank_useOutletStratNode_temp( Tank.Node( Tank.UseOutletStratNode ).Temp );
+		static Array1D< Real64 > CoeffUp; // Coupling coefficient to the upper node (W/K)
+		static Array1D< Real64 > CoeffDn; // Coupling coefficient to the lower node (W/K)
+		static Array1D< Real64 > CoeffSelf; // Coefficient of terms driven by the node's own temperature (W/K)
+		static Array1D< Real64 > HeatGain; // Heat gains independent of the node temperatures (W)
+		static Array1D< Real64 > MatA; // Sub-diagonal of the node heat balance matrix
+		static Array1D< Real64 > MatB; // Diagonal of the node heat balance matrix
+		static Array1D< Real64 > MatC; // Super-diagonal of the node heat balance matrix
+		static Array1D< Real64 > MatD; // Right-hand side, then new node temperatures
+		static Array1D< Real64 > MatW; // Solver work array
+		if ( CoeffUp.isize() < nTankNodes ) {
+			CoeffUp.dimension( nTankNodes );
+			CoeffDn.dimension( nTankNodes );
+			CoeffSelf.dimension( nTankNodes );
+			HeatGain.dimension( nTankNodes );
+			MatA.dimension( nTankNodes );
+			MatB.dimension( nTankNodes );
+			MatC.dimension( nTankNodes );
+			MatD.dimension( nTankNodes );
+			MatW.dimension( nTankNodes );
+		}
+
+		// Node heat balances over a sub time step of length SubStep, using the coefficients set up below.  The
+		// temperature dependent flows are evaluated at Theta * new + ( 1 - Theta ) * old temperatures
+		auto SolveNodeTemps = [&]( Real64 const SubStep, Real64 const Theta ) {
+			for ( int NodeNum = 1; NodeNum <= nTankNodes; ++NodeNum ) {
+				auto & tank_node( Tank.Node( NodeNum ) );
+				Real64 const Capacitance( tank_node.Mass * Cp / SubStep );
+				Real64 const CoeffNode( CoeffUp( NodeNum ) + CoeffDn( NodeNum ) + CoeffSelf( NodeNum ) );
+				Real64 OldFlow( -CoeffNode * tank_node.Temp );
+				if ( NodeNum > 1 ) OldFlow += CoeffUp( NodeNum ) * Tank.Node( NodeNum - 1 ).Temp;
+				if ( NodeNum < nTankNodes ) OldFlow += CoeffDn( NodeNum ) * Tank.Node( NodeNum + 1 ).Temp;
+				MatA( NodeNum ) = -Theta * CoeffUp( NodeNum );
+				MatC( NodeNum ) = -Theta * CoeffDn( NodeNum );
+				MatB( NodeNum ) = Capacitance + Theta * CoeffNode;
+				MatD( NodeNum ) = Capacitance * tank_node.Temp + ( 1.0 - Theta ) * OldFlow + HeatGain( NodeNum );
+			}
+			SolveTridiagonal( nTankNodes, MatA, MatB, MatC, MatD, MatW );
+			for ( int NodeNum = 1; NodeNum <= nTankNodes; ++NodeNum ) {
+				Tank.Node( NodeNum ).NewTemp = MatD( NodeNum );
+			}
+		};
+
+		// Fraction of the sub time step at which a heater node first reaches its control threshold, 1.0 if it does not
+		auto HeaterEventFraction = [&]( bool const HeaterOn, int const HeaterNode, Real64 const SetPointTemp, Real64 const MinTemp ) -> Real64 {
+			Real64 const TempBeg( Tank.Node( HeaterNode ).Temp );
+			Real64 const TempEnd( Tank.Node( HeaterNode ).NewTemp );
+			Real64 const Threshold( HeaterOn ? SetPointTemp : MinTemp );
+			bool const Switches( HeaterOn ? ( TempEnd >= Threshold ) : ( TempEnd < Threshold ) );
+			if ( ! Switches || ( TempEnd == TempBeg ) ) return 1.0;
+			return max( min( ( Threshold - TempBeg ) / ( TempEnd - TempBeg ), 1.0 ), 0.0 );
+		};
+
 		while ( TimeRemaining > 0.0 ) { //? Might be good to use a check that is tolerant to some epsilon * dt to avoid an extra pass due to roundoff when subtracting dt (if dt is ever not a value with an exact floating point representation)
 
 			if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
@@ -6758,7 +6809,6 @@ namespace WaterThermalTanks {
 
 				if ( Tank.HeaterOn1 ) {
 					Qheater1 = Tank.MaxCapacity;
-					Runtime1 += dt;
 				} else {
 					Qheater1 = 0.0;
 				}
@@ -6787,7 +6837,6 @@ namespace WaterThermalTanks {
 
 				if ( Tank.HeaterOn2 ) {
 					Qheater2 = Tank.MaxCapacity2;
-					Runtime2 += dt;
 				} else {
 					Qheater2 = 0.0;
 				}
@@ -6798,10 +6847,9 @@ namespace WaterThermalTanks {
 
 			}
 			Real64 const Qheaters( Qheater1 + Qheater2 );
+			bool const HeaterOn( Tank.HeaterOn1 || Tank.HeaterOn2 );
 
-			if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
-				Runtime += dt;
-
+			if ( HeaterOn ) {
 				Qfuel = Qheaters / Tank.Efficiency;
 				Qoncycfuel = Tank.OnCycParaLoad;
 				Qoffcycfuel = 0.0;
@@ -6811,15 +6859,110 @@ namespace WaterThermalTanks {
 				Qoffcycfuel = Tank.OffCycParaLoad;
 			}
 
-			// Loop through all nodes and simulate heat balance
-			for ( int NodeNum = 1, nTankNodes = Tank.Nodes; NodeNum <= nTankNodes; ++NodeNum ) {
+			// Set up the node heat balance coefficients.  Inversion mixing is decided from the temperatures at the
+			// start of the sub time step, as in the explicit formulation this replaces.  The sub time step is limited
+			// to a fraction of the shortest node time constant; inversion mixing only counts toward the time constant
+			// for inversions larger than round-off
+			Real64 MaxSubStep( SecInTimeStep );
+			bool InversionMixing( false );
+			for ( NodeNum = 1; NodeNum <= nTankNodes; ++NodeNum ) {
 				auto & tank_node( Tank.Node( NodeNum ) );
-				NodeMass = tank_node.Mass;
 				NodeTemp = tank_node.Temp;
 
 				UseMassFlowRate = tank_node.UseMassFlowRate * Tank.UseEffectiveness;
 				SourceMassFlowRate = tank_node.SourceMassFlowRate * Tank.SourceEffectiveness;
 
+				Real64 TransferUp( tank_node.CondCoeffUp + Cp * tank_node.MassFlowFromUpper );
+				Real64 TransferDn( tank_node.CondCoeffDn + Cp * tank_node.MassFlowFromLower );
+
+				InvMixUp = 0.0;
+				if ( NodeNum > 1 ) {
+					Real64 const TempUp( Tank.Node( NodeNum - 1 ).Temp );
+					if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
+					if ( TempUp < NodeTemp - InversionTempTol ) TransferUp += Cp * InvMixUp;
+				}
+				InvMixDn = 0.0;
+				if ( NodeNum < nTankNodes ) {
+					Real64 const TempDn( Tank.Node( NodeNum + 1 ).Temp );
+					if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
+					if ( TempDn > NodeTemp + InversionTempTol ) TransferDn += Cp * InvMixDn;
+				}
+				if ( ( InvMixUp > 0.0 ) || ( InvMixDn > 0.0 ) ) InversionMixing = true;
+
+				CoeffUp( NodeNum ) = tank_node.CondCoeffUp + Cp * ( tank_node.MassFlowFromUpper + InvMixUp );
+				CoeffDn( NodeNum ) = tank_node.CondCoeffDn + Cp * ( tank_node.MassFlowFromLower + InvMixDn );
+
+				LossCoeff = HeaterOn ? tank_node.OnCycLossCoeff : tank_node.OffCycLossCoeff;
+				CoeffSelf( NodeNum ) = UseMassFlowRate * Cp + LossCoeff;
+				HeatGain( NodeNum ) = UseMassFlowRate * Cp * UseInletTemp + LossCoeff * AmbientTemp;
+				if ( HeaterOn ) {
+					HeatGain( NodeNum ) += tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+					if ( NodeNum == Tank.HeaterNode1 ) {
+						HeatGain( NodeNum ) += Qheater1;
+					} else if ( NodeNum == Tank.HeaterNode2 ) {
+						HeatGain( NodeNum ) += Qheater2;
+					}
+				} else {
+					HeatGain( NodeNum ) += tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+				}
+
+				if ( Tank.HeatPumpNum > 0 ) {
+					// Heat Pump Water Heater
+					if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
+						if ( SourceMassFlowRate > 0.0 ) HeatGain( NodeNum ) += Qheatpump;
+					} else {
+						assert( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped );
+						HeatGain( NodeNum ) += Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
+					}
+				} else {
+					// Constant temperature source side flow
+					CoeffSelf( NodeNum ) += SourceMassFlowRate * Cp;
+					HeatGain( NodeNum ) += SourceMassFlowRate * Cp * SourceInletTemp;
+				}
+
+				Real64 const TotalCoeff( TransferUp + TransferDn + CoeffSelf( NodeNum ) );
+				if ( TotalCoeff > 0.0 ) MaxSubStep = min( MaxSubStep, SubStepTimeConstFrac * tank_node.Mass * Cp / TotalCoeff );
+			}
+
+			// Trapezoidal (Crank-Nicolson) weighting is second order accurate, but it does not damp the fast mode of
+			// inversion mixing, so fully implicit weighting is used while an inversion is being mixed
+			Real64 const Theta( InversionMixing ? 1.0 : 0.5 );
+			Real64 SubStep( min( max( dt, std::floor( min( MaxSubStep, MaxStratSubStep ) / dt ) * dt ), TimeRemaining ) );
+			SolveNodeTemps( SubStep, Theta );
+
+			// Shorten the sub time step to end where a heater element would first switch, so heater runtimes
+			// keep the one second resolution of the control checks
+			if ( ( SubStep > dt ) && !Tank.IsChilledWaterTank ) {
+				Real64 EventFrac( 1.0 );
+				if ( Tank.MaxCapacity > 0.0 ) {
+					EventFrac = min( EventFrac, HeaterEventFraction( Tank.HeaterOn1, Tank.HeaterNode1, SetPointTemp1, MinTemp1 ) );
+				}
+				if ( ( Tank.MaxCapacity2 > 0.0 ) && !( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) ) {
+					EventFrac = min( EventFrac, HeaterEventFraction( Tank.HeaterOn2, Tank.HeaterNode2, SetPointTemp2, MinTemp2 ) );
+				}
+				if ( EventFrac < 1.0 ) {
+					Real64 const EventStep( max( dt, std::ceil( EventFrac * SubStep / dt ) * dt ) );
+					if ( EventStep < SubStep ) {
+						SubStep = EventStep;
+						SolveNodeTemps( SubStep, Theta );
+					}
+				}
+			}
+
+			if ( Tank.HeaterOn1 ) Runtime1 += SubStep;
+			if ( Tank.HeaterOn2 ) Runtime2 += SubStep;
+			if ( HeaterOn ) Runtime += SubStep;
+
+			// Energy flows over the sub time step, evaluated at the same weighted node temperatures as the heat
+			// balance so that they balance the change in stored energy
+			for ( NodeNum = 1; NodeNum <= nTankNodes; ++NodeNum ) {
+				auto & tank_node( Tank.Node( NodeNum ) );
+				NodeMass = tank_node.Mass;
+				NodeTemp = Theta * tank_node.NewTemp + ( 1.0 - Theta ) * tank_node.Temp;
+
+				UseMassFlowRate = tank_node.UseMassFlowRate * Tank.UseEffectiveness;
+				SourceMassFlowRate = tank_node.SourceMassFlowRate * Tank.SourceEffectiveness;
+
 				// Heat transfer due to fluid flow entering an inlet node
 				Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
 				if ( Tank.HeatPumpNum > 0 ) {
@@ -6831,7 +6974,6 @@ namespace WaterThermalTanks {
 							Qsource = 0.0;
 						}
 					} else {
-						assert( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterWrapped );
 						Qsource = Qheatpump * tank_node.HPWHWrappedCondenserHeatingFrac;
 					}
 				} else {
@@ -6839,47 +6981,17 @@ namespace WaterThermalTanks {
 					Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
 				}
 
-				InvMixUp = 0.0;
-				if ( NodeNum > 1 ) {
-					TempUp = Tank.Node( NodeNum - 1 ).Temp;
-					if ( TempUp < NodeTemp ) InvMixUp = Tank.InversionMixingRate;
-				}
-//BUG? When NodeNum==1 TempUp is 0.0   Shouldn't it be NodeTemp to void the vertical conduction? !!!!!!!!!!!!!!!!!
-				Real64 const delTempUp( TempUp - NodeTemp );
-
-				InvMixDn = 0.0;
-				if ( NodeNum < nTankNodes ) {
-					TempDn = Tank.Node( NodeNum + 1 ).Temp;
-					if ( TempDn > NodeTemp ) InvMixDn = Tank.InversionMixingRate;
-				}
-				Real64 const delTempDn( TempDn - NodeTemp );
-
-				// Heat transfer due to vertical conduction between nodes
-				Qcond = tank_node.CondCoeffUp * delTempUp + tank_node.CondCoeffDn * delTempDn;
-
-				// Heat transfer due to fluid flow between inlet and outlet nodes
-				Qflow = Cp * ( tank_node.MassFlowFromUpper * delTempUp + tank_node.MassFlowFromLower * delTempDn );
-
-				// Heat transfer due to temperature inversion mixing between nodes
-				Qmix = Cp * ( InvMixUp * delTempUp + InvMixDn * delTempDn );
-
-				if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+				if ( HeaterOn ) {
 					LossCoeff = tank_node.OnCycLossCoeff;
 					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qheat = Qoncycheat = tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+					Qoncycheat = tank_node.OnCycParaLoad * Tank.OnCycParaFracToTank;
 					Qusl = Quse + Qsource + Qloss;
 
 					Qneeded = max( -Qusl - Qoncycheat, 0.0 );
-
-					if ( NodeNum == Tank.HeaterNode1 ) {
-						Qheat += Qheater1;
-					} else if ( NodeNum == Tank.HeaterNode2 ) {
-						Qheat += Qheater2;
-					}
 				} else {
 					LossCoeff = tank_node.OffCycLossCoeff;
 					Qloss = LossCoeff * ( AmbientTemp - NodeTemp );
-					Qheat = Qoffcycheat = tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+					Qoffcycheat = tank_node.OffCycParaLoad * Tank.OffCycParaFracToTank;
 					Qusl = Quse + Qsource + Qloss;
 
 					Qneeded = max( -Qusl - Qoffcycheat, 0.0 );
@@ -6887,49 +6999,41 @@ namespace WaterThermalTanks {
 
 				Qunmet = max( Qneeded - Qheaters, 0.0 );
 
-				// Calculate node heat balance
-				tank_node.NewTemp = NodeTemp + ( Qusl + Qcond + Qflow + Qmix + Qheat ) * dt_Cp / NodeMass;
-
 				if ( !Tank.IsChilledWaterTank ) {
-					if ( ( NodeNum == 1 ) && ( tank_node1_newTemp > MaxTemp ) ) {
-						Event += NodeMass * ( MaxTemp - tank_node1_newTemp );
-						tank_node1_newTemp = MaxTemp;
+					if ( ( NodeNum == 1 ) && ( tank_node.NewTemp > MaxTemp ) ) {
+						Event += NodeMass * ( MaxTemp - tank_node.NewTemp );
+						tank_node.NewTemp = MaxTemp;
 					}
 				}
 
-				Esource += Qsource;
-				Eloss += Qloss;
-				Eneeded += Qneeded;
-				Eunmet += Qunmet;
+				Esource += Qsource * SubStep;
+				Eloss += Qloss * SubStep;
+				Eneeded += Qneeded * SubStep;
+				Eunmet += Qunmet * SubStep;
+
+				tank_node.TempSum += NodeTemp * SubStep;
 
 			} // NodeNum
 
-			Euse += Tank.UseMassFlowRate * ( UseInletTemp - tank_useOutletStratNode_temp );
+			Euse += Tank.UseMassFlowRate * ( UseInletTemp - ( Theta * Tank.Node( Tank.UseOutletStratNode ).NewTemp + ( 1.0 - Theta ) * tank_useOutletStratNode_temp ) ) * SubStep;
 
 			// Calculation for standard ratings
 			if ( !Tank.FirstRecoveryDone ) {
-				Tank.FirstRecoveryFuel += ( Qfuel + Qoffcycfuel + Qoncycfuel ) * dt;
+				Tank.FirstRecoveryFuel += ( Qfuel + Qoffcycfuel + Qoncycfuel ) * SubStep;
 				if ( SetPointRecovered ) Tank.FirstRecoveryDone = true;
 			}
 
 			// Update node temperatures
-			for ( auto & e : Tank.Node ) {
-				e.Temp = e.NewTemp;
-				e.TempSum += e.Temp * dt;
-			}
+			for ( auto & e : Tank.Node ) e.Temp = e.NewTemp;
 
-			TimeRemaining -= dt;
+			TimeRemaining -= SubStep;
 
 		} // TimeRemaining > 0.0
 
 		// Finalize accumulated values
 		Event *= Cp;
-		Esource *= dt;
-		Eloss *= dt;
 		Elosszone = Eloss * Tank.SkinLossFracToZone;
-		Eneeded *= dt;
-		Eunmet *= dt;
-		Euse *= Cp * dt;
+		Euse *= Cp;
 
 		Eheater1 = Tank.MaxCapacity * Runtime1;
 		Eheater2 = Tank.MaxCapacity2 * Runtime2;
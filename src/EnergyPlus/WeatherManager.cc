@@ -5204,6 +5204,7 @@ Label9999: ;
 
 			if ( PrintEnvrnStamp ) {
 
+				OutputProcessor::FlushReportRecords(); // Stamps go after the report records already posted
 				if ( PrintEndDataDictionary && DoOutputReporting ) {
 					gio::write( OutputFileStandard, EndOfHeaderFormat );
 					gio::write( OutputFileMeters, EndOfHeaderFormat );
@@ -189,7 +189,7 @@ namespace WindowComplexManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Joe Klems
 		//       DATE WRITTEN   August 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, precompute weighted property sums per construction
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -282,6 +282,16 @@ namespace WindowComplexManager {
 			BsLoop_loop: ;
 		}
 		BasisList.redimension( NumBasis );
+		//  The Lamda-weighted sums of the property matrices depend only on the construction and its basis,
+		//    so compute them once here rather than for every window state that uses the construction
+		for ( IConst = FirstBSDF; IConst <= FirstBSDF + TotComplexFenStates - 1; ++IConst ) {
+			for ( IBasis = 1; IBasis <= NumBasis; ++IBasis ) {
+				if ( Construct( IConst ).BSDFInput.BasisMatIndex == BasisList( IBasis ).BasisMatIndex ) {
+					CalcBSDFLamdaSums( Construct( IConst ).BSDFInput, BasisList( IBasis ).Lamda );
+					break;
+				}
+			}
+		}
 		//  Proceed to set up geometry for complex fenestration states
 		ComplexWind.allocate( TotSurfaces ); //Set up companion array to SurfaceWindow to hold window
 		//     geometry for each state.  This is an allocatable array of
@@ -949,7 +959,7 @@ namespace WindowComplexManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Joe Klems
 		//       DATE WRITTEN   August 2011
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, use compressed matrices and precomputed weighted sums
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -989,7 +999,6 @@ namespace WindowComplexManager {
 		Real64 Phi;
 		int JSurf; // gen purpose surface no
 		int BaseSurf; // base surface no
-		int M; // general purpose index--ray
 		int L; // general purpose index--layer
 		int KBkSurf; // general purpose index--back surface
 		Real64 Sum1; // general purpose sum
@@ -1026,11 +1035,7 @@ namespace WindowComplexManager {
 				State.WinToSurfBmTrans( Hour, TS, I ) = Sum1;
 			} //Back surface loop
 			//Calculate the directional-hemispherical transmittance
-			Sum1 = 0.0;
-			for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, J );
-			}
-			State.WinDirHemiTrans( Hour, TS ) = Sum1;
+			State.WinDirHemiTrans( Hour, TS ) = Construct( IConst ).BSDFInput.SolFrtTransLamdaRow( IBm );
 			//Calculate the directional specular transmittance
 			//Note:  again using assumption that Inc and Trn basis have same structure
 			State.WinDirSpecTrans( Hour, TS ) = Geom.Trn.Lamda( IBm ) * Construct( IConst ).BSDFInput.SolFrtTrans( IBm, IBm );
@@ -1048,9 +1053,7 @@ namespace WindowComplexManager {
 			JRay = Geom.GndIndex( J );
 			if ( Geom.SolBmGndWt( Hour, TS, J ) > 0.0 ) {
 				Sum2 += Geom.SolBmGndWt( Hour, TS, J ) * Geom.Inc.Lamda( JRay );
-				for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-					Sum1 += Geom.SolBmGndWt( Hour, TS, J ) * Geom.Inc.Lamda( JRay ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( JRay, M );
-				} //Outgoing ray loop
+				Sum1 += Geom.SolBmGndWt( Hour, TS, J ) * Geom.Inc.Lamda( JRay ) * Construct( IConst ).BSDFInput.SolFrtTransLamdaRow( JRay );
 			}
 		} //Indcident ray loop
 		if ( Sum2 > 0.0 ) {
@@ -1102,11 +1105,7 @@ namespace WindowComplexManager {
 				//Here calculate the back incidence properties for the solar ray
 				//this does not say whether or not the ray can pass through the
 				//back surface window and hit this one!
-				Sum1 = 0.0;
-				for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-					Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( BkIncRay, J );
-				}
-				Refl = Sum1;
+				Refl = Construct( IConst ).BSDFInput.SolBkReflLamdaRow( BkIncRay );
 				for ( L = 1; L <= State.NLayers; ++L ) {
 					Absorb( L ) = Construct( IConst ).BSDFInput.Layer( L ).BkAbs( BkIncRay, 1 );
 				}
@@ -2010,7 +2009,7 @@ namespace WindowComplexManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Joe Klems
 		//       DATE WRITTEN   <date_written>
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026, use compressed matrices and precomputed weighted sums
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2061,9 +2060,7 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
 			Sum2 += Geom.Inc.Lamda( J );
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J );
-			} //Outgoing ray loop
+			Sum1 += Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTransLamdaCol( J );
 		} //Incident ray loop
 		if ( Sum2 > 0 ) {
 			State.WinDiffTrans = Sum1 / Sum2;
@@ -2078,9 +2075,7 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { //Incident ray loop
 			Sum2 += Geom.Inc.Lamda( J );
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { //Outgoing ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M ) * Construct( IConst ).BSDFInput.VisFrtTrans( M, J );
-			} //Outgoing ray loop
+			Sum1 += Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.VisFrtTransLamdaCol( J );
 		} //Incident ray loop
 		if ( Sum2 > 0.0 ) {
 			State.WinDiffVisTrans = Sum1 / Sum2;
@@ -2096,14 +2091,9 @@ namespace WindowComplexManager {
 		Sum1 = 0.0;
 		Sum2 = 0.0;
 		Sum3 = 0.0;
-		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.SkyIndex( JJ );
-				Sum1 += Geom.SolSkyWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
-			}
-		}
 		for ( JJ = 1; JJ <= Geom.NSky; ++JJ ) {
 			J = Geom.SkyIndex( JJ );
+			Sum1 += Geom.SolSkyWt( JJ ) * Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTransLamdaCol( J );
 			Sum2 += Geom.SolSkyWt( JJ ) * Geom.Inc.Lamda( J );
 		}
 
@@ -2139,15 +2129,9 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		Sum3 = 0.0;
 
-		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) {
-				J = Geom.GndIndex( JJ );
-				Sum1 += Geom.SolSkyGndWt( JJ ) * Construct( IConst ).BSDFInput.SolFrtTrans( M, J ) * Geom.Inc.Lamda( J ) * Geom.Trn.Lamda( M );
-			}
-		}
-
 		for ( JJ = 1; JJ <= Geom.NGnd; ++JJ ) {
 			J = Geom.GndIndex( JJ );
+			Sum1 += Geom.SolSkyGndWt( JJ ) * Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTransLamdaCol( J );
 			Sum2 += Geom.SolSkyGndWt( JJ ) * Geom.Inc.Lamda( J );
 		}
 
@@ -2178,10 +2162,8 @@ namespace WindowComplexManager {
 		Sum3 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.SolBkRefl( M, J ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
-			}
+		for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
+			Sum1 += Geom.Inc.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkReflLamdaRow( M );
 		}
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
 			Sum2 += Geom.Trn.Lamda( J );
@@ -2239,10 +2221,8 @@ namespace WindowComplexManager {
 		Sum2 = 0.0;
 		//Note this again assumes the equivalence Inc basis = transmission basis for back incidence and
 		// Trn basis = incident basis for back incidence
-		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
-				Sum1 += Construct( IConst ).BSDFInput.VisBkRefl( M, J ) * Geom.Trn.Lamda( J ) * Geom.Inc.Lamda( M );
-			}
+		for ( M = 1; M <= Geom.Inc.NBasis; ++M ) {
+			Sum1 += Geom.Inc.Lamda( M ) * Construct( IConst ).BSDFInput.VisBkReflLamdaRow( M );
 		}
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) {
 			Sum2 += Geom.Trn.Lamda( J );
@@ -2289,9 +2269,7 @@ namespace WindowComplexManager {
 			Sum2 = 0.0;
 			for ( J = 1; J <= Geom.NSurfInt( KBkSurf ); ++J ) { //Inc Ray loop
 				Sum2 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) );
-				for ( M = 1; M <= Geom.Inc.NBasis; ++M ) { //Outgoing Ray loop
-					Sum1 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) ) * Geom.Inc.Lamda( M ) * Construct( IConst ).BSDFInput.SolBkRefl( Geom.SurfInt( J, KBkSurf ), M );
-				} //Outgoing Ray loop
+				Sum1 += Geom.Trn.Lamda( Geom.SurfInt( J, KBkSurf ) ) * Construct( IConst ).BSDFInput.SolBkReflLamdaRow( Geom.SurfInt( J, KBkSurf ) );
 			} //Inc Ray loop
 			if ( Sum2 > 0.0 ) {
 				Hold = Sum1 / Sum2;
@@ -2351,11 +2329,7 @@ namespace WindowComplexManager {
 		// Integrating front transmittance
 		if ( ! allocated( State.IntegratedFtTrans ) ) State.IntegratedFtTrans.allocate( Geom.Inc.NBasis );
 		for ( J = 1; J <= Geom.Inc.NBasis; ++J ) { // Incident ray loop
-			Sum1 = 0.0;
-			for ( M = 1; M <= Geom.Trn.NBasis; ++M ) { // Outgoing ray loop
-				Sum1 += Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans( J, M );
-			} // Outgoing ray loop
-			State.IntegratedFtTrans( J ) = Sum1;
+			State.IntegratedFtTrans( J ) = Geom.Trn.Lamda( J ) * Construct( IConst ).BSDFInput.SolFrtTrans.rowSum( J );
 		} // Incident ray loop
 
 		if ( ! allocated( State.IntegratedFtRefl ) ) State.IntegratedFtRefl.allocate( Geom.Inc.NBasis );
@@ -2381,11 +2355,7 @@ namespace WindowComplexManager {
 		// Integrating back reflectance
 		if ( ! allocated( State.IntegratedBkRefl ) ) State.IntegratedBkRefl.allocate( Geom.Trn.NBasis );
 		for ( J = 1; J <= Geom.Trn.NBasis; ++J ) { // Outgoing ray loop
-			Sum1 = 0.0;
-			for ( M = 1; M <= Geom.Inc.NBasis; ++M ) { // Incident ray loop
-				Sum1 += Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl( J, M );
-			} //Incident ray loop
-			State.IntegratedBkRefl( J ) = Sum1;
+			State.IntegratedBkRefl( J ) = Geom.Inc.Lamda( J ) * Construct( IConst ).BSDFInput.SolBkRefl.rowSum( J );
 		} //Outgoing ray loop
 
 		if ( ! allocated( State.IntegratedBkTrans ) ) State.IntegratedBkTrans.allocate( Geom.Trn.NBasis );
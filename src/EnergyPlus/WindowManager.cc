@@ -81,6 +81,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DataZoneEquipment.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -148,6 +149,12 @@ namespace WindowManager {
 
 	//               Dens  dDens/dT  Con    dCon/dT   Vis    dVis/dT Prandtl dPrandtl/dT
 	Array1D< Real64 > const AirProps( 8, { 1.29, -0.4e-2, 2.41e-2, 7.6e-5, 1.73e-5, 1.0e-7, 0.72, 1.8e-3 } );
+	// Grid of the precomputed thermal response of bare glazing (see BuildWindowResponseCell)
+	Array1D< Real64 > const WinRespToutAxis( 9, { -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 30.0, 40.0, 50.0 } ); // Outside air temperature (C)
+	Array1D< Real64 > const WinRespTinAxis( 6, { 10.0, 15.0, 20.0, 25.0, 30.0, 35.0 } ); // Inside air temperature (C)
+	Array1D< Real64 > const WinRespHcOutAxis( 5, { 2.0, 5.0, 10.0, 20.0, 40.0 } ); // Outside convective film conductance (W/m2-K)
+	Array1D< Real64 > const WinRespHcInAxis( 5, { 0.5, 1.0, 2.0, 3.5, 6.0 } ); // Inside convective film conductance (W/m2-K)
+	Real64 const WinRespMaxError( 0.5 ); // Largest accepted face temperature error of a response table (K)
 	// Air mass 1.5 terrestrial solar global spectral irradiance (W/m2-micron)
 	// on a 37 degree tilted surface; corresponds
 	// to wavelengths (microns) in following data block (ISO 9845-1 and ASTM E 892;
@@ -240,6 +247,14 @@ namespace WindowManager {
 	Array2D< Real64 > rbadjPhi( 5, MaxSpectralDataElements, 0.0 ); // back reflectance at angle of incidence
 
 	Array1D_int numpt( 5, 0 ); // Number of spectral data wavelengths for each layer; =2 if no spectra data for a layer
+	Array2D_int wltIndex( 5, nume, 0 ); // For each layer, index of the first wavelength in wlt at or above each wavelength in wle
+	// (numpt + 1 if none)
+	Array1D< Real64 > esolInt( nume, 0.0 ); // Solar spectrum value times delta wavelength for each wavelength interval in wle
+	Array1D< Real64 > evisInt( nume, 0.0 ); // Solar spectrum value times photopic response times delta wavelength,
+	// for the wavelength interval ending at each wavelength in wle (zero outside the visible range)
+	Real64 esolSum( 0.0 ); // Sum of esolInt
+	Real64 evisSum( 0.0 ); // Sum of evisInt
+	bool SpectrumWeightsSet( false ); // True when esolInt and evisInt are set for the current solar spectrum
 	Array1D< Real64 > stPhi( nume, 0.0 ); // Glazing system transmittance at angle of incidence for each wavelength in wle
 	Array1D< Real64 > srfPhi( nume, 0.0 ); // Glazing system front reflectance at angle of incidence for each wavelength in wle
 	Array1D< Real64 > srbPhi( nume, 0.0 ); // Glazing system back reflectance at angle of incidence for each wavelenth in wle
@@ -262,6 +277,9 @@ namespace WindowManager {
 	Array1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	Array1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Object Data
+	Array1D< WindowResponseTableData > WindowResponseTable; // Precomputed thermal response of bare glazing, by construction
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -343,6 +361,12 @@ namespace WindowManager {
 		rfadjPhi = Array2D< Real64 >( 5, MaxSpectralDataElements, 0.0 );
 		rbadjPhi = Array2D< Real64 >( 5, MaxSpectralDataElements, 0.0 );
 		numpt = Array1D_int( 5, 0 );
+		wltIndex = Array2D_int( 5, nume, 0 );
+		esolInt = Array1D< Real64 >( nume, 0.0 );
+		evisInt = Array1D< Real64 >( nume, 0.0 );
+		esolSum = 0.0;
+		evisSum = 0.0;
+		SpectrumWeightsSet = false;
 		stPhi = Array1D< Real64 >( nume, 0.0 );
 		srfPhi = Array1D< Real64 >( nume, 0.0 );
 		srbPhi = Array1D< Real64 >( nume, 0.0 );
@@ -363,6 +387,7 @@ namespace WindowManager {
 		rfvisPhi = Array1D< Real64 >( 10, 0.0 );
 		rbvisPhi = Array1D< Real64 >( 10, 0.0 );
 		CosPhiIndepVar = Array1D< Real64 >( 10, 0.0 );
+		WindowResponseTable.deallocate();
 	}
 
 	void
@@ -378,6 +403,8 @@ namespace WindowManager {
 		//                      May 2006 (RR): add exterior window screen
 		//                      Aug 2010 (TH): allow spectral data for between-glass shade/blind
 		//                      Aug 2013 (TH): allow user defined solar and visible spectrum data
+		//                      Oct 2026: set up the precomputed thermal response of bare glazing
+		//                      Oct 2026: share bare glazing optics among constructions with the same glass layers
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -394,6 +421,7 @@ namespace WindowManager {
 		using namespace Vectors;
 		using General::TrimSigDigits;
 		using WindowEquivalentLayer::InitEquivalentLayerWindowCalculations;
+		using DataSystemVariables::WindowResponseTablesEnvFlag;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -548,6 +576,10 @@ namespace WindowManager {
 		static Real64 tmpReflectSolBeamBack( 0.0 );
 		static Real64 tmpReflectVisBeamFront( 0.0 );
 		static Real64 tmpReflectVisBeamBack( 0.0 );
+		std::vector< BareGlazingOpticsData > BareGlazingOptics; // Bare glazing optics of the constructions calculated so far
+		std::vector< int > OpticsKey; // Glass layers and flags that determine the bare glazing optics of a construction
+		int BareOpticsNum; // Index in BareGlazingOptics of the optics of the glass layers of a construction
+		// (-1 if not calculated yet)
 
 		//Debug
 		static Array1D< Real64 > DbgTheta( 11, { 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 82.5, 89.5 } );
@@ -563,6 +595,7 @@ namespace WindowManager {
 
 		// check and read custom solar and/or visible spectrum data if any
 		CheckAndReadCustomSprectrumData();
+		InitSpectrumAverageWeights();
 
 		W5InitGlassParameters();
 
@@ -701,6 +734,7 @@ namespace WindowManager {
 
 			lquasi = false;
 			AllGlassIsSpectralAverage = true;
+			OpticsKey.assign( { NGlass, int( StormWinConst ), int( BGFlag ), int( lSimpleGlazingSystem ) } );
 
 			// Loop over glass layers in the construction
 			for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
@@ -780,72 +814,105 @@ namespace WindowManager {
 					rff( IGlass, 2 ) = Material( LayPtr ).ReflectVisBeamFront;
 					rbb( IGlass, 2 ) = Material( LayPtr ).ReflectVisBeamBack;
 				}
+				OpticsKey.push_back( LayPtr );
+				OpticsKey.push_back( SpecDataNum );
 			} // End of loop over glass layers in the construction for front calculation
 
-			// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
-			// Get glass layer properties, then glazing system properties (which include the
-			// effect of inter-reflection among glass layers) at each incidence angle.
-
-			for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
-				Phi = double( IPhi - 1 ) * 10.0;
-				CosPhi = std::cos( Phi * DegToRadians );
-				if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
+			// The bare glazing optics depend only on the glass layers, so constructions with the same
+			// glass layers (typically the bare and shaded constructions of a window) share them
+			BareOpticsNum = -1;
+			for ( int OpticsNum = 0; OpticsNum < int( BareGlazingOptics.size() ); ++OpticsNum ) {
+				if ( BareGlazingOptics[ OpticsNum ].Key == OpticsKey ) {
+					BareOpticsNum = OpticsNum;
+					break;
+				}
+			}
+			if ( BareOpticsNum >= 0 ) {
+				auto const & Optics( BareGlazingOptics[ BareOpticsNum ] );
+				tsolPhi = Optics.tsolPhi;
+				rfsolPhi = Optics.rfsolPhi;
+				rbsolPhi = Optics.rbsolPhi;
+				tvisPhi = Optics.tvisPhi;
+				rfvisPhi = Optics.rfvisPhi;
+				rbvisPhi = Optics.rbvisPhi;
+				solabsPhi = Optics.solabsPhi;
+				solabsBackPhi = Optics.solabsBackPhi;
+				tBareSolPhi = Optics.tBareSolPhi;
+				tBareVisPhi = Optics.tBareVisPhi;
+				rfBareSolPhi = Optics.rfBareSolPhi;
+				rfBareVisPhi = Optics.rfBareVisPhi;
+				rbBareSolPhi = Optics.rbBareSolPhi;
+				rbBareVisPhi = Optics.rbBareVisPhi;
+				afBareSolPhi = Optics.afBareSolPhi;
+				abBareSolPhi = Optics.abBareSolPhi;
+			} else {
+				SpectralInterpolationIndices( NGlass );
 
-				// For each wavelength, get glass layer properties at this angle of incidence
-				// from properties at normal incidence
-				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+				// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
+				// Get glass layer properties, then glazing system properties (which include the
+				// effect of inter-reflection among glass layers) at each incidence angle.
 
-						TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
-					}
+				for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
+					Phi = double( IPhi - 1 ) * 10.0;
+					CosPhi = std::cos( Phi * DegToRadians );
+					if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
 
-					// For use with between-glass shade/blind, save angular properties of isolated glass
-					// for case that all glass layers were input with spectral-average properties
-					//  only used by between-glass shades or blinds
-					if ( AllGlassIsSpectralAverage ) {
-						tBareSolPhi( IGlass, IPhi ) = tPhi( IGlass, 1 );
-						tBareVisPhi( IGlass, IPhi ) = tPhi( IGlass, 2 );
-						rfBareSolPhi( IGlass, IPhi ) = rfPhi( IGlass, 1 );
-						rfBareVisPhi( IGlass, IPhi ) = rfPhi( IGlass, 2 );
-						rbBareSolPhi( IGlass, IPhi ) = rbPhi( IGlass, 1 );
-						rbBareVisPhi( IGlass, IPhi ) = rbPhi( IGlass, 2 );
-						afBareSolPhi( IGlass, IPhi ) = max( 0.0, 1.0 - ( tBareSolPhi( IGlass, IPhi ) + rfBareSolPhi( IGlass, IPhi ) ) );
-						abBareSolPhi( IGlass, IPhi ) = max( 0.0, 1.0 - ( tBareSolPhi( IGlass, IPhi ) + rbBareSolPhi( IGlass, IPhi ) ) );
-					}
-				}
+					// For each wavelength, get glass layer properties at this angle of incidence
+					// from properties at normal incidence
+					for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+						for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
 
-				// For each wavelength in the solar spectrum, calculate system properties
-				// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence.
-				// In the following the argument "1" indicates that spectral average solar values
-				// should be used for layers without spectral data.
-				SystemSpectralPropertiesAtPhi( 1, NGlass, 0.0, 2.54 );
+							TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+						}
 
-				// Get solar properties of system by integrating over solar irradiance spectrum.
-				// For now it is assumed that the exterior and interior irradiance spectra are the same.
-				SolarSprectrumAverage( stPhi, tsolPhi( IPhi ) );
-				SolarSprectrumAverage( srfPhi, rfsolPhi( IPhi ) );
-				SolarSprectrumAverage( srbPhi, rbsolPhi( IPhi ) );
+						// For use with between-glass shade/blind, save angular properties of isolated glass
+						// for case that all glass layers were input with spectral-average properties
+						//  only used by between-glass shades or blinds
+						if ( AllGlassIsSpectralAverage ) {
+							tBareSolPhi( IGlass, IPhi ) = tPhi( IGlass, 1 );
+							tBareVisPhi( IGlass, IPhi ) = tPhi( IGlass, 2 );
+							rfBareSolPhi( IGlass, IPhi ) = rfPhi( IGlass, 1 );
+							rfBareVisPhi( IGlass, IPhi ) = rfPhi( IGlass, 2 );
+							rbBareSolPhi( IGlass, IPhi ) = rbPhi( IGlass, 1 );
+							rbBareVisPhi( IGlass, IPhi ) = rbPhi( IGlass, 2 );
+							afBareSolPhi( IGlass, IPhi ) = max( 0.0, 1.0 - ( tBareSolPhi( IGlass, IPhi ) + rfBareSolPhi( IGlass, IPhi ) ) );
+							abBareSolPhi( IGlass, IPhi ) = max( 0.0, 1.0 - ( tBareSolPhi( IGlass, IPhi ) + rbBareSolPhi( IGlass, IPhi ) ) );
+						}
+					}
 
-				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( ILam = 1; ILam <= nume; ++ILam ) {
-						sabsPhi( ILam ) = saPhi( IGlass, ILam );
+					// For each wavelength in the solar spectrum, calculate system properties
+					// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence.
+					// In the following the argument "1" indicates that spectral average solar values
+					// should be used for layers without spectral data.
+					SystemSpectralPropertiesAtPhi( 1, NGlass, 0.0, 2.54 );
+
+					// Get solar properties of system by integrating over solar irradiance spectrum.
+					// For now it is assumed that the exterior and interior irradiance spectra are the same.
+					SolarSprectrumAverage( stPhi, tsolPhi( IPhi ) );
+					SolarSprectrumAverage( srfPhi, rfsolPhi( IPhi ) );
+					SolarSprectrumAverage( srbPhi, rbsolPhi( IPhi ) );
+
+					for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+						for ( ILam = 1; ILam <= nume; ++ILam ) {
+							sabsPhi( ILam ) = saPhi( IGlass, ILam );
+						}
+						SolarSprectrumAverage( sabsPhi, solabsPhi( IGlass, IPhi ) );
 					}
-					SolarSprectrumAverage( sabsPhi, solabsPhi( IGlass, IPhi ) );
-				}
 
-				// Get visible properties of system by integrating over solar irradiance
-				// spectrum weighted by photopic response.
-				// Need to redo the calculation of system spectral properties here only if
-				// one or more glass layers have no spectral data (lquasi = .TRUE.); in this
-				// case the spectral average visible properties will be used for the layers
-				// without spectral data, as indicated by the argument "2".
+					// Get visible properties of system by integrating over solar irradiance
+					// spectrum weighted by photopic response.
+					// Need to redo the calculation of system spectral properties here only if
+					// one or more glass layers have no spectral data (lquasi = .TRUE.); in this
+					// case the spectral average visible properties will be used for the layers
+					// without spectral data, as indicated by the argument "2".
 
-				if ( lquasi ) SystemSpectralPropertiesAtPhi( 2, NGlass, 0.37, 0.78 );
-				VisibleSprectrumAverage( stPhi, tvisPhi( IPhi ) );
-				VisibleSprectrumAverage( srfPhi, rfvisPhi( IPhi ) );
-				VisibleSprectrumAverage( srbPhi, rbvisPhi( IPhi ) );
+					if ( lquasi ) SystemSpectralPropertiesAtPhi( 2, NGlass, 0.37, 0.78 );
+					VisibleSprectrumAverage( stPhi, tvisPhi( IPhi ) );
+					VisibleSprectrumAverage( srfPhi, rfvisPhi( IPhi ) );
+					VisibleSprectrumAverage( srbPhi, rbvisPhi( IPhi ) );
 
-			} // End of loop over incidence angles for front calculation
+				} // End of loop over incidence angles for front calculation
+			}
 
 			//  only used by between-glass shades or blinds
 			if ( AllGlassIsSpectralAverage ) {
@@ -945,39 +1012,63 @@ namespace WindowManager {
 				}
 			} // End of loop over glass layers in the construction for back calculation
 
-			// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
-			// Get bare glass layer properties, then glazing system properties at each incidence angle.
-			// The glazing system properties include the effect of inter-reflection among glass layers,
-			// but exclude the effect of a shade or blind if present in the construction.
-			for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
-				Phi = double( IPhi - 1 ) * 10.0;
-				CosPhi = std::cos( Phi * DegToRadians );
-				if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
-
-				// For each wavelength, get glass layer properties at this angle of incidence
-				// from properties at normal incidence
-				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+			if ( BareOpticsNum < 0 ) {
+				SpectralInterpolationIndices( NGlass );
+
+				// Loop over incidence angle from 0 to 90 deg in 10 deg increments.
+				// Get bare glass layer properties, then glazing system properties at each incidence angle.
+				// The glazing system properties include the effect of inter-reflection among glass layers,
+				// but exclude the effect of a shade or blind if present in the construction.
+				for ( IPhi = 1; IPhi <= 10; ++IPhi ) {
+					Phi = double( IPhi - 1 ) * 10.0;
+					CosPhi = std::cos( Phi * DegToRadians );
+					if ( std::abs( CosPhi ) < 0.0001 ) CosPhi = 0.0;
 
-						TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+					// For each wavelength, get glass layer properties at this angle of incidence
+					// from properties at normal incidence
+					for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+						for ( ILam = 1; ILam <= numpt( IGlass ); ++ILam ) {
+
+							TransAndReflAtPhi( CosPhi, t( IGlass, ILam ), rff( IGlass, ILam ), rbb( IGlass, ILam ), tPhi( IGlass, ILam ), rfPhi( IGlass, ILam ), rbPhi( IGlass, ILam ), lSimpleGlazingSystem, SimpleGlazingSHGC, SimpleGlazingU );
+						}
 					}
-				}
 
-				// For each wavelength in the solar spectrum, calculate system properties
-				// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence
-				SystemSpectralPropertiesAtPhi( 1, NGlass, 0.0, 2.54 );
+					// For each wavelength in the solar spectrum, calculate system properties
+					// stPhi, srfPhi, srbPhi and saPhi at this angle of incidence
+					SystemSpectralPropertiesAtPhi( 1, NGlass, 0.0, 2.54 );
 
-				// Get back absorptance properties of system by integrating over solar irradiance spectrum.
-				// For now it is assumed that the exterior and interior irradiance spectra are the same.
+					// Get back absorptance properties of system by integrating over solar irradiance spectrum.
+					// For now it is assumed that the exterior and interior irradiance spectra are the same.
 
-				for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
-					for ( j = 1; j <= nume; ++j ) {
-						sabsPhi( j ) = saPhi( IGlass, j );
+					for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
+						for ( j = 1; j <= nume; ++j ) {
+							sabsPhi( j ) = saPhi( IGlass, j );
+						}
+						SolarSprectrumAverage( sabsPhi, solabsBackPhi( IGlass, IPhi ) );
 					}
-					SolarSprectrumAverage( sabsPhi, solabsBackPhi( IGlass, IPhi ) );
-				}
 
-			} // End of loop over incidence angles for back calculation
+				} // End of loop over incidence angles for back calculation
+
+				BareGlazingOpticsData Optics;
+				Optics.Key = OpticsKey;
+				Optics.tsolPhi = tsolPhi;
+				Optics.rfsolPhi = rfsolPhi;
+				Optics.rbsolPhi = rbsolPhi;
+				Optics.tvisPhi = tvisPhi;
+				Optics.rfvisPhi = rfvisPhi;
+				Optics.rbvisPhi = rbvisPhi;
+				Optics.solabsPhi = solabsPhi;
+				Optics.solabsBackPhi = solabsBackPhi;
+				Optics.tBareSolPhi = tBareSolPhi;
+				Optics.tBareVisPhi = tBareVisPhi;
+				Optics.rfBareSolPhi = rfBareSolPhi;
+				Optics.rfBareVisPhi = rfBareVisPhi;
+				Optics.rbBareSolPhi = rbBareSolPhi;
+				Optics.rbBareVisPhi = rbBareVisPhi;
+				Optics.afBareSolPhi = afBareSolPhi;
+				Optics.abBareSolPhi = abBareSolPhi;
+				BareGlazingOptics.push_back( Optics );
+			}
 
 			for ( IGlass = 1; IGlass <= NGlass; ++IGlass ) {
 				IGlassBack = NGlass - IGlass + 1;
@@ -1545,6 +1636,19 @@ namespace WindowManager {
 			}
 		} // End of surface loop
 
+		// Bare multi-pane glazing can start its layer heat balance from a precomputed thermal response
+		// where there is no previous time step solution to start from. The tables are built cell by cell
+		// when first used (see WindowResponseTemps), since the gap convection depends on the tilt and
+		// height of the window.
+		if ( WindowResponseTablesEnvFlag ) {
+			WindowResponseTable.allocate( TotConstructs );
+			for ( ConstrNum = 1; ConstrNum <= TotConstructs; ++ConstrNum ) {
+				if ( ! Construct( ConstrNum ).TypeIsWindow || Construct( ConstrNum ).WindowTypeBSDF || Construct( ConstrNum ).WindowTypeEQL || Construct( ConstrNum ).TotGlassLayers < 2 || Construct( ConstrNum ).TotGlassLayers != Construct( ConstrNum ).TotSolidLayers ) {
+					WindowResponseTable( ConstrNum ).Status = -1;
+				}
+			}
+		}
+
 		ReportGlass();
 
 	}
@@ -1753,7 +1857,7 @@ namespace WindowManager {
 		//       AUTHOR         Adapted by F.Winkelmann from WINDOW 5
 		//                      subroutine opcalc
 		//       DATE WRITTEN   August 1999
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; interpolate with the wavelength indices from SpectralInterpolationIndices
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1782,8 +1886,11 @@ namespace WindowManager {
 		int i;
 		int iwl; // Wavelength counter
 		int j;
+		int k; // Index of the first spectral data wavelength at or above wl
 		Real64 wl; // Wavelength
 		//   index to use in tPhi, rfPhi and rbPhi
+		Real64 dwl; // Wavelength from the spectral data wavelength below wl
+		Real64 dwlt; // Spectral data wavelength interval containing wl
 
 		// For each glass layer find tPhi, rfPhi, and rbPhi at each wavelength
 
@@ -1799,9 +1906,20 @@ namespace WindowManager {
 					rbadjPhi( in, iwl ) = rbPhi( in, iquasi );
 				} else {
 					// Interpolate to get properties at the solar spectrum wavelengths
-					Interpolate( wlt( in, 1 ), tPhi( in, 1 ), numpt( in ), wl, tadjPhi( in, iwl ) );
-					Interpolate( wlt( in, 1 ), rfPhi( in, 1 ), numpt( in ), wl, rfadjPhi( in, iwl ) );
-					Interpolate( wlt( in, 1 ), rbPhi( in, 1 ), numpt( in ), wl, rbadjPhi( in, iwl ) );
+					// (same as Interpolate, with the search done once per construction)
+					k = wltIndex( in, iwl );
+					if ( k == 1 || k > numpt( in ) ) {
+						if ( k > numpt( in ) ) k = numpt( in );
+						tadjPhi( in, iwl ) = tPhi( in, k );
+						rfadjPhi( in, iwl ) = rfPhi( in, k );
+						rbadjPhi( in, iwl ) = rbPhi( in, k );
+					} else {
+						dwl = wl - wlt( in, k - 1 );
+						dwlt = wlt( in, k ) - wlt( in, k - 1 );
+						tadjPhi( in, iwl ) = tPhi( in, k - 1 ) + ( tPhi( in, k ) - tPhi( in, k - 1 ) ) * dwl / dwlt;
+						rfadjPhi( in, iwl ) = rfPhi( in, k - 1 ) + ( rfPhi( in, k ) - rfPhi( in, k - 1 ) ) * dwl / dwlt;
+						rbadjPhi( in, iwl ) = rbPhi( in, k - 1 ) + ( rbPhi( in, k ) - rbPhi( in, k - 1 ) ) * dwl / dwlt;
+					}
 				}
 			}
 		}
@@ -1947,7 +2065,7 @@ namespace WindowManager {
 		// SUBROUTINE INFORMATION:
 		//       AUTHOR         Adapted by F.Winkelmann from WINDOW 5 subroutine solar
 		//       DATE WRITTEN   August 1999
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; use the spectrum weights from InitSpectrumAverageWeights
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -1966,22 +2084,19 @@ namespace WindowManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		Real64 up; // Intermediate variables
-		Real64 down;
 		int i; // Wavelength counter
-		Real64 esol; // Solar spectrum value times delta wavelength
 
 		// FLOW
 
+		if ( ! SpectrumWeightsSet ) InitSpectrumAverageWeights();
+
 		up = 0.0;
-		down = 0.0;
 
 		for ( i = 1; i <= nume - 1; ++i ) {
-			esol = ( wle( i + 1 ) - wle( i ) ) * 0.5 * ( e( i ) + e( i + 1 ) );
-			up += 0.5 * ( p( i ) + p( i + 1 ) ) * esol;
-			down += esol;
+			up += 0.5 * ( p( i ) + p( i + 1 ) ) * esolInt( i );
 		}
 
-		psol = up / down;
+		psol = up / esolSum;
 
 	}
 
@@ -1998,7 +2113,7 @@ namespace WindowManager {
 		//       AUTHOR         Adapted by F.Winkelmann from WINDOW 5
 		//                      subroutine w4vis
 		//       DATE WRITTEN   August 1999
-		//       MODIFIED       na
+		//       MODIFIED       Oct 2026; use the spectrum weights from InitSpectrumAverageWeights
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -2018,32 +2133,129 @@ namespace WindowManager {
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
 		Real64 up; // Intermediate variables
-		Real64 down;
 		int i; // Wavelength counter
-		//   response curve
+		// FLOW
+
+		if ( ! SpectrumWeightsSet ) InitSpectrumAverageWeights();
+
+		up = 0.0;
+
+		// evisInt is zero outside the visible range
+		for ( i = 2; i <= nume; ++i ) {
+			up += 0.5 * ( p( i ) + p( i - 1 ) ) * evisInt( i );
+		}
+
+		pvis = up / evisSum;
+
+	}
+
+	//**********************************************************************
+
+	void
+	InitSpectrumAverageWeights()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets the solar and visible weights of each wavelength interval of the solar spectrum
+		// used by SolarSprectrumAverage and VisibleSprectrumAverage.
+
+		// METHODOLOGY EMPLOYED:
+		// The weights depend only on the solar spectrum and the photopic response, so they are
+		// calculated once (after any custom spectrum is read) instead of at each average; the
+		// averages are then weighted sums over the wavelengths.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		int i; // Wavelength counter
 		Real64 y30ils1; // Photopic response variables
 		Real64 y30new;
-		Real64 evis; // Solar spectrum value times photopic response
-		//   times delta wavelength
+
 		// FLOW
 
-		down = 0.0;
-		up = 0.0;
+		esolSum = 0.0;
+		for ( i = 1; i <= nume - 1; ++i ) {
+			esolInt( i ) = ( wle( i + 1 ) - wle( i ) ) * 0.5 * ( e( i ) + e( i + 1 ) );
+			esolSum += esolInt( i );
+		}
+		esolInt( nume ) = 0.0;
+
+		evisSum = 0.0;
 		y30ils1 = 0.0;
 		y30new = 0.0;
-
+		evisInt( 1 ) = 0.0;
 		for ( i = 2; i <= nume; ++i ) { //Autodesk:BoundsViolation e|wle|p(i-1) @ i=1: Changed start index from 1 to 2: wle values prevented this violation from occurring in practice
 			// Restrict to visible range
 			if ( wle( i ) >= 0.37 && wle( i ) <= 0.78 ) {
 				Interpolate( wlt3, y30, numt3, wle( i ), y30new );
-				evis = e( i - 1 ) * 0.5 * ( y30new + y30ils1 ) * ( wle( i ) - wle( i - 1 ) );
-				up += 0.5 * ( p( i ) + p( i - 1 ) ) * evis;
-				down += evis;
+				evisInt( i ) = e( i - 1 ) * 0.5 * ( y30new + y30ils1 ) * ( wle( i ) - wle( i - 1 ) );
+				evisSum += evisInt( i );
 				y30ils1 = y30new;
+			} else {
+				evisInt( i ) = 0.0;
 			}
 		}
 
-		pvis = up / down;
+		SpectrumWeightsSet = true;
+
+	}
+
+	//**********************************************************************
+
+	void
+	SpectralInterpolationIndices( int const ngllayer ) // Number of glass layers in construction
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// For each glass layer with spectral data, finds the spectral data wavelength interval
+		// containing each wavelength of the solar spectrum, for the interpolation of the layer
+		// properties in SystemSpectralPropertiesAtPhi.
+
+		// METHODOLOGY EMPLOYED:
+		// The intervals do not depend on the angle of incidence or on the property interpolated,
+		// so they are found once per construction. wltIndex is the first i with wl <= wlt(i), as in
+		// Interpolate, or numpt + 1 if there is none. The spectral data wavelengths are increasing,
+		// so the search continues from the previous wavelength when wle is increasing.
+
+		// REFERENCES:
+		// na
+
+		// Locals
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+
+		int in; // Glass layer counter
+		int iwl; // Wavelength counter
+		int i; // Spectral data wavelength counter
+		Real64 wl; // Wavelength
+		Real64 wlPrev; // Previous wavelength
+
+		for ( in = 1; in <= ngllayer; ++in ) {
+			if ( numpt( in ) <= 2 ) continue;
+			i = 1;
+			wlPrev = wle( 1 );
+			for ( iwl = 1; iwl <= nume; ++iwl ) {
+				wl = wle( iwl );
+				if ( wl < wlPrev ) i = 1;
+				while ( i <= numpt( in ) && wl > wlt( in, i ) ) ++i;
+				wltIndex( in, iwl ) = i;
+				wlPrev = wl;
+			}
+		}
 
 	}
 
@@ -2877,6 +3089,9 @@ namespace WindowManager {
 		//                      May 2006, RR: add exterior window screen
 		//                      January 2009, BG: inserted call to recalc inside face convection inside iteration loop
 		//                        per ISO 15099 Section 8.3.2.2
+		//                      Oct 2026: start bare glazing from its precomputed thermal response, if any,
+		//                       instead of the resistance network guess of StartingWindowTemps; share the
+		//                       bare glazing equations with SolveBareGlazingResponse
 		//       RE-ENGINEERED  na
 
 		// PURPOSE OF THIS SUBROUTINE:
@@ -3063,6 +3278,7 @@ namespace WindowManager {
 		// Initialize face temperatures.
 
 		StartingWindowTemps( SurfNum, AbsRadShadeFace );
+		WindowResponseTemps( SurfNum );
 
 		hcvPrev = 0.0;
 		VGapPrev = 0.0;
@@ -3141,13 +3357,7 @@ namespace WindowManager {
 			{ auto const SELECT_CASE_var( ngllayer );
 
 			if ( SELECT_CASE_var == 1 ) {
-				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
-				Bface( 2 ) = Rmir * emis( 2 ) + hcin * tin + AbsRadGlassFace( 2 );
-
-				Aface( 1, 1 ) = hr( 1 ) + scon( 1 ) + hcout;
-				Aface( 2, 1 ) = -scon( 1 );
-				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = hr( 2 ) + scon( 1 ) + hcin;
+				BareGlazingFaceEquations( tout, tin, hcout, hcin, Outir, Rmir, AbsRadGlassFace, hr, hgap, Aface, Bface );
 
 				if ( ShadeFlag == IntShadeOn || ShadeFlag == IntBlindOn ) {
 					Bface( 2 ) = Rmir * emis( 2 ) * TauShIR / ShGlReflFacIR + hcv * TGapNew + AbsRadGlassFace( 2 );
@@ -3186,24 +3396,7 @@ namespace WindowManager {
 					hgap( 1 ) = hgap( 1 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 1 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
-				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
-				Bface( 2 ) = AbsRadGlassFace( 2 );
-				Bface( 3 ) = AbsRadGlassFace( 3 );
-				Bface( 4 ) = Rmir * emis( 4 ) + hcin * tin + AbsRadGlassFace( 4 );
-
-				Aface( 1, 1 ) = hr( 1 ) + scon( 1 ) + hcout;
-				Aface( 2, 1 ) = -scon( 1 );
-
-				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = scon( 1 ) + hgap( 1 ) - A23P * hr( 2 );
-				Aface( 3, 2 ) = -hgap( 1 ) - A32P * hr( 3 );
-
-				Aface( 2, 3 ) = -hgap( 1 ) + A23P * hr( 2 );
-				Aface( 3, 3 ) = hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
-				Aface( 4, 3 ) = -scon( 2 );
-
-				Aface( 3, 4 ) = -scon( 2 );
-				Aface( 4, 4 ) = hr( 4 ) + scon( 2 ) + hcin;
+				BareGlazingFaceEquations( tout, tin, hcout, hcin, Outir, Rmir, AbsRadGlassFace, hr, hgap, Aface, Bface );
 
 				if ( ShadeFlag != BGShadeOn && ShadeFlag != BGBlindOn && SurfaceWindow( SurfNum ).AirflowThisTS > 0.0 ) {
 					Bface( 2 ) = AbsRadGlassFace( 2 ) + hcvAirflowGap * TAirflowGapNew;
@@ -3294,34 +3487,7 @@ namespace WindowManager {
 					hgap( 2 ) = hgap( 2 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 2 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
 
-				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
-				Bface( 2 ) = AbsRadGlassFace( 2 );
-				Bface( 3 ) = AbsRadGlassFace( 3 );
-				Bface( 4 ) = AbsRadGlassFace( 4 );
-				Bface( 5 ) = AbsRadGlassFace( 5 );
-				Bface( 6 ) = Rmir * emis( 6 ) + hcin * tin + AbsRadGlassFace( 6 );
-
-				Aface( 1, 1 ) = hr( 1 ) + scon( 1 ) + hcout;
-				Aface( 2, 1 ) = -scon( 1 );
-
-				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = scon( 1 ) + hgap( 1 ) - A23P * hr( 2 );
-				Aface( 3, 2 ) = -hgap( 1 ) - A32P * hr( 3 );
-
-				Aface( 2, 3 ) = -hgap( 1 ) + A23P * hr( 2 );
-				Aface( 3, 3 ) = hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
-				Aface( 4, 3 ) = -scon( 2 );
-
-				Aface( 3, 4 ) = -scon( 2 );
-				Aface( 4, 4 ) = scon( 2 ) + hgap( 2 ) - A45P * hr( 4 );
-				Aface( 5, 4 ) = -hgap( 2 ) - A54P * hr( 5 );
-
-				Aface( 4, 5 ) = -hgap( 2 ) + A45P * hr( 4 );
-				Aface( 5, 5 ) = hgap( 2 ) + scon( 3 ) + A54P * hr( 5 );
-				Aface( 6, 5 ) = -scon( 3 );
-
-				Aface( 5, 6 ) = -scon( 3 );
-				Aface( 6, 6 ) = hr( 6 ) + scon( 3 ) + hcin;
+				BareGlazingFaceEquations( tout, tin, hcout, hcin, Outir, Rmir, AbsRadGlassFace, hr, hgap, Aface, Bface );
 
 				if ( ShadeFlag != BGShadeOn && ShadeFlag != BGBlindOn && SurfaceWindow( SurfNum ).AirflowThisTS > 0.0 ) {
 					Bface( 4 ) = AbsRadGlassFace( 4 ) + hcvAirflowGap * TAirflowGapNew;
@@ -3419,44 +3585,7 @@ namespace WindowManager {
 					hrgap( 3 ) = 0.5 * std::abs( A67 ) * pow_3( thetas( 6 ) + thetas( 7 ) );
 					hgap( 3 ) = hgap( 3 ) * SurfaceWindow( SurfNum ).EdgeGlCorrFac + hrgap( 3 ) * ( SurfaceWindow( SurfNum ).EdgeGlCorrFac - 1.0 );
 				}
-				Bface( 1 ) = Outir * emis( 1 ) + hcout * tout + AbsRadGlassFace( 1 );
-				Bface( 2 ) = AbsRadGlassFace( 2 );
-				Bface( 3 ) = AbsRadGlassFace( 3 );
-				Bface( 4 ) = AbsRadGlassFace( 4 );
-				Bface( 5 ) = AbsRadGlassFace( 5 );
-				Bface( 6 ) = AbsRadGlassFace( 6 );
-				Bface( 7 ) = AbsRadGlassFace( 7 );
-				Bface( 8 ) = Rmir * emis( 8 ) + hcin * tin + AbsRadGlassFace( 8 );
-
-				Aface( 1, 1 ) = hr( 1 ) + scon( 1 ) + hcout;
-				Aface( 2, 1 ) = -scon( 1 );
-
-				Aface( 1, 2 ) = -scon( 1 );
-				Aface( 2, 2 ) = scon( 1 ) + hgap( 1 ) - A23P * hr( 2 );
-				Aface( 3, 2 ) = -hgap( 1 ) - A32P * hr( 3 );
-
-				Aface( 2, 3 ) = -hgap( 1 ) + A23P * hr( 2 );
-				Aface( 3, 3 ) = hgap( 1 ) + scon( 2 ) + A32P * hr( 3 );
-				Aface( 4, 3 ) = -scon( 2 );
-
-				Aface( 3, 4 ) = -scon( 2 );
-				Aface( 4, 4 ) = scon( 2 ) + hgap( 2 ) - A45P * hr( 4 );
-				Aface( 5, 4 ) = -hgap( 2 ) - A54P * hr( 5 );
-
-				Aface( 4, 5 ) = -hgap( 2 ) + A45P * hr( 4 );
-				Aface( 5, 5 ) = hgap( 2 ) + scon( 3 ) + A54P * hr( 5 );
-				Aface( 6, 5 ) = -scon( 3 );
-
-				Aface( 5, 6 ) = -scon( 3 );
-				Aface( 6, 6 ) = scon( 3 ) + hgap( 3 ) - A67P * hr( 6 );
-				Aface( 7, 6 ) = -hgap( 3 ) - A76P * hr( 7 );
-
-				Aface( 6, 7 ) = -hgap( 3 ) + A67P * hr( 6 );
-				Aface( 7, 7 ) = hgap( 3 ) + scon( 4 ) + A76P * hr( 7 );
-				Aface( 8, 7 ) = -scon( 4 );
-
-				Aface( 7, 8 ) = -scon( 4 );
-				Aface( 8, 8 ) = hr( 8 ) + scon( 4 ) + hcin;
+				BareGlazingFaceEquations( tout, tin, hcout, hcin, Outir, Rmir, AbsRadGlassFace, hr, hgap, Aface, Bface );
 
 				if ( ShadeFlag == IntShadeOn || ShadeFlag == IntBlindOn ) {
 					Bface( 8 ) = Rmir * emis( 8 ) * TauShIR / ShGlReflFacIR + hcv * TGapNew + AbsRadGlassFace( 8 );
@@ -5075,6 +5204,731 @@ namespace WindowManager {
 		}
 	}
 
+	//****************************************************************************
+
+	void
+	BareGlazingFaceEquations(
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Real64 const OutIR, // IR radiance of the exterior surround (W/m2)
+		Real64 const RmIR, // IR radiance of the interior surround (W/m2)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed at each glass face (W/m2)
+		Array1< Real64 > const & hr, // Radiative conductance of each glass face (W/m2-K)
+		Array1< Real64 > const & hgap, // Gap gas conductance (W/m2-K)
+		Array2< Real64 > & Aface, // Coefficient in equation Aface*thetas = Bface
+		Array1< Real64 > & Bface // Coefficient in equation Aface*thetas = Bface
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluates the coefficients Aface and Bface of the glass face heat balance equations
+		// of bare multi-pane glazing (no shading device, no airflow gap) for the given boundary
+		// conditions, radiative conductances and gap gas conductances.
+
+		// METHODOLOGY EMPLOYED:
+		// Written for any number of glass layers of the current construction. Used by
+		// SolveForWindowTemperatures, which then modifies the equations for a shading device
+		// or an airflow gap, and by SolveBareGlazingResponse.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int IGlass; // Glass layer number
+		int IGap; // Gap number
+		int i; // Face numbers
+		int j;
+		Real64 AijP; // IR exchange factors between the faces of a gap (A23P and A32P for gap 1)
+		Real64 AjiP;
+
+		Aface = 0.0;
+		Bface = 0.0;
+
+		for ( i = 1; i <= nglface; ++i ) {
+			Bface( i ) = AbsFace( i );
+		}
+		Bface( 1 ) = OutIR * emis( 1 ) + HcOut * ToutK + AbsFace( 1 );
+		Bface( nglface ) = RmIR * emis( nglface ) + HcIn * TinK + AbsFace( nglface );
+
+		// Conduction through each glass layer
+		for ( IGlass = 1; IGlass <= ngllayer; ++IGlass ) {
+			i = 2 * IGlass - 1;
+			j = 2 * IGlass;
+			Aface( j, i ) = -scon( IGlass );
+			Aface( i, j ) = -scon( IGlass );
+		}
+		Aface( 1, 1 ) = hr( 1 ) + scon( 1 ) + HcOut;
+		Aface( nglface, nglface ) = hr( nglface ) + scon( ngllayer ) + HcIn;
+
+		// Gas conductance and IR exchange across each gap
+		for ( IGap = 1; IGap < ngllayer; ++IGap ) {
+			i = 2 * IGap;
+			j = i + 1;
+			AijP = -emis( j ) / ( 1.0 - ( 1.0 - emis( i ) ) * ( 1.0 - emis( j ) ) );
+			AjiP = emis( i ) / ( 1.0 - ( 1.0 - emis( i ) ) * ( 1.0 - emis( j ) ) );
+			Aface( i, i ) = scon( IGap ) + hgap( IGap ) - AijP * hr( i );
+			Aface( j, i ) = -hgap( IGap ) - AjiP * hr( j );
+			Aface( i, j ) = -hgap( IGap ) + AijP * hr( i );
+			Aface( j, j ) = hgap( IGap ) + scon( IGap + 1 ) + AjiP * hr( j );
+		}
+
+	}
+
+	//****************************************************************************
+
+	bool
+	SolveBareGlazingResponse(
+		int const SurfNum, // Surface number, for the gap convection
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Real64 const OutIR, // IR radiance of the exterior surround (W/m2)
+		Real64 const RmIR, // IR radiance of the interior surround (W/m2)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed at each glass face (W/m2)
+		Array1< Real64 > & Theta, // Glass face temperatures (K)
+		Array2< Real64 > & Jac, // LU decomposition of the face heat balance Jacobian at the solution
+		Array1_int & indx // Vector of row permutations of Jac
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Solves the glass face heat balance of bare multi-pane glazing for the given boundary
+		// conditions and returns the LU decomposition of the Jacobian of the face heat balance
+		// at the solution. Returns false if the solution does not converge.
+
+		// METHODOLOGY EMPLOYED:
+		// Same successive substitution with relaxation as SolveForWindowTemperatures, to a much
+		// tighter tolerance. In the Jacobian the radiative terms hr*theta, which go as theta**4,
+		// are differentiated (4*hr); the dependence of the gap gas conductance on the face
+		// temperatures is neglected.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		int const MaxIterations( 200 ); // Maximum allowed number of iterations
+		Real64 const errtemptol( 1.0e-4 ); // Tolerance on errtemp for convergence
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int i; // Face counter
+		int IGap; // Gap number
+		int iter; // Iteration number
+		Real64 errtemp; // Absolute value of sum of face temperature differences
+		//   between iterations, divided by number of faces
+		Real64 ThetaNew; // Relaxed face temperature (K)
+		Real64 gr; // Grashof number of gas in a gap
+		Real64 con; // Gap gas conductivity
+		Real64 pr; // Gap gas Prandtl number
+		Real64 nu; // Gap gas Nusselt number
+		Real64 d; // +1 if number of row interchanges is even,
+		// -1 if odd (in LU decomposition)
+		Array1D< Real64 > hr( 10 ); // Radiative conductance (W/m2-K)
+		Array1D< Real64 > hgap( 5 ); // Gap gas conductance (W/m2-K)
+		Array2D< Real64 > Aface( 10, 10 ); // Coefficient in equation Aface*thetas = Bface
+		Array1D< Real64 > Bface( 10 ); // Coefficient in equation Aface*thetas = Bface
+
+		// Start from a linear profile between the outside and inside air temperatures
+		for ( i = 1; i <= nglface; ++i ) {
+			Theta( i ) = ToutK + ( TinK - ToutK ) * i / ( nglface + 1.0 );
+		}
+
+		iter = 0;
+		errtemp = errtemptol * 2.0;
+
+		while ( iter < MaxIterations && errtemp > errtemptol ) {
+
+			for ( i = 1; i <= nglface; ++i ) {
+				hr( i ) = emis( i ) * sigma * pow_3( Theta( i ) );
+			}
+			for ( IGap = 1; IGap < ngllayer; ++IGap ) {
+				WindowGasConductance( Theta( 2 * IGap ), Theta( 2 * IGap + 1 ), IGap, con, pr, gr );
+				NusseltNumber( SurfNum, Theta( 2 * IGap ), Theta( 2 * IGap + 1 ), IGap, gr, pr, nu );
+				hgap( IGap ) = con / gap( IGap ) * nu;
+			}
+
+			BareGlazingFaceEquations( ToutK, TinK, HcOut, HcIn, OutIR, RmIR, AbsFace, hr, hgap, Aface, Bface );
+			LUdecomposition( Aface, nglface, indx, d );
+			LUsolution( Aface, nglface, indx, Bface );
+
+			++iter;
+			errtemp = 0.0;
+			for ( i = 1; i <= nglface; ++i ) {
+				if ( iter < MaxIterations / 4 ) {
+					ThetaNew = 0.5 * Theta( i ) + 0.5 * Bface( i );
+				} else {
+					ThetaNew = 0.75 * Theta( i ) + 0.25 * Bface( i );
+				}
+				errtemp += std::abs( ThetaNew - Theta( i ) );
+				Theta( i ) = ThetaNew;
+			}
+			errtemp /= nglface;
+
+		}
+
+		if ( errtemp > errtemptol ) return false;
+
+		// Jacobian of the face heat balance at the solution
+		for ( i = 1; i <= nglface; ++i ) {
+			hr( i ) = 4.0 * emis( i ) * sigma * pow_3( Theta( i ) );
+		}
+		BareGlazingFaceEquations( ToutK, TinK, HcOut, HcIn, OutIR, RmIR, AbsFace, hr, hgap, Jac, Bface );
+		LUdecomposition( Jac, nglface, indx, d );
+
+		return true;
+
+	}
+
+	//****************************************************************************
+
+	void
+	InitWindowResponseTable(
+		int const ConstrNum, // Construction number
+		int const SurfNum // Surface number of a window with this construction
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Sets up the precomputed thermal response of a bare multi-pane glazing construction.
+		// The grid nodes are solved and the grid cells checked when first used (see
+		// BuildWindowResponseCell).
+
+		// METHODOLOGY EMPLOYED:
+		// The layer properties and the window geometry (tilt and height, for the gap convection)
+		// are those of the window currently being calculated by CalcWindowHeatBalance.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NumNodes; // Number of grid nodes
+		int NumCells; // Number of grid cells
+
+		auto & Table( WindowResponseTable( ConstrNum ) );
+		Table.Status = 1;
+		Table.NumFaces = nglface;
+		Table.Tilt = tilt;
+		Table.Height = Surface( SurfNum ).Height;
+		Table.MaxError = 0.0;
+		Table.NumCellsRejected = 0;
+		NumNodes = size( WinRespToutAxis ) * size( WinRespTinAxis ) * size( WinRespHcOutAxis ) * size( WinRespHcInAxis );
+		NumCells = ( size( WinRespToutAxis ) - 1 ) * ( size( WinRespTinAxis ) - 1 ) * ( size( WinRespHcOutAxis ) - 1 ) * ( size( WinRespHcInAxis ) - 1 );
+		Table.Response.allocate( nglface * ( nglface + 3 ), NumNodes );
+		Table.NodeStatus.dimension( NumNodes, 0 );
+		Table.CellStatus.dimension( NumCells, 0 );
+
+	}
+
+	//****************************************************************************
+
+	bool
+	LocateWindowResponseCell(
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Array1_int & Lower, // Lower node of the grid cell along each axis
+		Array1< Real64 > & Frac // Position in the grid cell along each axis
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Finds the cell of the response table grid containing the given air temperatures and
+		// film conductances (axes 1 to 4, in that order). Returns false if they are outside the grid.
+
+		// METHODOLOGY EMPLOYED:
+		// The face temperatures vary much more nearly linearly with the logarithm of the film
+		// conductances than with the film conductances, so Frac is a logarithmic position along
+		// those two axes.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Array1D< Real64 > const * const Axis[ 4 ] = { &WinRespToutAxis, &WinRespTinAxis, &WinRespHcOutAxis, &WinRespHcInAxis };
+		Real64 const Value[ 4 ] = { ToutK - TKelvin, TinK - TKelvin, HcOut, HcIn };
+		int Dim; // Axis counter
+		int j; // Node counter along an axis
+
+		for ( Dim = 1; Dim <= 4; ++Dim ) {
+			auto const & Ax( *Axis[ Dim - 1 ] );
+			Real64 const V( Value[ Dim - 1 ] );
+			if ( V < Ax( 1 ) || V > Ax( isize( Ax ) ) ) return false;
+			j = 1;
+			while ( j < isize( Ax ) - 1 && V > Ax( j + 1 ) ) ++j;
+			Lower( Dim ) = j;
+			if ( Dim <= 2 ) {
+				Frac( Dim ) = ( V - Ax( j ) ) / ( Ax( j + 1 ) - Ax( j ) );
+			} else {
+				Frac( Dim ) = std::log( V / Ax( j ) ) / std::log( Ax( j + 1 ) / Ax( j ) );
+			}
+		}
+
+		return true;
+
+	}
+
+	//****************************************************************************
+
+	int
+	WindowResponseCellNum( Array1_int const & Lower ) // Lower node of the grid cell along each axis
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns the number of the response table grid cell with the given lower nodes.
+
+		// METHODOLOGY EMPLOYED:
+		// Cells are numbered like the grid nodes, outside air temperature varying slowest
+		// and inside film conductance fastest.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		// na
+
+		return ( ( ( Lower( 1 ) - 1 ) * ( isize( WinRespTinAxis ) - 1 ) + Lower( 2 ) - 1 ) * ( isize( WinRespHcOutAxis ) - 1 ) + Lower( 3 ) - 1 ) * ( isize( WinRespHcInAxis ) - 1 ) + Lower( 4 );
+
+	}
+
+	//****************************************************************************
+
+	bool
+	BuildWindowResponseCell(
+		int const ConstrNum, // Construction number
+		int const SurfNum, // Surface number of a window with this construction
+		Array1_int const & Lower // Lower node of the grid cell along each axis
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Solves the nodes of a grid cell of the precomputed thermal response of a bare multi-pane
+		// glazing construction that have not been solved yet, and checks the cell against the full
+		// solution. Returns true if the cell can be used.
+
+		// METHODOLOGY EMPLOYED:
+		// At each node the face temperatures are solved without absorbed radiation and with black
+		// body surrounds at the air temperatures. Their sensitivities to the radiation absorbed at
+		// each face and to the exterior and interior IR radiance are obtained from the Jacobian at
+		// the solution. The response interpolated at the center of the cell, with absorbed solar
+		// radiation and a sky colder than the outside air, is then checked against the full
+		// solution; the cell is only used if the largest difference is within WinRespMaxError.
+		// A cell thus costs at most 17 solutions, fewer where it shares nodes with cells already
+		// built.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using General::RoundSigDigits;
+
+		// Return value
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int NumInputs; // Number of linear inputs: radiation absorbed at each face, exterior and interior IR radiance
+		int CellNum; // Grid cell number
+		int Corner; // Corner of the grid cell, one bit per axis
+		int Node; // Grid node number
+		int iTout; // Grid indices of the node
+		int iTin;
+		int iHcOut;
+		int iHcIn;
+		int i; // Face counter
+		int k; // Input counter
+		Real64 ToutK; // Outside air temperature (K)
+		Real64 TinK; // Inside air temperature (K)
+		Real64 HcOut; // Outside convective film conductance (W/m2-K)
+		Real64 HcIn; // Inside convective film conductance (W/m2-K)
+		Real64 CellError; // Largest face temperature difference from the full solution at the center of the cell (K)
+		Array1D< Real64 > AbsFace( 10, 0.0 ); // Radiation absorbed at each glass face (W/m2)
+		Array1D< Real64 > Theta( 10, 0.0 ); // Glass face temperatures from the full solution (K)
+		Array1D< Real64 > ThetaTable( 10, 0.0 ); // Glass face temperatures from the table (K)
+		Array1D< Real64 > Rhs( 10, 0.0 ); // Right hand side, then sensitivities of the face temperatures
+		Array2D< Real64 > Jac( 10, 10, 0.0 ); // LU decomposition of the face heat balance Jacobian
+		Array1D_int indx( 10, 0 ); // Vector of row permutations in LU decomposition
+
+		auto & Table( WindowResponseTable( ConstrNum ) );
+		CellNum = WindowResponseCellNum( Lower );
+		if ( Table.CellStatus( CellNum ) != 0 ) return ( Table.CellStatus( CellNum ) == 1 );
+		Table.CellStatus( CellNum ) = -1; // Until the cell is complete and checked
+		NumInputs = nglface + 2;
+
+		for ( Corner = 0; Corner < 16; ++Corner ) {
+			iTout = Lower( 1 ) + ( Corner & 1 );
+			iTin = Lower( 2 ) + ( ( Corner >> 1 ) & 1 );
+			iHcOut = Lower( 3 ) + ( ( Corner >> 2 ) & 1 );
+			iHcIn = Lower( 4 ) + ( ( Corner >> 3 ) & 1 );
+			Node = ( ( ( iTout - 1 ) * isize( WinRespTinAxis ) + iTin - 1 ) * isize( WinRespHcOutAxis ) + iHcOut - 1 ) * isize( WinRespHcInAxis ) + iHcIn;
+			if ( Table.NodeStatus( Node ) == -1 ) return false;
+			if ( Table.NodeStatus( Node ) == 1 ) continue;
+			Table.NodeStatus( Node ) = -1; // Until the node is solved
+			ToutK = WinRespToutAxis( iTout ) + TKelvin;
+			TinK = WinRespTinAxis( iTin ) + TKelvin;
+			HcOut = WinRespHcOutAxis( iHcOut );
+			HcIn = WinRespHcInAxis( iHcIn );
+			if ( ! SolveBareGlazingResponse( SurfNum, ToutK, TinK, HcOut, HcIn, sigma * pow_4( ToutK ), sigma * pow_4( TinK ), AbsFace, Theta, Jac, indx ) ) return false;
+			for ( i = 1; i <= nglface; ++i ) {
+				Table.Response( i, Node ) = Theta( i );
+			}
+			for ( k = 1; k <= NumInputs; ++k ) {
+				Rhs = 0.0;
+				if ( k <= nglface ) {
+					Rhs( k ) = 1.0;
+				} else if ( k == nglface + 1 ) {
+					Rhs( 1 ) = emis( 1 );
+				} else {
+					Rhs( nglface ) = emis( nglface );
+				}
+				LUsolution( Jac, nglface, indx, Rhs );
+				for ( i = 1; i <= nglface; ++i ) {
+					Table.Response( i + k * nglface, Node ) = Rhs( i );
+				}
+			}
+			Table.NodeStatus( Node ) = 1;
+		}
+
+		// Check the cell against the full solution at its center,
+		// with 100 W/m2 absorbed by the outer glass and 20 W/m2 by each of the others
+		for ( i = 1; i <= nglface; ++i ) {
+			AbsFace( i ) = ( i <= 2 ) ? 50.0 : 10.0;
+		}
+		ToutK = 0.5 * ( WinRespToutAxis( Lower( 1 ) ) + WinRespToutAxis( Lower( 1 ) + 1 ) ) + TKelvin;
+		TinK = 0.5 * ( WinRespTinAxis( Lower( 2 ) ) + WinRespTinAxis( Lower( 2 ) + 1 ) ) + TKelvin;
+		HcOut = 0.5 * ( WinRespHcOutAxis( Lower( 3 ) ) + WinRespHcOutAxis( Lower( 3 ) + 1 ) );
+		HcIn = 0.5 * ( WinRespHcInAxis( Lower( 4 ) ) + WinRespHcInAxis( Lower( 4 ) + 1 ) );
+		if ( ! SolveBareGlazingResponse( SurfNum, ToutK, TinK, HcOut, HcIn, sigma * pow_4( ToutK - 10.0 ), sigma * pow_4( TinK ), AbsFace, Theta, Jac, indx ) ) return false;
+		if ( ! InterpolateWindowResponse( Table, ToutK, TinK, HcOut, HcIn, sigma * pow_4( ToutK - 10.0 ), sigma * pow_4( TinK ), AbsFace, ThetaTable ) ) return false;
+		CellError = 0.0;
+		for ( i = 1; i <= nglface; ++i ) {
+			CellError = max( CellError, std::abs( ThetaTable( i ) - Theta( i ) ) );
+		}
+		Table.MaxError = max( Table.MaxError, CellError );
+
+		if ( CellError <= WinRespMaxError ) {
+			Table.CellStatus( CellNum ) = 1;
+		} else {
+			++Table.NumCellsRejected;
+			if ( DisplayExtraWarnings && Table.NumCellsRejected == 1 ) {
+				ShowWarningError( "BuildWindowResponseCell: the precomputed thermal response is not used for some conditions for window construction=\"" + Construct( ConstrNum ).Name + "\"." );
+				ShowContinueError( "...face temperature difference from the full solution=" + RoundSigDigits( CellError, 3 ) + " K." );
+			}
+		}
+
+		return ( Table.CellStatus( CellNum ) == 1 );
+
+	}
+
+	//****************************************************************************
+
+	bool
+	InterpolateWindowResponse(
+		WindowResponseTableData const & Table, // Precomputed response of the construction
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Real64 const OutIR, // IR radiance of the exterior surround (W/m2)
+		Real64 const RmIR, // IR radiance of the interior surround (W/m2)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed at each glass face (W/m2)
+		Array1< Real64 > & Theta // Glass face temperatures (K)
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Evaluates the glass face temperatures of bare glazing from its precomputed response
+		// (see BuildWindowResponseCell). Returns false if the air temperatures or film
+		// conductances are outside the grid of the table, or if the nodes of their grid cell
+		// have not all been solved.
+
+		// METHODOLOGY EMPLOYED:
+		// Multilinear interpolation between the 16 nodes of the grid cell, in the air temperatures
+		// and in the logarithm of the film conductances (see LocateWindowResponseCell). At each
+		// node the face temperatures are extended linearly from the reference conditions of the
+		// node to the actual absorbed radiation and exterior and interior IR radiance.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Return value
+
+		// Locals
+		// FUNCTION ARGUMENT DEFINITIONS:
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int const NumFaces( Table.NumFaces );
+		int const AxisSize[ 4 ] = { isize( WinRespToutAxis ), isize( WinRespTinAxis ), isize( WinRespHcOutAxis ), isize( WinRespHcInAxis ) };
+		Array1D_int Lower( 4 ); // Lower node of the grid cell along each axis
+		Array1D< Real64 > Frac( 4 ); // Position in the grid cell along each axis
+		Array1D_int CornerNode( 16 ); // Grid node number of each corner of the cell
+		Array1D< Real64 > CornerWeight( 16 ); // Interpolation weight of each corner of the cell
+		int Dim; // Axis counter
+		int Corner; // Corner of the grid cell, one bit per axis
+		int Node; // Grid node number
+		int i; // Face counter
+		int k; // Face counter for the absorbed radiation
+		int Upper; // 1 for the upper node along an axis
+		Real64 Weight; // Interpolation weight of the node
+		Real64 dOutIR; // Exterior and interior IR radiance relative to the node (W/m2)
+		Real64 dRmIR;
+		Real64 ThetaNode; // Face temperature at the node (K)
+
+		if ( ! LocateWindowResponseCell( ToutK, TinK, HcOut, HcIn, Lower, Frac ) ) return false;
+
+		for ( Corner = 0; Corner < 16; ++Corner ) {
+			Weight = 1.0;
+			Node = 0;
+			for ( Dim = 1; Dim <= 4; ++Dim ) {
+				Upper = ( Corner >> ( Dim - 1 ) ) & 1;
+				Weight *= ( Upper == 1 ) ? Frac( Dim ) : 1.0 - Frac( Dim );
+				Node = Node * AxisSize[ Dim - 1 ] + Lower( Dim ) - 1 + Upper;
+			}
+			CornerNode( Corner + 1 ) = Node + 1;
+			CornerWeight( Corner + 1 ) = Weight;
+			if ( Weight != 0.0 && Table.NodeStatus( Node + 1 ) != 1 ) return false;
+		}
+
+		for ( i = 1; i <= NumFaces; ++i ) {
+			Theta( i ) = 0.0;
+		}
+
+		for ( Corner = 0; Corner < 16; ++Corner ) {
+			Weight = CornerWeight( Corner + 1 );
+			if ( Weight == 0.0 ) continue;
+			Node = CornerNode( Corner + 1 );
+
+			dOutIR = OutIR - sigma * pow_4( WinRespToutAxis( Lower( 1 ) + ( Corner & 1 ) ) + TKelvin );
+			dRmIR = RmIR - sigma * pow_4( WinRespTinAxis( Lower( 2 ) + ( ( Corner >> 1 ) & 1 ) ) + TKelvin );
+			for ( i = 1; i <= NumFaces; ++i ) {
+				ThetaNode = Table.Response( i, Node );
+				for ( k = 1; k <= NumFaces; ++k ) {
+					ThetaNode += Table.Response( i + k * NumFaces, Node ) * AbsFace( k );
+				}
+				ThetaNode += Table.Response( i + ( NumFaces + 1 ) * NumFaces, Node ) * dOutIR;
+				ThetaNode += Table.Response( i + ( NumFaces + 2 ) * NumFaces, Node ) * dRmIR;
+				Theta( i ) += Weight * ThetaNode;
+			}
+		}
+
+		return true;
+
+	}
+
+	//****************************************************************************
+
+	void
+	WindowResponseTemps( int const SurfNum ) // Surface number
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   Oct 2026
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Replaces the resistance network guess of StartingWindowTemps for the glass face
+		// temperatures (thetas) of a bare multi-pane window, at the beginning of an environment or
+		// when a storm window is added or removed, by the precomputed thermal response of its
+		// construction. The other time steps start from the previous time step solution, which is
+		// left as is.
+
+		// METHODOLOGY EMPLOYED:
+		// The interpolated temperatures are only the starting point of the iteration in
+		// SolveForWindowTemperatures, which still has to converge on the full heat balance.
+		// Unlike the resistance network guess they account for the absorbed radiation and the
+		// gap and surface radiative exchange. The grid cell is built on first use.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// Locals
+		// SUBROUTINE ARGUMENT DEFINITIONS:
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		// na
+
+		// INTERFACE BLOCK SPECIFICATIONS:
+		// na
+
+		// DERIVED TYPE DEFINITIONS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int ConstrNum; // Construction number
+		int ShadeFlag; // Shading flag
+		Array1D_int Lower( 4 ); // Lower node of the grid cell along each axis
+		Array1D< Real64 > Frac( 4 ); // Position in the grid cell along each axis
+
+		if ( ! allocated( WindowResponseTable ) ) return;
+		if ( ! BeginEnvrnFlag && SurfaceWindow( SurfNum ).StormWinFlag == SurfaceWindow( SurfNum ).StormWinFlagPrevDay ) return;
+
+		ShadeFlag = SurfaceWindow( SurfNum ).ShadingFlag;
+		if ( ShadeFlag > ShadeOff && ShadeFlag != SwitchableGlazing ) return;
+		if ( SurfaceWindow( SurfNum ).AirflowThisTS > 0.0 || SurfaceWindow( SurfNum ).EdgeGlCorrFac > 1.0 ) return;
+
+		ConstrNum = Surface( SurfNum ).Construction;
+		if ( SurfaceWindow( SurfNum ).StormWinFlag > 0 ) ConstrNum = Surface( SurfNum ).StormWinConstruction;
+
+		auto & Table( WindowResponseTable( ConstrNum ) );
+		if ( Table.Status == 0 ) InitWindowResponseTable( ConstrNum, SurfNum );
+		if ( Table.Status != 1 || Table.NumFaces != nglface ) return;
+		if ( std::abs( tilt - Table.Tilt ) > 1.0 || std::abs( Surface( SurfNum ).Height - Table.Height ) > 0.1 * Table.Height ) return;
+
+		if ( ! LocateWindowResponseCell( tout, tin, hcout, hcin, Lower, Frac ) ) return;
+		if ( ! BuildWindowResponseCell( ConstrNum, SurfNum, Lower ) ) return;
+		InterpolateWindowResponse( Table, tout, tin, hcout, hcin, Outir, Rmir, AbsRadGlassFace, thetas );
+
+	}
+
 	//*******************************************************************************************************
 
 	void
@@ -59,9 +59,13 @@
 #ifndef WindowManager_hh_INCLUDED
 #define WindowManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1A.hh>
 #include <ObjexxFCL/Array2A.hh>
+#include <ObjexxFCL/Array2D.hh>
 #include <ObjexxFCL/Array3D.hh>
 
 // EnergyPlus Headers
@@ -173,6 +177,14 @@ namespace WindowManager {
 	extern Array2D< Real64 > rbadjPhi; // back reflectance at angle of incidence
 
 	extern Array1D_int numpt; // Number of spectral data wavelengths for each layer; =2 if no spectra data for a layer
+	extern Array2D_int wltIndex; // For each layer, index of the first wavelength in wlt at or above each wavelength in wle
+	// (numpt + 1 if none)
+	extern Array1D< Real64 > esolInt; // Solar spectrum value times delta wavelength for each wavelength interval in wle
+	extern Array1D< Real64 > evisInt; // Solar spectrum value times photopic response times delta wavelength,
+	// for the wavelength interval ending at each wavelength in wle (zero outside the visible range)
+	extern Real64 esolSum; // Sum of esolInt
+	extern Real64 evisSum; // Sum of evisInt
+	extern bool SpectrumWeightsSet; // True when esolInt and evisInt are set for the current solar spectrum
 	extern Array1D< Real64 > stPhi; // Glazing system transmittance at angle of incidence for each wavelength in wle
 	extern Array1D< Real64 > srfPhi; // Glazing system front reflectance at angle of incidence for each wavelength in wle
 	extern Array1D< Real64 > srbPhi; // Glazing system back reflectance at angle of incidence for each wavelenth in wle
@@ -195,6 +207,64 @@ namespace WindowManager {
 	extern Array1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
 	extern Array1D< Real64 > CosPhiIndepVar; // Cos of incidence angles at 10-deg increments for curve fits
 
+	// Types
+
+	struct WindowResponseTableData
+	{
+		// Members
+		int Status; // 0 = not set up yet, 1 = set up, -1 = not used
+		int NumFaces; // Number of glass faces (2 * number of glass layers)
+		Real64 Tilt; // Tilt of the window the table was set up for (deg)
+		Real64 Height; // Height of the window the table was set up for (m)
+		Real64 MaxError; // Largest face temperature difference from the full solution at the checked cells (K)
+		int NumCellsRejected; // Number of grid cells not used because of their error
+		Array2D< Real64 > Response; // Face temperatures at the reference conditions of each grid node, followed by
+		//  their sensitivities to the radiation absorbed at each face and to the exterior and interior IR radiance
+		Array1D_int NodeStatus; // 0 = not solved yet, 1 = solved, -1 = no convergence
+		Array1D_int CellStatus; // 0 = not checked yet, 1 = within the error bound, -1 = not used
+
+		// Default Constructor
+		WindowResponseTableData() :
+			Status( 0 ),
+			NumFaces( 0 ),
+			Tilt( 0.0 ),
+			Height( 0.0 ),
+			MaxError( 0.0 ),
+			NumCellsRejected( 0 )
+		{}
+
+	};
+
+	struct BareGlazingOpticsData
+	{
+		// Members
+		std::vector< int > Key; // Glass layer materials and spectral data sets, front to back, and flags affecting their optics
+		Array1D< Real64 > tsolPhi; // Glazing system solar transmittance for each angle of incidence
+		Array1D< Real64 > rfsolPhi; // Glazing system solar front reflectance for each angle of incidence
+		Array1D< Real64 > rbsolPhi; // Glazing system solar back reflectance for each angle of incidence
+		Array1D< Real64 > tvisPhi; // Glazing system visible transmittance for each angle of incidence
+		Array1D< Real64 > rfvisPhi; // Glazing system visible front reflectance for each angle of incidence
+		Array1D< Real64 > rbvisPhi; // Glazing system visible back reflectance for each angle of incidence
+		Array2D< Real64 > solabsPhi; // Glazing system solar absorptance for each angle of incidence
+		Array2D< Real64 > solabsBackPhi; // Glazing system back solar absorptance for each angle of incidence
+		Array2D< Real64 > tBareSolPhi; // Isolated glass solar transmittance for each incidence angle
+		Array2D< Real64 > tBareVisPhi; // Isolated glass visible transmittance for each incidence angle
+		Array2D< Real64 > rfBareSolPhi; // Isolated glass front solar reflectance for each incidence angle
+		Array2D< Real64 > rfBareVisPhi; // Isolated glass front visible reflectance for each incidence angle
+		Array2D< Real64 > rbBareSolPhi; // Isolated glass back solar reflectance for each incidence angle
+		Array2D< Real64 > rbBareVisPhi; // Isolated glass back visible reflectance for each incidence angle
+		Array2D< Real64 > afBareSolPhi; // Isolated glass front solar absorptance for each incidence angle
+		Array2D< Real64 > abBareSolPhi; // Isolated glass back solar absorptance for each incidence angle
+
+		// Default Constructor
+		BareGlazingOpticsData()
+		{}
+
+	};
+
+	// Object Data
+	extern Array1D< WindowResponseTableData > WindowResponseTable; // Precomputed thermal response of bare glazing, by construction
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -253,6 +323,16 @@ namespace WindowManager {
 
 	//**********************************************************************
 
+	void
+	InitSpectrumAverageWeights();
+
+	//**********************************************************************
+
+	void
+	SpectralInterpolationIndices( int const ngllayer ); // Number of glass layers in construction
+
+	//**********************************************************************
+
 	void
 	Interpolate(
 		Array1A< Real64 > x, // Array of data points for independent variable
@@ -397,6 +477,94 @@ namespace WindowManager {
 		Real64 & gnu // Gap gas Nusselt number
 	);
 
+	//****************************************************************************
+
+	void
+	BareGlazingFaceEquations(
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Real64 const OutIR, // IR radiance of the exterior surround (W/m2)
+		Real64 const RmIR, // IR radiance of the interior surround (W/m2)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed at each glass face (W/m2)
+		Array1< Real64 > const & hr, // Radiative conductance of each glass face (W/m2-K)
+		Array1< Real64 > const & hgap, // Gap gas conductance (W/m2-K)
+		Array2< Real64 > & Aface, // Coefficient in equation Aface*thetas = Bface
+		Array1< Real64 > & Bface // Coefficient in equation Aface*thetas = Bface
+	);
+
+	//****************************************************************************
+
+	bool
+	SolveBareGlazingResponse(
+		int const SurfNum, // Surface number, for the gap convection
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Real64 const OutIR, // IR radiance of the exterior surround (W/m2)
+		Real64 const RmIR, // IR radiance of the interior surround (W/m2)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed at each glass face (W/m2)
+		Array1< Real64 > & Theta, // Glass face temperatures (K)
+		Array2< Real64 > & Jac, // LU decomposition of the face heat balance Jacobian at the solution
+		Array1_int & indx // Vector of row permutations of Jac
+	);
+
+	//****************************************************************************
+
+	void
+	InitWindowResponseTable(
+		int const ConstrNum, // Construction number
+		int const SurfNum // Surface number of a window with this construction
+	);
+
+	//****************************************************************************
+
+	bool
+	LocateWindowResponseCell(
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Array1_int & Lower, // Lower node of the grid cell along each axis
+		Array1< Real64 > & Frac // Position in the grid cell along each axis
+	);
+
+	//****************************************************************************
+
+	int
+	WindowResponseCellNum( Array1_int const & Lower ); // Lower node of the grid cell along each axis
+
+	//****************************************************************************
+
+	bool
+	BuildWindowResponseCell(
+		int const ConstrNum, // Construction number
+		int const SurfNum, // Surface number of a window with this construction
+		Array1_int const & Lower // Lower node of the grid cell along each axis
+	);
+
+	//****************************************************************************
+
+	bool
+	InterpolateWindowResponse(
+		WindowResponseTableData const & Table, // Precomputed response of the construction
+		Real64 const ToutK, // Outside air temperature (K)
+		Real64 const TinK, // Inside air temperature (K)
+		Real64 const HcOut, // Outside convective film conductance (W/m2-K)
+		Real64 const HcIn, // Inside convective film conductance (W/m2-K)
+		Real64 const OutIR, // IR radiance of the exterior surround (W/m2)
+		Real64 const RmIR, // IR radiance of the interior surround (W/m2)
+		Array1< Real64 > const & AbsFace, // Radiation absorbed at each glass face (W/m2)
+		Array1< Real64 > & Theta // Glass face temperatures (K)
+	);
+
+	//****************************************************************************
+
+	void
+	WindowResponseTemps( int const SurfNum ); // Surface number
+
 	//*******************************************************************************************************
 
 	void
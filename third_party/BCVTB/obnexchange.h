@@ -0,0 +1,127 @@
+/* -*- mode: C++; indent-tabs-mode: nil; -*- */
+/** \file
+ * \brief Lock-free exchange between the EnergyPlus thread and the OBN node thread.
+ *
+ * The two threads hand control back and forth several times per zone time step
+ * (UPDATE_Y, UPDATE_X and their acknowledgements).  The signals and the exchanged
+ * values are passed through the single-producer/single-consumer primitives below,
+ * so the common case never takes a lock.
+ */
+
+#ifndef OBN_ENERGYPLUS_OBNEXCHANGE_H
+#define OBN_ENERGYPLUS_OBNEXCHANGE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace EnergyPlus {
+    namespace ExternalInterface {
+
+        /** A signal written by one thread and waited for by another.
+         Setting, reading and resetting the signal are lock-free.  A waiter first polls the
+         signal for a short while, which covers the usual quick turnaround between the two
+         threads, and only then blocks on a condition variable.  The setter takes the mutex
+         only when a waiter is actually blocked.
+         */
+        template <typename T, T NoneValue>
+        class OBNSignalSlot {
+            std::atomic<T> m_value;
+            std::atomic<int> m_sleepers;
+            std::mutex m_mutex;
+            std::condition_variable m_cond;
+
+            static const int spin_count = 4096;    ///< Polls before blocking; the later ones yield
+
+        public:
+            OBNSignalSlot(): m_value(NoneValue), m_sleepers(0) { }
+
+            /** Set the signal and wake up a blocked waiter, if any. */
+            void set(T sig) {
+                m_value.store(sig);
+                if (m_sleepers.load() > 0) {
+                    std::lock_guard<std::mutex> mylock(m_mutex);
+                    m_cond.notify_all();
+                }
+            }
+
+            T get() const { return m_value.load(); }
+
+            void reset() { m_value.store(NoneValue); }
+
+            /** Returns the signal and resets it in one step. */
+            T take() { return m_value.exchange(NoneValue); }
+
+            /** Waits for the signal to be different from NoneValue and returns it.
+             \param timeout Timeout in seconds; non-positive values mean waiting indefinitely.
+             \return The signal, or NoneValue if the timeout expired.
+             */
+            T wait(int timeout) {
+                for (int i = 0; i < spin_count; ++i) {
+                    T sig = m_value.load();
+                    if (sig != NoneValue) {
+                        return sig;
+                    }
+                    if (i >= spin_count / 4) {
+                        std::this_thread::yield();
+                    }
+                }
+
+                std::unique_lock<std::mutex> mylock(m_mutex);
+                ++m_sleepers;
+                auto isSet = [this]{ return m_value.load() != NoneValue; };
+                bool received = true;
+                if (timeout <= 0) {
+                    m_cond.wait(mylock, isSet);
+                } else {
+                    received = m_cond.wait_for(mylock, std::chrono::seconds(timeout), isSet);
+                }
+                --m_sleepers;
+                return received ? m_value.load() : NoneValue;
+            }
+        };
+
+        /** Single-producer/single-consumer exchange of the latest value (triple buffer).
+         The producer fills back() and calls publish(); the consumer calls consume() and, if it
+         returns true, reads front().  Neither side ever waits for the other and no copy is made
+         by the buffer itself, so the buffers keep their capacity from step to step.
+         */
+        template <typename T>
+        class OBNExchangeBuffer {
+            static const unsigned fresh_bit = 4u;  ///< Set in m_middle when it holds unread data
+
+            T m_buffers[3];
+            std::atomic<unsigned> m_middle;     ///< Index of the buffer in transit, plus fresh_bit
+            unsigned m_back;        ///< Owned by the producer
+            unsigned m_front;       ///< Owned by the consumer
+
+        public:
+            OBNExchangeBuffer(): m_middle(2u), m_back(0u), m_front(1u) { }
+
+            /** The buffer the producer writes to. */
+            T& back() { return m_buffers[m_back]; }
+
+            /** Make back() available to the consumer; an unread older value is dropped. */
+            void publish() {
+                m_back = m_middle.exchange(m_back | fresh_bit, std::memory_order_acq_rel) & ~fresh_bit;
+            }
+
+            /** Take the latest published value into front().
+             \return false if nothing was published since the last call.
+             */
+            bool consume() {
+                if ((m_middle.load(std::memory_order_relaxed) & fresh_bit) == 0) {
+                    return false;
+                }
+                m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & ~fresh_bit;
+                return true;
+            }
+
+            /** The buffer the consumer reads from. */
+            T& front() { return m_buffers[m_front]; }
+        };
+    }
+}
+#endif
@@ -0,0 +1,159 @@
+/* -*- mode: C++; indent-tabs-mode: nil; -*- */
+/** \file
+ * \brief Benchmark of the co-simulation exchange through the in-process loopback backend.
+ *
+ * The benchmark makes the same calls as ExternalInterface does during an openBuildNet
+ * co-simulation (initOBNNode, the START handshake, one exchangedoublewithOBN per zone time
+ * step, then TERM), but with the "loopback" communication, so neither an MQTT broker nor
+ * an OBN master is needed.  It reports the exchanged steps per second and the percentiles
+ * of the per-step exchange latency.
+ *
+ * Usage: obnloopbackbench [--outputs N] [--inputs M] [--steps S] [--stepsize SEC] [--work USEC]
+ *  --outputs   number of values sent by EnergyPlus at each step (default 16)
+ *  --inputs    number of values received by EnergyPlus at each step (default 16)
+ *  --steps     number of exchanged steps (default 100000)
+ *  --stepsize  simulation time step in seconds (default 60)
+ *  --work      busy time in microseconds between exchanges, standing in for a time step (default 0)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "openbuildnet.h"
+
+using namespace EnergyPlus::ExternalInterface;
+typedef std::chrono::steady_clock bench_clock;
+
+namespace {
+    const char * const config_file_name = "obnloopbackbench.cfg";
+
+    /** Busy-wait for the given time, standing in for the computation of a time step. */
+    void simulateWork(long usec) {
+        if (usec <= 0) {
+            return;
+        }
+        auto until = bench_clock::now() + std::chrono::microseconds(usec);
+        while (bench_clock::now() < until) { }
+    }
+
+    /** Returns the p-th percentile (0 <= p <= 1) of sorted latencies. */
+    double percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        auto k = static_cast<std::size_t>(p * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(k, sorted.size() - 1)];
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int nOutputs = 16;
+    int nInputs = 16;
+    long nSteps = 100000;
+    double stepSize = 60.0;
+    long workUSec = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool hasValue = (i + 1 < argc);
+        if (hasValue && std::strcmp(argv[i], "--outputs") == 0) {
+            nOutputs = std::atoi(argv[++i]);
+        } else if (hasValue && std::strcmp(argv[i], "--inputs") == 0) {
+            nInputs = std::atoi(argv[++i]);
+        } else if (hasValue && std::strcmp(argv[i], "--steps") == 0) {
+            nSteps = std::atol(argv[++i]);
+        } else if (hasValue && std::strcmp(argv[i], "--stepsize") == 0) {
+            stepSize = std::atof(argv[++i]);
+        } else if (hasValue && std::strcmp(argv[i], "--work") == 0) {
+            workUSec = std::atol(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--outputs N] [--inputs M] [--steps S] [--stepsize SEC] [--work USEC]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (nOutputs < 0 || nInputs < 0 || nSteps <= 0 || stepSize <= 0.0) {
+        std::fprintf(stderr, "Invalid benchmark settings.\n");
+        return 2;
+    }
+
+    // Same config file format as openbuildnet.cfg
+    {
+        std::ofstream cfg(config_file_name);
+        cfg << "loopback " << stepSize << ' ' << nInputs << '\n' << "energyplusbench\n";
+    }
+    if (!initOBNNode(config_file_name)) {
+        std::fprintf(stderr, "Could not start the loopback node.\n");
+        return 1;
+    }
+
+    // Start handshake, as in ExternalInterface's initialization
+    auto sig = waitforOBNSignal();
+    resetOBNSignal();
+    if (sig != EPSIG_START) {
+        std::fprintf(stderr, "Expected START, received %s.\n", getOBNSignalName(sig).c_str());
+        signalOBN(OBNSIG_EXIT);
+        stopOBNNode();
+        return 1;
+    }
+    signalOBN(OBNSIG_DONE);
+
+    std::vector<double> dblValWri(nOutputs);
+    std::vector<double> dblValRea(std::max(nInputs, 1));
+    std::vector<double> latencies;
+    latencies.reserve(nSteps);
+    const int flaWri = 0;
+    long nErrors = 0;
+
+    auto start = bench_clock::now();
+    for (long step = 0; step < nSteps; ++step) {
+        for (int i = 0; i < nOutputs; ++i) {
+            dblValWri[i] = step + 0.001 * i;
+        }
+
+        int flaRea = 0;
+        int nDblRea = 0;
+        double simTimRea = 0.0;
+        auto t0 = bench_clock::now();
+        int retVal = exchangedoublewithOBN(&flaWri, &flaRea, &nOutputs, &nDblRea, dblValWri.data(), &simTimRea, dblValRea.data());
+        auto t1 = bench_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+
+        // The loopback feeds the outputs of this step back, at the simulation time of this step
+        bool valid = (retVal == 0 && flaRea == 0 && nDblRea == nInputs && simTimRea == step * stepSize);
+        for (int i = 0; valid && i < std::min(nInputs, nOutputs); ++i) {
+            valid = (dblValRea[i] == dblValWri[i]);
+        }
+        if (!valid) {
+            ++nErrors;
+            if (retVal != 0 || flaRea != 0) {
+                std::fprintf(stderr, "Exchange failed at step %ld (return value %d, flag %d).\n", step, retVal, flaRea);
+                break;
+            }
+        }
+
+        simulateWork(workUSec);
+    }
+    auto elapsed = std::chrono::duration<double>(bench_clock::now() - start).count();
+
+    signalOBN_TERM();
+    stopOBNNode();
+    std::remove(config_file_name);
+
+    std::sort(latencies.begin(), latencies.end());
+    std::printf("outputs %d, inputs %d, steps %zu, step size %g s, work %ld us\n",
+                nOutputs, nInputs, latencies.size(), stepSize, workUSec);
+    std::printf("throughput: %.0f steps/s (%.3f s)\n", latencies.size() / elapsed, elapsed);
+    std::printf("exchange latency [us]: p50 %.2f  p90 %.2f  p99 %.2f  p99.9 %.2f  max %.2f\n",
+                percentile(latencies, 0.5), percentile(latencies, 0.9), percentile(latencies, 0.99),
+                percentile(latencies, 0.999), latencies.empty() ? 0.0 : latencies.back());
+    if (nErrors > 0) {
+        std::printf("invalid exchanges: %ld\n", nErrors);
+    }
+
+    return (nErrors > 0) ? 1 : 0;
+}
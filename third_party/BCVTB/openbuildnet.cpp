@@ -8,14 +8,17 @@
  * \author Truong X. Nghiem (xuan.nghiem@epfl.ch)
  */
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <thread>
-#include <mutex>
-#include <condition_variable>
 #include <fstream>
+#include <sstream>
+#include <vector>
 
 #include <obnnode.h>
 #include "openbuildnet.h"
+#include "obnexchange.h"
 
 #define NDBLMAX 1024    // The maximum number of double values that can be read; this MUST be the same number hard-coded in ExternalInterface.cc
 
@@ -28,43 +31,26 @@ namespace EnergyPlus {
         bool quitIfOBNTerminates = false;   ///< whether E+ should quit if OBN terminates
         int default_obn_timeout = -1;   ///< The default timeout value
         
-        EPlusSignalToOBN eplus_signal_to_obn = OBNSIG_NONE;       ///< The signal from E+ to OBN.
-        std::mutex eplus_signal_to_obn_mutex;       ///< Mutex to access the signal
-        std::condition_variable eplus_signal_to_obn_cond;   ///< Condition variable to wait for the signal
-
-        OBNSignalToEPlus obn_signal_to_eplus = EPSIG_NONE;       ///< The signal from OBN to E+.
-        std::mutex obn_signal_to_eplus_mutex;       ///< Mutex to access the signal
-        std::condition_variable obn_signal_to_eplus_cond;   ///< Condition variable to wait for the signal
+        OBNSignalSlot<EPlusSignalToOBN, OBNSIG_NONE> eplus_signal_to_obn;   ///< The signal from E+ to OBN.
+        OBNSignalSlot<OBNSignalToEPlus, EPSIG_NONE> obn_signal_to_eplus;    ///< The signal from OBN to E+.
         
         /** Set the signal from OBN to E+. */
         void signalEPlus(OBNSignalToEPlus sig) {
-            {
-                std::lock_guard<std::mutex> mylock(obn_signal_to_eplus_mutex);
-                obn_signal_to_eplus = sig;
-            }
-            obn_signal_to_eplus_cond.notify_all();
+            obn_signal_to_eplus.set(sig);
         }
         
         /** Wait for a signal from EnergyPlus. */
         EPlusSignalToOBN waitforEPlusSignal() {
-            std::unique_lock<std::mutex> mylock(eplus_signal_to_obn_mutex);
-            if (eplus_signal_to_obn != OBNSIG_NONE) {
-                return eplus_signal_to_obn;
-            }
-            
-            eplus_signal_to_obn_cond.wait(mylock, []{ return eplus_signal_to_obn != OBNSIG_NONE; });
-            return eplus_signal_to_obn;
+            return eplus_signal_to_obn.wait(-1);
         }
         
         /** Reset the signal from EnergyPlus. */
         void resetEPlusSignal() {
-            std::lock_guard<std::mutex> mylock(eplus_signal_to_obn_mutex);
-            eplus_signal_to_obn = OBNSIG_NONE;
+            eplus_signal_to_obn.reset();
         }
         
         OBNSignalToEPlus getOBNSignal() {
-            std::lock_guard<std::mutex> mylock(obn_signal_to_eplus_mutex);
-            return obn_signal_to_eplus;
+            return obn_signal_to_eplus.get();
         }
         
         std::string getOBNSignalName(OBNSignalToEPlus sig) {
@@ -96,8 +82,7 @@ namespace EnergyPlus {
         }
         
         void resetOBNSignal() {
-            std::lock_guard<std::mutex> mylock(obn_signal_to_eplus_mutex);
-            obn_signal_to_eplus = EPSIG_NONE;
+            obn_signal_to_eplus.reset();
         }
         
         void signalOBN_TERM() {
@@ -109,27 +94,14 @@ namespace EnergyPlus {
         }
         
         OBNSignalToEPlus waitforOBNSignal(int timeout) {
-            std::unique_lock<std::mutex> mylock(obn_signal_to_eplus_mutex);
-            if (obn_signal_to_eplus != EPSIG_NONE) {
-                return obn_signal_to_eplus;
-            }
-            
             // Get the actual timeout value we want to use
             if (timeout <= 0) {
                 timeout = default_obn_timeout;
             }
             
             // Wait for the signal to be not EPSIG_NONE, with or without timeout
-            if (timeout <= 0) {
-                obn_signal_to_eplus_cond.wait(mylock, []{ return obn_signal_to_eplus != EPSIG_NONE; });
-                return obn_signal_to_eplus;
-            } else {
-                if (obn_signal_to_eplus_cond.wait_for(mylock, std::chrono::seconds(timeout), []{ return obn_signal_to_eplus != EPSIG_NONE; })) {
-                    return obn_signal_to_eplus;
-                } else {
-                    return EPSIG_TIMEOUT;
-                }
-            }
+            auto sig = obn_signal_to_eplus.wait(timeout);
+            return (sig != EPSIG_NONE) ? sig : EPSIG_TIMEOUT;
         }
         
         void setOBNTimeout(int timeout) {
@@ -137,73 +109,68 @@ namespace EnergyPlus {
         }
         
 
-        /** The OBN node class for EnergyPlus. */
-        class MQTTNodeEPlus: public MQTTNodeBase {
-            /** Input and output ports for the node. */
-            MQTTInput< OBN_PB, obn_vector<double> > m_double_input;     // All double inputs
-            MQTTOutput< OBN_PB, obn_vector<double> > m_double_output;   // All double outputs
-            
-            /** Ask EnergyPlus to stop unexpectedly. */
-            void askEnergyPlusToQuit() {
-                resetEPlusSignal();
-                signalEPlus(EPSIG_QUIT);       // Forward the signal to EPlus
-                waitforEPlusSignal();           // Wait for the ACK to ensure that EnergyPlus has registered the request
-            }
+        /** Input values handed from the node thread to E+ at UPDATE_X. */
+        struct OBNInputValues {
+            std::vector<double> values;
+            double simTime = 0.0;   // Current simulation time in seconds
+            bool tooMany = false;   // More than NDBLMAX values were received
+        };
+        
+        /** The values exchanged between E+ and the node thread, whichever communication backend runs the node.
+         The ports of the backend (if any) are only accessed on the node thread.
+         */
+        class EPlusNodeExchange {
+            OBNExchangeBuffer< std::vector<double> > m_output_values;  // E+ -> node
+            OBNExchangeBuffer< OBNInputValues > m_input_values;        // node -> E+
             
-            bool m_duringUpdateX = false;  // true if the node is currently processing its UpdateX event
+            std::atomic<bool> m_duringUpdateX{false};  // true if the node is currently processing its UpdateX event
             
         public:
-            bool initialize();
-            
-            MQTTNodeEPlus(const std::string& t_name, const std::string& t_ws):
-            MQTTNodeBase(t_name, t_ws), m_double_input("in"), m_double_output("out")
-            { }
-            
-            void handleEPlusSignal();       ///< Handle some signals from EnergyPlus
-            
-            /** Write the output values to the output port.
-             \return negative value if error; otherwise the number of values sent.
+            /** Hand the output values to the node thread (called by E+).
+             \return negative value if error; otherwise the number of values handed over.
              */
-            int setOutputValues(std::size_t nDbl, double dblVals[]) {
-                auto& v = *m_double_output;
-                v.resize(nDbl);
-                if (nDbl > 0) {
-                    std::copy_n(dblVals, nDbl, v.data());
-                }
+            int publishOutputValues(std::size_t nDbl, const double dblVals[]) {
+                m_output_values.back().assign(dblVals, dblVals + nDbl);
+                m_output_values.publish();
                 return nDbl;
             }
             
-            /** Write the output values to the output port and send them immediately.
-             \return negative value if error; otherwise the number of values sent.
+            /** Take the latest output values from E+ into outputValues() (node thread).
+             \return true if new values were published since the last call.
              */
-            int sendOutputValues(std::size_t nDbl, double dblVals[]) {
-                int v = setOutputValues(nDbl, dblVals);
-                m_double_output.sendSync();
-                return v;
-            }
+            bool consumeOutputValues() { return m_output_values.consume(); }
+            
+            const std::vector<double>& outputValues() { return m_output_values.front(); }
+            
+            /** The input values for E+ to be filled by the node thread, then handed over by publishInputValues(). */
+            OBNInputValues& inputValues() { return m_input_values.back(); }
+            
+            void publishInputValues() { m_input_values.publish(); }
             
-            /** Read the input values from the input port.
+            /** Read the input values published by the node thread (called by E+).
              The arrays to write the values to are already allocated by EnergyPlus.
              \return non-zero value if error.
              */
-            int getInputValues(int *nDblRea, double dblValRea[]) {
-                // Directly access the internal data to avoid copying data multiple times
+            int takeInputValues(int *nDblRea, double dblValRea[], double *simTimRea) {
                 *nDblRea = 0;
-                auto la = m_double_input.lock_and_get();
-                auto sz = la->size();
-                if (sz > NDBLMAX) {
+                if (!m_input_values.consume()) {
                     return -1;
                 }
-                *nDblRea = sz;
-                if (sz > 0) {
-                    std::copy_n(la->data(), sz, dblValRea);
+                const auto& in = m_input_values.front();
+                *simTimRea = in.simTime;
+                if (in.tooMany) {
+                    return -1;
+                }
+                *nDblRea = in.values.size();
+                if (!in.values.empty()) {
+                    std::copy_n(in.values.data(), in.values.size(), dblValRea);
                 }
                 return 0;
             }
             
             bool isDuringUpdateX() const { return m_duringUpdateX; }
             
-            void setDuringUpdateX() { m_duringUpdateX = true; }
+            void setDuringUpdateX(bool during = true) { m_duringUpdateX = during; }
             
             /** Reset m_duringUpdateX and send ACK signal to OBN. */
             void finishUpdateX() {
@@ -212,6 +179,64 @@ namespace EnergyPlus {
                     EnergyPlus::ExternalInterface::signalOBN(EnergyPlus::ExternalInterface::OBNSIG_DONE);   // ACK to OBN
                 }
             }
+        };
+        
+        EPlusNodeExchange node_exchange;
+        
+        /** The OBN node class for EnergyPlus. */
+        class MQTTNodeEPlus: public MQTTNodeBase {
+            /** Input and output ports for the node. */
+            MQTTInput< OBN_PB, obn_vector<double> > m_double_input;     // All double inputs
+            MQTTOutput< OBN_PB, obn_vector<double> > m_double_output;   // All double outputs
+            
+            /** Ask EnergyPlus to stop unexpectedly. */
+            void askEnergyPlusToQuit() {
+                resetEPlusSignal();
+                signalEPlus(EPSIG_QUIT);       // Forward the signal to EPlus
+                waitforEPlusSignal();           // Wait for the ACK to ensure that EnergyPlus has registered the request
+            }
+            
+        public:
+            bool initialize();
+            
+            MQTTNodeEPlus(const std::string& t_name, const std::string& t_ws):
+            MQTTNodeBase(t_name, t_ws), m_double_input("in"), m_double_output("out")
+            { }
+            
+            void handleEPlusSignal();       ///< Handle some signals from EnergyPlus
+            
+            /** Copy the latest output values from E+ into the output port.
+             \return true if new values were copied.
+             */
+            bool takeOutputValues() {
+                if (!node_exchange.consumeOutputValues()) {
+                    return false;
+                }
+                const auto& vals = node_exchange.outputValues();
+                auto& v = *m_double_output;
+                v.resize(vals.size());
+                if (!vals.empty()) {
+                    std::copy_n(vals.data(), vals.size(), v.data());
+                }
+                return true;
+            }
+            
+            /** Copy the input values and the simulation time for E+ (before EPSIG_X). */
+            void captureInputValues() {
+                auto& in = node_exchange.inputValues();
+                {
+                    auto la = m_double_input.lock_and_get();
+                    auto sz = la->size();
+                    in.tooMany = (sz > NDBLMAX);
+                    if (in.tooMany) {
+                        in.values.clear();
+                    } else {
+                        in.values.assign(la->data(), la->data() + sz);
+                    }
+                }
+                in.simTime = currentSimulationTime<std::chrono::seconds>();
+                node_exchange.publishInputValues();
+            }
             
             
             /** \brief Callback for UPDATE_Y event */
@@ -319,9 +344,51 @@ namespace EnergyPlus {
         
         std::unique_ptr<EPlusOBNThread> obn_thread;
         
+        /** \brief In-process stand-in for the OBN system, used to measure the exchange overhead without MQTT.
+         The thread runs the same START / UPDATE_Y / UPDATE_X handshake as an OBN simulation, advancing the
+         simulation time by a fixed step and feeding the outputs of E+ back to its inputs, until E+ stops.
+         */
+        class EPlusLoopbackThread {
+            std::thread m_thread;
+            double m_stepSize;  ///< Simulation time step in seconds
+            int m_nInputs;      ///< Number of inputs to E+; negative to feed back all outputs
+            
+            /** Main function of the thread. */
+            void threadMain();
+            
+        public:
+            EPlusLoopbackThread(double t_stepSize, int t_nInputs): m_stepSize(t_stepSize), m_nInputs(t_nInputs)
+            {
+            }
+            
+            ~EPlusLoopbackThread() {
+                stopThread();
+            }
+            
+            /** Start the loopback thread. */
+            bool startThread() {
+                if (m_thread.joinable()) {
+                    return false;
+                }
+                node_exchange.setDuringUpdateX(false);
+                m_thread = std::thread(&EPlusLoopbackThread::threadMain, this);
+                return true;
+            }
+            
+            /** Stop the loopback thread properly. */
+            void stopThread() {
+                if (m_thread.joinable()) {
+                    signalOBN(OBNSIG_EXIT);
+                    m_thread.join();
+                }
+            }
+        };
+        
+        std::unique_ptr<EPlusLoopbackThread> loopback_thread;
+        
         bool initOBNNode(const char * docname) {
             if (!docname) return false;
-            if (!obn_thread) {
+            if (!obn_thread && !loopback_thread) {
                 std::string node_name;
                 std::string workspace;
                 std::string comm;
@@ -424,8 +491,22 @@ namespace EnergyPlus {
                     
                     // Start the thread
                     return obn_thread->startThread();
+                } else if (comm == "loopback") {
+                    // In-process stand-in for OBN: [comm_config] is "[stepsize [ninputs]]"
+                    double stepSize = 60.0;
+                    int nInputs = -1;
+                    std::istringstream loopback_config(comm_config);
+                    if (loopback_config >> stepSize) {
+                        loopback_config >> nInputs;
+                    }
+                    if (stepSize <= 0.0 || nInputs > NDBLMAX) {
+                        return false;
+                    }
+                    
+                    loopback_thread.reset(new EPlusLoopbackThread(stepSize, nInputs));
+                    return loopback_thread->startThread();
                 } else {
-                    // Only MQTT is supported
+                    // Only MQTT and the loopback are supported
                     return false;
                 }
             }
@@ -434,17 +515,16 @@ namespace EnergyPlus {
         }
         
         void stopOBNNode() {
-            if (!obn_thread) {
+            if (obn_thread) {
                 obn_thread->stopThread();
             }
+            if (loopback_thread) {
+                loopback_thread->stopThread();
+            }
         }
 
         void signalOBN(EPlusSignalToOBN sig) {
-            {
-                std::lock_guard<std::mutex> mylock(eplus_signal_to_obn_mutex);
-                eplus_signal_to_obn = sig;
-            }
-            eplus_signal_to_obn_cond.notify_all();
+            eplus_signal_to_obn.set(sig);
             if (sig != OBNSIG_DONE && obn_thread && sig != OBNSIG_NONE) {
                 // Push an event to the node's queue to process the signal
                 obn_thread->m_obnnode.postCallbackEvent(std::bind(&MQTTNodeEPlus::handleEPlusSignal, &obn_thread->m_obnnode));
@@ -457,11 +537,54 @@ namespace EnergyPlus {
          This thread will terminate when the OBN system terminates or when it receives the EXIT signal from E+.
          */
         void EPlusOBNThread::threadMain() {
-            //            std::unique_lock<std::mutex> mylock(eplus_signal_to_obn_mutex);
-            //            eplus_signal_to_obn_cond.wait(mylock, []{ return eplus_signal_to_obn == OBNSIG_EXIT; });
             m_obnnode.run();
         }
         
+        /** Run the loopback until E+ answers anything other than DONE, i.e. it terminates or exits. */
+        void EPlusLoopbackThread::threadMain() {
+            // Send a signal to E+ and wait for its ACK
+            auto handshake = [](OBNSignalToEPlus sig) {
+                signalEPlus(sig);
+                if (waitforEPlusSignal() != OBNSIG_DONE) {
+                    return false;
+                }
+                resetEPlusSignal();
+                return true;
+            };
+            
+            if (!handshake(EPSIG_START)) {
+                return;
+            }
+            
+            std::vector<double> fed_back;
+            for (double simTime = 0.0; ; simTime += m_stepSize) {
+                if (!handshake(EPSIG_Y)) {
+                    break;
+                }
+                if (node_exchange.consumeOutputValues()) {
+                    fed_back = node_exchange.outputValues();
+                }
+                
+                // Feed the outputs back to the inputs, truncated or padded with zeros to the number of inputs
+                auto& in = node_exchange.inputValues();
+                in.values = fed_back;
+                if (m_nInputs >= 0) {
+                    in.values.resize(m_nInputs, 0.0);
+                }
+                in.tooMany = (in.values.size() > NDBLMAX);
+                if (in.tooMany) {
+                    in.values.clear();
+                }
+                in.simTime = simTime;
+                node_exchange.publishInputValues();
+                
+                if (!handshake(EPSIG_X)) {
+                    break;
+                }
+                node_exchange.consumeOutputValues();    // Sent with the ACK of UPDATE_X; nobody listens here
+            }
+        }
+        
         /** Initialize the node for EPlus. */
         bool MQTTNodeEPlus::initialize() {
             if (!openSMNPort()) {
@@ -479,16 +602,23 @@ namespace EnergyPlus {
             // Only reset the signal if the update was done properly, otherwise let the main function handle the signal
             if (sig == OBNSIG_DONE) {
                 resetEPlusSignal();
+                takeOutputValues();     // E+ published its outputs before the ACK
             }
         }
         
         /** \brief Callback for UPDATE_X event */
         void MQTTNodeEPlus::onUpdateX(updatemask_t m) {
+            captureInputValues();       // All inputs have been received; hand them to EPlus with the signal
             signalEPlus(EPSIG_X);       // Forward the signal to EPlus
             auto sig = waitforEPlusSignal();
             // Only reset the signal if the update was done properly, otherwise let the main function handle the signal
             if (sig == OBNSIG_DONE) {
                 resetEPlusSignal();
+                // E+ acknowledges UPDATE_X at its next exchange, after computing its next outputs;
+                // send them from this thread so E+ can go on right away
+                if (takeOutputValues()) {
+                    m_double_output.sendSync();
+                }
             }
         }
         
@@ -500,7 +630,7 @@ namespace EnergyPlus {
             if (sig == OBNSIG_DONE) {
                 resetEPlusSignal();
             }
-            m_duringUpdateX = false;
+            node_exchange.setDuringUpdateX(false);
             
             return 0;
         }
@@ -512,12 +642,7 @@ namespace EnergyPlus {
         
         /** Handle signal from EnergyPlus, except for DONE and NONE. */
         void MQTTNodeEPlus::handleEPlusSignal() {
-            EPlusSignalToOBN sig;
-            {
-                std::lock_guard<std::mutex> mylock(eplus_signal_to_obn_mutex);
-                sig = eplus_signal_to_obn;
-                eplus_signal_to_obn = OBNSIG_NONE;
-            }
+            EPlusSignalToOBN sig = eplus_signal_to_obn.take();
             switch (sig) {
                 case OBNSIG_TERM:
                 case OBNSIG_EXIT:
@@ -579,16 +704,18 @@ namespace EnergyPlus {
             
             *flaRea = 0;    // Initialize to normal status
             
-            if (!EnergyPlus::ExternalInterface::obn_thread) {
+            if (!EnergyPlus::ExternalInterface::obn_thread && !EnergyPlus::ExternalInterface::loopback_thread) {
                 return -1;
             }
             
             int retVal = 0;
+            auto& exchange = EnergyPlus::ExternalInterface::node_exchange;
             
-            // If currently during an UPDATE_X, send the values out to OBN then ACK that UPDATE_X has completed
-            if (EnergyPlus::ExternalInterface::obn_thread->m_obnnode.isDuringUpdateX()) {
-                retVal = EnergyPlus::ExternalInterface::obn_thread->m_obnnode.sendOutputValues(*nDblWri, dblValWri);
-                EnergyPlus::ExternalInterface::obn_thread->m_obnnode.finishUpdateX();
+            // If currently during an UPDATE_X, hand the values to the node thread, which sends them out
+            // to OBN, then ACK that UPDATE_X has completed
+            if (exchange.isDuringUpdateX()) {
+                retVal = exchange.publishOutputValues(*nDblWri, dblValWri);
+                exchange.finishUpdateX();
                 if (retVal < 0) {
                     return retVal;
                 }
@@ -602,7 +729,7 @@ namespace EnergyPlus {
             }
             
             // Set the values of the output port
-            retVal = EnergyPlus::ExternalInterface::obn_thread->m_obnnode.setOutputValues(*nDblWri, dblValWri);
+            retVal = exchange.publishOutputValues(*nDblWri, dblValWri);
             
             EnergyPlus::ExternalInterface::signalOBN(EnergyPlus::ExternalInterface::OBNSIG_DONE);   // ACK to OBN
             
@@ -614,17 +741,14 @@ namespace EnergyPlus {
                     return processOBNSignal(sig, flaRea);
                 }
                 
-                // Obtain the input values
-                retVal = EnergyPlus::ExternalInterface::obn_thread->m_obnnode.getInputValues(nDblRea, dblValRea);
-                
-                // Get the current simulation time from OBN for EnergyPlus
-                *simTimRea = EnergyPlus::ExternalInterface::obn_thread->m_obnnode.currentSimulationTime<std::chrono::seconds>();
+                // Obtain the input values and the current simulation time captured by the node thread
+                retVal = exchange.takeInputValues(nDblRea, dblValRea, simTimRea);
                 
                 // The flag flaRea is already set at the beginning
                 
                 // Set the flag that the node is currently during UPDATE_X and not yet ACK to OBN
                 // Note that we don't ACK here but wait for E+ to update its states to the next time step, then immediately send the outputs to OBN before ACK.
-                EnergyPlus::ExternalInterface::obn_thread->m_obnnode.setDuringUpdateX();
+                exchange.setDuringUpdateX();
             }
             return retVal;
         }
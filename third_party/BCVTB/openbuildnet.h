@@ -22,8 +22,10 @@ namespace EnergyPlus {
          <comm> [comm_config]
          <nodename> [workspace]
          [quitIfOBNstops]
-         where <comm> specifies the communication: currently only "mqtt" is supported.
-         [comm_config] is the optional configuration of the communication: for MQTT, it's the server address and port.
+         where <comm> specifies the communication: "mqtt", or "loopback" for an in-process stand-in of OBN used for benchmarking.
+         [comm_config] is the optional configuration of the communication: for MQTT, it's the server address and port;
+         for the loopback, it's "[stepsize [ninputs]]", the simulation time step in seconds (default 60) and the number of
+         inputs to E+ (default: all outputs of E+ are fed back to its inputs, otherwise truncated or padded with zeros).
          <nodename> is the required name of the node.
          [workspace] is the optional workspace name.
          [quitIfOBNstops] will tell EnergyPlus to quit immediately (with an error) if OBN stops before the end of the E+ simulation period.
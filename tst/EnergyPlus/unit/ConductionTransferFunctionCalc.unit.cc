@@ -0,0 +1,321 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::ConductionTransferFunctionCalc Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/ConductionTransferFunctionCalc.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataStringGlobals.hh>
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::ConductionTransferFunctionCalc;
+using DataHeatBalance::Construct;
+
+namespace EnergyPlus {
+
+	// Sets the EPLUS_CTF_CACHE_DIR environment variable, or removes it if the folder is empty
+	static void
+	SetCTFCacheDir( std::string const & folder )
+	{
+#ifdef _WIN32
+		_putenv_s( "EPLUS_CTF_CACHE_DIR", folder.c_str() );
+#else
+		if ( folder.empty() ) {
+			unsetenv( "EPLUS_CTF_CACHE_DIR" );
+		} else {
+			setenv( "EPLUS_CTF_CACHE_DIR", folder.c_str(), 1 );
+		}
+#endif
+	}
+
+	// Materials and constructions of the CTF reuse tests
+	static std::vector< std::string >
+	CTFReuseTestObjects()
+	{
+		return {
+			"Version,8.6;",
+			"Material,",
+			" Heavy Concrete,           !- Name",
+			" MediumRough,              !- Roughness",
+			" 0.2,                      !- Thickness {m}",
+			" 1.95,                     !- Conductivity {W/m-K}",
+			" 2240.0,                   !- Density {kg/m3}",
+			" 900.0,                    !- Specific Heat {J/kg-K}",
+			" 0.9,                      !- Thermal Absorptance",
+			" 0.7,                      !- Solar Absorptance",
+			" 0.7;                      !- Visible Absorptance",
+			"Material,",
+			" Insulation Board,         !- Name",
+			" MediumRough,              !- Roughness",
+			" 0.05,                     !- Thickness {m}",
+			" 0.03,                     !- Conductivity {W/m-K}",
+			" 43.0,                     !- Density {kg/m3}",
+			" 1210.0,                   !- Specific Heat {J/kg-K}",
+			" 0.9,                      !- Thermal Absorptance",
+			" 0.7,                      !- Solar Absorptance",
+			" 0.7;                      !- Visible Absorptance",
+			"Material,",
+			" Copy of Heavy Concrete,   !- Name",
+			" Smooth,                   !- Roughness",
+			" 0.2,                      !- Thickness {m}",
+			" 1.95,                     !- Conductivity {W/m-K}",
+			" 2240.0,                   !- Density {kg/m3}",
+			" 900.0,                    !- Specific Heat {J/kg-K}",
+			" 0.9,                      !- Thermal Absorptance",
+			" 0.7,                      !- Solar Absorptance",
+			" 0.7;                      !- Visible Absorptance",
+			"Construction,",
+			" Insulated Wall,           !- Name",
+			" Heavy Concrete,           !- Outside Layer",
+			" Insulation Board;         !- Layer 2",
+			"Construction,",
+			" Other Insulated Wall,     !- Name",
+			" Copy of Heavy Concrete,   !- Outside Layer",
+			" Insulation Board;         !- Layer 2",
+			"Construction,",
+			" Concrete Wall,            !- Name",
+			" Heavy Concrete;           !- Outside Layer",
+		};
+	}
+
+	TEST_F( EnergyPlusFixture, ConductionTransferFunctionCalc_CTFCacheKey )
+	{
+		// 64-bit FNV-1a of the key bytes: the offset basis for an empty key
+		EXPECT_EQ( "cbf29ce484222325", GetCTFCacheKey( std::vector< Real64 >() ) );
+		// and the hash of the little-endian IEEE bytes of 1.0 and 2.0
+		EXPECT_EQ( "aab1693229ba1db8", GetCTFCacheKey( std::vector< Real64 >( { 1.0 } ) ) );
+		EXPECT_EQ( "2f121cea1c5c97f8", GetCTFCacheKey( std::vector< Real64 >( { 1.0, 2.0 } ) ) );
+
+		// Equal keys share a file, any change of layer property, time step or option does not
+		std::vector< Real64 > const key( { 0.25, 19.0, 2.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.2, 1.95, 2240.0, 900.0, 0.1, 0.0 } );
+		std::vector< Real64 > otherKey( key );
+		otherKey[ 0 ] = 1.0 / 6.0;
+		std::vector< Real64 > otherLayerKey( key );
+		otherLayerKey[ 9 ] = 1.9500000000000002;
+		EXPECT_EQ( 16u, GetCTFCacheKey( key ).size() );
+		EXPECT_EQ( GetCTFCacheKey( key ), GetCTFCacheKey( std::vector< Real64 >( key ) ) );
+		EXPECT_NE( GetCTFCacheKey( key ), GetCTFCacheKey( otherKey ) );
+		EXPECT_NE( GetCTFCacheKey( key ), GetCTFCacheKey( otherLayerKey ) );
+	}
+
+	TEST_F( EnergyPlusFixture, ConductionTransferFunctionCalc_CTFCacheFileRoundTrip )
+	{
+		CTFCacheData CTFs;
+		CTFs.Key = { 0.25, 19.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.2, 1.95, 2240.0, 900.0, 0.1, 0.0 };
+		CTFs.CTFTimeStep = 0.5;
+		CTFs.NumHistories = 2;
+		CTFs.NumCTFTerms = 3;
+		CTFs.s0.allocate( 3, 4 );
+		CTFs.s.allocate( 3, 4, CTFs.NumCTFTerms );
+		CTFs.e.allocate( CTFs.NumCTFTerms );
+		for ( int i = 1; i <= 3; ++i ) {
+			for ( int j = 1; j <= 4; ++j ) {
+				CTFs.s0( i, j ) = 1.0 / ( i + 10 * j );
+				for ( int HistTerm = 1; HistTerm <= CTFs.NumCTFTerms; ++HistTerm ) {
+					CTFs.s( i, j, HistTerm ) = -1.0 / ( i + 10 * j + 100 * HistTerm );
+				}
+			}
+		}
+		for ( int HistTerm = 1; HistTerm <= CTFs.NumCTFTerms; ++HistTerm ) CTFs.e( HistTerm ) = 0.1 / HistTerm;
+
+		std::string const fileName( "ConductionTransferFunctionCalc_CTFCacheFileRoundTrip.ctf" );
+		WriteCTFCacheFile( fileName, CTFs );
+		ASSERT_TRUE( FileSystem::fileExists( fileName ) );
+
+		// Read back to the last bit
+		CTFCacheData readCTFs;
+		ASSERT_TRUE( ReadCTFCacheFile( fileName, CTFs.Key, readCTFs ) );
+		EXPECT_EQ( CTFs.Key, readCTFs.Key );
+		EXPECT_EQ( CTFs.CTFTimeStep, readCTFs.CTFTimeStep );
+		EXPECT_EQ( CTFs.NumHistories, readCTFs.NumHistories );
+		EXPECT_EQ( CTFs.NumCTFTerms, readCTFs.NumCTFTerms );
+		for ( int i = 1; i <= 3; ++i ) {
+			for ( int j = 1; j <= 4; ++j ) {
+				EXPECT_EQ( CTFs.s0( i, j ), readCTFs.s0( i, j ) );
+				for ( int HistTerm = 1; HistTerm <= CTFs.NumCTFTerms; ++HistTerm ) {
+					EXPECT_EQ( CTFs.s( i, j, HistTerm ), readCTFs.s( i, j, HistTerm ) );
+				}
+			}
+		}
+		for ( int HistTerm = 1; HistTerm <= CTFs.NumCTFTerms; ++HistTerm ) EXPECT_EQ( CTFs.e( HistTerm ), readCTFs.e( HistTerm ) );
+
+		// The file of another key, e.g. after a hash collision, is not used
+		std::vector< Real64 > otherKey( CTFs.Key );
+		otherKey.back() = 1.0;
+		EXPECT_FALSE( ReadCTFCacheFile( fileName, otherKey, readCTFs ) );
+		otherKey.pop_back();
+		EXPECT_FALSE( ReadCTFCacheFile( fileName, otherKey, readCTFs ) );
+
+		// Nor is the file written by another version of the program
+		std::string const VerString( DataStringGlobals::VerString );
+		DataStringGlobals::VerString += " (other build)";
+		EXPECT_FALSE( ReadCTFCacheFile( fileName, CTFs.Key, readCTFs ) );
+		DataStringGlobals::VerString = VerString;
+		EXPECT_TRUE( ReadCTFCacheFile( fileName, CTFs.Key, readCTFs ) );
+
+		// Nor is a missing, foreign or incomplete file
+		FileSystem::removeFile( fileName );
+		EXPECT_FALSE( ReadCTFCacheFile( fileName, CTFs.Key, readCTFs ) );
+		{
+			std::ofstream foreignFile( fileName, std::ios::binary );
+			foreignFile << "E+CTF0 not a cache file";
+		}
+		EXPECT_FALSE( ReadCTFCacheFile( fileName, CTFs.Key, readCTFs ) );
+		{
+			std::ofstream incompleteFile( fileName, std::ios::binary );
+			incompleteFile.write( CTFCacheHeader, sizeof( CTFCacheHeader ) );
+		}
+		EXPECT_FALSE( ReadCTFCacheFile( fileName, CTFs.Key, readCTFs ) );
+		FileSystem::removeFile( fileName );
+	}
+
+	TEST_F( EnergyPlusFixture, ConductionTransferFunctionCalc_ReusedCTFsMatchCalculated )
+	{
+		// The second construction has the layers of the first one under another name and reuses its CTFs
+		std::string const idf_objects = delimited_string( CTFReuseTestObjects() );
+
+		ASSERT_FALSE( process_idf( idf_objects ) );
+
+		bool ErrorsFound( false );
+		HeatBalanceManager::GetMaterialData( ErrorsFound );
+		EXPECT_FALSE( ErrorsFound );
+		HeatBalanceManager::GetConstructData( ErrorsFound );
+		EXPECT_FALSE( ErrorsFound );
+		ASSERT_EQ( 3, DataHeatBalance::TotConstructs );
+
+		DataGlobals::TimeStepZone = 0.25;
+		InitConductionTransferFunctions();
+
+		// Three constructions, but only two calculations
+		ASSERT_EQ( 2u, CTFCache.size() );
+		EXPECT_NE( CTFCache[ 0 ].Key, CTFCache[ 1 ].Key );
+
+		auto const & calculated( Construct( 1 ) );
+		auto const & reused( Construct( 2 ) );
+		ASSERT_GT( calculated.NumCTFTerms, 0 );
+		EXPECT_EQ( calculated.CTFTimeStep, reused.CTFTimeStep );
+		EXPECT_EQ( calculated.NumHistories, reused.NumHistories );
+		EXPECT_EQ( calculated.NumCTFTerms, reused.NumCTFTerms );
+		EXPECT_EQ( calculated.UValue, reused.UValue );
+		for ( int HistTerm = 0; HistTerm <= calculated.NumCTFTerms; ++HistTerm ) {
+			EXPECT_EQ( calculated.CTFOutside( HistTerm ), reused.CTFOutside( HistTerm ) );
+			EXPECT_EQ( calculated.CTFCross( HistTerm ), reused.CTFCross( HistTerm ) );
+			EXPECT_EQ( calculated.CTFInside( HistTerm ), reused.CTFInside( HistTerm ) );
+			if ( HistTerm != 0 ) {
+				EXPECT_EQ( calculated.CTFFlux( HistTerm ), reused.CTFFlux( HistTerm ) );
+			}
+		}
+
+		// A construction with other layers gets its own CTFs
+		EXPECT_NE( calculated.CTFCross( 0 ), Construct( 3 ).CTFCross( 0 ) );
+	}
+
+	TEST_F( EnergyPlusFixture, ConductionTransferFunctionCalc_CTFsReadFromCacheFolder )
+	{
+		ASSERT_FALSE( process_idf( delimited_string( CTFReuseTestObjects() ) ) );
+
+		bool ErrorsFound( false );
+		HeatBalanceManager::GetMaterialData( ErrorsFound );
+		EXPECT_FALSE( ErrorsFound );
+		HeatBalanceManager::GetConstructData( ErrorsFound );
+		EXPECT_FALSE( ErrorsFound );
+		DataGlobals::TimeStepZone = 0.25;
+
+		// The first run calculates the CTFs and keeps them in the cache folder
+		std::string const cacheFolder( "ConductionTransferFunctionCalc_CTFCache" );
+		SetCTFCacheDir( cacheFolder );
+		InitConductionTransferFunctions();
+		ASSERT_EQ( 2u, CTFCache.size() );
+		std::string const fileName( cacheFolder + DataStringGlobals::pathChar + GetCTFCacheKey( CTFCache[ 0 ].Key ) + ".ctf" );
+		ASSERT_TRUE( FileSystem::fileExists( fileName ) );
+		int const NumCTFTerms( Construct( 1 ).NumCTFTerms );
+		ASSERT_GT( NumCTFTerms, 0 );
+		Real64 const calculatedOutside( Construct( 1 ).CTFOutside( 0 ) );
+
+		// Seed the file with a marker coefficient: the next run must take it from the file
+		CTFCacheData markedCTFs( CTFCache[ 0 ] );
+		markedCTFs.e( NumCTFTerms ) = 0.123456;
+		FileSystem::removeFile( fileName );
+		WriteCTFCacheFile( fileName, markedCTFs );
+		ASSERT_TRUE( FileSystem::fileExists( fileName ) );
+
+		InitConductionTransferFunctions();
+		SetCTFCacheDir( "" );
+		EXPECT_EQ( -0.123456, Construct( 1 ).CTFFlux( NumCTFTerms ) );
+		EXPECT_EQ( -0.123456, Construct( 2 ).CTFFlux( NumCTFTerms ) );
+		EXPECT_EQ( calculatedOutside, Construct( 1 ).CTFOutside( 0 ) );
+		EXPECT_NE( -0.123456, Construct( 3 ).CTFFlux( Construct( 3 ).NumCTFTerms ) );
+
+		FileSystem::removeDirectory( cacheFolder );
+	}
+
+}
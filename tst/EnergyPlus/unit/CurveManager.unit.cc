@@ -1001,3 +1001,76 @@ TEST_F( EnergyPlusFixture, Tables_OneIndependentVariable_Linear_EvaluateCurveTyp
 
 		EXPECT_FALSE( has_err_output() );
 }
+
+TEST_F( EnergyPlusFixture, Curves_CurveValuesMatchCurveValue ) {
+	std::string const idf_objects = delimited_string( {
+		"Version,8.5;",
+		"Curve:Biquadratic,",
+		"TestBiquadratic,         !- Name",
+		"0.9,                     !- Coefficient1 Constant",
+		"0.01,                    !- Coefficient2 x",
+		"0.001,                   !- Coefficient3 x**2",
+		"-0.005,                  !- Coefficient4 y",
+		"-0.0002,                 !- Coefficient5 y**2",
+		"0.0003,                  !- Coefficient6 x*y",
+		"12.0,                    !- Minimum Value of x",
+		"24.0,                    !- Maximum Value of x",
+		"18.0,                    !- Minimum Value of y",
+		"46.0;                    !- Maximum Value of y",
+
+		"Table:OneIndependentVariable,",
+		"TestTableLinear,         !- Name",
+		"Linear,                  !- Curve Type",
+		"LinearInterpolationOfTable,  !- Interpolation Method",
+		",                        !- Minimum Value of X",
+		",                        !- Maximum Value of X",
+		",                        !- Minimum Table Output",
+		",                        !- Maximum Table Output",
+		"Dimensionless,           !- Input Unit Type for X",
+		"Dimensionless,           !- Output Unit Type",
+		",                        !- Normalization Reference",
+		"0,                       !- X Value #1",
+		"0,                       !- Output Value #1",
+		"1,                       !- X Value #2",
+		"2,                       !- Output Value #2",
+		"2,                       !- X Value #3",
+		"3,                       !- Output Value #3",
+		"4,                       !- X Value #4",
+		"4;                       !- Output Value #4" } );
+
+		ASSERT_FALSE( process_idf( idf_objects ) );
+		CurveManager::GetCurveInput();
+		CurveManager::GetCurvesInputFlag = false;
+		ASSERT_EQ( 2, CurveManager::NumCurves );
+
+		// kernels and table grids are compiled at input time
+		EXPECT_EQ( CurveManager::BiQuadratic, CurveManager::PerfCurve( 1 ).KernelCurveType );
+		EXPECT_TRUE( CurveManager::PerfCurveTableData( CurveManager::PerfCurve( 2 ).TableIndex ).GridCompiled );
+		EXPECT_TRUE( CurveManager::PerfCurveTableData( CurveManager::PerfCurve( 2 ).TableIndex ).X1Ascending );
+
+		Array1D< Real64 > X( { 10.0, 12.5, 19.0, 23.9, 30.0 } );
+		Array1D< Real64 > Y( { 15.0, 20.0, 35.0, 45.0, 50.0 } );
+		Array1D< Real64 > Result( 5 );
+		CurveManager::CurveValues( 1, X, Result, Y );
+		for ( int i = 1; i <= 5; ++i ) {
+			EXPECT_DOUBLE_EQ( CurveManager::CurveValue( 1, X( i ), Y( i ) ), Result( i ) );
+		}
+		EXPECT_DOUBLE_EQ( Result( 5 ), CurveManager::PerfCurve( 1 ).CurveOutput );
+
+		// out of order points exercise the bracket search hint in both directions
+		Array1D< Real64 > T( { 3.5, 0.25, 2.0, 1.5, -1.0, 5.0, 3.0 } );
+		Array1D< Real64 > TableResult( 7 );
+		CurveManager::CurveValues( 2, T, TableResult );
+		EXPECT_DOUBLE_EQ( 3.75, TableResult( 1 ) );
+		EXPECT_DOUBLE_EQ( 0.5, TableResult( 2 ) );
+		EXPECT_DOUBLE_EQ( 3.0, TableResult( 3 ) );
+		EXPECT_DOUBLE_EQ( 2.5, TableResult( 4 ) );
+		EXPECT_DOUBLE_EQ( 0.0, TableResult( 5 ) );
+		EXPECT_DOUBLE_EQ( 4.0, TableResult( 6 ) );
+		EXPECT_DOUBLE_EQ( 3.5, TableResult( 7 ) );
+
+		// a curve type changed after input is recompiled on the next evaluation
+		CurveManager::PerfCurve( 1 ).CurveType = CurveManager::Linear;
+		EXPECT_DOUBLE_EQ( 0.9 + 0.01 * 20.0, CurveManager::CurveValue( 1, 20.0 ) );
+		EXPECT_EQ( CurveManager::Linear, CurveManager::PerfCurve( 1 ).KernelCurveType );
+}
@@ -1715,4 +1715,111 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, DXCoils_MultiSpeedFullLoadPerformance ) {
+		using CurveManager::Quadratic;
+		using CurveManager::BiQuadratic;
+		using CurveManager::NumCurves;
+		using Psychrometrics::PsyHFnTdbW;
+		using Psychrometrics::PsyTwbFnTdbWPb;
+		int CurveNum;
+
+		// Two speeds with the same temperature curves and different flow curves
+		NumCurves = 3;
+		PerfCurve.allocate( NumCurves );
+		CurveNum = 1;
+		PerfCurve( CurveNum ).CurveType = BiQuadratic;
+		PerfCurve( CurveNum ).ObjectType = CurveType_BiQuadratic;
+		PerfCurve( CurveNum ).InterpolationType = EvaluateCurveToLimits;
+		PerfCurve( CurveNum ).Coeff1 = 0.942587793;
+		PerfCurve( CurveNum ).Coeff2 = 0.009543347;
+		PerfCurve( CurveNum ).Coeff3 = 0.000683770;
+		PerfCurve( CurveNum ).Coeff4 = -0.011042676;
+		PerfCurve( CurveNum ).Coeff5 = 0.000005249;
+		PerfCurve( CurveNum ).Coeff6 = -0.000009720;
+		PerfCurve( CurveNum ).Var1Min = 12.77778;
+		PerfCurve( CurveNum ).Var1Max = 23.88889;
+		PerfCurve( CurveNum ).Var2Min = 18.0;
+		PerfCurve( CurveNum ).Var2Max = 46.11111;
+
+		CurveNum = 2;
+		PerfCurve( CurveNum ).CurveType = Quadratic;
+		PerfCurve( CurveNum ).ObjectType = CurveType_Quadratic;
+		PerfCurve( CurveNum ).InterpolationType = EvaluateCurveToLimits;
+		PerfCurve( CurveNum ).Coeff1 = 0.8;
+		PerfCurve( CurveNum ).Coeff2 = 0.2;
+		PerfCurve( CurveNum ).Coeff3 = 0.0;
+		PerfCurve( CurveNum ).Var1Min = 0.5;
+		PerfCurve( CurveNum ).Var1Max = 1.5;
+
+		CurveNum = 3;
+		PerfCurve( CurveNum ).CurveType = Quadratic;
+		PerfCurve( CurveNum ).ObjectType = CurveType_Quadratic;
+		PerfCurve( CurveNum ).InterpolationType = EvaluateCurveToLimits;
+		PerfCurve( CurveNum ).Coeff1 = 1.1552;
+		PerfCurve( CurveNum ).Coeff2 = -0.1808;
+		PerfCurve( CurveNum ).Coeff3 = 0.0256;
+		PerfCurve( CurveNum ).Var1Min = 0.5;
+		PerfCurve( CurveNum ).Var1Max = 1.5;
+
+		NumDXCoils = 1;
+		DXCoil.allocate( NumDXCoils );
+		DXCoil( 1 ).NumOfSpeeds = 2;
+		DXCoil( 1 ).MSRatedTotCap.allocate( 2 );
+		DXCoil( 1 ).MSRatedCBF.allocate( 2 );
+		DXCoil( 1 ).MSRatedAirMassFlowRate.allocate( 2 );
+		DXCoil( 1 ).MSCCapFTemp.allocate( 2 );
+		DXCoil( 1 ).MSCCapFFlow.allocate( 2 );
+		DXCoil( 1 ).MSEIRFTemp.allocate( 2 );
+		DXCoil( 1 ).MSEIRFFlow.allocate( 2 );
+		DXCoil( 1 ).MSRatedTotCap = { 5000.0, 10000.0 };
+		DXCoil( 1 ).MSRatedCBF = { 0.12, 0.1 };
+		DXCoil( 1 ).MSRatedAirMassFlowRate = { 0.3, 0.6 };
+		DXCoil( 1 ).MSCCapFTemp = 1;
+		DXCoil( 1 ).MSCCapFFlow = { 2, 3 };
+		DXCoil( 1 ).MSEIRFTemp = 1;
+		DXCoil( 1 ).MSEIRFFlow = { 3, 2 };
+
+		Real64 const InletDryBulb( 26.7 );
+		Real64 const InletHumRat( 0.0111 );
+		Real64 const InletEnthalpy( PsyHFnTdbW( InletDryBulb, InletHumRat ) );
+		Real64 const InletWetBulb( PsyTwbFnTdbWPb( InletDryBulb, InletHumRat, 101325.0 ) );
+		Real64 const CondInletTemp( 35.0 );
+		Array1D< Real64 > const AirMassFlow( 2, { 0.27, 0.66 } );
+
+		Array1D< DXCoilOperatingPointData > Points( 2 );
+		for ( int Speed = 1; Speed <= 2; ++Speed ) {
+			SetMultiSpeedDXCoilOperatingPoint( 1, Speed, AirMassFlow( Speed ), AirMassFlow( Speed ) / DXCoil( 1 ).MSRatedAirMassFlowRate( Speed ), InletDryBulb, InletHumRat, InletEnthalpy, InletWetBulb, CondInletTemp, 101325.0, Points( Speed ) );
+			CalcMultiSpeedDXCoilFullLoadPerformance( 1, Speed, Points( Speed ) );
+		}
+
+		// Same results as the point by point calculation
+		for ( int Speed = 1; Speed <= 2; ++Speed ) {
+			Real64 const AirMassFlowRatio( AirMassFlow( Speed ) / DXCoil( 1 ).MSRatedAirMassFlowRate( Speed ) );
+			Real64 const CBF( AdjustCBF( DXCoil( 1 ).MSRatedCBF( Speed ), DXCoil( 1 ).MSRatedAirMassFlowRate( Speed ), AirMassFlow( Speed ) ) );
+			Real64 TotCap( 0.0 );
+			Real64 SHR( 0.0 );
+			CalcTotCapSHR( InletDryBulb, InletHumRat, InletEnthalpy, InletWetBulb, AirMassFlowRatio, AirMassFlow( Speed ), DXCoil( 1 ).MSRatedTotCap( Speed ), CBF, DXCoil( 1 ).MSCCapFTemp( Speed ), DXCoil( 1 ).MSCCapFFlow( Speed ), TotCap, SHR, CondInletTemp, 101325.0 );
+			EXPECT_TRUE( Points( Speed ).Evaluated );
+			EXPECT_DOUBLE_EQ( CBF, Points( Speed ).CBF );
+			EXPECT_DOUBLE_EQ( TotCap, Points( Speed ).TotCap );
+			EXPECT_DOUBLE_EQ( SHR, Points( Speed ).SHR );
+			EXPECT_DOUBLE_EQ( CurveValue( DXCoil( 1 ).MSEIRFTemp( Speed ), InletWetBulb, CondInletTemp ), Points( Speed ).EIRTempModFac );
+			EXPECT_DOUBLE_EQ( CurveValue( DXCoil( 1 ).MSEIRFFlow( Speed ), AirMassFlowRatio ), Points( Speed ).EIRFlowModFac );
+		}
+
+		// The stored result of a speed is reused at unchanged operating conditions
+		Real64 const TotCapHS( Points( 2 ).TotCap );
+		DXCoil( 1 ).MSFullLoadPerformance( 2 ).TotCap = 1.0;
+		SetMultiSpeedDXCoilOperatingPoint( 1, 2, AirMassFlow( 2 ), AirMassFlow( 2 ) / DXCoil( 1 ).MSRatedAirMassFlowRate( 2 ), InletDryBulb, InletHumRat, InletEnthalpy, InletWetBulb, CondInletTemp, 101325.0, Points( 2 ) );
+		CalcMultiSpeedDXCoilFullLoadPerformance( 1, 2, Points( 2 ) );
+		EXPECT_DOUBLE_EQ( 1.0, Points( 2 ).TotCap );
+
+		// and recalculated when the conditions change
+		SetMultiSpeedDXCoilOperatingPoint( 1, 2, AirMassFlow( 2 ), AirMassFlow( 2 ) / DXCoil( 1 ).MSRatedAirMassFlowRate( 2 ), InletDryBulb, InletHumRat, InletEnthalpy, InletWetBulb, CondInletTemp - 5.0, 101325.0, Points( 2 ) );
+		CalcMultiSpeedDXCoilFullLoadPerformance( 1, 2, Points( 2 ) );
+		EXPECT_LT( TotCapHS, Points( 2 ).TotCap );
+		EXPECT_DOUBLE_EQ( Points( 2 ).TotCap, DXCoil( 1 ).MSFullLoadPerformance( 2 ).TotCap );
+
+	}
+
 }
@@ -0,0 +1,149 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+
+// EnergyPlus::DataBSDFWindow Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataBSDFWindow.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataBSDFWindow;
+using namespace ObjexxFCL;
+
+TEST( DataBSDFWindowTest, CompressBSDFMatrix )
+{
+	Array2D< Real64 > Dense( 4, 4, 0.0 );
+	Dense( 1, 1 ) = 0.5;
+	Dense( 1, 3 ) = 0.25;
+	Dense( 3, 2 ) = 0.125;
+	Dense( 4, 4 ) = 1.0;
+
+	BSDFSparseMatrix Sparse;
+	CompressBSDFMatrix( Dense, Sparse );
+
+	EXPECT_EQ( 4, Sparse.NRows );
+	EXPECT_EQ( 4, Sparse.NCols );
+	EXPECT_EQ( 4, Sparse.nonZeros() );
+	for ( int i = 1; i <= 4; ++i ) {
+		for ( int j = 1; j <= 4; ++j ) {
+			EXPECT_EQ( Dense( i, j ), Sparse( i, j ) );
+		}
+	}
+
+	Array1D< Real64 > W( { 1.0, 2.0, 3.0, 4.0 } );
+	EXPECT_DOUBLE_EQ( 0.5 + 0.75, Sparse.rowDot( 1, W ) );
+	EXPECT_DOUBLE_EQ( 0.0, Sparse.rowDot( 2, W ) );
+	EXPECT_DOUBLE_EQ( 0.25, Sparse.rowDot( 3, W ) );
+	EXPECT_DOUBLE_EQ( 0.75, Sparse.rowSum( 1 ) );
+	EXPECT_DOUBLE_EQ( 1.0, Sparse.rowSum( 4 ) );
+}
+
+TEST( DataBSDFWindowTest, CalcBSDFLamdaSums )
+{
+	int const NBasis( 5 );
+	Array1D< Real64 > Lamda( NBasis );
+	Array2D< Real64 > SolFrtTrans( NBasis, NBasis, 0.0 );
+	Array2D< Real64 > SolBkRefl( NBasis, NBasis, 0.0 );
+	Array2D< Real64 > VisFrtTrans( NBasis, NBasis, 0.0 );
+	Array2D< Real64 > VisBkRefl( NBasis, NBasis, 0.0 );
+	for ( int i = 1; i <= NBasis; ++i ) {
+		Lamda( i ) = 0.1 * i;
+		for ( int j = 1; j <= NBasis; ++j ) {
+			if ( ( i + 2 * j ) % 3 == 0 ) continue; // leave a pattern of zeros
+			SolFrtTrans( i, j ) = 0.01 * ( i + j );
+			SolBkRefl( i, j ) = 0.02 * i + 0.003 * j;
+			VisFrtTrans( i, j ) = 0.015 * ( i * j );
+			VisBkRefl( i, j ) = 0.04 / ( i + j );
+		}
+	}
+
+	BSDFWindowInputStruct BSDFInput;
+	CompressBSDFMatrix( SolFrtTrans, BSDFInput.SolFrtTrans );
+	CompressBSDFMatrix( SolBkRefl, BSDFInput.SolBkRefl );
+	CompressBSDFMatrix( VisFrtTrans, BSDFInput.VisFrtTrans );
+	CompressBSDFMatrix( VisBkRefl, BSDFInput.VisBkRefl );
+	CalcBSDFLamdaSums( BSDFInput, Lamda );
+
+	for ( int i = 1; i <= NBasis; ++i ) {
+		Real64 SolFrtTransRow( 0.0 );
+		Real64 SolFrtTransCol( 0.0 );
+		Real64 VisFrtTransCol( 0.0 );
+		Real64 SolBkReflRow( 0.0 );
+		Real64 VisBkReflRow( 0.0 );
+		for ( int m = 1; m <= NBasis; ++m ) {
+			SolFrtTransRow += Lamda( m ) * SolFrtTrans( i, m );
+			SolFrtTransCol += Lamda( m ) * SolFrtTrans( m, i );
+			VisFrtTransCol += Lamda( m ) * VisFrtTrans( m, i );
+			SolBkReflRow += Lamda( m ) * SolBkRefl( i, m );
+			VisBkReflRow += Lamda( m ) * VisBkRefl( i, m );
+		}
+		EXPECT_NEAR( SolFrtTransRow, BSDFInput.SolFrtTransLamdaRow( i ), 1.0e-14 );
+		EXPECT_NEAR( SolFrtTransCol, BSDFInput.SolFrtTransLamdaCol( i ), 1.0e-14 );
+		EXPECT_NEAR( VisFrtTransCol, BSDFInput.VisFrtTransLamdaCol( i ), 1.0e-14 );
+		EXPECT_NEAR( SolBkReflRow, BSDFInput.SolBkReflLamdaRow( i ), 1.0e-14 );
+		EXPECT_NEAR( VisBkReflRow, BSDFInput.VisBkReflLamdaRow( i ), 1.0e-14 );
+	}
+}
@@ -60,6 +60,7 @@
 #include <gtest/gtest.h>
 
 // ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
@@ -68,12 +69,15 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DaylightingManager.hh>
 #include <General.hh>
 #include <HeatBalanceManager.hh>
 #include <InputProcessor.hh>
 #include <InternalHeatGains.hh>
+#include <OutputProcessor.hh>
 #include <ScheduleManager.hh>
+#include <SimulationManager.hh>
 #include <SurfaceGeometry.hh>
 #include "Fixtures/EnergyPlusFixture.hh"
 
@@ -719,3 +723,327 @@ TEST_F( EnergyPlusFixture, DaylightingManager_GetDaylParamInGeoTrans_Test )
 	EXPECT_NEAR( -2.048, ZoneDaylight( 1 ).DaylRefPtAbsCoord( 2, 1 ), 0.001 );
 	EXPECT_NEAR( 0.9, ZoneDaylight( 1 ).DaylRefPtAbsCoord( 3, 1 ), 0.001 );
 }
+
+TEST_F( EnergyPlusFixture, DaylightingManager_ParallelDayltgCoeffsMatchSerial )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.6;",
+		"Timestep, 4;",
+		"Building, Daylit Box, 0.0, Suburbs, .04, .4, FullExterior, 25, 6;",
+		"SimulationControl, NO, NO, NO, YES, NO;",
+		"Site:Location,",
+		"  Miami Intl Ap FL USA TMY3 WMO=722020E, !- Name",
+		"  25.82,                   !- Latitude {deg}",
+		"  -80.30,                  !- Longitude {deg}",
+		"  -5.00,                   !- Time Zone {hr}",
+		"  11;                      !- Elevation {m}",
+		"SizingPeriod:DesignDay,",
+		" Miami Intl Ap Ann Clg .4% Condns DB/MCWB, !- Name",
+		" 7,                        !- Month",
+		" 21,                       !- Day of Month",
+		" SummerDesignDay,          !- Day Type",
+		" 31.7,                     !- Maximum Dry-Bulb Temperature {C}",
+		" 10.0,                     !- Daily Dry-Bulb Temperature Range {deltaC}",
+		" ,                         !- Dry-Bulb Temperature Range Modifier Type",
+		" ,                         !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+		" Wetbulb,                  !- Humidity Condition Type",
+		" 22.7,                     !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+		" ,                         !- Humidity Condition Day Schedule Name",
+		" ,                         !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+		" ,                         !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+		" ,                         !- Daily Wet-Bulb Temperature Range {deltaC}",
+		" 101217.,                  !- Barometric Pressure {Pa}",
+		" 3.8,                      !- Wind Speed {m/s}",
+		" 340,                      !- Wind Direction {deg}",
+		" No,                       !- Rain Indicator",
+		" No,                       !- Snow Indicator",
+		" No,                       !- Daylight Saving Time Indicator",
+		" ASHRAEClearSky,           !- Solar Model Indicator",
+		" ,                         !- Beam Solar Day Schedule Name",
+		" ,                         !- Diffuse Solar Day Schedule Name",
+		" ,                         !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+		" ,                         !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+		" 1.00;                     !- Sky Clearness",
+		"Zone,",
+		"  Box,                     !- Name",
+		"  0.0000,                  !- Direction of Relative North {deg}",
+		"  0.0000,                  !- X Origin {m}",
+		"  0.0000,                  !- Y Origin {m}",
+		"  0.0000,                  !- Z Origin {m}",
+		"  1,                       !- Type",
+		"  1,                       !- Multiplier",
+		"  2.7,                     !- Ceiling Height {m}",
+		"  ,                        !- Volume {m3}",
+		"  autocalculate,           !- Floor Area {m2}",
+		"  ,                        !- Zone Inside Convection Algorithm",
+		"  ,                        !- Zone Outside Convection Algorithm",
+		"  Yes;                     !- Part of Total Floor Area",
+		"Lights,",
+		" Box Lights,               !- Name",
+		" Box,                      !- Zone or ZoneList Name",
+		" OnSched,                  !- Schedule Name",
+		" Watts/Area,               !- Design Level Calculation Method",
+		" ,                         !- Lighting Level {W}",
+		" 10.0,                     !- Watts per Zone Floor Area {W/m2}",
+		" ,                         !- Watts per Person {W/person}",
+		" 0.0,                      !- Return Air Fraction",
+		" 0.59,                     !- Fraction Radiant",
+		" 0.2,                      !- Fraction Visible",
+		" 0,                        !- Fraction Replaceable",
+		" GeneralLights;            !- End-Use Subcategory",
+		"Schedule:Compact,",
+		" OnSched,                  !- Name",
+		" Fraction,                 !- Schedule Type Limits Name",
+		" Through: 12/31,           !- Field 1",
+		" For: AllDays,             !- Field 2",
+		" Until: 24:00, 1.0;        !- Field 3",
+		"ScheduleTypeLimits,",
+		" Fraction,                 !- Name",
+		" 0.0,                      !- Lower Limit Value",
+		" 1.0,                      !- Upper Limit Value",
+		" CONTINUOUS;               !- Numeric Type",
+		"Material,",
+		" GP02,                     !- Name",
+		" MediumSmooth,             !- Roughness",
+		" 1.5900001E-02,            !- Thickness {m}",
+		" 0.1600000,                !- Conductivity {W/m-K}",
+		" 801.0000,                 !- Density {kg/m3}",
+		" 837.0000,                 !- Specific Heat {J/kg-K}",
+		" 0.9000000,                !- Thermal Absorptance",
+		" 0.7500000,                !- Solar Absorptance",
+		" 0.5000000;                !- Visible Absorptance",
+		"Material:NoMass,",
+		" R13,                      !- Name",
+		" Rough,                    !- Roughness",
+		" 2.29,                     !- Thermal Resistance {m2-K/W}",
+		" 0.9000000,                !- Thermal Absorptance",
+		" 0.7500000,                !- Solar Absorptance",
+		" 0.7500000;                !- Visible Absorptance",
+		"Construction,",
+		" WALL-1,                   !- Name",
+		" GP02,                     !- Outside Layer",
+		" R13,                      !- Layer 2",
+		" GP02;                     !- Layer 3",
+		"WindowMaterial:SimpleGlazingSystem,",
+		" Simple Glazing,           !- Name",
+		" 2.0,                      !- U-Factor {W/m2-K}",
+		" 0.5,                      !- Solar Heat Gain Coefficient",
+		" 0.6;                      !- Visible Transmittance",
+		"Construction,",
+		" WIN-1,                    !- Name",
+		" Simple Glazing;           !- Outside Layer",
+		"BuildingSurface:Detailed,",
+		" South Wall,               !- Name",
+		" WALL,                     !- Surface Type",
+		" WALL-1,                   !- Construction Name",
+		" Box,                      !- Zone Name",
+		" Outdoors,                 !- Outside Boundary Condition",
+		" ,                         !- Outside Boundary Condition Object",
+		" SunExposed,               !- Sun Exposure",
+		" WindExposed,              !- Wind Exposure",
+		" 0.5,                      !- View Factor to Ground",
+		" 4,                        !- Number of Vertices",
+		" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 6.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+		"FenestrationSurface:Detailed,",
+		" South Window,             !- Name",
+		" WINDOW,                   !- Surface Type",
+		" WIN-1,                    !- Construction Name",
+		" South Wall,               !- Building Surface Name",
+		" ,                         !- Outside Boundary Condition Object",
+		" 0.5,                      !- View Factor to Ground",
+		" ,                         !- Shading Control Name",
+		" ,                         !- Frame and Divider Name",
+		" 1.0,                      !- Multiplier",
+		" 4,                        !- Number of Vertices",
+		" 1.0, 0.0, 2.1,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 1.0, 0.0, 0.9,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 5.0, 0.0, 0.9,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 5.0, 0.0, 2.1;            !- X,Y,Z ==> Vertex 4 {m}",
+		"BuildingSurface:Detailed,",
+		" East Wall,                !- Name",
+		" WALL,                     !- Surface Type",
+		" WALL-1,                   !- Construction Name",
+		" Box,                      !- Zone Name",
+		" Adiabatic,                !- Outside Boundary Condition",
+		" ,                         !- Outside Boundary Condition Object",
+		" NoSun,                    !- Sun Exposure",
+		" NoWind,                   !- Wind Exposure",
+		" 0.0,                      !- View Factor to Ground",
+		" 4,                        !- Number of Vertices",
+		" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+		"BuildingSurface:Detailed,",
+		" North Wall,               !- Name",
+		" WALL,                     !- Surface Type",
+		" WALL-1,                   !- Construction Name",
+		" Box,                      !- Zone Name",
+		" Adiabatic,                !- Outside Boundary Condition",
+		" ,                         !- Outside Boundary Condition Object",
+		" NoSun,                    !- Sun Exposure",
+		" NoWind,                   !- Wind Exposure",
+		" 0.0,                      !- View Factor to Ground",
+		" 4,                        !- Number of Vertices",
+		" 6.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 0.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+		"BuildingSurface:Detailed,",
+		" West Wall,                !- Name",
+		" WALL,                     !- Surface Type",
+		" WALL-1,                   !- Construction Name",
+		" Box,                      !- Zone Name",
+		" Adiabatic,                !- Outside Boundary Condition",
+		" ,                         !- Outside Boundary Condition Object",
+		" NoSun,                    !- Sun Exposure",
+		" NoWind,                   !- Wind Exposure",
+		" 0.0,                      !- View Factor to Ground",
+		" 4,                        !- Number of Vertices",
+		" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 0.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+		"BuildingSurface:Detailed,",
+		" Floor,                    !- Name",
+		" FLOOR,                    !- Surface Type",
+		" WALL-1,                   !- Construction Name",
+		" Box,                      !- Zone Name",
+		" Adiabatic,                !- Outside Boundary Condition",
+		" ,                         !- Outside Boundary Condition Object",
+		" NoSun,                    !- Sun Exposure",
+		" NoWind,                   !- Wind Exposure",
+		" 0.0,                      !- View Factor to Ground",
+		" 4,                        !- Number of Vertices",
+		" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 0.0, 5.0, 0.0;            !- X,Y,Z ==> Vertex 4 {m}",
+		"BuildingSurface:Detailed,",
+		" Roof,                     !- Name",
+		" ROOF,                     !- Surface Type",
+		" WALL-1,                   !- Construction Name",
+		" Box,                      !- Zone Name",
+		" Adiabatic,                !- Outside Boundary Condition",
+		" ,                         !- Outside Boundary Condition Object",
+		" NoSun,                    !- Sun Exposure",
+		" NoWind,                   !- Wind Exposure",
+		" 0.0,                      !- View Factor to Ground",
+		" 4,                        !- Number of Vertices",
+		" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+		" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 2 {m}",
+		" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 3 {m}",
+		" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+		"Daylighting:Controls,",
+		" Box_DaylCtrl,             !- Name",
+		" Box,                      !- Zone Name",
+		" SplitFlux,                !- Daylighting Method",
+		" ,                         !- Availability Schedule Name",
+		" Continuous,               !- Lighting Control Type",
+		" 0.3,                      !- Minimum Input Power Fraction for Continuous or ContinuousOff Dimming Control",
+		" 0.2,                      !- Minimum Light Output Fraction for Continuous or ContinuousOff Dimming Control",
+		" ,                         !- Number of Stepped Control Steps",
+		" 1.0,                      !- Probability Lighting will be Reset When Needed in Manual Stepped Control",
+		" Box_DaylRefPt1,           !- Glare Calculation Daylighting Reference Point Name",
+		" 180.0,                    !- Glare Calculation Azimuth Angle of View Direction Clockwise from Zone y-Axis {deg}",
+		" 20.0,                     !- Maximum Allowable Discomfort Glare Index",
+		" ,                         !- DElight Gridding Resolution {m2}",
+		" Box_DaylRefPt1,           !- Daylighting Reference Point 1 Name",
+		" 0.35,                     !- Fraction of Zone Controlled by Reference Point 1",
+		" 400.,                     !- Illuminance Setpoint at Reference Point 1 {lux}",
+		" Box_DaylRefPt2,           !- Daylighting Reference Point 2 Name",
+		" 0.4,                      !- Fraction of Zone Controlled by Reference Point 2",
+		" 500.,                     !- Illuminance Setpoint at Reference Point 2 {lux}",
+		" Box_DaylRefPt3,           !- Daylighting Reference Point 3 Name",
+		" 0.25,                     !- Fraction of Zone Controlled by Reference Point 3",
+		" 450.;                     !- Illuminance Setpoint at Reference Point 3 {lux}",
+		"Daylighting:ReferencePoint,",
+		" Box_DaylRefPt1,           !- Name",
+		" Box,                      !- Zone Name",
+		" 3.0,                      !- X-Coordinate of Reference Point {m}",
+		" 1.0,                      !- Y-Coordinate of Reference Point {m}",
+		" 0.8;                      !- Z-Coordinate of Reference Point {m}",
+		"Daylighting:ReferencePoint,",
+		" Box_DaylRefPt2,           !- Name",
+		" Box,                      !- Zone Name",
+		" 3.0,                      !- X-Coordinate of Reference Point {m}",
+		" 2.5,                      !- Y-Coordinate of Reference Point {m}",
+		" 0.8;                      !- Z-Coordinate of Reference Point {m}",
+		"Daylighting:ReferencePoint,",
+		" Box_DaylRefPt3,           !- Name",
+		" Box,                      !- Zone Name",
+		" 3.0,                      !- X-Coordinate of Reference Point {m}",
+		" 4.0,                      !- Y-Coordinate of Reference Point {m}",
+		" 0.8;                      !- Z-Coordinate of Reference Point {m}",
+		"Output:IlluminanceMap,",
+		" Map1,                     !- Name",
+		" Box,                      !- Zone Name",
+		" 0.8,                      !- Z height {m}",
+		" 0.5,                      !- X Minimum Coordinate {m}",
+		" 5.5,                      !- X Maximum Coordinate {m}",
+		" 4,                        !- Number of X Grid Points",
+		" 0.5,                      !- Y Minimum Coordinate {m}",
+		" 4.5,                      !- Y Maximum Coordinate {m}",
+		" 3;                        !- Number of Y Grid Points",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	OutputProcessor::TimeValue.allocate( 2 );
+	DataGlobals::DDOnlySimulation = true;
+
+	SimulationManager::ManageSimulation();
+	ASSERT_EQ( 3, ZoneDaylight( 1 ).TotalDaylRefPoints );
+	ASSERT_EQ( 1, TotIllumMaps );
+	ASSERT_TRUE( CanCalcDayltgCoeffsConcurrently( 1 ) );
+
+	// Recalculate the factors of the last design day from zero, first serially and then with four threads
+	auto const zeroFactors = [](){
+		ZoneDaylight( 1 ).DaylIllFacSky = 0.0;
+		ZoneDaylight( 1 ).DaylSourceFacSky = 0.0;
+		ZoneDaylight( 1 ).DaylBackFacSky = 0.0;
+		ZoneDaylight( 1 ).DaylIllFacSun = 0.0;
+		ZoneDaylight( 1 ).DaylIllFacSunDisk = 0.0;
+		ZoneDaylight( 1 ).DaylSourceFacSun = 0.0;
+		ZoneDaylight( 1 ).DaylSourceFacSunDisk = 0.0;
+		ZoneDaylight( 1 ).DaylBackFacSun = 0.0;
+		ZoneDaylight( 1 ).DaylBackFacSunDisk = 0.0;
+		IllumMapCalc( 1 ).DaylIllFacSky = 0.0;
+		IllumMapCalc( 1 ).DaylIllFacSun = 0.0;
+		IllumMapCalc( 1 ).DaylIllFacSunDisk = 0.0;
+	};
+	zeroFactors();
+	DataSystemVariables::NumberParallelThreads = 1;
+	CalcDayltgCoeffsRefMapPoints( 1 );
+	ZoneDaylightCalc const serialRefPoints( ZoneDaylight( 1 ) );
+	MapCalcData const serialMapPoints( IllumMapCalc( 1 ) );
+	EXPECT_GT( maxval( serialRefPoints.DaylIllFacSky ), 0.0 );
+	EXPECT_GT( maxval( serialMapPoints.DaylIllFacSky ), 0.0 );
+
+	zeroFactors();
+	DataSystemVariables::NumberParallelThreads = 4;
+	CalcDayltgCoeffsRefMapPoints( 1 );
+	DataSystemVariables::NumberParallelThreads = 1;
+
+	auto const expectIdentical = []( Array< Real64 > const & serial, Array< Real64 > const & parallel ){
+		ASSERT_EQ( serial.size(), parallel.size() );
+		for ( Array< Real64 >::size_type i = 0; i < serial.size(); ++i ) {
+			EXPECT_EQ( serial[ i ], parallel[ i ] );
+		}
+	};
+	expectIdentical( serialRefPoints.DaylIllFacSky, ZoneDaylight( 1 ).DaylIllFacSky );
+	expectIdentical( serialRefPoints.DaylSourceFacSky, ZoneDaylight( 1 ).DaylSourceFacSky );
+	expectIdentical( serialRefPoints.DaylBackFacSky, ZoneDaylight( 1 ).DaylBackFacSky );
+	expectIdentical( serialRefPoints.DaylIllFacSun, ZoneDaylight( 1 ).DaylIllFacSun );
+	expectIdentical( serialRefPoints.DaylIllFacSunDisk, ZoneDaylight( 1 ).DaylIllFacSunDisk );
+	expectIdentical( serialRefPoints.DaylSourceFacSun, ZoneDaylight( 1 ).DaylSourceFacSun );
+	expectIdentical( serialRefPoints.DaylSourceFacSunDisk, ZoneDaylight( 1 ).DaylSourceFacSunDisk );
+	expectIdentical( serialRefPoints.DaylBackFacSun, ZoneDaylight( 1 ).DaylBackFacSun );
+	expectIdentical( serialRefPoints.DaylBackFacSunDisk, ZoneDaylight( 1 ).DaylBackFacSunDisk );
+	expectIdentical( serialMapPoints.DaylIllFacSky, IllumMapCalc( 1 ).DaylIllFacSky );
+	expectIdentical( serialMapPoints.DaylIllFacSun, IllumMapCalc( 1 ).DaylIllFacSun );
+	expectIdentical( serialMapPoints.DaylIllFacSunDisk, IllumMapCalc( 1 ).DaylIllFacSunDisk );
+}
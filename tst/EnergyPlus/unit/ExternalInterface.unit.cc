@@ -0,0 +1,147 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::ExternalInterface Unit Tests
+
+// C++ Headers
+#include <fstream>
+#include <string>
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/ExternalInterface.hh>
+#include <EnergyPlus/FileSystem.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::OutputProcessor;
+
+TEST_F( EnergyPlusFixture, ExternalInterface_FMUInputVariableKeptCurrent )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.6;",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	DataGlobals::MinutesPerTimeStep = 10;
+	Real64 timeStep = 1.0 / 6;
+	TimeValue.allocate( 2 );
+	SetupTimePointers( "Zone", timeStep );
+	SetupTimePointers( "HVAC", timeStep );
+	TimeValue( 1 ).CurMinute = 0;
+	TimeValue( 2 ).CurMinute = 0;
+
+	// Neither variable is reported or metered
+	GetReportVariableInput();
+	Real64 zoneTemp1 = 20.0;
+	Real64 zoneTemp2 = 20.0;
+	SetupOutputVariable( "Zone Mean Air Temperature [C]", zoneTemp1, "Zone", "Average", "SPACE1-1" );
+	SetupOutputVariable( "Zone Mean Air Temperature [C]", zoneTemp2, "Zone", "Average", "SPACE2-1" );
+
+	// Resolve the first one the way InitExternalInterfaceFMUImport resolves an FMU input variable
+	Array1D_string varKeys( 1, "SPACE1-1" );
+	Array1D_string varNames( 1, "Zone Mean Air Temperature" );
+	Array1D_int keyIndexes( 1 );
+	Array1D_int varTypes( 1 );
+	ExternalInterface::GetReportVariableKey( varKeys, 1, varNames, keyIndexes, varTypes );
+	ASSERT_EQ( VarType_Real, varTypes( 1 ) );
+	EXPECT_TRUE( RVariableTypes( keyIndexes( 1 ) ).VarPtr().ExternalInterface );
+	EXPECT_FALSE( ActiveVariables.Current );
+
+	// Its zone time step value is updated, the variable nothing reads is skipped
+	zoneTemp1 = 23.5;
+	zoneTemp2 = 23.5;
+	UpdateDataandReport( DataGlobals::ZoneTSReporting );
+	EXPECT_DOUBLE_EQ( 23.5, GetInternalVariableValueExternalInterface( varTypes( 1 ), keyIndexes( 1 ) ) );
+	EXPECT_DOUBLE_EQ( 0.0, RVariableTypes( keyIndexes( 1 ) + 1 ).VarPtr().EITSValue );
+}
+
+TEST_F( EnergyPlusFixture, ExternalInterface_GetFMUCacheKey )
+{
+	// 64-bit FNV-1a hash of the content, then the size, both in hexadecimal
+	std::string const fileName( "ExternalInterface_GetFMUCacheKey.fmu" );
+	auto writeFile = [&]( std::string const & content ) {
+		std::ofstream fmuFile( fileName, std::ios::binary | std::ios::trunc );
+		fmuFile << content;
+	};
+
+	writeFile( "" );
+	EXPECT_EQ( "cbf29ce484222325_0", ExternalInterface::GetFMUCacheKey( fileName ) );
+	writeFile( "a" );
+	EXPECT_EQ( "af63dc4c8601ec8c_1", ExternalInterface::GetFMUCacheKey( fileName ) );
+	writeFile( "foobar" );
+	EXPECT_EQ( "85944171f73967e8_6", ExternalInterface::GetFMUCacheKey( fileName ) );
+
+	// Content spanning more than one read buffer
+	std::string content( 70000, '\0' );
+	for ( std::size_t i = 0; i < content.size(); ++i ) content[ i ] = static_cast< char >( i % 256 );
+	writeFile( content );
+	EXPECT_EQ( "bdc3725b257b6a55_11170", ExternalInterface::GetFMUCacheKey( fileName ) );
+
+	FileSystem::removeFile( fileName );
+	EXPECT_EQ( "", ExternalInterface::GetFMUCacheKey( fileName ) );
+}
@@ -58,9 +58,20 @@
 
 // EnergyPlus::SortAndStringUtilities Unit Tests
 
+// C++ Headers
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/gio.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/General.hh>
 
@@ -245,3 +256,174 @@ TEST_F( EnergyPlusFixture, General_CreateTimeIntervalString )
 		EXPECT_EQ( "00:00:59.0 - 00:00:59.9", General::CreateTimeIntervalString( 59, 59.9 ) );
 	}
 }
+
+TEST_F( EnergyPlusFixture, General_SolveTridiagonal )
+{
+	// Diagonally dominant system with known solution ( 1, 2, 3, 4 )
+	Array1D< Real64 > A( { 0.0, -1.0, -1.0, -1.0 } );
+	Array1D< Real64 > B( { 4.0, 4.0, 4.0, 4.0 } );
+	Array1D< Real64 > C( { -1.0, -1.0, -1.0, 0.0 } );
+	Array1D< Real64 > D( { 2.0, 4.0, 6.0, 13.0 } );
+	Array1D< Real64 > W( 4 );
+
+	General::SolveTridiagonal( 4, A, B, C, D, W );
+	EXPECT_NEAR( 1.0, D( 1 ), 1.0e-12 );
+	EXPECT_NEAR( 2.0, D( 2 ), 1.0e-12 );
+	EXPECT_NEAR( 3.0, D( 3 ), 1.0e-12 );
+	EXPECT_NEAR( 4.0, D( 4 ), 1.0e-12 );
+
+	// Single equation
+	D( 1 ) = 8.0;
+	General::SolveTridiagonal( 1, A, B, C, D, W );
+	EXPECT_NEAR( 2.0, D( 1 ), 1.0e-12 );
+}
+
+TEST_F( EnergyPlusFixture, General_SolveRegulaFalsiWithGuess )
+{
+	// Part-load like residual with a root at 0.3
+	int NumEvals( 0 );
+	auto f = [ &NumEvals ]( Real64 const X ) {
+		++NumEvals;
+		return ( X - 0.3 ) * ( 1.0 + X );
+	};
+	int Flag( 0 );
+	Real64 XRes( 0.0 );
+
+	// Bounds supplied by the caller are not evaluated again
+	General::SolveRegulaFalsi( 1.0e-6, 100, Flag, XRes, f, 0.0, f( 0.0 ), 1.0, f( 1.0 ), 0.0 );
+	EXPECT_GT( Flag, 1 );
+	EXPECT_NEAR( 0.3, XRes, 1.0e-5 );
+	EXPECT_EQ( Flag + 2, NumEvals );
+
+	// A guess at the previous solution converges on the first evaluation
+	NumEvals = 0;
+	General::SolveRegulaFalsi( 1.0e-6, 100, Flag, XRes, f, 0.0, -0.3, 1.0, 1.4, XRes );
+	EXPECT_EQ( 1, Flag );
+	EXPECT_EQ( 1, NumEvals );
+	EXPECT_NEAR( 0.3, XRes, 1.0e-5 );
+
+	// Same sign at both bounds
+	General::SolveRegulaFalsi( 1.0e-6, 100, Flag, XRes, f, 0.5, f( 0.5 ), 1.0, f( 1.0 ), 0.7 );
+	EXPECT_EQ( -2, Flag );
+	EXPECT_EQ( 0.5, XRes );
+}
+
+// Report values like those written to the eso: temperatures, loads, energies, flows, fractions, and zeros
+std::vector< Real64 >
+reportValueStream( std::size_t const n )
+{
+	std::mt19937 gen( 1031 );
+	std::uniform_real_distribution< Real64 > u( 0.0, 1.0 );
+	std::vector< Real64 > values;
+	values.reserve( n );
+	for ( std::size_t i = 0; i < n; ++i ) {
+		switch ( i % 8 ) {
+		case 0: values.push_back( 18.0 + 8.0 * u( gen ) ); break; // Zone air temperature (C)
+		case 1: values.push_back( -10.0 + 40.0 * u( gen ) ); break; // Outdoor temperature (C)
+		case 2: values.push_back( 25000.0 * u( gen ) ); break; // Coil load (W)
+		case 3: values.push_back( 3.6e9 * u( gen ) ); break; // Meter energy (J)
+		case 4: values.push_back( 0.05 * u( gen ) ); break; // Mass flow rate (kg/s)
+		case 5: values.push_back( u( gen ) ); break; // Part load or schedule fraction
+		case 6: values.push_back( std::round( 100.0 * u( gen ) ) / 4.0 ); break; // Short decimal
+		default: values.push_back( 0.0 ); // Off equipment
+		}
+	}
+	return values;
+}
+
+TEST_F( EnergyPlusFixture, General_ListDirectedString )
+{
+	static gio::Fmt fmtLD( "*" );
+	std::string String;
+
+	EXPECT_EQ( "   21.5000000000000     ", General::ListDirectedString( 21.5 ) );
+	EXPECT_EQ( " -4.000000000000000E-002", General::ListDirectedString( -0.04 ) );
+	EXPECT_EQ( "  1.234567890123457E+017", General::ListDirectedString( 123456789012345678.0 ) );
+
+	// Same characters as list-directed output around every power of ten and for report-like values
+	std::vector< Real64 > values( reportValueStream( 4000 ) );
+	for ( int e = -320; e <= 308; ++e ) {
+		Real64 const p( std::pow( 10.0, e ) );
+		values.push_back( p );
+		values.push_back( -std::nextafter( p, 0.0 ) );
+		values.push_back( std::nextafter( p, 2.0 * p ) );
+	}
+	values.push_back( 0.1 + 0.2 );
+	values.push_back( 99999999999999999.0 );
+	for ( Real64 const v : values ) {
+		gio::write( String, fmtLD ) << v;
+		EXPECT_EQ( String, General::ListDirectedString( v ) ) << v;
+	}
+}
+
+TEST_F( EnergyPlusFixture, General_FixedAndExponentString )
+{
+	static gio::Fmt fmtF2( "(F12.2)" );
+	static gio::Fmt fmtF9( "(F12.9)" );
+	static gio::Fmt fmtE( "(E12.6)" );
+	std::string String;
+
+	EXPECT_EQ( "       -0.50", General::FixedString( -0.5, 12, 2 ) );
+	EXPECT_EQ( "-.500000000", General::FixedString( -0.5, 11, 9 ) );
+	EXPECT_EQ( "************", General::FixedString( 1.0e12, 12, 2 ) );
+	EXPECT_EQ( "0.123457E+03", General::ExponentString( 123.4567, 12, 6, 2, 0 ) );
+	EXPECT_EQ( "-.100000E+12", General::ExponentString( -99999999999.9, 12, 6, 2, 0 ) );
+	EXPECT_EQ( "0.100000+101", General::ExponentString( 1.0e100, 12, 6, 2, 0 ) );
+
+	for ( Real64 const v : reportValueStream( 4000 ) ) {
+		gio::write( String, fmtF2 ) << v;
+		EXPECT_EQ( String, General::FixedString( v, 12, 2 ) ) << v;
+		gio::write( String, fmtF9 ) << v;
+		EXPECT_EQ( String, General::FixedString( v, 12, 9 ) ) << v;
+		gio::write( String, fmtE ) << v;
+		EXPECT_EQ( String, General::ExponentString( v, 12, 6, 2, 0 ) ) << v;
+	}
+}
+
+TEST_F( EnergyPlusFixture, General_RoundAndTrimSigDigits )
+{
+	EXPECT_EQ( "21.46", General::RoundSigDigits( 21.456, 2 ) );
+	EXPECT_EQ( "21.45", General::TrimSigDigits( 21.456, 2 ) );
+	EXPECT_EQ( "-10.00", General::RoundSigDigits( -9.9999, 2 ) );
+	EXPECT_EQ( "-9.99", General::TrimSigDigits( -9.9999, 2 ) );
+	EXPECT_EQ( "100", General::RoundSigDigits( 99.96, 0 ) );
+	EXPECT_EQ( "1234568", General::RoundSigDigits( 1234567.891, 0 ) );
+	EXPECT_EQ( "1.235E-004", General::RoundSigDigits( 0.000123456, 3 ) );
+	EXPECT_EQ( "1.234E-004", General::TrimSigDigits( 0.000123456, 3 ) );
+	EXPECT_EQ( "-3.E-007", General::RoundSigDigits( -2.5e-7, 0 ) );
+	EXPECT_EQ( "1.00E+020", General::RoundSigDigits( 1.0e20, 2 ) );
+	EXPECT_EQ( "0.00", General::RoundSigDigits( 0.0, 2 ) );
+	EXPECT_EQ( "-17", General::RoundSigDigits( -17 ) );
+	EXPECT_EQ( "2147483647", General::TrimSigDigits( 2147483647 ) );
+}
+
+// Formatting throughput benchmark: Run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST( GeneralTest, DISABLED_FormatBenchmark )
+{
+	static gio::Fmt fmtLD( "*" );
+	std::vector< Real64 > const values( reportValueStream( 1000000 ) );
+	std::string String;
+	std::size_t lenGio( 0 ), lenFast( 0 ), lenRound( 0 );
+	using Clock = std::chrono::steady_clock;
+
+	Clock::time_point const t0( Clock::now() );
+	for ( Real64 const v : values ) {
+		gio::write( String, fmtLD ) << v;
+		lenGio += String.length();
+	}
+	Clock::time_point const t1( Clock::now() );
+	for ( Real64 const v : values ) lenFast += General::ListDirectedString( v ).length();
+	Clock::time_point const t2( Clock::now() );
+	for ( Real64 const v : values ) lenRound += General::RoundSigDigits( v, 2 ).length();
+	Clock::time_point const t3( Clock::now() );
+	EXPECT_EQ( lenGio, lenFast );
+
+	Real64 const n( Real64( values.size() ) );
+	Real64 const secGio( std::chrono::duration< Real64 >( t1 - t0 ).count() );
+	Real64 const secFast( std::chrono::duration< Real64 >( t2 - t1 ).count() );
+	Real64 const secRound( std::chrono::duration< Real64 >( t3 - t2 ).count() );
+	std::cout << "Values: " << values.size() << " (" << lenRound << " rounded characters)\n";
+	std::cout << "gio list-directed:  " << n / secGio << " values/s\n";
+	std::cout << "ListDirectedString: " << n / secFast << " values/s  (x" << secGio / secFast << ")\n";
+	std::cout << "RoundSigDigits:     " << n / secRound << " values/s\n";
+}
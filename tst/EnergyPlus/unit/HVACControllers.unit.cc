@@ -65,8 +65,11 @@
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataHVACControllers.hh>
+#include <EnergyPlus/DataRootFinder.hh>
 #include <EnergyPlus/HVACControllers.hh>
 #include <EnergyPlus/MixedAir.hh>
+#include <EnergyPlus/RootFinder.hh>
 #include <EnergyPlus/ScheduleManager.hh>
 #include <EnergyPlus/SetPointManager.hh>
 #include <EnergyPlus/WaterCoils.hh>
@@ -74,6 +77,7 @@
 
 #include "Fixtures/EnergyPlusFixture.hh"
 
+using namespace EnergyPlus::DataRootFinder;
 using namespace EnergyPlus::MixedAir;
 using namespace EnergyPlus::HVACControllers;
 using namespace EnergyPlus::ScheduleManager;
@@ -219,4 +223,95 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, HVACControllers_SecantCandidate ) {
+		ControllerProps.allocate( 1 );
+		RootFinders.allocate( 1 );
+		RootFinder::SetupRootFinder( RootFinders( 1 ), iSlopeIncreasing, iMethodBrent, 0.0, 1.0e-6, 0.01 );
+		RootFinder::InitializeRootFinder( RootFinders( 1 ), 0.0, 1.0 );
+
+		// Min point is below the setpoint: the root finder would try the max point next
+		bool IsDoneFlag( false );
+		RootFinder::IterateRootFinder( RootFinders( 1 ), 0.0, -2.0, IsDoneFlag );
+		EXPECT_FALSE( IsDoneFlag );
+		EXPECT_EQ( iMethodBracket, RootFinders( 1 ).CurrentMethodType );
+		EXPECT_DOUBLE_EQ( 1.0, RootFinders( 1 ).XCandidate );
+
+		// No sensitivity known yet
+		Real64 XNext( -1.0 );
+		EXPECT_FALSE( SecantCandidate( 1, XNext ) );
+		EXPECT_DOUBLE_EQ( -1.0, XNext );
+
+		// Secant step with the stored sensitivity
+		ControllerProps( 1 ).SensitivityDefinedFlag = true;
+		ControllerProps( 1 ).Sensitivity = 4.0;
+		EXPECT_TRUE( SecantCandidate( 1, XNext ) );
+		EXPECT_DOUBLE_EQ( 0.5, XNext );
+		EXPECT_EQ( 1, ControllerProps( 1 ).NumSecantSteps );
+
+		// Candidates outside of the min/max range are left to the root finder
+		ControllerProps( 1 ).Sensitivity = 1.0;
+		EXPECT_FALSE( SecantCandidate( 1, XNext ) );
+		EXPECT_DOUBLE_EQ( 0.5, XNext );
+
+		// Limited number of secant steps per root finder initialization
+		ControllerProps( 1 ).Sensitivity = 4.0;
+		ControllerProps( 1 ).NumSecantSteps = MaxSecantSteps;
+		EXPECT_FALSE( SecantCandidate( 1, XNext ) );
+	}
+
+	TEST_F( EnergyPlusFixture, HVACControllers_SecantReducesIterations ) {
+		ControllerProps.allocate( 1 );
+		RootFinders.allocate( 1 );
+		RootFinder::SetupRootFinder( RootFinders( 1 ), iSlopeIncreasing, iMethodBrent, 0.0, 1.0e-6, 0.001 );
+
+		// Sensed value as a slightly nonlinear, increasing function of the actuated value on [0,1]
+		auto SensedValue = []( Real64 const X ) { return 2.0 * X + 0.1 * X * X; };
+
+		// Iterates the controller as SimAirLoopComponents/CalcSimpleController would, starting from
+		// the min point, and returns the number of controller iterations needed to converge
+		auto Solve = [&]( Real64 const SetPoint, Real64 & Root ) {
+			bool IsConvergedFlag( false );
+			bool IsUpToDateFlag( false );
+			int NumIterations( 0 );
+			RootFinder::InitializeRootFinder( RootFinders( 1 ), 0.0, 1.0 );
+			ControllerProps( 1 ).NumSecantSteps = 0;
+			ControllerProps( 1 ).NextActuatedValue = RootFinders( 1 ).MinPoint.X;
+			while ( ! IsConvergedFlag && NumIterations < 50 ) {
+				ControllerProps( 1 ).ActuatedValue = ControllerProps( 1 ).NextActuatedValue;
+				ControllerProps( 1 ).DeltaSensed = SensedValue( ControllerProps( 1 ).ActuatedValue ) - SetPoint;
+				FindRootSimpleController( 1, false, IsConvergedFlag, IsUpToDateFlag, "TEST CONTROLLER" );
+				++NumIterations;
+			}
+			EXPECT_TRUE( IsConvergedFlag );
+			EXPECT_EQ( DataHVACControllers::iModeActive, ControllerProps( 1 ).Mode );
+			Root = ControllerProps( 1 ).NextActuatedValue;
+			return NumIterations;
+		};
+
+		// First solution brackets with the min/max points and saves the sensitivity at the root
+		Real64 Root( 0.0 );
+		Solve( 1.5, Root );
+		EXPECT_NEAR( 1.5, SensedValue( Root ), 0.001 );
+		ASSERT_TRUE( ControllerProps( 1 ).SensitivityDefinedFlag );
+		EXPECT_NEAR( 2.0 + 0.2 * Root, ControllerProps( 1 ).Sensitivity, 0.01 );
+		Real64 const Sensitivity = ControllerProps( 1 ).Sensitivity;
+
+		// Next setpoint without the stored sensitivity
+		Real64 RootWithout( 0.0 );
+		ControllerProps( 1 ).SensitivityDefinedFlag = false;
+		int const NumIterationsWithout = Solve( 1.6, RootWithout );
+
+		// Same setpoint with the stored sensitivity
+		Real64 RootWith( 0.0 );
+		ControllerProps( 1 ).SensitivityDefinedFlag = true;
+		ControllerProps( 1 ).Sensitivity = Sensitivity;
+		int const NumIterationsWith = Solve( 1.6, RootWith );
+
+		EXPECT_GT( ControllerProps( 1 ).NumSecantSteps, 0 );
+		EXPECT_LT( NumIterationsWith, NumIterationsWithout );
+		EXPECT_NEAR( 1.6, SensedValue( RootWithout ), 0.001 );
+		EXPECT_NEAR( 1.6, SensedValue( RootWith ), 0.001 );
+		EXPECT_NEAR( RootWithout, RootWith, 0.001 );
+	}
+
 }
@@ -58,19 +58,221 @@
 
 // EnergyPlus::HeatBalFiniteDiffManager Unit Tests
 
+// C++ Headers
+#include <string>
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/HeatBalFiniteDiffManager.hh>
+#include <EnergyPlus/InputProcessor.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/SimulationManager.hh>
 
 using namespace EnergyPlus::HeatBalFiniteDiffManager;
 
 namespace EnergyPlus {
 
+	static
+	std::vector< std::string >
+	FiniteDiffBoxIDFObjects()
+	{
+		// One zone box without HVAC, whose opaque surfaces are all solved by CondFD, run for one design day
+		return {
+			"Version,8.6;",
+			"Timestep, 12;",
+			"Building, CondFD Box, 0.0, Suburbs, .04, .4, FullExterior, 25, 6;",
+			"SimulationControl, NO, NO, NO, YES, NO;",
+			"HeatBalanceAlgorithm, ConductionFiniteDifference;",
+			"HeatBalanceSettings:ConductionFiniteDifference,",
+			" FullyImplicitFirstOrder,  !- Difference Scheme",
+			" 3,                        !- Space Discretization Constant",
+			" 1.0,                      !- Relaxation Factor",
+			" 0.002,                    !- Inside Face Surface Temperature Convergence Criteria",
+			" GaussSeidel;              !- Solution Method",
+			"Site:Location,",
+			"  Miami Intl Ap FL USA TMY3 WMO=722020E, !- Name",
+			"  25.82,                   !- Latitude {deg}",
+			"  -80.30,                  !- Longitude {deg}",
+			"  -5.00,                   !- Time Zone {hr}",
+			"  11;                      !- Elevation {m}",
+			"SizingPeriod:DesignDay,",
+			" Miami Intl Ap Ann Clg .4% Condns DB/MCWB, !- Name",
+			" 7,                        !- Month",
+			" 21,                       !- Day of Month",
+			" SummerDesignDay,          !- Day Type",
+			" 31.7,                     !- Maximum Dry-Bulb Temperature {C}",
+			" 10.0,                     !- Daily Dry-Bulb Temperature Range {deltaC}",
+			" ,                         !- Dry-Bulb Temperature Range Modifier Type",
+			" ,                         !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+			" Wetbulb,                  !- Humidity Condition Type",
+			" 22.7,                     !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+			" ,                         !- Humidity Condition Day Schedule Name",
+			" ,                         !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+			" ,                         !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+			" ,                         !- Daily Wet-Bulb Temperature Range {deltaC}",
+			" 101217.,                  !- Barometric Pressure {Pa}",
+			" 3.8,                      !- Wind Speed {m/s}",
+			" 340,                      !- Wind Direction {deg}",
+			" No,                       !- Rain Indicator",
+			" No,                       !- Snow Indicator",
+			" No,                       !- Daylight Saving Time Indicator",
+			" ASHRAEClearSky,           !- Solar Model Indicator",
+			" ,                         !- Beam Solar Day Schedule Name",
+			" ,                         !- Diffuse Solar Day Schedule Name",
+			" ,                         !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+			" ,                         !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+			" 1.00;                     !- Sky Clearness",
+			"Zone,",
+			"  Box,                     !- Name",
+			"  0.0000,                  !- Direction of Relative North {deg}",
+			"  0.0000,                  !- X Origin {m}",
+			"  0.0000,                  !- Y Origin {m}",
+			"  0.0000,                  !- Z Origin {m}",
+			"  1,                       !- Type",
+			"  1,                       !- Multiplier",
+			"  2.7,                     !- Ceiling Height {m}",
+			"  ,                        !- Volume {m3}",
+			"  autocalculate,           !- Floor Area {m2}",
+			"  ,                        !- Zone Inside Convection Algorithm",
+			"  ,                        !- Zone Outside Convection Algorithm",
+			"  Yes;                     !- Part of Total Floor Area",
+			"Material,",
+			" Brick,                    !- Name",
+			" Rough,                    !- Roughness",
+			" 0.1,                      !- Thickness {m}",
+			" 0.89,                     !- Conductivity {W/m-K}",
+			" 1920.0,                   !- Density {kg/m3}",
+			" 790.0,                    !- Specific Heat {J/kg-K}",
+			" 0.9,                      !- Thermal Absorptance",
+			" 0.7,                      !- Solar Absorptance",
+			" 0.7;                      !- Visible Absorptance",
+			"Material,",
+			" Insulation,               !- Name",
+			" MediumRough,              !- Roughness",
+			" 0.05,                     !- Thickness {m}",
+			" 0.03,                     !- Conductivity {W/m-K}",
+			" 43.0,                     !- Density {kg/m3}",
+			" 1210.0,                   !- Specific Heat {J/kg-K}",
+			" 0.9,                      !- Thermal Absorptance",
+			" 0.7,                      !- Solar Absorptance",
+			" 0.7;                      !- Visible Absorptance",
+			"Material,",
+			" GP02,                     !- Name",
+			" MediumSmooth,             !- Roughness",
+			" 1.5900001E-02,            !- Thickness {m}",
+			" 0.1600000,                !- Conductivity {W/m-K}",
+			" 801.0000,                 !- Density {kg/m3}",
+			" 837.0000,                 !- Specific Heat {J/kg-K}",
+			" 0.9000000,                !- Thermal Absorptance",
+			" 0.7500000,                !- Solar Absorptance",
+			" 0.5000000;                !- Visible Absorptance",
+			"Construction,",
+			" WALL-1,                   !- Name",
+			" Brick,                    !- Outside Layer",
+			" Insulation,               !- Layer 2",
+			" GP02;                     !- Layer 3",
+			"BuildingSurface:Detailed,",
+			" South Wall,               !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Box,                      !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" East Wall,                !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Box,                      !- Zone Name",
+			" Adiabatic,                !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" NoSun,                    !- Sun Exposure",
+			" NoWind,                   !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" North Wall,               !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Box,                      !- Zone Name",
+			" Adiabatic,                !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" NoSun,                    !- Sun Exposure",
+			" NoWind,                   !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" West Wall,                !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Box,                      !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Floor,                    !- Name",
+			" FLOOR,                    !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Box,                      !- Zone Name",
+			" Adiabatic,                !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" NoSun,                    !- Sun Exposure",
+			" NoWind,                   !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 5.0, 0.0;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Roof,                     !- Name",
+			" ROOF,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Box,                      !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}"
+		};
+	}
+
 	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_CalcNodeHeatFluxTest)
 	{
 
@@ -193,4 +395,116 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_IndependentFiniteDiffSurfaceTest )
+	{
+		using namespace DataSurfaces;
+
+		TotSurfaces = 5;
+		Surface.allocate( TotSurfaces );
+		for ( auto & surface : Surface ) {
+			surface.HeatTransferAlgorithm = HeatTransferModel_CondFD;
+			surface.Class = SurfaceClass_Wall;
+		}
+		Surface( 1 ).ExtBoundCond = ExternalEnvironment; // exterior wall
+		Surface( 2 ).ExtBoundCond = 2; // adiabatic partition
+		Surface( 3 ).ExtBoundCond = 4; // interzone partition
+		Surface( 4 ).ExtBoundCond = ExternalEnvironment;
+		Surface( 4 ).MaterialMovInsulExt = 1; // outside movable insulation
+		Surface( 5 ).ExtBoundCond = ExternalEnvironment;
+		Surface( 5 ).HeatTransferAlgorithm = HeatTransferModel_CTF;
+
+		EXPECT_TRUE( IndependentFiniteDiffSurface( 1 ) );
+		EXPECT_TRUE( IndependentFiniteDiffSurface( 2 ) );
+		EXPECT_FALSE( IndependentFiniteDiffSurface( 3 ) );
+		EXPECT_FALSE( IndependentFiniteDiffSurface( 4 ) );
+		EXPECT_FALSE( IndependentFiniteDiffSurface( 5 ) );
+	}
+
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_DirectMatchesConvergedGaussSeidel )
+	{
+		ASSERT_FALSE( process_idf( delimited_string( FiniteDiffBoxIDFObjects() ) ) );
+
+		OutputProcessor::TimeValue.allocate( 2 );
+		DataGlobals::DDOnlySimulation = true;
+
+		SimulationManager::ManageSimulation();
+
+		int const Surf( InputProcessor::FindItemInList( "SOUTH WALL", DataSurfaces::Surface ) );
+		ASSERT_GT( Surf, 0 );
+		ASSERT_EQ( DataSurfaces::ExternalEnvironment, DataSurfaces::Surface( Surf ).ExtBoundCond );
+		DataHeatBalance::CondFDRelaxFactor = 1.0;
+
+		// Iterate the node equations of the last time step of the design day to their fixed point
+		auto const saved = SurfaceFD( Surf );
+		Real64 TempSurfInTmp( 0.0 );
+		Real64 TempSurfOutTmp( 0.0 );
+		CondFDSolutionMethod = GaussSeidelSolution;
+		for ( int call = 1; call <= 1000; ++call ) {
+			Array1D< Real64 > const TDTLast( SurfaceFD( Surf ).TDT );
+			CalcHeatBalFiniteDiff( Surf, TempSurfInTmp, TempSurfOutTmp );
+			Real64 MaxDelTemp( 0.0 );
+			for ( int i = 1, e = TDTLast.u(); i <= e; ++i ) {
+				MaxDelTemp = max( std::abs( SurfaceFD( Surf ).TDT( i ) - TDTLast( i ) ), MaxDelTemp );
+			}
+			if ( MaxDelTemp < 1.0e-10 ) break;
+		}
+		Array1D< Real64 > const gaussSeidelTDT( SurfaceFD( Surf ).TDT );
+		Real64 const gaussSeidelIn( TempSurfInTmp );
+		Real64 const gaussSeidelOut( TempSurfOutTmp );
+
+		// Solve the same step directly, once, from the same starting state
+		SurfaceFD( Surf ) = saved;
+		CondFDSolutionMethod = DirectSolution;
+		CalcHeatBalFiniteDiff( Surf, TempSurfInTmp, TempSurfOutTmp );
+		EXPECT_EQ( 1, SurfaceFD( Surf ).GSloopCounter );
+
+		ASSERT_EQ( gaussSeidelTDT.size(), SurfaceFD( Surf ).TDT.size() );
+		for ( int i = 1, e = gaussSeidelTDT.u(); i <= e; ++i ) {
+			EXPECT_NEAR( gaussSeidelTDT( i ), SurfaceFD( Surf ).TDT( i ), 1.0e-6 );
+		}
+		EXPECT_NEAR( gaussSeidelIn, TempSurfInTmp, 1.0e-6 );
+		EXPECT_NEAR( gaussSeidelOut, TempSurfOutTmp, 1.0e-6 );
+	}
+
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_ParallelSurfacesMatchSerial )
+	{
+		ASSERT_FALSE( process_idf( delimited_string( FiniteDiffBoxIDFObjects() ) ) );
+
+		OutputProcessor::TimeValue.allocate( 2 );
+		DataGlobals::DDOnlySimulation = true;
+
+		SimulationManager::ManageSimulation();
+
+		std::vector< int > SurfNums;
+		for ( int SurfNum = 1; SurfNum <= DataSurfaces::TotSurfaces; ++SurfNum ) {
+			if ( IndependentFiniteDiffSurface( SurfNum ) ) SurfNums.push_back( SurfNum );
+		}
+		ASSERT_EQ( 6u, SurfNums.size() );
+
+		// Solve the surfaces of the last time step again, first serially and then with four threads
+		auto const saved = SurfaceFD;
+		Array1D< Real64 > serialIn( DataSurfaces::TotSurfaces, 0.0 );
+		Array1D< Real64 > serialOut( DataSurfaces::TotSurfaces, 0.0 );
+		DataSystemVariables::NumberParallelThreads = 1;
+		ManageHeatBalFiniteDiffSurfaces( SurfNums, serialIn, serialOut );
+		auto const serial = SurfaceFD;
+
+		SurfaceFD = saved;
+		Array1D< Real64 > parallelIn( DataSurfaces::TotSurfaces, 0.0 );
+		Array1D< Real64 > parallelOut( DataSurfaces::TotSurfaces, 0.0 );
+		DataSystemVariables::NumberParallelThreads = 4;
+		ManageHeatBalFiniteDiffSurfaces( SurfNums, parallelIn, parallelOut );
+		DataSystemVariables::NumberParallelThreads = 1;
+
+		for ( int const SurfNum : SurfNums ) {
+			EXPECT_EQ( serialIn( SurfNum ), parallelIn( SurfNum ) );
+			EXPECT_EQ( serialOut( SurfNum ), parallelOut( SurfNum ) );
+			EXPECT_EQ( serial( SurfNum ).GSloopCounter, SurfaceFD( SurfNum ).GSloopCounter );
+			for ( int i = 1, e = serial( SurfNum ).TDT.u(); i <= e; ++i ) {
+				EXPECT_EQ( serial( SurfNum ).TDT( i ), SurfaceFD( SurfNum ).TDT( i ) );
+				EXPECT_EQ( serial( SurfNum ).QDreport( i ), SurfaceFD( SurfNum ).QDreport( i ) );
+			}
+		}
+	}
+
 }
@@ -68,6 +68,7 @@
 #include <DataGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <ExteriorEnergyUse.hh>
+#include <HeatBalanceInternalHeatGains.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
 
@@ -241,3 +242,57 @@ TEST_F( EnergyPlusFixture, InternalHeatGains_OtherEquipment_BadFuelType ) {
 	EXPECT_TRUE( compare_err_stream( error_string, true ) );
 
 }
+
+TEST_F( EnergyPlusFixture, InternalHeatGains_ZoneGainSumsByType ) {
+
+	Real64 PeopleConvGain( 100.0 );
+	Real64 PeopleLatentGain( 50.0 );
+	Real64 LightsConvGain( 30.0 );
+	Real64 LightsRadGain( 70.0 );
+	Real64 EquipConvGain( 20.0 );
+
+	DataGlobals::NumOfZones = 1;
+	DataHeatBalance::ZoneIntGain.allocate( DataGlobals::NumOfZones );
+	SetupZoneInternalGain( 1, "People", "PEOPLE 1", DataHeatBalance::IntGainTypeOf_People, PeopleConvGain, _, _, PeopleLatentGain );
+	SetupZoneInternalGain( 1, "Lights", "LIGHTS 1", DataHeatBalance::IntGainTypeOf_Lights, LightsConvGain, _, LightsRadGain );
+	SetupZoneInternalGain( 1, "ElectricEquipment", "EQUIP 1", DataHeatBalance::IntGainTypeOf_ElectricEquipment, EquipConvGain );
+	EXPECT_FALSE( DataHeatBalance::ZoneIntGainSumsCurrent );
+
+	InternalHeatGains::UpdateInternalGainValues();
+	EXPECT_TRUE( DataHeatBalance::ZoneIntGainSumsCurrent );
+
+	Real64 SumGainRate( 0.0 );
+	InternalHeatGains::SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 150.0, SumGainRate );
+	InternalHeatGains::SumAllInternalRadiationGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 70.0, SumGainRate );
+	InternalHeatGains::SumAllInternalLatentGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 50.0, SumGainRate );
+
+	Array1D_int GainTypes( 2 );
+	GainTypes( 1 ) = DataHeatBalance::IntGainTypeOf_People;
+	GainTypes( 2 ) = DataHeatBalance::IntGainTypeOf_ElectricEquipment;
+	InternalHeatGains::SumInternalConvectionGainsByTypes( 1, GainTypes, SumGainRate );
+	EXPECT_DOUBLE_EQ( 120.0, SumGainRate );
+	InternalHeatGains::SumInternalRadiationGainsByTypes( 1, GainTypes, SumGainRate );
+	EXPECT_DOUBLE_EQ( 0.0, SumGainRate );
+
+	// the sums only change with the next update
+	LightsConvGain = 40.0;
+	InternalHeatGains::SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 150.0, SumGainRate );
+	InternalHeatGains::UpdateInternalGainValues();
+	InternalHeatGains::SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 160.0, SumGainRate );
+
+	// a new device invalidates the sums until the next update, the device loop is used meanwhile
+	Real64 OtherConvGain( 5.0 );
+	SetupZoneInternalGain( 1, "OtherEquipment", "OTHER 1", DataHeatBalance::IntGainTypeOf_OtherEquipment, OtherConvGain );
+	EXPECT_FALSE( DataHeatBalance::ZoneIntGainSumsCurrent );
+	InternalHeatGains::SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 160.0, SumGainRate );
+	InternalHeatGains::UpdateInternalGainValues();
+	InternalHeatGains::SumAllInternalConvectionGains( 1, SumGainRate );
+	EXPECT_DOUBLE_EQ( 165.0, SumGainRate );
+
+}
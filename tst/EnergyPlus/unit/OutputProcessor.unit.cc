@@ -3356,6 +3356,156 @@ namespace EnergyPlus {
 
 		}
 
+
+		TEST_F( EnergyPlusFixture, OutputProcessor_MeterIncidence )
+		{
+			std::string const idf_objects = delimited_string( {
+				"Version,8.3;",
+				"Output:Meter,Electricity:Facility,hourly;",
+			} );
+
+			ASSERT_FALSE( process_idf( idf_objects ) );
+
+			GetReportVariableInput();
+			Real64 lights_1 = 0.0;
+			Real64 lights_2 = 0.0;
+			Real64 fan = 0.0;
+			SetupOutputVariable( "Lights Electric Energy [J]", lights_1, "Zone", "Sum", "SPACE1-1 LIGHTS 1", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE1-1", 1, 1 );
+			SetupOutputVariable( "Lights Electric Energy [J]", lights_2, "Zone", "Sum", "SPACE2-1 LIGHTS 1", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE2-1", 2, 1 );
+			SetupOutputVariable( "Fan Electric Energy [J]", fan, "System", "Sum", "FAN 1", _, "Electricity", "Fans", "General", "System" );
+			UpdateMeterReporting();
+
+			int const facility = GetMeterIndex( "Electricity:Facility" );
+			int const lights = GetMeterIndex( "InteriorLights:Electricity" );
+			int const space2 = GetMeterIndex( "Electricity:Zone:SPACE2-1" );
+			int const fans = GetMeterIndex( "Fans:Electricity" );
+			ASSERT_GT( facility, 0 );
+			ASSERT_GT( lights, 0 );
+			ASSERT_GT( space2, 0 );
+			ASSERT_GT( fans, 0 );
+
+			RVariableTypes( 1 ).VarPtr().TSValue = 100.0;
+			RVariableTypes( 2 ).VarPtr().TSValue = 200.0;
+			RVariableTypes( 3 ).VarPtr().TSValue = 50.0;
+			UpdateMeterValues();
+
+			EXPECT_TRUE( MeterIncidence.Current );
+			EXPECT_DOUBLE_EQ( 550.0, MeterValue( facility ) );
+			EXPECT_DOUBLE_EQ( 500.0, MeterValue( lights ) );
+			EXPECT_DOUBLE_EQ( 400.0, MeterValue( space2 ) );
+			EXPECT_DOUBLE_EQ( 50.0, MeterValue( fans ) );
+
+			// Only the meter reported hourly gets an hourly roll-up; run period values are kept for all
+			UpdateMeters( 0 );
+			EXPECT_DOUBLE_EQ( 550.0, EnergyMeters( facility ).HRValue );
+			EXPECT_DOUBLE_EQ( 0.0, EnergyMeters( fans ).HRValue );
+			EXPECT_DOUBLE_EQ( 550.0, EnergyMeters( facility ).SMValue );
+			EXPECT_DOUBLE_EQ( 50.0, EnergyMeters( fans ).SMValue );
+
+			// A variable set up later invalidates the matrix and is picked up on the next update
+			Real64 pump = 0.0;
+			SetupOutputVariable( "Pump Electric Energy [J]", pump, "System", "Sum", "PUMP 1", _, "Electricity", "Pumps", "General", "Plant" );
+			EXPECT_FALSE( MeterIncidence.Current );
+			RVariableTypes( 4 ).VarPtr().TSValue = 25.0;
+			UpdateMeterValues();
+			EXPECT_DOUBLE_EQ( 575.0, MeterValue( facility ) );
+			EXPECT_DOUBLE_EQ( 25.0, MeterValue( GetMeterIndex( "Pumps:Electricity" ) ) );
+		}
+
+
+		TEST_F( EnergyPlusFixture, OutputProcessor_ActiveVariableSet )
+		{
+			std::string const idf_objects = delimited_string( {
+				"Version,8.3;",
+				"Output:Variable,*,Site Outdoor Air Drybulb Temperature,hourly;",
+			} );
+
+			ASSERT_FALSE( process_idf( idf_objects ) );
+
+			GetReportVariableInput();
+			SetupOutputVariable( "Site Outdoor Air Drybulb Temperature [C]", DataEnvironment::OutDryBulbTemp, "Zone", "Average", "Environment" );
+			Real64 lights = 0.0;
+			SetupOutputVariable( "Lights Electric Energy [J]", lights, "Zone", "Sum", "SPACE1-1 LIGHTS 1", _, "Electricity", "InteriorLights", "GeneralLights", "Building", "SPACE1-1", 1, 1 );
+			Real64 fan = 0.0;
+			SetupOutputVariable( "Fan Electric Energy [J]", fan, "System", "Sum", "FAN 1", _, "Electricity", "Fans", "General", "System" );
+			ASSERT_EQ( 3, NumOfRVariable );
+
+			BuildActiveVariableSet();
+			EXPECT_TRUE( ActiveVariables.Current );
+			EXPECT_EQ( std::vector< int >( { 1 } ), ActiveVariables.ReportedR( ZoneVar ) );
+			EXPECT_EQ( std::vector< int >( { 1 } ), ActiveVariables.ReportedRByFreq( ReportHourly, ZoneVar ) );
+			EXPECT_TRUE( ActiveVariables.ReportedRByFreq( ReportDaily, ZoneVar ).empty() );
+			EXPECT_TRUE( ActiveVariables.ReportedR( HVACVar ).empty() );
+			EXPECT_EQ( std::vector< int >( { 2 } ), ActiveVariables.AccumulatedR( ZoneVar ) );
+			EXPECT_EQ( std::vector< int >( { 3 } ), ActiveVariables.AccumulatedR( HVACVar ) );
+
+			// A variable read by the external interface is kept current even when it is not reported or metered
+			RVariableTypes( 3 ).VarPtr().MeterArrayPtr = 0;
+			SetExternalInterfaceVariable( VarType_Real, 3 );
+			EXPECT_FALSE( ActiveVariables.Current );
+			BuildActiveVariableSet();
+			EXPECT_EQ( std::vector< int >( { 3 } ), ActiveVariables.AccumulatedR( HVACVar ) );
+			RVariableTypes( 3 ).VarPtr().ExternalInterface = false;
+			BuildActiveVariableSet();
+			EXPECT_TRUE( ActiveVariables.AccumulatedR( HVACVar ).empty() );
+
+			// The external interface can resolve the value it reads once
+			RVariableTypes( 3 ).VarPtr().EITSValue = 12.5;
+			Real64 const * const fanValue( GetInternalVariableValueExternalInterfacePtr( VarType_Real, 3 ) );
+			ASSERT_NE( nullptr, fanValue );
+			EXPECT_DOUBLE_EQ( GetInternalVariableValueExternalInterface( VarType_Real, 3 ), *fanValue );
+			EXPECT_EQ( nullptr, GetInternalVariableValueExternalInterfacePtr( VarType_Real, 4 ) );
+			EXPECT_EQ( nullptr, GetInternalVariableValueExternalInterfacePtr( VarType_Meter, 1 ) );
+		}
+
+		TEST_F( EnergyPlusFixture, OutputProcessor_ReportWriter )
+		{
+			auto writeRecords = []( int const nRecords ) {
+				WriteTimeStampFormatData( DataGlobals::eso_stream, ReportEach, 1, "1", 1, "1", false, 7, 21, 12, 60.0, 50.0, 0, "Tuesday" );
+				WriteTimeStampFormatData( DataGlobals::mtr_stream, ReportDaily, 2, "2", 1, "1", false, 7, 21, _, _, _, 0, "Tuesday" );
+				WriteReportRealData( 7, "7", 12.5, SummedVar, 1.0, ReportEach, 0.0, 0, 0.0, 0 );
+				WriteReportRealData( 8, "8", 616771620.98702729, AveragedVar, 4.0, ReportDaily, 4283136.2516839253, 12210110, 4283136.2587211775, 12212460 );
+				WriteReportMeterData( 9, "9", 999.9, ReportMonthly, 0.0, 12210110, 2.5, 12212460, false );
+				WriteCumulativeReportMeterData( 10, "10", 0.0, true );
+				WriteReportIntegerData( 11, "11", 7.0, AveragedVar, 2.0, ReportDaily, 3, 12210110, 4, 12212460 );
+				for ( int i = 0; i < nRecords; ++i ) {
+					WriteNumericData( 12, "12", i * 0.25 );
+					WriteNumericData( 13, "13", int32_t( i ) );
+				}
+			};
+			int const nRecords( 20000 ); // Spans several buffer hand offs
+			std::ostream * const eso_stream_save( DataGlobals::eso_stream );
+			std::ostream * const mtr_stream_save( DataGlobals::mtr_stream );
+
+			std::ostringstream eso;
+			std::ostringstream mtr;
+			DataGlobals::eso_stream = &eso;
+			DataGlobals::mtr_stream = &mtr;
+			writeRecords( nRecords );
+			EXPECT_EQ( 0u, eso.str().find( "1,1, 7,21, 0,12,50.00,60.00,Tuesday\n7,12.5\n" ) );
+			EXPECT_NE( std::string::npos, eso.str().find( "11,3.5,3, 1,10,4,24,60\n" ) );
+			EXPECT_EQ( 0u, mtr.str().find( "2,1, 7,21, 0,Tuesday\n9,999.9,0.0,21, 1,10,2.5,21,24,60\n10,0.0\n" ) );
+
+			// The writer thread produces the same files, once the records are flushed
+			std::ostringstream esoAsync;
+			std::ostringstream mtrAsync;
+			DataGlobals::eso_stream = &esoAsync;
+			DataGlobals::mtr_stream = &mtrAsync;
+			StartReportWriter();
+			writeRecords( nRecords );
+			FlushReportRecords();
+			EXPECT_EQ( eso.str(), esoAsync.str() );
+			EXPECT_EQ( mtr.str(), mtrAsync.str() );
+
+			// Records posted after the writer stops are written right away
+			StopReportWriter();
+			WriteNumericData( 12, "12", 1.5 );
+			EXPECT_EQ( eso.str() + "12,1.5\n", esoAsync.str() );
+
+			DataGlobals::eso_stream = eso_stream_save;
+			DataGlobals::mtr_stream = mtr_stream_save;
+		}
+
 	}
 
 }
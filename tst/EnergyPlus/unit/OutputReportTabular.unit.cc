@@ -61,6 +61,9 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// C++ Headers
+#include <sstream>
+
 #include "Fixtures/EnergyPlusFixture.hh"
 #include "Fixtures/SQLiteFixture.hh"
 
@@ -151,6 +154,75 @@ TEST( OutputReportTabularTest, RealToStr )
 
 }
 
+TEST_F( EnergyPlusFixture, OutputReportTabularTest_TableStreamWriter )
+{
+	ShowMessage( "Begin Test: OutputReportTabularTest, TableStreamWriter" );
+
+	std::ostringstream csvStreamed, htmStreamed, xmlStreamed;
+	std::ostringstream csvWritten, htmWritten, xmlWritten;
+	std::streambuf * const csvBuf( csv_stream.std::ostream::rdbuf() );
+	std::streambuf * const htmBuf( htm_stream.std::ostream::rdbuf() );
+	std::streambuf * const xmlBuf( xml_stream.std::ostream::rdbuf() );
+
+	numStyles = 3;
+	TableStyle( 1 ) = tableStyleComma;
+	del( 1 ) = ",";
+	TabularOutputFile( 1 ) = &csv_stream;
+	TableStyle( 2 ) = tableStyleHTML;
+	del( 2 ) = " ";
+	TabularOutputFile( 2 ) = &htm_stream;
+	TableStyle( 3 ) = tableStyleXML;
+	del( 3 ) = " ";
+	TabularOutputFile( 3 ) = &xml_stream;
+
+	Array1D_string rowHead( 3 );
+	Array1D_string columnHead( 2 );
+	Array1D_int columnWidth( 2, 10 );
+	rowHead( 1 ) = "Lights";
+	rowHead( 2 ) = "Fans";
+	rowHead( 3 ) = "Pumps";
+	columnHead( 1 ) = "Energy [GJ]";
+	columnHead( 2 ) = "Peak|Demand [W]";
+
+	// the last row is never given and is filled with blanks by finish
+	csv_stream.std::ostream::rdbuf( csvStreamed.rdbuf() );
+	htm_stream.std::ostream::rdbuf( htmStreamed.rdbuf() );
+	xml_stream.std::ostream::rdbuf( xmlStreamed.rdbuf() );
+	activeSubTableName = "Test Table";
+	activeReportName = "Test Report";
+	TableStreamWriter table( rowHead, columnHead, columnWidth );
+	table.addCell( "1.00" );
+	table.addCell( "" );
+	table.addCell( 2.5, 2 );
+	table.addCell( "7 < 8" );
+	table.finish();
+	std::string const streamedSubTableName( activeSubTableName );
+	EXPECT_EQ( 11, columnWidth( 1 ) ); // widened to fit the label
+	EXPECT_EQ( 15, columnWidth( 2 ) );
+
+	Array2D_string tableBody( 2, 3, "" );
+	tableBody( 1, 1 ) = "1.00";
+	tableBody( 1, 2 ) = RealToStr( 2.5, 2 );
+	tableBody( 2, 2 ) = "7 < 8";
+	csv_stream.std::ostream::rdbuf( csvWritten.rdbuf() );
+	htm_stream.std::ostream::rdbuf( htmWritten.rdbuf() );
+	xml_stream.std::ostream::rdbuf( xmlWritten.rdbuf() );
+	activeSubTableName = "Test Table";
+	activeReportName = "Test Report";
+	WriteTable( tableBody, rowHead, columnHead, columnWidth );
+
+	csv_stream.std::ostream::rdbuf( csvBuf );
+	htm_stream.std::ostream::rdbuf( htmBuf );
+	xml_stream.std::ostream::rdbuf( xmlBuf );
+
+	EXPECT_EQ( ",,Energy [GJ],Peak\n,,,Demand [W]\n,Lights,1.00,\n,Fans,2.50,7 < 8\n,Pumps,,\n\n\n", csvStreamed.str() );
+	EXPECT_EQ( csvWritten.str(), csvStreamed.str() );
+	EXPECT_EQ( htmWritten.str(), htmStreamed.str() );
+	EXPECT_EQ( xmlWritten.str(), xmlStreamed.str() );
+	EXPECT_NE( std::string::npos, xmlStreamed.str().find( "7 &lt; 8" ) );
+	EXPECT_EQ( activeSubTableName, streamedSubTableName );
+}
+
 TEST(OutputReportTabularTest, ConfirmResourceWarning)
 {
 	ShowMessage( "Begin Test: OutputReportTabularTest, ConfirmResourceWarning" );
@@ -3441,6 +3513,72 @@ TEST_F( EnergyPlusFixture, OutputReportTabularMonthly_ResetMonthlyGathering )
 
 }
 
+TEST_F( EnergyPlusFixture, OutputReportTabularMonthly_GatherTriggeredColumns )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.3;",
+		"Output:Table:Monthly,",
+		"Lights Hours Report, !- Name",
+		"2, !-  Digits After Decimal",
+		"Exterior Lights Electric Power, !- Variable or Meter 1 Name",
+		"HoursNonzero, !- Aggregation Type for Variable or Meter 1",
+		"Exterior Lights Electric Energy, !- Variable or Meter 2 Name",
+		"SumOrAverageDuringHoursShown, !- Aggregation Type for Variable or Meter 2",
+		"Exterior Lights Electric Power, !- Variable or Meter 3 Name",
+		"Maximum, !- Aggregation Type for Variable or Meter 3",
+		"Exterior Lights Electric Energy, !- Variable or Meter 4 Name",
+		"ValueWhenMaximumOrMinimum; !- Aggregation Type for Variable or Meter 4",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	Real64 extLitPow;
+	Real64 extLitUse;
+
+	SetupOutputVariable( "Exterior Lights Electric Power [W]", extLitPow, "Zone", "Average", "Lite1" );
+	SetupOutputVariable( "Exterior Lights Electric Energy [J]", extLitUse, "Zone", "Sum", "Lite1" );
+
+	DataGlobals::DoWeathSim = true;
+	DataGlobals::TimeStepZone = 0.25;
+	DataGlobals::TimeStepZoneSec = 900.0;
+
+	GetInputTabularMonthly();
+	InitializeTabularMonthly();
+	EXPECT_EQ( 4, MonthlyTables( 1 ).numColumns );
+
+	DataEnvironment::Month = 12;
+
+	extLitPow = 100.0;
+	extLitUse = 90000.0;
+	GatherMonthlyResultsForTimestep( ZoneTSReporting );
+	EXPECT_EQ( 0.25, MonthlyColumns( 1 ).reslt( 12 ) );
+	EXPECT_EQ( 90000.0, MonthlyColumns( 2 ).reslt( 12 ) );
+	EXPECT_EQ( 100.0, MonthlyColumns( 3 ).reslt( 12 ) );
+	EXPECT_EQ( 100.0, MonthlyColumns( 4 ).reslt( 12 ) );
+
+	// Off: neither the hours nor the maximum trigger
+	extLitPow = 0.0;
+	extLitUse = 0.0;
+	GatherMonthlyResultsForTimestep( ZoneTSReporting );
+	EXPECT_EQ( 0.25, MonthlyColumns( 1 ).reslt( 12 ) );
+	EXPECT_EQ( 90000.0, MonthlyColumns( 2 ).reslt( 12 ) );
+	EXPECT_EQ( 100.0, MonthlyColumns( 3 ).reslt( 12 ) );
+	EXPECT_EQ( 100.0, MonthlyColumns( 4 ).reslt( 12 ) );
+
+	extLitPow = 200.0;
+	extLitUse = 180000.0;
+	GatherMonthlyResultsForTimestep( ZoneTSReporting );
+	EXPECT_EQ( 0.5, MonthlyColumns( 1 ).reslt( 12 ) );
+	EXPECT_EQ( 270000.0, MonthlyColumns( 2 ).reslt( 12 ) );
+	EXPECT_EQ( 200.0, MonthlyColumns( 3 ).reslt( 12 ) );
+	EXPECT_EQ( 200.0, MonthlyColumns( 4 ).reslt( 12 ) );
+
+	// HVAC time step gathering does not touch zone time step columns
+	GatherMonthlyResultsForTimestep( HVACTSReporting );
+	EXPECT_EQ( 0.5, MonthlyColumns( 1 ).reslt( 12 ) );
+	EXPECT_EQ( 270000.0, MonthlyColumns( 2 ).reslt( 12 ) );
+}
+
 TEST_F( EnergyPlusFixture, OutputReportTabular_ConfirmResetBEPSGathering )
 {
 
@@ -0,0 +1,198 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::PlantLoopSolver Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/PlantLoopSolver.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPlant;
+using namespace EnergyPlus::PlantLoopSolver;
+using DataLoopNode::Node;
+
+namespace EnergyPlus {
+
+	// Single branch with one uncontrolled component between nodes 1 and 2
+	static void
+	SetupSkipTestLoop()
+	{
+		DataGlobals::BeginEnvrnFlag = false;
+		Node.allocate( 2 );
+		PlantReport.allocate( 1 );
+		PlantLoop.allocate( 1 );
+		PlantLoop( 1 ).LoopSide.allocate( 2 );
+		auto & loop_side( PlantLoop( 1 ).LoopSide( DemandSide ) );
+		loop_side.FlowLock = FlowUnlocked;
+		loop_side.TotalBranches = 1;
+		loop_side.Branch.allocate( 1 );
+		loop_side.Branch( 1 ).TotalComponents = 1;
+		loop_side.Branch( 1 ).Comp.allocate( 1 );
+		auto & comp( loop_side.Branch( 1 ).Comp( 1 ) );
+		comp.TypeOf_Num = TypeOf_Pipe;
+		comp.CurOpSchemeType = NoControlOpSchemeType;
+		comp.NodeNumIn = 1;
+		comp.NodeNumOut = 2;
+
+		Node( 1 ).Temp = 12.0;
+		Node( 1 ).MassFlowRate = 0.5;
+		Node( 1 ).MassFlowRateMaxAvail = 1.0;
+		Node( 2 ).Temp = 12.0;
+		Node( 2 ).MassFlowRate = 0.5;
+		Node( 2 ).MassFlowRateMaxAvail = 1.0;
+	}
+
+	// Stands in for the component simulation: outlet follows the inlet with a fixed temperature rise
+	static void
+	SimulateSkipTestComponent()
+	{
+		Node( 2 ).Temp = Node( 1 ).Temp + 5.0;
+		Node( 2 ).MassFlowRate = Node( 1 ).MassFlowRate;
+		Node( 2 ).MassFlowRateMaxAvail = Node( 1 ).MassFlowRateMaxAvail;
+	}
+
+	TEST_F( EnergyPlusFixture, PlantLoopSolver_SkippedBranchMatchesSimulatedBranch )
+	{
+		SetupSkipTestLoop();
+		PlantManageCalls = 1;
+		EXPECT_TRUE( BranchSimStateReusable( 1, DemandSide, 1 ) );
+
+		// Nothing saved yet in this plant solve
+		auto const NodesBefore = Node;
+		EXPECT_FALSE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+
+		// First simulation of the branch saves its states
+		SaveBranchSimState( 1, DemandSide, 1, false );
+		SimulateSkipTestComponent();
+		SaveBranchSimState( 1, DemandSide, 1, true );
+		auto const NodesSimulated = Node;
+
+		// Same nodes as before the first simulation: the branch is skipped and left as the simulation left it
+		Node = NodesBefore;
+		EXPECT_TRUE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+		EXPECT_EQ( 1, PlantReport( 1 ).SkippedCompSimulations );
+		EXPECT_DOUBLE_EQ( NodesSimulated( 2 ).Temp, Node( 2 ).Temp );
+		EXPECT_DOUBLE_EQ( NodesSimulated( 2 ).MassFlowRate, Node( 2 ).MassFlowRate );
+		EXPECT_DOUBLE_EQ( NodesSimulated( 2 ).MassFlowRateMaxAvail, Node( 2 ).MassFlowRateMaxAvail );
+
+		// and in the same state as a full simulation of the branch from those nodes
+		auto const NodesSkipped = Node;
+		Node = NodesBefore;
+		SimulateSkipTestComponent();
+		EXPECT_DOUBLE_EQ( Node( 2 ).Temp, NodesSkipped( 2 ).Temp );
+		EXPECT_DOUBLE_EQ( Node( 2 ).MassFlowRate, NodesSkipped( 2 ).MassFlowRate );
+		EXPECT_DOUBLE_EQ( Node( 1 ).Temp, NodesSkipped( 1 ).Temp );
+
+		// The saved states only hold for the flow lock state they were saved in
+		Node = NodesBefore;
+		PlantLoop( 1 ).LoopSide( DemandSide ).FlowLock = FlowLocked;
+		EXPECT_FALSE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+		PlantLoop( 1 ).LoopSide( DemandSide ).FlowLock = FlowUnlocked;
+
+		// and within the plant solve they were saved in
+		++PlantManageCalls;
+		EXPECT_FALSE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+		EXPECT_EQ( 1, PlantReport( 1 ).SkippedCompSimulations );
+	}
+
+	TEST_F( EnergyPlusFixture, PlantLoopSolver_ChangedInletInvalidatesSkip )
+	{
+		SetupSkipTestLoop();
+		PlantManageCalls = 1;
+
+		SaveBranchSimState( 1, DemandSide, 1, false );
+		auto const NodesBefore = Node;
+		SimulateSkipTestComponent();
+		SaveBranchSimState( 1, DemandSide, 1, true );
+
+		// Changed inlet temperature: the branch must be simulated and the nodes are left alone
+		Node = NodesBefore;
+		Node( 1 ).Temp = 14.0;
+		EXPECT_FALSE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+		EXPECT_DOUBLE_EQ( 14.0, Node( 1 ).Temp );
+		EXPECT_DOUBLE_EQ( NodesBefore( 2 ).Temp, Node( 2 ).Temp );
+		EXPECT_EQ( 0, PlantReport( 1 ).SkippedCompSimulations );
+
+		// Changed inlet flow rate
+		Node = NodesBefore;
+		Node( 1 ).MassFlowRate = 0.6;
+		EXPECT_FALSE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+
+		// Changed component load
+		Node = NodesBefore;
+		PlantLoop( 1 ).LoopSide( DemandSide ).Branch( 1 ).Comp( 1 ).MyLoad = 100.0;
+		EXPECT_FALSE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+		PlantLoop( 1 ).LoopSide( DemandSide ).Branch( 1 ).Comp( 1 ).MyLoad = 0.0;
+
+		// Unchanged again: skipped
+		EXPECT_TRUE( ReuseBranchSimState( 1, DemandSide, 1 ) );
+		EXPECT_EQ( 1, PlantReport( 1 ).SkippedCompSimulations );
+
+		// Controlled equipment on the branch is always simulated
+		PlantLoop( 1 ).LoopSide( DemandSide ).Branch( 1 ).Comp( 1 ).CurOpSchemeType = HeatingRBOpSchemeType;
+		EXPECT_FALSE( BranchSimStateReusable( 1, DemandSide, 1 ) );
+	}
+
+}
@@ -0,0 +1,669 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::PlantManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <vector>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataConvergParams.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/OutsideEnergySources.hh>
+#include <EnergyPlus/PlantLoadProfile.hh>
+#include <EnergyPlus/PlantManager.hh>
+#include <EnergyPlus/Pumps.hh>
+#include <EnergyPlus/SimulationManager.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPlant;
+using namespace EnergyPlus::PlantManager;
+
+namespace EnergyPlus {
+
+	// Water loop whose supply side holds one component of the given type
+	static void
+	SetupGroupTestLoop( int const LoopNum, int const SupplyTypeOf_Num )
+	{
+		auto & loop( PlantLoop( LoopNum ) );
+		loop.FluidType = DataLoopNode::NodeType_Water;
+		loop.CommonPipeType = CommonPipe_No;
+		loop.PressureSimType = Press_NoPressure;
+		loop.LoopSide.allocate( 2 );
+		for ( int LoopSideNum = DemandSide; LoopSideNum <= SupplySide; ++LoopSideNum ) {
+			auto & loop_side( loop.LoopSide( LoopSideNum ) );
+			loop_side.TotalBranches = 1;
+			loop_side.Branch.allocate( 1 );
+			loop_side.Branch( 1 ).TotalComponents = 1;
+			loop_side.Branch( 1 ).Comp.allocate( 1 );
+			loop_side.Branch( 1 ).Comp( 1 ).TypeOf_Num = ( LoopSideNum == SupplySide ) ? SupplyTypeOf_Num : TypeOf_Pipe;
+		}
+	}
+
+	// Connects the given side of one loop to the other loop, as a heat exchanger or chiller condenser does
+	static void
+	ConnectGroupTestLoops( int const LoopNum, int const LoopSideNum, int const OtherLoopNum )
+	{
+		auto & loop_side( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+		loop_side.TotalConnected = 1;
+		loop_side.Connected.allocate( 1 );
+		loop_side.Connected( 1 ).LoopNum = OtherLoopNum;
+		loop_side.Connected( 1 ).LoopSideNum = SupplySide;
+	}
+
+	TEST_F( EnergyPlusFixture, PlantManager_ConcurrentPlantLoopGroups )
+	{
+		// Loops 1 and 2 are connected, loop 3 stands alone and loop 4 has a boiler
+		TotNumLoops = 4;
+		TotNumHalfLoops = 8;
+		PlantLoop.allocate( TotNumLoops );
+		SetupGroupTestLoop( 1, TypeOf_Pipe );
+		SetupGroupTestLoop( 2, TypeOf_PurchHotWater );
+		SetupGroupTestLoop( 3, TypeOf_PumpVariableSpeed );
+		SetupGroupTestLoop( 4, TypeOf_Boiler_Simple );
+		ConnectGroupTestLoops( 1, DemandSide, 2 );
+
+		// Calling order mixes the half loops of the different loops
+		std::vector< int > const CallingOrderLoops( { 1, 3, 2, 1, 4, 3, 2, 4 } );
+		PlantCallingOrderInfo.allocate( TotNumHalfLoops );
+		for ( int HalfLoopNum = 1; HalfLoopNum <= TotNumHalfLoops; ++HalfLoopNum ) {
+			PlantCallingOrderInfo( HalfLoopNum ).LoopIndex = CallingOrderLoops[ HalfLoopNum - 1 ];
+		}
+
+		EXPECT_TRUE( ConcurrentPlantLoop( 1 ) );
+		EXPECT_TRUE( ConcurrentPlantLoop( 2 ) );
+		EXPECT_TRUE( ConcurrentPlantLoop( 3 ) );
+		EXPECT_FALSE( ConcurrentPlantLoop( 4 ) );
+
+		// Connected loops share a group, each group keeps the calling order
+		std::vector< std::vector< int > > HalfLoopGroups;
+		std::vector< int > SequentialHalfLoopNums;
+		SetupConcurrentPlantLoopGroups( HalfLoopGroups, SequentialHalfLoopNums );
+		ASSERT_EQ( 2u, HalfLoopGroups.size() );
+		EXPECT_EQ( std::vector< int >( { 1, 3, 4, 7 } ), HalfLoopGroups[ 0 ] );
+		EXPECT_EQ( std::vector< int >( { 2, 6 } ), HalfLoopGroups[ 1 ] );
+		EXPECT_EQ( std::vector< int >( { 5, 8 } ), SequentialHalfLoopNums );
+
+		// A loop connected to the boiler loop is simulated in sequence with it, leaving a single concurrent group
+		ConnectGroupTestLoops( 4, SupplySide, 3 );
+		SetupConcurrentPlantLoopGroups( HalfLoopGroups, SequentialHalfLoopNums );
+		EXPECT_TRUE( HalfLoopGroups.empty() );
+		EXPECT_TRUE( SequentialHalfLoopNums.empty() );
+
+		// With district cooling in place of the boiler, loops 3 and 4 form the second concurrent group
+		PlantLoop( 4 ).LoopSide( SupplySide ).Branch( 1 ).Comp( 1 ).TypeOf_Num = TypeOf_PurchChilledWater;
+		SetupConcurrentPlantLoopGroups( HalfLoopGroups, SequentialHalfLoopNums );
+		ASSERT_EQ( 2u, HalfLoopGroups.size() );
+		EXPECT_EQ( std::vector< int >( { 1, 3, 4, 7 } ), HalfLoopGroups[ 0 ] );
+		EXPECT_EQ( std::vector< int >( { 2, 5, 6, 8 } ), HalfLoopGroups[ 1 ] );
+		EXPECT_TRUE( SequentialHalfLoopNums.empty() );
+	}
+
+	TEST_F( EnergyPlusFixture, PlantManager_ParallelPlantLoopsMatchSerial )
+	{
+		// Two independent water loops: district heating and district cooling each serving a load profile
+		std::string const idf_objects = delimited_string( {
+			"Version,8.6;",
+			"Timestep, 4;",
+			"Building, Two Plant Loops, 0.0, Suburbs, .04, .4, FullExterior, 25, 6;",
+			"SimulationControl, NO, NO, NO, YES, NO;",
+			"Site:Location,",
+			"  Miami Intl Ap FL USA TMY3 WMO=722020E, !- Name",
+			"  25.82,                   !- Latitude {deg}",
+			"  -80.30,                  !- Longitude {deg}",
+			"  -5.00,                   !- Time Zone {hr}",
+			"  11;                      !- Elevation {m}",
+			"SizingPeriod:DesignDay,",
+			" Miami Intl Ap Ann Htg 99.6% Condns DB, !- Name",
+			" 1,                        !- Month",
+			" 21,                       !- Day of Month",
+			" WinterDesignDay,          !- Day Type",
+			" 8.7,                      !- Maximum Dry-Bulb Temperature {C}",
+			" 0.0,                      !- Daily Dry-Bulb Temperature Range {deltaC}",
+			" ,                         !- Dry-Bulb Temperature Range Modifier Type",
+			" ,                         !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+			" Wetbulb,                  !- Humidity Condition Type",
+			" 8.7,                      !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+			" ,                         !- Humidity Condition Day Schedule Name",
+			" ,                         !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+			" ,                         !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+			" ,                         !- Daily Wet-Bulb Temperature Range {deltaC}",
+			" 101217.,                  !- Barometric Pressure {Pa}",
+			" 3.8,                      !- Wind Speed {m/s}",
+			" 340,                      !- Wind Direction {deg}",
+			" No,                       !- Rain Indicator",
+			" No,                       !- Snow Indicator",
+			" No,                       !- Daylight Saving Time Indicator",
+			" ASHRAEClearSky,           !- Solar Model Indicator",
+			" ,                         !- Beam Solar Day Schedule Name",
+			" ,                         !- Diffuse Solar Day Schedule Name",
+			" ,                         !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+			" ,                         !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+			" 0.00;                     !- Sky Clearness",
+			"Schedule:Constant,",
+			" AvailSched,               !- Name",
+			" ,                         !- Schedule Type Limits Name",
+			" 1.0;                      !- Hourly Value",
+			"PlantLoop,",
+			" Heat Loop,                !- Name",
+			" Water,                    !- Fluid Type",
+			" ,                         !- User Defined Fluid Type",
+			" Heat Operation,           !- Plant Equipment Operation Scheme Name",
+			" Heat Supply Outlet Node,  !- Loop Temperature Setpoint Node Name",
+			" 100,                      !- Maximum Loop Temperature {C}",
+			" 3,                        !- Minimum Loop Temperature {C}",
+			" 0.003,                    !- Maximum Loop Flow Rate {m3/s}",
+			" 0,                        !- Minimum Loop Flow Rate {m3/s}",
+			" 1.0,                      !- Plant Loop Volume {m3}",
+			" Heat Supply Inlet Node,   !- Plant Side Inlet Node Name",
+			" Heat Supply Outlet Node,  !- Plant Side Outlet Node Name",
+			" Heat Supply Branches,     !- Plant Side Branch List Name",
+			" Heat Supply Connectors,   !- Plant Side Connector List Name",
+			" Heat Demand Inlet Node,   !- Demand Side Inlet Node Name",
+			" Heat Demand Outlet Node,  !- Demand Side Outlet Node Name",
+			" Heat Demand Branches,     !- Demand Side Branch List Name",
+			" Heat Demand Connectors,   !- Demand Side Connector List Name",
+			" Optimal;                  !- Load Distribution Scheme",
+			"SetpointManager:Scheduled,",
+			" Heat Setpoint Manager,    !- Name",
+			" Temperature,              !- Control Variable",
+			" Heat Temp Sched,          !- Schedule Name",
+			" Heat Supply Outlet Node;  !- Setpoint Node or NodeList Name",
+			"Schedule:Constant,",
+			" Heat Temp Sched,          !- Name",
+			" ,                         !- Schedule Type Limits Name",
+			" 60.0;                     !- Hourly Value",
+			"Schedule:Constant,",
+			" Heat Load Sched,          !- Name",
+			" ,                         !- Schedule Type Limits Name",
+			" 5000;                     !- Hourly Value",
+			"PlantEquipmentOperationSchemes,",
+			" Heat Operation,           !- Name",
+			" PlantEquipmentOperation:Uncontrolled,!- Control Scheme 1 Object Type",
+			" Heat Uncontrolled,        !- Control Scheme 1 Name",
+			" AvailSched;               !- Control Scheme 1 Schedule Name",
+			"PlantEquipmentOperation:Uncontrolled,",
+			" Heat Uncontrolled,        !- Name",
+			" Heat Equipment;           !- Equipment List Name",
+			"PlantEquipmentList,",
+			" Heat Equipment,           !- Name",
+			" DistrictHeating,          !- Equipment 1 Object Type",
+			" Heat District;            !- Equipment 1 Name",
+			"BranchList,",
+			" Heat Supply Branches,     !- Name",
+			" Heat Supply Inlet Branch, !- Branch 1 Name",
+			" Heat Supply Equipment Branch,!- Branch 2 Name",
+			" Heat Supply Bypass Branch,!- Branch 3 Name",
+			" Heat Supply Outlet Branch;!- Branch 4 Name",
+			"ConnectorList,",
+			" Heat Supply Connectors,   !- Name",
+			" Connector:Splitter,       !- Connector 1 Object Type",
+			" Heat Supply Splitter,     !- Connector 1 Name",
+			" Connector:Mixer,          !- Connector 2 Object Type",
+			" Heat Supply Mixer;        !- Connector 2 Name",
+			"Connector:Splitter,",
+			" Heat Supply Splitter,     !- Name",
+			" Heat Supply Inlet Branch, !- Inlet Branch Name",
+			" Heat Supply Equipment Branch,!- Outlet Branch 1 Name",
+			" Heat Supply Bypass Branch;!- Outlet Branch 2 Name",
+			"Connector:Mixer,",
+			" Heat Supply Mixer,        !- Name",
+			" Heat Supply Outlet Branch,!- Outlet Branch Name",
+			" Heat Supply Equipment Branch,!- Inlet Branch 1 Name",
+			" Heat Supply Bypass Branch;!- Inlet Branch 2 Name",
+			"Branch,",
+			" Heat Supply Inlet Branch, !- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pump:VariableSpeed,       !- Component 1 Object Type",
+			" Heat Supply Pump,         !- Component 1 Name",
+			" Heat Supply Inlet Node,   !- Component 1 Inlet Node Name",
+			" Heat Supply Split Node;   !- Component 1 Outlet Node Name",
+			"Pump:VariableSpeed,",
+			" Heat Supply Pump,         !- Name",
+			" Heat Supply Inlet Node,   !- Inlet Node Name",
+			" Heat Supply Split Node,   !- Outlet Node Name",
+			" 0.003,                    !- Rated Flow Rate {m3/s}",
+			" 10000,                    !- Rated Pump Head {Pa}",
+			" 50,                       !- Rated Power Consumption {W}",
+			" 0.87,                     !- Motor Efficiency",
+			" 0.0,                      !- Fraction of Motor Inefficiencies to Fluid Stream",
+			" 0,                        !- Coefficient 1 of the Part Load Performance Curve",
+			" 1,                        !- Coefficient 2 of the Part Load Performance Curve",
+			" 0,                        !- Coefficient 3 of the Part Load Performance Curve",
+			" 0,                        !- Coefficient 4 of the Part Load Performance Curve",
+			" 0,                        !- Minimum Flow Rate {m3/s}",
+			" Intermittent;             !- Pump Control Type",
+			"Branch,",
+			" Heat Supply Equipment Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" DistrictHeating,          !- Component 1 Object Type",
+			" Heat District,            !- Component 1 Name",
+			" Heat Supply Equipment Inlet Node,!- Component 1 Inlet Node Name",
+			" Heat Supply Equipment Outlet Node;!- Component 1 Outlet Node Name",
+			"DistrictHeating,",
+			" Heat District,            !- Name",
+			" Heat Supply Equipment Inlet Node,!- Inlet Node Name",
+			" Heat Supply Equipment Outlet Node,!- Outlet Node Name",
+			" 100000;                   !- Nominal Capacity {W}",
+			"Branch,",
+			" Heat Supply Bypass Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Heat Supply Bypass Pipe,  !- Component 1 Name",
+			" Heat Supply Bypass Inlet Node,!- Component 1 Inlet Node Name",
+			" Heat Supply Bypass Outlet Node;!- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Heat Supply Bypass Pipe,  !- Name",
+			" Heat Supply Bypass Inlet Node,!- Inlet Node Name",
+			" Heat Supply Bypass Outlet Node;!- Outlet Node Name",
+			"Branch,",
+			" Heat Supply Outlet Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Heat Supply Outlet Pipe,  !- Component 1 Name",
+			" Heat Supply Mix Node,     !- Component 1 Inlet Node Name",
+			" Heat Supply Outlet Node;  !- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Heat Supply Outlet Pipe,  !- Name",
+			" Heat Supply Mix Node,     !- Inlet Node Name",
+			" Heat Supply Outlet Node;  !- Outlet Node Name",
+			"BranchList,",
+			" Heat Demand Branches,     !- Name",
+			" Heat Demand Inlet Branch, !- Branch 1 Name",
+			" Heat Demand Equipment Branch,!- Branch 2 Name",
+			" Heat Demand Bypass Branch,!- Branch 3 Name",
+			" Heat Demand Outlet Branch;!- Branch 4 Name",
+			"ConnectorList,",
+			" Heat Demand Connectors,   !- Name",
+			" Connector:Splitter,       !- Connector 1 Object Type",
+			" Heat Demand Splitter,     !- Connector 1 Name",
+			" Connector:Mixer,          !- Connector 2 Object Type",
+			" Heat Demand Mixer;        !- Connector 2 Name",
+			"Connector:Splitter,",
+			" Heat Demand Splitter,     !- Name",
+			" Heat Demand Inlet Branch, !- Inlet Branch Name",
+			" Heat Demand Equipment Branch,!- Outlet Branch 1 Name",
+			" Heat Demand Bypass Branch;!- Outlet Branch 2 Name",
+			"Connector:Mixer,",
+			" Heat Demand Mixer,        !- Name",
+			" Heat Demand Outlet Branch,!- Outlet Branch Name",
+			" Heat Demand Equipment Branch,!- Inlet Branch 1 Name",
+			" Heat Demand Bypass Branch;!- Inlet Branch 2 Name",
+			"Branch,",
+			" Heat Demand Inlet Branch, !- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Heat Demand Inlet Pipe,   !- Component 1 Name",
+			" Heat Demand Inlet Node,   !- Component 1 Inlet Node Name",
+			" Heat Demand Split Node;   !- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Heat Demand Inlet Pipe,   !- Name",
+			" Heat Demand Inlet Node,   !- Inlet Node Name",
+			" Heat Demand Split Node;   !- Outlet Node Name",
+			"Branch,",
+			" Heat Demand Equipment Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" LoadProfile:Plant,        !- Component 1 Object Type",
+			" Heat Load Profile,        !- Component 1 Name",
+			" Heat Demand Equipment Inlet Node,!- Component 1 Inlet Node Name",
+			" Heat Demand Equipment Outlet Node;!- Component 1 Outlet Node Name",
+			"LoadProfile:Plant,",
+			" Heat Load Profile,        !- Name",
+			" Heat Demand Equipment Inlet Node,!- Inlet Node Name",
+			" Heat Demand Equipment Outlet Node,!- Outlet Node Name",
+			" Heat Load Sched,          !- Load Schedule Name",
+			" 0.002,                    !- Peak Flow Rate {m3/s}",
+			" AvailSched;               !- Flow Rate Fraction Schedule Name",
+			"Branch,",
+			" Heat Demand Bypass Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Heat Demand Bypass Pipe,  !- Component 1 Name",
+			" Heat Demand Bypass Inlet Node,!- Component 1 Inlet Node Name",
+			" Heat Demand Bypass Outlet Node;!- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Heat Demand Bypass Pipe,  !- Name",
+			" Heat Demand Bypass Inlet Node,!- Inlet Node Name",
+			" Heat Demand Bypass Outlet Node;!- Outlet Node Name",
+			"Branch,",
+			" Heat Demand Outlet Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Heat Demand Outlet Pipe,  !- Component 1 Name",
+			" Heat Demand Mix Node,     !- Component 1 Inlet Node Name",
+			" Heat Demand Outlet Node;  !- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Heat Demand Outlet Pipe,  !- Name",
+			" Heat Demand Mix Node,     !- Inlet Node Name",
+			" Heat Demand Outlet Node;  !- Outlet Node Name",
+			"PlantLoop,",
+			" Cool Loop,                !- Name",
+			" Water,                    !- Fluid Type",
+			" ,                         !- User Defined Fluid Type",
+			" Cool Operation,           !- Plant Equipment Operation Scheme Name",
+			" Cool Supply Outlet Node,  !- Loop Temperature Setpoint Node Name",
+			" 100,                      !- Maximum Loop Temperature {C}",
+			" 3,                        !- Minimum Loop Temperature {C}",
+			" 0.003,                    !- Maximum Loop Flow Rate {m3/s}",
+			" 0,                        !- Minimum Loop Flow Rate {m3/s}",
+			" 1.0,                      !- Plant Loop Volume {m3}",
+			" Cool Supply Inlet Node,   !- Plant Side Inlet Node Name",
+			" Cool Supply Outlet Node,  !- Plant Side Outlet Node Name",
+			" Cool Supply Branches,     !- Plant Side Branch List Name",
+			" Cool Supply Connectors,   !- Plant Side Connector List Name",
+			" Cool Demand Inlet Node,   !- Demand Side Inlet Node Name",
+			" Cool Demand Outlet Node,  !- Demand Side Outlet Node Name",
+			" Cool Demand Branches,     !- Demand Side Branch List Name",
+			" Cool Demand Connectors,   !- Demand Side Connector List Name",
+			" Optimal;                  !- Load Distribution Scheme",
+			"SetpointManager:Scheduled,",
+			" Cool Setpoint Manager,    !- Name",
+			" Temperature,              !- Control Variable",
+			" Cool Temp Sched,          !- Schedule Name",
+			" Cool Supply Outlet Node;  !- Setpoint Node or NodeList Name",
+			"Schedule:Constant,",
+			" Cool Temp Sched,          !- Name",
+			" ,                         !- Schedule Type Limits Name",
+			" 7.0;                      !- Hourly Value",
+			"Schedule:Constant,",
+			" Cool Load Sched,          !- Name",
+			" ,                         !- Schedule Type Limits Name",
+			" -5000;                    !- Hourly Value",
+			"PlantEquipmentOperationSchemes,",
+			" Cool Operation,           !- Name",
+			" PlantEquipmentOperation:Uncontrolled,!- Control Scheme 1 Object Type",
+			" Cool Uncontrolled,        !- Control Scheme 1 Name",
+			" AvailSched;               !- Control Scheme 1 Schedule Name",
+			"PlantEquipmentOperation:Uncontrolled,",
+			" Cool Uncontrolled,        !- Name",
+			" Cool Equipment;           !- Equipment List Name",
+			"PlantEquipmentList,",
+			" Cool Equipment,           !- Name",
+			" DistrictCooling,          !- Equipment 1 Object Type",
+			" Cool District;            !- Equipment 1 Name",
+			"BranchList,",
+			" Cool Supply Branches,     !- Name",
+			" Cool Supply Inlet Branch, !- Branch 1 Name",
+			" Cool Supply Equipment Branch,!- Branch 2 Name",
+			" Cool Supply Bypass Branch,!- Branch 3 Name",
+			" Cool Supply Outlet Branch;!- Branch 4 Name",
+			"ConnectorList,",
+			" Cool Supply Connectors,   !- Name",
+			" Connector:Splitter,       !- Connector 1 Object Type",
+			" Cool Supply Splitter,     !- Connector 1 Name",
+			" Connector:Mixer,          !- Connector 2 Object Type",
+			" Cool Supply Mixer;        !- Connector 2 Name",
+			"Connector:Splitter,",
+			" Cool Supply Splitter,     !- Name",
+			" Cool Supply Inlet Branch, !- Inlet Branch Name",
+			" Cool Supply Equipment Branch,!- Outlet Branch 1 Name",
+			" Cool Supply Bypass Branch;!- Outlet Branch 2 Name",
+			"Connector:Mixer,",
+			" Cool Supply Mixer,        !- Name",
+			" Cool Supply Outlet Branch,!- Outlet Branch Name",
+			" Cool Supply Equipment Branch,!- Inlet Branch 1 Name",
+			" Cool Supply Bypass Branch;!- Inlet Branch 2 Name",
+			"Branch,",
+			" Cool Supply Inlet Branch, !- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pump:VariableSpeed,       !- Component 1 Object Type",
+			" Cool Supply Pump,         !- Component 1 Name",
+			" Cool Supply Inlet Node,   !- Component 1 Inlet Node Name",
+			" Cool Supply Split Node;   !- Component 1 Outlet Node Name",
+			"Pump:VariableSpeed,",
+			" Cool Supply Pump,         !- Name",
+			" Cool Supply Inlet Node,   !- Inlet Node Name",
+			" Cool Supply Split Node,   !- Outlet Node Name",
+			" 0.003,                    !- Rated Flow Rate {m3/s}",
+			" 10000,                    !- Rated Pump Head {Pa}",
+			" 50,                       !- Rated Power Consumption {W}",
+			" 0.87,                     !- Motor Efficiency",
+			" 0.0,                      !- Fraction of Motor Inefficiencies to Fluid Stream",
+			" 0,                        !- Coefficient 1 of the Part Load Performance Curve",
+			" 1,                        !- Coefficient 2 of the Part Load Performance Curve",
+			" 0,                        !- Coefficient 3 of the Part Load Performance Curve",
+			" 0,                        !- Coefficient 4 of the Part Load Performance Curve",
+			" 0,                        !- Minimum Flow Rate {m3/s}",
+			" Intermittent;             !- Pump Control Type",
+			"Branch,",
+			" Cool Supply Equipment Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" DistrictCooling,          !- Component 1 Object Type",
+			" Cool District,            !- Component 1 Name",
+			" Cool Supply Equipment Inlet Node,!- Component 1 Inlet Node Name",
+			" Cool Supply Equipment Outlet Node;!- Component 1 Outlet Node Name",
+			"DistrictCooling,",
+			" Cool District,            !- Name",
+			" Cool Supply Equipment Inlet Node,!- Inlet Node Name",
+			" Cool Supply Equipment Outlet Node,!- Outlet Node Name",
+			" 100000;                   !- Nominal Capacity {W}",
+			"Branch,",
+			" Cool Supply Bypass Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Cool Supply Bypass Pipe,  !- Component 1 Name",
+			" Cool Supply Bypass Inlet Node,!- Component 1 Inlet Node Name",
+			" Cool Supply Bypass Outlet Node;!- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Cool Supply Bypass Pipe,  !- Name",
+			" Cool Supply Bypass Inlet Node,!- Inlet Node Name",
+			" Cool Supply Bypass Outlet Node;!- Outlet Node Name",
+			"Branch,",
+			" Cool Supply Outlet Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Cool Supply Outlet Pipe,  !- Component 1 Name",
+			" Cool Supply Mix Node,     !- Component 1 Inlet Node Name",
+			" Cool Supply Outlet Node;  !- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Cool Supply Outlet Pipe,  !- Name",
+			" Cool Supply Mix Node,     !- Inlet Node Name",
+			" Cool Supply Outlet Node;  !- Outlet Node Name",
+			"BranchList,",
+			" Cool Demand Branches,     !- Name",
+			" Cool Demand Inlet Branch, !- Branch 1 Name",
+			" Cool Demand Equipment Branch,!- Branch 2 Name",
+			" Cool Demand Bypass Branch,!- Branch 3 Name",
+			" Cool Demand Outlet Branch;!- Branch 4 Name",
+			"ConnectorList,",
+			" Cool Demand Connectors,   !- Name",
+			" Connector:Splitter,       !- Connector 1 Object Type",
+			" Cool Demand Splitter,     !- Connector 1 Name",
+			" Connector:Mixer,          !- Connector 2 Object Type",
+			" Cool Demand Mixer;        !- Connector 2 Name",
+			"Connector:Splitter,",
+			" Cool Demand Splitter,     !- Name",
+			" Cool Demand Inlet Branch, !- Inlet Branch Name",
+			" Cool Demand Equipment Branch,!- Outlet Branch 1 Name",
+			" Cool Demand Bypass Branch;!- Outlet Branch 2 Name",
+			"Connector:Mixer,",
+			" Cool Demand Mixer,        !- Name",
+			" Cool Demand Outlet Branch,!- Outlet Branch Name",
+			" Cool Demand Equipment Branch,!- Inlet Branch 1 Name",
+			" Cool Demand Bypass Branch;!- Inlet Branch 2 Name",
+			"Branch,",
+			" Cool Demand Inlet Branch, !- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Cool Demand Inlet Pipe,   !- Component 1 Name",
+			" Cool Demand Inlet Node,   !- Component 1 Inlet Node Name",
+			" Cool Demand Split Node;   !- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Cool Demand Inlet Pipe,   !- Name",
+			" Cool Demand Inlet Node,   !- Inlet Node Name",
+			" Cool Demand Split Node;   !- Outlet Node Name",
+			"Branch,",
+			" Cool Demand Equipment Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" LoadProfile:Plant,        !- Component 1 Object Type",
+			" Cool Load Profile,        !- Component 1 Name",
+			" Cool Demand Equipment Inlet Node,!- Component 1 Inlet Node Name",
+			" Cool Demand Equipment Outlet Node;!- Component 1 Outlet Node Name",
+			"LoadProfile:Plant,",
+			" Cool Load Profile,        !- Name",
+			" Cool Demand Equipment Inlet Node,!- Inlet Node Name",
+			" Cool Demand Equipment Outlet Node,!- Outlet Node Name",
+			" Cool Load Sched,          !- Load Schedule Name",
+			" 0.002,                    !- Peak Flow Rate {m3/s}",
+			" AvailSched;               !- Flow Rate Fraction Schedule Name",
+			"Branch,",
+			" Cool Demand Bypass Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Cool Demand Bypass Pipe,  !- Component 1 Name",
+			" Cool Demand Bypass Inlet Node,!- Component 1 Inlet Node Name",
+			" Cool Demand Bypass Outlet Node;!- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Cool Demand Bypass Pipe,  !- Name",
+			" Cool Demand Bypass Inlet Node,!- Inlet Node Name",
+			" Cool Demand Bypass Outlet Node;!- Outlet Node Name",
+			"Branch,",
+			" Cool Demand Outlet Branch,!- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Pipe:Adiabatic,           !- Component 1 Object Type",
+			" Cool Demand Outlet Pipe,  !- Component 1 Name",
+			" Cool Demand Mix Node,     !- Component 1 Inlet Node Name",
+			" Cool Demand Outlet Node;  !- Component 1 Outlet Node Name",
+			"Pipe:Adiabatic,",
+			" Cool Demand Outlet Pipe,  !- Name",
+			" Cool Demand Mix Node,     !- Inlet Node Name",
+			" Cool Demand Outlet Node;  !- Outlet Node Name",
+		} );
+
+		ASSERT_FALSE( process_idf( idf_objects ) );
+
+		OutputProcessor::TimeValue.allocate( 2 );
+		DataGlobals::DDOnlySimulation = true;
+
+		SimulationManager::ManageSimulation();
+		ASSERT_EQ( 2, TotNumLoops );
+		ASSERT_TRUE( ConcurrentPlantLoop( 1 ) );
+		ASSERT_TRUE( ConcurrentPlantLoop( 2 ) );
+		std::vector< std::vector< int > > HalfLoopGroups;
+		std::vector< int > SequentialHalfLoopNums;
+		SetupConcurrentPlantLoopGroups( HalfLoopGroups, SequentialHalfLoopNums );
+		ASSERT_EQ( 2u, HalfLoopGroups.size() );
+		EXPECT_TRUE( SequentialHalfLoopNums.empty() );
+
+		// Simulate the plant loops of the last time step again, first serially and then with four threads
+		auto const savedNode( DataLoopNode::Node );
+		auto const savedPlantLoop( PlantLoop );
+		auto const savedPlantReport( PlantReport );
+		auto const savedPlantConvergence( DataConvergParams::PlantConvergence );
+		auto const savedPump( Pumps::PumpEquip );
+		auto const savedPumpReport( Pumps::PumpEquipReport );
+		auto const savedProfile( PlantLoadProfile::PlantProfile );
+		auto const savedSource( OutsideEnergySources::EnergySource );
+		auto const savedSourceReport( OutsideEnergySources::EnergySourceReport );
+		bool SimAirLoops( false );
+		bool SimZoneEquipment( false );
+		bool SimNonZoneEquipment( false );
+		bool SimPlantLoops( true );
+		bool SimElecCircuits( false );
+		DataSystemVariables::ParallelPlantLoopsEnvFlag = true;
+		DataSystemVariables::NumberParallelThreads = 1;
+		ManagePlantLoops( false, SimAirLoops, SimZoneEquipment, SimNonZoneEquipment, SimPlantLoops, SimElecCircuits );
+		auto const serialNode( DataLoopNode::Node );
+		auto const serialPump( Pumps::PumpEquip );
+		auto const serialProfile( PlantLoadProfile::PlantProfile );
+		auto const serialSource( OutsideEnergySources::EnergySource );
+		bool const serialSimPlantLoops( SimPlantLoops );
+		EXPECT_GT( serialSource( 1 ).EnergyRate, 0.0 );
+		EXPECT_GT( serialSource( 2 ).EnergyRate, 0.0 );
+
+		DataLoopNode::Node = savedNode;
+		PlantLoop = savedPlantLoop;
+		PlantReport = savedPlantReport;
+		DataConvergParams::PlantConvergence = savedPlantConvergence;
+		Pumps::PumpEquip = savedPump;
+		Pumps::PumpEquipReport = savedPumpReport;
+		PlantLoadProfile::PlantProfile = savedProfile;
+		OutsideEnergySources::EnergySource = savedSource;
+		OutsideEnergySources::EnergySourceReport = savedSourceReport;
+		SimPlantLoops = true;
+		DataSystemVariables::NumberParallelThreads = 4;
+		ManagePlantLoops( false, SimAirLoops, SimZoneEquipment, SimNonZoneEquipment, SimPlantLoops, SimElecCircuits );
+		DataSystemVariables::NumberParallelThreads = 1;
+		DataSystemVariables::ParallelPlantLoopsEnvFlag = false;
+
+		EXPECT_EQ( serialSimPlantLoops, SimPlantLoops );
+		for ( int NodeNum = 1; NodeNum <= DataLoopNode::NumOfNodes; ++NodeNum ) {
+			EXPECT_EQ( serialNode( NodeNum ).Temp, DataLoopNode::Node( NodeNum ).Temp );
+			EXPECT_EQ( serialNode( NodeNum ).MassFlowRate, DataLoopNode::Node( NodeNum ).MassFlowRate );
+			EXPECT_EQ( serialNode( NodeNum ).MassFlowRateMaxAvail, DataLoopNode::Node( NodeNum ).MassFlowRateMaxAvail );
+		}
+		for ( int PumpNum = 1; PumpNum <= Pumps::NumPumps; ++PumpNum ) {
+			EXPECT_EQ( serialPump( PumpNum ).Power, Pumps::PumpEquip( PumpNum ).Power );
+		}
+		for ( int ProfileNum = 1; ProfileNum <= PlantLoadProfile::NumOfPlantProfile; ++ProfileNum ) {
+			EXPECT_EQ( serialProfile( ProfileNum ).Power, PlantLoadProfile::PlantProfile( ProfileNum ).Power );
+		}
+		for ( int SourceNum = 1; SourceNum <= OutsideEnergySources::NumDistrictUnits; ++SourceNum ) {
+			EXPECT_EQ( serialSource( SourceNum ).EnergyRate, OutsideEnergySources::EnergySource( SourceNum ).EnergyRate );
+		}
+	}
+
+}
@@ -72,10 +72,19 @@
 #include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
 #include <DataAirSystems.hh>
+#include <DataGlobals.hh>
+#include <DataHVACGlobals.hh>
+#include <DataLoopNode.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
+#include <Fans.hh>
+#include <HeatingCoils.hh>
 #include <SimAirServingZones.hh>
 #include <MixedAir.hh>
+#include <OutputProcessor.hh>
+#include <SimulationManager.hh>
 #include <UtilityRoutines.hh>
 
 using namespace EnergyPlus;
@@ -169,4 +178,577 @@ namespace EnergyPlus {
 
 	}
 
+	TEST( SimAirServingZones, ConcurrentAirLoop )
+	{
+		// PURPOSE OF THIS SUBROUTINE:
+		// This subroutine tests which air loops may be simulated concurrently with other air loops
+
+		ShowMessage( "Begin Test: SimAirServingZones, ConcurrentAirLoop" );
+
+		Fans::Fan.allocate( 2 );
+		Fans::Fan( 1 ).FanType_Num = DataHVACGlobals::FanType_SimpleVAV;
+		Fans::Fan( 2 ).FanType_Num = DataHVACGlobals::FanType_SimpleVAV;
+		Fans::Fan( 2 ).FaultyFilterFlag = true;
+		HeatingCoils::HeatingCoil.allocate( 2 );
+		HeatingCoils::HeatingCoil( 1 ).HCoilType_Num = DataHVACGlobals::Coil_HeatingGasOrOtherFuel;
+		HeatingCoils::HeatingCoil( 2 ).HCoilType_Num = DataHVACGlobals::Coil_HeatingGasOrOtherFuel;
+		HeatingCoils::HeatingCoil( 2 ).PLFCurveIndex = 1;
+
+		PrimaryAirSystem.allocate( 1 );
+		auto & airLoop( PrimaryAirSystem( 1 ) );
+		airLoop.NumControllers = 0;
+		airLoop.NumBranches = 1;
+		airLoop.Branch.allocate( 1 );
+		airLoop.Branch( 1 ).TotalComponents = 3;
+		airLoop.Branch( 1 ).Comp.allocate( 3 );
+		airLoop.Branch( 1 ).Comp( 1 ).CompType_Num = Coil_GasHeat;
+		airLoop.Branch( 1 ).Comp( 1 ).CompIndex = 1;
+		airLoop.Branch( 1 ).Comp( 2 ).CompType_Num = Fan_Simple_VAV;
+		airLoop.Branch( 1 ).Comp( 2 ).CompIndex = 1;
+		airLoop.Branch( 1 ).Comp( 3 ).CompType_Num = Duct;
+		airLoop.Branch( 1 ).Comp( 3 ).CompIndex = 1;
+		EXPECT_TRUE( ConcurrentAirLoop( 1 ) );
+
+		// Components not yet simulated
+		airLoop.Branch( 1 ).Comp( 3 ).CompIndex = 0;
+		EXPECT_FALSE( ConcurrentAirLoop( 1 ) );
+		airLoop.Branch( 1 ).Comp( 3 ).CompIndex = 1;
+
+		// Part load curve of the fuel coil
+		airLoop.Branch( 1 ).Comp( 1 ).CompIndex = 2;
+		EXPECT_FALSE( ConcurrentAirLoop( 1 ) );
+		airLoop.Branch( 1 ).Comp( 1 ).CompIndex = 1;
+
+		// Fouling air filter of the fan
+		airLoop.Branch( 1 ).Comp( 2 ).CompIndex = 2;
+		EXPECT_FALSE( ConcurrentAirLoop( 1 ) );
+		airLoop.Branch( 1 ).Comp( 2 ).CompIndex = 1;
+
+		// Controllers and outdoor air systems are simulated in sequence
+		airLoop.NumControllers = 1;
+		EXPECT_FALSE( ConcurrentAirLoop( 1 ) );
+		airLoop.NumControllers = 0;
+		airLoop.Branch( 1 ).Comp( 3 ).CompType_Num = OAMixer_Num;
+		EXPECT_FALSE( ConcurrentAirLoop( 1 ) );
+
+		// Clean up
+		PrimaryAirSystem.deallocate( );
+		Fans::Fan.deallocate( );
+		HeatingCoils::HeatingCoil.deallocate( );
+
+	}
+
+	TEST_F( EnergyPlusFixture, SimAirServingZones_ParallelAirLoopsMatchSerial )
+	{
+		// Two air loops with an electric heating coil and a constant volume fan each, supplying two zones
+		std::string const idf_objects = delimited_string( {
+			"Version,8.6;",
+			"Timestep, 4;",
+			"Building, Two Air Loops, 0.0, Suburbs, .04, .4, FullExterior, 25, 6;",
+			"SimulationControl, NO, NO, NO, YES, NO;",
+			"Site:Location,",
+			"  Miami Intl Ap FL USA TMY3 WMO=722020E, !- Name",
+			"  25.82,                   !- Latitude {deg}",
+			"  -80.30,                  !- Longitude {deg}",
+			"  -5.00,                   !- Time Zone {hr}",
+			"  11;                      !- Elevation {m}",
+			"SizingPeriod:DesignDay,",
+			" Miami Intl Ap Ann Htg 99.6% Condns DB, !- Name",
+			" 1,                        !- Month",
+			" 21,                       !- Day of Month",
+			" WinterDesignDay,          !- Day Type",
+			" 8.7,                      !- Maximum Dry-Bulb Temperature {C}",
+			" 0.0,                      !- Daily Dry-Bulb Temperature Range {deltaC}",
+			" ,                         !- Dry-Bulb Temperature Range Modifier Type",
+			" ,                         !- Dry-Bulb Temperature Range Modifier Day Schedule Name",
+			" Wetbulb,                  !- Humidity Condition Type",
+			" 8.7,                      !- Wetbulb or DewPoint at Maximum Dry-Bulb {C}",
+			" ,                         !- Humidity Condition Day Schedule Name",
+			" ,                         !- Humidity Ratio at Maximum Dry-Bulb {kgWater/kgDryAir}",
+			" ,                         !- Enthalpy at Maximum Dry-Bulb {J/kg}",
+			" ,                         !- Daily Wet-Bulb Temperature Range {deltaC}",
+			" 101217.,                  !- Barometric Pressure {Pa}",
+			" 3.8,                      !- Wind Speed {m/s}",
+			" 340,                      !- Wind Direction {deg}",
+			" No,                       !- Rain Indicator",
+			" No,                       !- Snow Indicator",
+			" No,                       !- Daylight Saving Time Indicator",
+			" ASHRAEClearSky,           !- Solar Model Indicator",
+			" ,                         !- Beam Solar Day Schedule Name",
+			" ,                         !- Diffuse Solar Day Schedule Name",
+			" ,                         !- ASHRAE Clear Sky Optical Depth for Beam Irradiance (taub) {dimensionless}",
+			" ,                         !- ASHRAE Clear Sky Optical Depth for Diffuse Irradiance (taud) {dimensionless}",
+			" 0.00;                     !- Sky Clearness",
+			"ScheduleTypeLimits,",
+			" Any Number;               !- Name",
+			"Schedule:Compact,",
+			" AvailSched,               !- Name",
+			" Any Number,               !- Schedule Type Limits Name",
+			" Through: 12/31,           !- Field 1",
+			" For: AllDays,             !- Field 2",
+			" Until: 24:00, 1.0;        !- Field 3",
+			"Schedule:Compact,",
+			" Supply Temp Sched,        !- Name",
+			" Any Number,               !- Schedule Type Limits Name",
+			" Through: 12/31,           !- Field 1",
+			" For: AllDays,             !- Field 2",
+			" Until: 24:00, 30.0;       !- Field 3",
+			"Material,",
+			" GP02,                     !- Name",
+			" MediumSmooth,             !- Roughness",
+			" 1.5900001E-02,            !- Thickness {m}",
+			" 0.1600000,                !- Conductivity {W/m-K}",
+			" 801.0000,                 !- Density {kg/m3}",
+			" 837.0000,                 !- Specific Heat {J/kg-K}",
+			" 0.9000000,                !- Thermal Absorptance",
+			" 0.7500000,                !- Solar Absorptance",
+			" 0.5000000;                !- Visible Absorptance",
+			"Material:NoMass,",
+			" R13,                      !- Name",
+			" Rough,                    !- Roughness",
+			" 2.29,                     !- Thermal Resistance {m2-K/W}",
+			" 0.9000000,                !- Thermal Absorptance",
+			" 0.7500000,                !- Solar Absorptance",
+			" 0.7500000;                !- Visible Absorptance",
+			"Construction,",
+			" WALL-1,                   !- Name",
+			" GP02,                     !- Outside Layer",
+			" R13,                      !- Layer 2",
+			" GP02;                     !- Layer 3",
+			"Zone,",
+			" Zone 1,                   !- Name",
+			" 0.0,                      !- Direction of Relative North {deg}",
+			" 0.0,                      !- X Origin {m}",
+			" 0.0,                      !- Y Origin {m}",
+			" 0.0,                      !- Z Origin {m}",
+			" 1,                        !- Type",
+			" 1,                        !- Multiplier",
+			" 2.7,                      !- Ceiling Height {m}",
+			" ,                         !- Volume {m3}",
+			" autocalculate,            !- Floor Area {m2}",
+			" ,                         !- Zone Inside Convection Algorithm",
+			" ,                         !- Zone Outside Convection Algorithm",
+			" Yes;                      !- Part of Total Floor Area",
+			"BuildingSurface:Detailed,",
+			" Z1 South Wall,            !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 1,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z1 East Wall,             !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 1,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z1 North Wall,            !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 1,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z1 West Wall,             !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 1,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z1 Floor,                 !- Name",
+			" FLOOR,                    !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 1,                   !- Zone Name",
+			" Adiabatic,                !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" NoSun,                    !- Sun Exposure",
+			" NoWind,                   !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 5.0, 0.0;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z1 Roof,                  !- Name",
+			" ROOF,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 1,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"ZoneHVAC:EquipmentConnections,",
+			" Zone 1,                   !- Zone Name",
+			" Zone 1 Eq,                !- Zone Conditioning Equipment List Name",
+			" Zone 1 In Node,           !- Zone Air Inlet Node or NodeList Name",
+			" ,                         !- Zone Air Exhaust Node or NodeList Name",
+			" Zone 1 Node,              !- Zone Air Node Name",
+			" Zone 1 Ret Node;          !- Zone Return Air Node Name",
+			"ZoneHVAC:EquipmentList,",
+			" Zone 1 Eq,                !- Name",
+			" AirTerminal:SingleDuct:Uncontrolled, !- Zone Equipment 1 Object Type",
+			" Zone 1 Direct Air,        !- Zone Equipment 1 Name",
+			" 1,                        !- Zone Equipment 1 Cooling Sequence",
+			" 1;                        !- Zone Equipment 1 Heating or No-Load Sequence",
+			"AirTerminal:SingleDuct:Uncontrolled,",
+			" Zone 1 Direct Air,        !- Name",
+			" AvailSched,               !- Availability Schedule Name",
+			" Zone 1 In Node,           !- Zone Supply Air Node Name",
+			" 0.2;                      !- Maximum Air Flow Rate {m3/s}",
+			"BranchList,",
+			" Sys 1 Branches,           !- Name",
+			" Sys 1 Main Branch;        !- Branch 1 Name",
+			"Branch,",
+			" Sys 1 Main Branch,        !- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Coil:Heating:Electric,    !- Component 1 Object Type",
+			" Sys 1 Heating Coil,       !- Component 1 Name",
+			" Sys 1 Inlet Node,         !- Component 1 Inlet Node Name",
+			" Sys 1 Heating Coil Outlet Node, !- Component 1 Outlet Node Name",
+			" Fan:ConstantVolume,       !- Component 2 Object Type",
+			" Sys 1 Supply Fan,         !- Component 2 Name",
+			" Sys 1 Heating Coil Outlet Node, !- Component 2 Inlet Node Name",
+			" Sys 1 Outlet Node;        !- Component 2 Outlet Node Name",
+			"AirLoopHVAC,",
+			" Sys 1,                    !- Name",
+			" ,                         !- Controller List Name",
+			" ,                         !- Availability Manager List Name",
+			" 0.2,                      !- Design Supply Air Flow Rate {m3/s}",
+			" Sys 1 Branches,           !- Branch List Name",
+			" ,                         !- Connector List Name",
+			" Sys 1 Inlet Node,         !- Supply Side Inlet Node Name",
+			" Sys 1 Demand Out Node,    !- Demand Side Outlet Node Name",
+			" Sys 1 Demand In Node,     !- Demand Side Inlet Node Names",
+			" Sys 1 Outlet Node;        !- Supply Side Outlet Node Names",
+			"AirLoopHVAC:SupplyPath,",
+			" Sys 1 Supply Path,        !- Name",
+			" Sys 1 Demand In Node,     !- Supply Air Path Inlet Node Name",
+			" AirLoopHVAC:ZoneSplitter, !- Component 1 Object Type",
+			" Sys 1 Splitter;           !- Component 1 Name",
+			"AirLoopHVAC:ZoneSplitter,",
+			" Sys 1 Splitter,           !- Name",
+			" Sys 1 Demand In Node,     !- Inlet Node Name",
+			" Zone 1 In Node;           !- Outlet 1 Node Name",
+			"AirLoopHVAC:ReturnPath,",
+			" Sys 1 Return Path,        !- Name",
+			" Sys 1 Demand Out Node,    !- Return Air Path Outlet Node Name",
+			" AirLoopHVAC:ZoneMixer,    !- Component 1 Object Type",
+			" Sys 1 Mixer;              !- Component 1 Name",
+			"AirLoopHVAC:ZoneMixer,",
+			" Sys 1 Mixer,              !- Name",
+			" Sys 1 Demand Out Node,    !- Outlet Node Name",
+			" Zone 1 Ret Node;          !- Inlet 1 Node Name",
+			"Coil:Heating:Electric,",
+			" Sys 1 Heating Coil,       !- Name",
+			" AvailSched,               !- Availability Schedule Name",
+			" 1.0,                      !- Efficiency",
+			" 5000,                     !- Nominal Capacity {W}",
+			" Sys 1 Inlet Node,         !- Air Inlet Node Name",
+			" Sys 1 Heating Coil Outlet Node, !- Air Outlet Node Name",
+			" Sys 1 Heating Coil Outlet Node; !- Temperature Setpoint Node Name",
+			"Fan:ConstantVolume,",
+			" Sys 1 Supply Fan,         !- Name",
+			" AvailSched,               !- Availability Schedule Name",
+			" 0.7,                      !- Fan Total Efficiency",
+			" 600.0,                    !- Pressure Rise {Pa}",
+			" 0.2,                      !- Maximum Flow Rate {m3/s}",
+			" 0.9,                      !- Motor Efficiency",
+			" 1.0,                      !- Motor In Airstream Fraction",
+			" Sys 1 Heating Coil Outlet Node, !- Air Inlet Node Name",
+			" Sys 1 Outlet Node;        !- Air Outlet Node Name",
+			"SetpointManager:Scheduled,",
+			" Sys 1 Supply Temp Manager, !- Name",
+			" Temperature,              !- Control Variable",
+			" Supply Temp Sched,        !- Schedule Name",
+			" Sys 1 Heating Coil Outlet Node; !- Setpoint Node or NodeList Name",
+			"Zone,",
+			" Zone 2,                   !- Name",
+			" 0.0,                      !- Direction of Relative North {deg}",
+			" 10.0,                     !- X Origin {m}",
+			" 0.0,                      !- Y Origin {m}",
+			" 0.0,                      !- Z Origin {m}",
+			" 1,                        !- Type",
+			" 1,                        !- Multiplier",
+			" 2.7,                      !- Ceiling Height {m}",
+			" ,                         !- Volume {m3}",
+			" autocalculate,            !- Floor Area {m2}",
+			" ,                         !- Zone Inside Convection Algorithm",
+			" ,                         !- Zone Outside Convection Algorithm",
+			" Yes;                      !- Part of Total Floor Area",
+			"BuildingSurface:Detailed,",
+			" Z2 South Wall,            !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 2,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z2 East Wall,             !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 2,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z2 North Wall,            !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 2,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z2 West Wall,             !- Name",
+			" WALL,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 2,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.5,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 0.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z2 Floor,                 !- Name",
+			" FLOOR,                    !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 2,                   !- Zone Name",
+			" Adiabatic,                !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" NoSun,                    !- Sun Exposure",
+			" NoWind,                   !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 6.0, 5.0, 0.0,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 6.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 0.0, 0.0, 0.0,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 0.0, 5.0, 0.0;            !- X,Y,Z ==> Vertex 4 {m}",
+			"BuildingSurface:Detailed,",
+			" Z2 Roof,                  !- Name",
+			" ROOF,                     !- Surface Type",
+			" WALL-1,                   !- Construction Name",
+			" Zone 2,                   !- Zone Name",
+			" Outdoors,                 !- Outside Boundary Condition",
+			" ,                         !- Outside Boundary Condition Object",
+			" SunExposed,               !- Sun Exposure",
+			" WindExposed,              !- Wind Exposure",
+			" 0.0,                      !- View Factor to Ground",
+			" 4,                        !- Number of Vertices",
+			" 0.0, 5.0, 2.7,            !- X,Y,Z ==> Vertex 1 {m}",
+			" 0.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 2 {m}",
+			" 6.0, 0.0, 2.7,            !- X,Y,Z ==> Vertex 3 {m}",
+			" 6.0, 5.0, 2.7;            !- X,Y,Z ==> Vertex 4 {m}",
+			"ZoneHVAC:EquipmentConnections,",
+			" Zone 2,                   !- Zone Name",
+			" Zone 2 Eq,                !- Zone Conditioning Equipment List Name",
+			" Zone 2 In Node,           !- Zone Air Inlet Node or NodeList Name",
+			" ,                         !- Zone Air Exhaust Node or NodeList Name",
+			" Zone 2 Node,              !- Zone Air Node Name",
+			" Zone 2 Ret Node;          !- Zone Return Air Node Name",
+			"ZoneHVAC:EquipmentList,",
+			" Zone 2 Eq,                !- Name",
+			" AirTerminal:SingleDuct:Uncontrolled, !- Zone Equipment 1 Object Type",
+			" Zone 2 Direct Air,        !- Zone Equipment 1 Name",
+			" 1,                        !- Zone Equipment 1 Cooling Sequence",
+			" 1;                        !- Zone Equipment 1 Heating or No-Load Sequence",
+			"AirTerminal:SingleDuct:Uncontrolled,",
+			" Zone 2 Direct Air,        !- Name",
+			" AvailSched,               !- Availability Schedule Name",
+			" Zone 2 In Node,           !- Zone Supply Air Node Name",
+			" 0.2;                      !- Maximum Air Flow Rate {m3/s}",
+			"BranchList,",
+			" Sys 2 Branches,           !- Name",
+			" Sys 2 Main Branch;        !- Branch 1 Name",
+			"Branch,",
+			" Sys 2 Main Branch,        !- Name",
+			" ,                         !- Pressure Drop Curve Name",
+			" Coil:Heating:Electric,    !- Component 1 Object Type",
+			" Sys 2 Heating Coil,       !- Component 1 Name",
+			" Sys 2 Inlet Node,         !- Component 1 Inlet Node Name",
+			" Sys 2 Heating Coil Outlet Node, !- Component 1 Outlet Node Name",
+			" Fan:ConstantVolume,       !- Component 2 Object Type",
+			" Sys 2 Supply Fan,         !- Component 2 Name",
+			" Sys 2 Heating Coil Outlet Node, !- Component 2 Inlet Node Name",
+			" Sys 2 Outlet Node;        !- Component 2 Outlet Node Name",
+			"AirLoopHVAC,",
+			" Sys 2,                    !- Name",
+			" ,                         !- Controller List Name",
+			" ,                         !- Availability Manager List Name",
+			" 0.2,                      !- Design Supply Air Flow Rate {m3/s}",
+			" Sys 2 Branches,           !- Branch List Name",
+			" ,                         !- Connector List Name",
+			" Sys 2 Inlet Node,         !- Supply Side Inlet Node Name",
+			" Sys 2 Demand Out Node,    !- Demand Side Outlet Node Name",
+			" Sys 2 Demand In Node,     !- Demand Side Inlet Node Names",
+			" Sys 2 Outlet Node;        !- Supply Side Outlet Node Names",
+			"AirLoopHVAC:SupplyPath,",
+			" Sys 2 Supply Path,        !- Name",
+			" Sys 2 Demand In Node,     !- Supply Air Path Inlet Node Name",
+			" AirLoopHVAC:ZoneSplitter, !- Component 1 Object Type",
+			" Sys 2 Splitter;           !- Component 1 Name",
+			"AirLoopHVAC:ZoneSplitter,",
+			" Sys 2 Splitter,           !- Name",
+			" Sys 2 Demand In Node,     !- Inlet Node Name",
+			" Zone 2 In Node;           !- Outlet 1 Node Name",
+			"AirLoopHVAC:ReturnPath,",
+			" Sys 2 Return Path,        !- Name",
+			" Sys 2 Demand Out Node,    !- Return Air Path Outlet Node Name",
+			" AirLoopHVAC:ZoneMixer,    !- Component 1 Object Type",
+			" Sys 2 Mixer;              !- Component 1 Name",
+			"AirLoopHVAC:ZoneMixer,",
+			" Sys 2 Mixer,              !- Name",
+			" Sys 2 Demand Out Node,    !- Outlet Node Name",
+			" Zone 2 Ret Node;          !- Inlet 1 Node Name",
+			"Coil:Heating:Electric,",
+			" Sys 2 Heating Coil,       !- Name",
+			" AvailSched,               !- Availability Schedule Name",
+			" 1.0,                      !- Efficiency",
+			" 6000,                     !- Nominal Capacity {W}",
+			" Sys 2 Inlet Node,         !- Air Inlet Node Name",
+			" Sys 2 Heating Coil Outlet Node, !- Air Outlet Node Name",
+			" Sys 2 Heating Coil Outlet Node; !- Temperature Setpoint Node Name",
+			"Fan:ConstantVolume,",
+			" Sys 2 Supply Fan,         !- Name",
+			" AvailSched,               !- Availability Schedule Name",
+			" 0.7,                      !- Fan Total Efficiency",
+			" 600.0,                    !- Pressure Rise {Pa}",
+			" 0.2,                      !- Maximum Flow Rate {m3/s}",
+			" 0.9,                      !- Motor Efficiency",
+			" 1.0,                      !- Motor In Airstream Fraction",
+			" Sys 2 Heating Coil Outlet Node, !- Air Inlet Node Name",
+			" Sys 2 Outlet Node;        !- Air Outlet Node Name",
+			"SetpointManager:Scheduled,",
+			" Sys 2 Supply Temp Manager, !- Name",
+			" Temperature,              !- Control Variable",
+			" Supply Temp Sched,        !- Schedule Name",
+			" Sys 2 Heating Coil Outlet Node; !- Setpoint Node or NodeList Name",
+		} );
+
+		ASSERT_FALSE( process_idf( idf_objects ) );
+
+		OutputProcessor::TimeValue.allocate( 2 );
+		DataGlobals::DDOnlySimulation = true;
+
+		SimulationManager::ManageSimulation();
+		ASSERT_EQ( 2, DataHVACGlobals::NumPrimaryAirSys );
+		ASSERT_TRUE( ConcurrentAirLoop( 1 ) );
+		ASSERT_TRUE( ConcurrentAirLoop( 2 ) );
+
+		// Simulate the air loops of the last time step again, first serially and then with four threads
+		auto const savedNode( DataLoopNode::Node );
+		auto const savedFan( Fans::Fan );
+		auto const savedCoil( HeatingCoils::HeatingCoil );
+		bool SimZoneEquipment( false );
+		DataSystemVariables::ParallelAirLoopsEnvFlag = true;
+		DataSystemVariables::NumberParallelThreads = 1;
+		SimAirLoops( false, SimZoneEquipment );
+		auto const serialNode( DataLoopNode::Node );
+		auto const serialFan( Fans::Fan );
+		auto const serialCoil( HeatingCoils::HeatingCoil );
+		int const serialCurBranchNum( CurBranchNum );
+		int const serialCurDuctType( CurDuctType );
+		Real64 const serialFanElecPower( DataHVACGlobals::FanElecPower );
+		Real64 const serialElecHeatingCoilPower( DataHVACGlobals::ElecHeatingCoilPower );
+		EXPECT_GT( serialCoil( 1 ).HeatingCoilLoad, 0.0 );
+		EXPECT_GT( serialCoil( 2 ).HeatingCoilLoad, 0.0 );
+
+		DataLoopNode::Node = savedNode;
+		Fans::Fan = savedFan;
+		HeatingCoils::HeatingCoil = savedCoil;
+		DataSystemVariables::NumberParallelThreads = 4;
+		SimAirLoops( false, SimZoneEquipment );
+		DataSystemVariables::NumberParallelThreads = 1;
+		DataSystemVariables::ParallelAirLoopsEnvFlag = false;
+
+		for ( int NodeNum = 1; NodeNum <= DataLoopNode::NumOfNodes; ++NodeNum ) {
+			EXPECT_EQ( serialNode( NodeNum ).Temp, DataLoopNode::Node( NodeNum ).Temp );
+			EXPECT_EQ( serialNode( NodeNum ).HumRat, DataLoopNode::Node( NodeNum ).HumRat );
+			EXPECT_EQ( serialNode( NodeNum ).Enthalpy, DataLoopNode::Node( NodeNum ).Enthalpy );
+			EXPECT_EQ( serialNode( NodeNum ).MassFlowRate, DataLoopNode::Node( NodeNum ).MassFlowRate );
+		}
+		for ( int FanNum = 1; FanNum <= Fans::NumFans; ++FanNum ) {
+			EXPECT_EQ( serialFan( FanNum ).FanPower, Fans::Fan( FanNum ).FanPower );
+		}
+		for ( int CoilNum = 1; CoilNum <= HeatingCoils::NumHeatingCoils; ++CoilNum ) {
+			EXPECT_EQ( serialCoil( CoilNum ).HeatingCoilLoad, HeatingCoils::HeatingCoil( CoilNum ).HeatingCoilLoad );
+			EXPECT_EQ( serialCoil( CoilNum ).ElecUseLoad, HeatingCoils::HeatingCoil( CoilNum ).ElecUseLoad );
+		}
+
+		// The calling thread is left with the state of the last air loop, as after the serial simulation
+		EXPECT_EQ( 0, CurSysNum );
+		EXPECT_EQ( serialCurBranchNum, CurBranchNum );
+		EXPECT_EQ( serialCurDuctType, CurDuctType );
+		EXPECT_EQ( serialFanElecPower, DataHVACGlobals::FanElecPower );
+		EXPECT_EQ( serialElecHeatingCoilPower, DataHVACGlobals::ElecHeatingCoilPower );
+	}
+
 }
@@ -0,0 +1,339 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::SurfaceBVH Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/SurfaceBVH.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/PierceSurface.hh>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
+// C++ Headers
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataSurfaces;
+using namespace ObjexxFCL;
+using Vertex = SurfaceBVH::Vertex;
+
+namespace {
+
+// Add a rectangular surface
+void
+addRectangle( std::vector< SurfaceData > & surfaces, Vertex const & v1, Vertex const & v2, Vertex const & v3, Vertex const & v4 )
+{
+	SurfaceData surface;
+	surface.Sides = 4;
+	surface.Shape = SurfaceShape::Rectangle;
+	surface.Vertex.dimension( 4 );
+	surface.Vertex = { v1, v2, v3, v4 };
+	surface.set_computed_geometry();
+	surfaces.push_back( surface );
+}
+
+// Surfaces with the shape of the 10-windows-per-zone large office benchmark model:
+//  73.1 m x 48.7 m footprint, 4.57 m deep perimeter zones, 10 windows in each exterior wall, and an overhang over each facade
+void
+setOfficeSurfaces( int const nFloors )
+{
+	Real64 const X( 73.1 ), Y( 48.7 ), D( 4.57 ), H( 3.96 ); // Footprint, perimeter zone depth, and floor height (m)
+	std::vector< SurfaceData > surfaces;
+	for ( int floor = 0; floor < nFloors; ++floor ) {
+		Real64 const z0( floor * H ), z1( z0 + H );
+		// Floor slabs: Core and the 4 perimeter strips
+		addRectangle( surfaces, Vertex( D, D, z0 ), Vertex( X - D, D, z0 ), Vertex( X - D, Y - D, z0 ), Vertex( D, Y - D, z0 ) );
+		addRectangle( surfaces, Vertex( 0, 0, z0 ), Vertex( X, 0, z0 ), Vertex( X, D, z0 ), Vertex( 0, D, z0 ) );
+		addRectangle( surfaces, Vertex( 0, Y - D, z0 ), Vertex( X, Y - D, z0 ), Vertex( X, Y, z0 ), Vertex( 0, Y, z0 ) );
+		addRectangle( surfaces, Vertex( 0, D, z0 ), Vertex( D, D, z0 ), Vertex( D, Y - D, z0 ), Vertex( 0, Y - D, z0 ) );
+		addRectangle( surfaces, Vertex( X - D, D, z0 ), Vertex( X, D, z0 ), Vertex( X, Y - D, z0 ), Vertex( X - D, Y - D, z0 ) );
+		// Core walls
+		addRectangle( surfaces, Vertex( D, D, z0 ), Vertex( X - D, D, z0 ), Vertex( X - D, D, z1 ), Vertex( D, D, z1 ) );
+		addRectangle( surfaces, Vertex( D, Y - D, z0 ), Vertex( X - D, Y - D, z0 ), Vertex( X - D, Y - D, z1 ), Vertex( D, Y - D, z1 ) );
+		addRectangle( surfaces, Vertex( D, D, z0 ), Vertex( D, Y - D, z0 ), Vertex( D, Y - D, z1 ), Vertex( D, D, z1 ) );
+		addRectangle( surfaces, Vertex( X - D, D, z0 ), Vertex( X - D, Y - D, z0 ), Vertex( X - D, Y - D, z1 ), Vertex( X - D, D, z1 ) );
+		// Exterior walls with 10 windows each
+		for ( int side = 0; side < 4; ++side ) {
+			bool const alongX( side < 2 );
+			Real64 const L( alongX ? X : Y ), c( side == 0 ? 0.0 : ( side == 1 ? Y : ( side == 2 ? 0.0 : X ) ) );
+			auto vtx = [=]( Real64 const s, Real64 const z ){ return alongX ? Vertex( s, c, z ) : Vertex( c, s, z ); };
+			addRectangle( surfaces, vtx( 0, z0 ), vtx( L, z0 ), vtx( L, z1 ), vtx( 0, z1 ) );
+			Real64 const w( L / 10 );
+			for ( int win = 0; win < 10; ++win ) {
+				Real64 const s0( win * w + 0.1 * w ), s1( s0 + 0.8 * w );
+				addRectangle( surfaces, vtx( s0, z0 + 0.9 ), vtx( s1, z0 + 0.9 ), vtx( s1, z0 + 2.1 ), vtx( s0, z0 + 2.1 ) );
+			}
+			// Overhang
+			Vertex const out( alongX ? Vertex( 0, side == 0 ? -1.0 : 1.0, 0 ) : Vertex( side == 2 ? -1.0 : 1.0, 0, 0 ) );
+			addRectangle( surfaces, vtx( 0, z0 + 2.3 ), vtx( L, z0 + 2.3 ), vtx( L, z0 + 2.3 ) + out, vtx( 0, z0 + 2.3 ) + out );
+		}
+	}
+	// Roof
+	Real64 const zr( nFloors * H );
+	addRectangle( surfaces, Vertex( 0, 0, zr ), Vertex( X, 0, zr ), Vertex( X, Y, zr ), Vertex( 0, Y, zr ) );
+
+	TotSurfaces = static_cast< int >( surfaces.size() );
+	Surface.dimension( TotSurfaces );
+	for ( int i = 1; i <= TotSurfaces; ++i ) Surface( i ) = surfaces[ i - 1 ];
+}
+
+// Deterministic unit ray directions spread over the sphere
+std::vector< Vertex >
+rayDirections( int const n )
+{
+	std::vector< Vertex > dirs;
+	Real64 const golden( 2.399963229728653 ); // Golden angle (radians)
+	for ( int i = 0; i < n; ++i ) {
+		Real64 const z( 1.0 - ( 2.0 * i + 1.0 ) / n );
+		Real64 const r( std::sqrt( 1.0 - z * z ) );
+		dirs.push_back( Vertex( r * std::cos( golden * i ), r * std::sin( golden * i ), z ) );
+	}
+	return dirs;
+}
+
+// Ray origins: Window centers offset slightly outward and inward
+std::vector< Vertex >
+rayOrigins()
+{
+	std::vector< Vertex > origins;
+	for ( int i = 1; i <= TotSurfaces; i += 7 ) {
+		auto const & v( Surface( i ).Vertex );
+		Vertex const c( 0.25 * ( v( 1 ) + v( 2 ) + v( 3 ) + v( 4 ) ) );
+		origins.push_back( c + Vertex( 0.05, 0.05, 0.05 ) );
+		origins.push_back( c - Vertex( 0.05, 0.05, 0.05 ) );
+	}
+	return origins;
+}
+
+// Linear search for nearest hit surface
+int
+nearestHitLinear( Vertex const & a, Vertex const & dir )
+{
+	int nearest( 0 );
+	Real64 nearestDistance_sq( std::numeric_limits< Real64 >::max() );
+	Vertex hitPt;
+	bool hit;
+	for ( int i = 1; i <= TotSurfaces; ++i ) {
+		PierceSurface( Surface( i ), a, dir, hitPt, hit );
+		if ( hit ) {
+			Real64 const distance_sq( distance_squared( hitPt, a ) );
+			if ( distance_sq < nearestDistance_sq ) {
+				nearestDistance_sq = distance_sq;
+				nearest = i;
+			}
+		}
+	}
+	return nearest;
+}
+
+// BVH search for nearest hit surface
+int
+nearestHitBVH( SurfaceBVH const & bvh, Vertex const & a, Vertex const & dir )
+{
+	int nearest( 0 );
+	Real64 nearestDistance_sq( std::numeric_limits< Real64 >::max() );
+	Vertex hitPt;
+	bool hit;
+	bvh.processSurfaceRayIntersects( a, dir, [&]( int const i ){
+		PierceSurface( Surface( i ), a, dir, hitPt, hit );
+		if ( hit ) {
+			Real64 const distance_sq( distance_squared( hitPt, a ) );
+			if ( ( distance_sq < nearestDistance_sq ) || ( ( distance_sq == nearestDistance_sq ) && ( i < nearest ) ) ) {
+				nearestDistance_sq = distance_sq;
+				nearest = i;
+			}
+		}
+	} );
+	return nearest;
+}
+
+}
+
+TEST( SurfaceBVHTest, Basic )
+{
+	// Surfaces: Simple Unit Cube
+	std::vector< SurfaceData > surfaces;
+	addRectangle( surfaces, Vertex(0,0,0), Vertex(1,0,0), Vertex(1,0,1), Vertex(0,0,1) );
+	addRectangle( surfaces, Vertex(0,1,0), Vertex(1,1,0), Vertex(1,1,1), Vertex(0,1,1) );
+	addRectangle( surfaces, Vertex(0,0,0), Vertex(0,1,0), Vertex(0,1,1), Vertex(0,0,1) );
+	addRectangle( surfaces, Vertex(1,0,0), Vertex(1,1,0), Vertex(1,1,1), Vertex(1,0,1) );
+	addRectangle( surfaces, Vertex(0,0,0), Vertex(1,0,0), Vertex(1,1,0), Vertex(0,1,0) );
+	addRectangle( surfaces, Vertex(0,0,1), Vertex(1,0,1), Vertex(1,1,1), Vertex(0,1,1) );
+	TotSurfaces = 6;
+	Surface.dimension( TotSurfaces );
+	for ( int i = 1; i <= TotSurfaces; ++i ) Surface( i ) = surfaces[ i - 1 ];
+
+	SurfaceBVH const bvh( Surface );
+	EXPECT_FALSE( bvh.empty() );
+	EXPECT_EQ( 6u, bvh.size() );
+	EXPECT_TRUE( bvh.nodes()[ 0 ].l.x <= 0.0 );
+	EXPECT_TRUE( bvh.nodes()[ 0 ].u.z >= 1.0 );
+
+	{ // Each surface is in exactly one leaf
+		std::vector< int > count( TotSurfaces + 1, 0 );
+		for ( int const i : bvh.surfaceNums() ) ++count[ i ];
+		for ( int i = 1; i <= TotSurfaces; ++i ) EXPECT_EQ( 1, count[ i ] );
+	}
+
+	{ // Box tests
+		Vertex const l( 0.0 ), u( 1.0 );
+		Vertex const dir( 1.0, 0.0, 0.0 ), dir_inv( SurfaceBVH::safe_inverse( dir ) );
+		EXPECT_TRUE( SurfaceBVH::rayIntersectsBox( l, u, Vertex( -1.0, 0.5, 0.5 ), dir, dir_inv, 10.0 ) );
+		EXPECT_FALSE( SurfaceBVH::rayIntersectsBox( l, u, Vertex( -1.0, 0.5, 0.5 ), dir, dir_inv, 0.5 ) ); // Stops short of box
+		EXPECT_FALSE( SurfaceBVH::rayIntersectsBox( l, u, Vertex( 2.0, 0.5, 0.5 ), dir, dir_inv, 10.0 ) ); // Points away from box
+		EXPECT_FALSE( SurfaceBVH::rayIntersectsBox( l, u, Vertex( -1.0, 1.5, 0.5 ), dir, dir_inv, 10.0 ) ); // Parallel outside slab
+		EXPECT_TRUE( SurfaceBVH::rayIntersectsBox( l, u, Vertex( 0.5, 0.5, 0.5 ), dir, dir_inv, 10.0 ) ); // Origin inside box
+	}
+
+	{ // Ray from inside up through the top face
+		Vertex const a( 0.5, 0.5, 0.5 ), dir( 0.0, 0.0, 1.0 );
+		std::vector< int > hits;
+		Vertex hitPt;
+		bool hit;
+		bvh.processSurfaceRayIntersects( a, dir, [&]( int const i ){
+			PierceSurface( Surface( i ), a, dir, hitPt, hit );
+			if ( hit ) hits.push_back( i );
+		} );
+		ASSERT_EQ( 1u, hits.size() );
+		EXPECT_EQ( 6, hits[ 0 ] );
+	}
+
+	{ // Ray outside the cube misses all surface boxes
+		int nCandidates( 0 );
+		bvh.processSurfaceRayIntersects( Vertex( 2.0, 2.0, 2.0 ), Vertex( 0.0, 0.0, 1.0 ), [&]( int const ){ ++nCandidates; } );
+		EXPECT_EQ( 0, nCandidates );
+	}
+
+	{ // Segments
+		auto pierces = [&]( Vertex const & a, Vertex const & b ){
+			Vertex const dir( ( b - a ).normalize() );
+			Real64 const d( distance( a, b ) );
+			Vertex hitPt;
+			bool hit( false );
+			return bvh.hasSurfaceSegmentIntersects( a, b, [&]( int const i ){ PierceSurface( Surface( i ), a, dir, d, hitPt, hit ); return hit; } );
+		};
+		EXPECT_FALSE( pierces( Vertex( 0.2, 0.2, 0.2 ), Vertex( 0.8, 0.8, 0.8 ) ) ); // Inside cube
+		EXPECT_TRUE( pierces( Vertex( 0.5, 0.5, 0.5 ), Vertex( 0.5, 0.5, 1.5 ) ) ); // Through top face
+		EXPECT_FALSE( pierces( Vertex( 0.5, 0.5, 1.5 ), Vertex( 0.5, 0.5, 2.5 ) ) ); // Above cube
+	}
+
+	{ // Clear
+		SurfaceBVH bvh2( Surface );
+		bvh2.clear();
+		EXPECT_TRUE( bvh2.empty() );
+		EXPECT_FALSE( bvh2.hasSurfaceRayIntersects( Vertex( 0.5, 0.5, 0.5 ), Vertex( 0.0, 0.0, 1.0 ), []( int const ){ return true; } ) );
+	}
+
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
+
+TEST( SurfaceBVHTest, MatchesLinearSearch )
+{
+	setOfficeSurfaces( 4 );
+	SurfaceBVH const bvh( Surface );
+	EXPECT_EQ( std::size_t( TotSurfaces ), bvh.size() );
+
+	std::vector< Vertex > const origins( rayOrigins() );
+	std::vector< Vertex > const dirs( rayDirections( 64 ) );
+	for ( Vertex const & a : origins ) {
+		for ( Vertex const & dir : dirs ) {
+			EXPECT_EQ( nearestHitLinear( a, dir ), nearestHitBVH( bvh, a, dir ) );
+		}
+	}
+
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
+
+// Ray query throughput benchmark: Run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+TEST( SurfaceBVHTest, DISABLED_Benchmark )
+{
+	setOfficeSurfaces( 4 );
+	SurfaceBVH const bvh( Surface );
+	std::vector< Vertex > const origins( rayOrigins() );
+	std::vector< Vertex > const dirs( rayDirections( 1024 ) );
+	Real64 const nRays( Real64( origins.size() ) * dirs.size() );
+	using Clock = std::chrono::steady_clock;
+
+	int sumLinear( 0 ), sumBVH( 0 );
+	Clock::time_point const t0( Clock::now() );
+	for ( Vertex const & a : origins ) for ( Vertex const & dir : dirs ) sumLinear += nearestHitLinear( a, dir );
+	Clock::time_point const t1( Clock::now() );
+	for ( Vertex const & a : origins ) for ( Vertex const & dir : dirs ) sumBVH += nearestHitBVH( bvh, a, dir );
+	Clock::time_point const t2( Clock::now() );
+	EXPECT_EQ( sumLinear, sumBVH );
+
+	Real64 const secLinear( std::chrono::duration< Real64 >( t1 - t0 ).count() );
+	Real64 const secBVH( std::chrono::duration< Real64 >( t2 - t1 ).count() );
+	std::cout << "Surfaces: " << TotSurfaces << "  Rays: " << nRays << '\n';
+	std::cout << "Linear: " << nRays / secLinear << " rays/s\n";
+	std::cout << "BVH:    " << nRays / secBVH << " rays/s  (x" << secLinear / secBVH << ")\n";
+
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
@@ -1618,3 +1618,165 @@ TEST_F( EnergyPlusFixture, StratifiedTankUseEnergy )
 	ASSERT_LT(Tank.UseRate, 0.0);
 
 }
+
+TEST_F( EnergyPlusFixture, StratifiedTankDrawWithHeaterEnergyBalance )
+{
+	using WaterThermalTanks::WaterThermalTank;
+	using DataGlobals::HourOfDay;
+	using DataGlobals::TimeStep;
+	using DataGlobals::TimeStepZone;
+	using DataHVACGlobals::SysTimeElapsed;
+	using DataHVACGlobals::TimeStepSys;
+
+	std::string const idf_objects = delimited_string( {
+		"Schedule:Constant, Hot Water Demand Schedule, , 1.0;",
+		"Schedule:Constant, Ambient Temp Schedule, , 20.0;",
+		"Schedule:Constant, Inlet Water Temperature, , 10.0;",
+		"Schedule:Constant, Hot Water Setpoint Temp Schedule, , 60.0;",
+		"Schedule:Constant, Lower Element Setpoint Temp Schedule, , 5.0;",
+		"WaterHeater:Stratified,",
+		"  Stratified Tank,         !- Name",
+		"  ,                        !- End-Use Subcategory",
+		"  0.17,                    !- Tank Volume {m3}",
+		"  1.4,                     !- Tank Height {m}",
+		"  VerticalCylinder,        !- Tank Shape",
+		"  ,                        !- Tank Perimeter {m}",
+		"  82.2222,                 !- Maximum Temperature Limit {C}",
+		"  MasterSlave,             !- Heater Priority Control",
+		"  Hot Water Setpoint Temp Schedule,  !- Heater 1 Setpoint Temperature Schedule Name",
+		"  2.0,                     !- Heater 1 Deadband Temperature Difference {deltaC}",
+		"  3000,                    !- Heater 1 Capacity {W}",
+		"  1.3,                     !- Heater 1 Height {m}",
+		"  Lower Element Setpoint Temp Schedule,  !- Heater 2 Setpoint Temperature Schedule Name",
+		"  5.0,                     !- Heater 2 Deadband Temperature Difference {deltaC}",
+		"  3000,                    !- Heater 2 Capacity {W}",
+		"  0.0,                     !- Heater 2 Height {m}",
+		"  ELECTRICITY,             !- Heater Fuel Type",
+		"  1,                       !- Heater Thermal Efficiency",
+		"  ,                        !- Off Cycle Parasitic Fuel Consumption Rate {W}",
+		"  ELECTRICITY,             !- Off Cycle Parasitic Fuel Type",
+		"  ,                        !- Off Cycle Parasitic Heat Fraction to Tank",
+		"  ,                        !- Off Cycle Parasitic Height {m}",
+		"  ,                        !- On Cycle Parasitic Fuel Consumption Rate {W}",
+		"  ELECTRICITY,             !- On Cycle Parasitic Fuel Type",
+		"  ,                        !- On Cycle Parasitic Heat Fraction to Tank",
+		"  ,                        !- On Cycle Parasitic Height {m}",
+		"  SCHEDULE,                !- Ambient Temperature Indicator",
+		"  Ambient Temp Schedule,   !- Ambient Temperature Schedule Name",
+		"  ,                        !- Ambient Temperature Zone Name",
+		"  ,                        !- Ambient Temperature Outdoor Air Node Name",
+		"  0.846,                   !- Uniform Skin Loss Coefficient per Unit Area to Ambient Temperature {W/m2-K}",
+		"  ,                        !- Skin Loss Fraction to Zone",
+		"  ,                        !- Off Cycle Flue Loss Coefficient to Ambient Temperature {W/K}",
+		"  ,                        !- Off Cycle Flue Loss Fraction to Zone",
+		"  0.0001,                  !- Peak Use Flow Rate {m3/s}",
+		"  Hot Water Demand Schedule,  !- Use Flow Rate Fraction Schedule Name",
+		"  Inlet Water Temperature, !- Cold Water Supply Temperature Schedule Name",
+		"  ,                        !- Use Side Inlet Node Name",
+		"  ,                        !- Use Side Outlet Node Name",
+		"  1.0,                     !- Use Side Effectiveness",
+		"  0.0,                     !- Use Side Inlet Height {m}",
+		"  1.4,                     !- Use Side Outlet Height {m}",
+		"  ,                        !- Source Side Inlet Node Name",
+		"  ,                        !- Source Side Outlet Node Name",
+		"  ,                        !- Source Side Effectiveness",
+		"  ,                        !- Source Side Inlet Height {m}",
+		"  ,                        !- Source Side Outlet Height {m}",
+		"  FIXED,                   !- Inlet Mode",
+		"  ,                        !- Use Side Design Flow Rate {m3/s}",
+		"  ,                        !- Source Side Design Flow Rate {m3/s}",
+		"  ,                        !- Indirect Water Heating Recovery Time {hr}",
+		"  10,                      !- Number of Nodes",
+		"  0.1;                     !- Additional Destratification Conductivity {W/m-K}",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	bool ErrorsFound = false;
+	EXPECT_FALSE( WaterThermalTanks::GetWaterThermalTankInputData( ErrorsFound ) );
+
+	WaterThermalTanks::WaterThermalTankData & Tank = WaterThermalTank( 1 );
+
+	// Stratified tank with a draw of cold water at the bottom and the upper element heating the top node
+	Tank.TankTemp = 0.0;
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		auto & node = Tank.Node( i );
+		node.SavedTemp = 52.0 - 2.2 * ( i - 1 );
+		node.Temp = node.SavedTemp;
+		Tank.TankTemp += node.Temp;
+	}
+	Tank.TankTemp /= Tank.Nodes;
+	HourOfDay = 0;
+	TimeStep = 1;
+	TimeStepZone = 10. / 60.;
+	TimeStepSys = TimeStepZone;
+	SysTimeElapsed = 0.0;
+	Tank.TimeElapsed = HourOfDay + TimeStep * TimeStepZone + SysTimeElapsed;
+	Tank.AmbientTemp = 20.0;
+	Tank.UseInletTemp = 10.0;
+	Tank.SetPointTemp = 60.0;
+	Tank.SetPointTemp2 = 5.0;
+	Tank.UseMassFlowRate = 0.1;
+	Tank.SavedHeaterOn1 = true;
+	Tank.HeaterOn1 = Tank.SavedHeaterOn1;
+	Tank.SavedHeaterOn2 = false;
+	Tank.HeaterOn2 = Tank.SavedHeaterOn2;
+
+	int GlycolIndex = 0;
+	Real64 const Cp = FluidProperties::GetSpecificHeatGlycol( FluidProperties::Water, Tank.TankTemp, GlycolIndex, "StratifiedTankDrawWithHeaterEnergyBalance" );
+	Real64 const SecInTimeStep = TimeStepSys * DataGlobals::SecInHour;
+
+	WaterThermalTanks::CalcWaterThermalTankStratified( 1 );
+
+	// The upper element stays on for the whole time step
+	EXPECT_DOUBLE_EQ( 1.0, Tank.RuntimeFraction1 );
+	EXPECT_DOUBLE_EQ( 0.0, Tank.RuntimeFraction2 );
+	ASSERT_LT( Tank.UseRate, 0.0 );
+
+	// Change in stored energy equals the net heat transfer to the tank
+	Real64 StoredEnergy = 0.0;
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		StoredEnergy += Tank.Node( i ).Mass * Cp * ( Tank.Node( i ).Temp - Tank.Node( i ).SavedTemp );
+	}
+	EXPECT_NEAR( Tank.NetHeatTransferRate * SecInTimeStep, StoredEnergy, 1.0e-6 * Tank.HeaterRate * SecInTimeStep );
+
+	// Reference: the forward Euler formulation the implicit solution replaced, with one second time steps
+	Array1D< Real64 > RefTemp( Tank.Nodes );
+	for ( int i = 1; i <= Tank.Nodes; ++i ) RefTemp( i ) = Tank.Node( i ).SavedTemp;
+	Array1D< Real64 > RefNewTemp( RefTemp );
+	bool RefHeaterOn1 = Tank.SavedHeaterOn1;
+	Real64 RefEuse = 0.0;
+	for ( int Sec = 1; Sec <= int( SecInTimeStep ); ++Sec ) {
+		Real64 const HeaterTemp = RefTemp( Tank.HeaterNode1 );
+		if ( RefHeaterOn1 ) {
+			if ( HeaterTemp >= Tank.SetPointTemp ) RefHeaterOn1 = false;
+		} else if ( HeaterTemp < Tank.SetPointTemp - Tank.DeadBandDeltaTemp ) {
+			RefHeaterOn1 = true;
+		}
+		for ( int i = 1; i <= Tank.Nodes; ++i ) {
+			auto const & node = Tank.Node( i );
+			Real64 const NodeTemp = RefTemp( i );
+			Real64 const TempUp = ( i > 1 ) ? RefTemp( i - 1 ) : NodeTemp;
+			Real64 const TempDn = ( i < Tank.Nodes ) ? RefTemp( i + 1 ) : NodeTemp;
+			Real64 const InvMixUp = ( TempUp < NodeTemp ) ? Tank.InversionMixingRate : 0.0;
+			Real64 const InvMixDn = ( TempDn > NodeTemp ) ? Tank.InversionMixingRate : 0.0;
+			Real64 Qnode = node.UseMassFlowRate * Cp * ( Tank.UseInletTemp - NodeTemp );
+			Qnode += ( RefHeaterOn1 ? node.OnCycLossCoeff : node.OffCycLossCoeff ) * ( Tank.AmbientTemp - NodeTemp );
+			Qnode += ( node.CondCoeffUp + Cp * ( node.MassFlowFromUpper + InvMixUp ) ) * ( TempUp - NodeTemp );
+			Qnode += ( node.CondCoeffDn + Cp * ( node.MassFlowFromLower + InvMixDn ) ) * ( TempDn - NodeTemp );
+			if ( RefHeaterOn1 && ( i == Tank.HeaterNode1 ) ) Qnode += Tank.MaxCapacity;
+			RefNewTemp( i ) = NodeTemp + Qnode / ( node.Mass * Cp );
+		}
+		RefEuse += Tank.UseMassFlowRate * Cp * ( Tank.UseInletTemp - RefTemp( Tank.UseOutletStratNode ) );
+		RefTemp = RefNewTemp;
+	}
+
+	Real64 RefTankTemp = 0.0;
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		EXPECT_NEAR( RefTemp( i ), Tank.Node( i ).Temp, 0.1 );
+		RefTankTemp += RefTemp( i );
+	}
+	RefTankTemp /= Tank.Nodes;
+	EXPECT_NEAR( RefTankTemp, Tank.TankTemp, 0.01 );
+	EXPECT_NEAR( RefEuse / SecInTimeStep, Tank.UseRate, 0.005 * std::abs( Tank.UseRate ) );
+}
@@ -1,6 +1,7 @@
 // EnergyPlus::WindowManager unit tests
 
 // C++ Headers
+#include <algorithm>
 #include <iostream>
 
 // Google Test Headers
@@ -281,3 +282,104 @@ TEST_F(EnergyPlusFixture, WindowManager_TransAndReflAtPhi)
 
 
 
+
+TEST_F(EnergyPlusFixture, WindowManager_BareGlazingResponseTable)
+{
+	// Clear double glazing, 3 mm glass, 12.7 mm air gap, vertical window 1.5 m high
+	ngllayer = 2;
+	nglface = 4;
+	scon( 1 ) = 0.9 / 0.003;
+	scon( 2 ) = 0.9 / 0.003;
+	for ( int i = 1; i <= 4; ++i ) emis( i ) = 0.84;
+	gap( 1 ) = 0.0127;
+	gnmix( 1 ) = 1;
+	gfract( 1, 1 ) = 1.0;
+	gwght( 1, 1 ) = DataHeatBalance::GasWght( 1 );
+	for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+		gcon( ICoeff, 1, 1 ) = DataHeatBalance::GasCoeffsCon( ICoeff, 1 );
+		gvis( ICoeff, 1, 1 ) = DataHeatBalance::GasCoeffsVis( ICoeff, 1 );
+		gcp( ICoeff, 1, 1 ) = DataHeatBalance::GasCoeffsCp( ICoeff, 1 );
+	}
+	tilt = 90.0;
+	DataSurfaces::Surface.allocate( 1 );
+	DataSurfaces::Surface( 1 ).Height = 1.5;
+	WindowResponseTable.allocate( 1 );
+
+	InitWindowResponseTable( 1, 1 );
+
+	EXPECT_EQ( 1, WindowResponseTable( 1 ).Status );
+
+	// Winter night with some absorbed radiation, off the grid nodes
+	Real64 const ToutK = -7.0 + DataGlobals::KelvinConv;
+	Real64 const TinK = 21.0 + DataGlobals::KelvinConv;
+	Array1D_int Lower( 4 );
+	Array1D< Real64 > Frac( 4 );
+	EXPECT_TRUE( LocateWindowResponseCell( ToutK, TinK, 14.0, 2.5, Lower, Frac ) );
+	EXPECT_EQ( 3, Lower( 1 ) );
+	EXPECT_EQ( 3, Lower( 2 ) );
+	EXPECT_EQ( 3, Lower( 3 ) );
+	EXPECT_EQ( 3, Lower( 4 ) );
+	EXPECT_NEAR( 0.3, Frac( 1 ), 1.0e-12 );
+	EXPECT_NEAR( 0.2, Frac( 2 ), 1.0e-12 );
+
+	// Only the 16 nodes of the cell are solved
+	EXPECT_TRUE( BuildWindowResponseCell( 1, 1, Lower ) );
+	EXPECT_EQ( 16, std::count( WindowResponseTable( 1 ).NodeStatus.begin(), WindowResponseTable( 1 ).NodeStatus.end(), 1 ) );
+	EXPECT_EQ( 1, WindowResponseTable( 1 ).CellStatus( WindowResponseCellNum( Lower ) ) );
+	EXPECT_LT( WindowResponseTable( 1 ).MaxError, 0.5 );
+	Real64 const OutIR = DataGlobals::StefanBoltzmann * pow_4( ToutK - 8.0 );
+	Real64 const RmIR = DataGlobals::StefanBoltzmann * pow_4( TinK );
+	Array1D< Real64 > AbsFace( 10, 0.0 );
+	AbsFace( 1 ) = 20.0;
+	AbsFace( 4 ) = 15.0;
+	Array1D< Real64 > Theta( 10, 0.0 );
+	Array1D< Real64 > ThetaTable( 10, 0.0 );
+	Array2D< Real64 > Jac( 10, 10, 0.0 );
+	Array1D_int indx( 10, 0 );
+
+	EXPECT_TRUE( SolveBareGlazingResponse( 1, ToutK, TinK, 14.0, 2.5, OutIR, RmIR, AbsFace, Theta, Jac, indx ) );
+	EXPECT_TRUE( InterpolateWindowResponse( WindowResponseTable( 1 ), ToutK, TinK, 14.0, 2.5, OutIR, RmIR, AbsFace, ThetaTable ) );
+	for ( int i = 1; i <= 4; ++i ) {
+		EXPECT_NEAR( Theta( i ), ThetaTable( i ), 0.5 );
+	}
+	EXPECT_LT( Theta( 1 ), Theta( 2 ) );
+	EXPECT_LT( Theta( 3 ), Theta( 4 ) );
+
+	// Outside the grid of the table, and in a cell that has not been built
+	EXPECT_FALSE( InterpolateWindowResponse( WindowResponseTable( 1 ), ToutK, TinK, 60.0, 2.5, OutIR, RmIR, AbsFace, ThetaTable ) );
+	EXPECT_FALSE( InterpolateWindowResponse( WindowResponseTable( 1 ), ToutK + 30.0, TinK, 14.0, 2.5, OutIR, RmIR, AbsFace, ThetaTable ) );
+}
+
+TEST_F(EnergyPlusFixture, WindowManager_SpectralInterpolationAndAverages)
+{
+	// Single glass layer with spectral data on a coarser grid than the solar spectrum
+	numpt( 1 ) = 5;
+	Array1D< Real64 > const wlData( 5, { 0.25, 0.5, 1.0, 1.5, 2.5 } );
+	Array1D< Real64 > const tData( 5, { 0.1, 0.8, 0.7, 0.4, 0.2 } );
+	for ( int i = 1; i <= 5; ++i ) {
+		wlt( 1, i ) = wlData( i );
+		tPhi( 1, i ) = tData( i );
+		rfPhi( 1, i ) = 0.1;
+		rbPhi( 1, i ) = 0.1;
+	}
+
+	SpectralInterpolationIndices( 1 );
+	SystemSpectralPropertiesAtPhi( 1, 1, 0.0, 2.54 );
+
+	Real64 tExpected( 0.0 );
+	for ( int iwl = 1; iwl <= nume; ++iwl ) {
+		Interpolate( wlt( 1, 1 ), tPhi( 1, 1 ), numpt( 1 ), wle( iwl ), tExpected );
+		EXPECT_DOUBLE_EQ( tExpected, stPhi( iwl ) );
+	}
+
+	// Averages of a constant are the constant
+	Array1D< Real64 > p( nume, 0.6 );
+	Real64 pAverage( 0.0 );
+	SolarSprectrumAverage( p, pAverage );
+	EXPECT_NEAR( 0.6, pAverage, 1.0e-12 );
+	VisibleSprectrumAverage( p, pAverage );
+	EXPECT_NEAR( 0.6, pAverage, 1.0e-12 );
+	EXPECT_TRUE( SpectrumWeightsSet );
+	EXPECT_GT( esolSum, 0.0 );
+	EXPECT_GT( evisSum, 0.0 );
+}